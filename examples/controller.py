@@ -74,7 +74,7 @@ class Controller:
     def step(self, controls: np.ndarray) -> np.ndarray:
         """Send a control vector, advance physics, and return observation."""
         obs = self.client.step(actions=[float(x) for x in controls])
-        return np.array(obs.observation, dtype=np.float32)
+        return np.array(obs.to_numpy(), dtype=np.float32)
 
     def run_loop(self, rate_hz: float, duration_s: float) -> None:
         """Run a simple control loop at the requested rate for a fixed duration.
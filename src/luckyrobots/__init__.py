@@ -8,16 +8,27 @@ from luckyrobots.client import GrpcConnectionError as GrpcConnectionError
 from luckyrobots.client import LuckyEngineClient as LuckyEngineClient
 from luckyrobots.models import BenchmarkResult as BenchmarkResult
 from luckyrobots.models import FPS as FPS
+from luckyrobots.models import StepProfile as StepProfile
+from luckyrobots.models import BatchObservation as BatchObservation
 from luckyrobots.models import CameraFrame as CameraFrame
+from luckyrobots.models import PhysicsThreadTiming as PhysicsThreadTiming
 from luckyrobots.models import ObservationResponse as ObservationResponse
+from luckyrobots.models import AppliedRandomization as AppliedRandomization
+from luckyrobots.step_arrays import StepArrays as StepArrays
 from luckyrobots.lucky_env import LuckyEnv as LuckyEnv
+from luckyrobots.lucky_vec_env import LuckyVecEnv as LuckyVecEnv
 from luckyrobots.session import Session as Session
+from luckyrobots.pool import EnginePool as EnginePool
+from luckyrobots.metadata_cache import MetadataCache as MetadataCache
 from luckyrobots.robots import RobotController as RobotController
+from luckyrobots.robots import RobotCommandBatch as RobotCommandBatch
 from luckyrobots.robots import PolicySlotState as PolicySlotState
 from luckyrobots.robots import RobotControllerState as RobotControllerState
 from luckyrobots.robots import PolicyDescriptorInfo as PolicyDescriptorInfo
 from luckyrobots.robots import list_robot_controllers as list_robot_controllers
 from luckyrobots.robots import list_policy_descriptors as list_policy_descriptors
+from luckyrobots.robots import PolicyInferenceStats as PolicyInferenceStats
+from luckyrobots.robots import set_policy_inference_config as set_policy_inference_config
 
 # Worker A — MujocoScene wrapper
 from luckyrobots.scene import MujocoScene as MujocoScene
@@ -26,6 +37,10 @@ from luckyrobots.scene import ActuatorInfo as ActuatorInfo
 from luckyrobots.scene import ActuatorGainInfo as ActuatorGainInfo
 from luckyrobots.scene import ModelInfo as ModelInfo
 from luckyrobots.scene import FullStateSnapshot as FullStateSnapshot
+from luckyrobots.scene import SceneSnapshot as SceneSnapshot
+from luckyrobots.scene import RaycastResult as RaycastResult
+from luckyrobots.scene import HeightScan as HeightScan
+from luckyrobots.scene import ContactSet as ContactSet
 
 # Worker B — pose teleport helper + command-store view
 from luckyrobots.poses import set_robot_pose as set_robot_pose
@@ -49,8 +64,27 @@ from luckyrobots.debug_overlay import draw_policy_overlay as draw_policy_overlay
 from luckyrobots.recording import SessionRecording as SessionRecording
 from luckyrobots.recording import RecordedEvent as RecordedEvent
 from luckyrobots.recording import record_session as record_session
+from luckyrobots.reclog import RecordingLog as RecordingLog
+from luckyrobots.reclog import RecordingLogWriter as RecordingLogWriter
 from luckyrobots.streams import StreamMultiplexer as StreamMultiplexer
+from luckyrobots.streams import SynchronizedStream as SynchronizedStream
+from luckyrobots.streams import SyncFrame as SyncFrame
 
 # Worker H — async wrappers
 from luckyrobots.async_session import AsyncSession as AsyncSession
 from luckyrobots.async_robots import AsyncRobotController as AsyncRobotController
+from luckyrobots.async_robots import AsyncRobotCommandBatch as AsyncRobotCommandBatch
+from luckyrobots.async_scene import AsyncMujocoScene as AsyncMujocoScene
+from luckyrobots.async_env import AsyncLuckyEnv as AsyncLuckyEnv
+from luckyrobots.async_env import AsyncPolicyEnv as AsyncPolicyEnv
+
+# Persistent bidirectional step channels
+from luckyrobots.step_stream import StepStream as StepStream
+from luckyrobots.step_stream import AsyncStepStream as AsyncStepStream
+
+# Video camera / viewport stream decoding
+from luckyrobots.video import VideoStreamDecoder as VideoStreamDecoder
+
+# Delta-encoded state / telemetry stream reconstruction
+from luckyrobots.delta import TelemetryDeltaDecoder as TelemetryDeltaDecoder
+from luckyrobots.delta import TelemetrySample as TelemetrySample
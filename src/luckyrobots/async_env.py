@@ -0,0 +1,296 @@
+"""Asyncio mirrors of LuckyEnv and PolicyEnv, built on AsyncSession.
+
+The sync envs block on every Step RPC, so the engine idles while the
+policy runs and the policy idles while the engine steps. The async envs
+can keep one step in flight while the caller works on the previous
+observation:
+
+    env = await AsyncLuckyEnv.create(robot="unitreego2", scene="velocity",
+                                     reward_terms=["track_linear_velocity"])
+    obs, info = await env.reset()
+    action = policy(obs)
+    while True:
+        pending = await env.step_async(action)   # step N+1 is on the wire...
+        action = policy(obs)                     # ...while the policy reads obs N
+        obs, reward, terminated, truncated, info = await pending
+        if terminated or truncated:
+            obs, info = await env.reset()
+            action = policy(obs)
+
+Each action is applied one step after the observation it was computed from,
+i.e. one control step of action latency. Use ``await env.step(action)`` for
+lock-step semantics.
+
+Several envs (one per engine) can also be driven concurrently with
+``asyncio.gather(*(env.step(a) for env, a in zip(envs, actions)))``.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import logging
+from typing import Any, Optional, Union
+
+import numpy as np
+
+from .async_session import AsyncSession
+from .lucky_env import LuckyEnv
+from .policy_env import _HAS_GYMNASIUM, PolicyEnv
+
+logger = logging.getLogger(__name__)
+
+__all__ = ["AsyncLuckyEnv", "AsyncPolicyEnv"]
+
+
+class AsyncLuckyEnv(LuckyEnv):
+    """:class:`LuckyEnv` over a ``grpc.aio`` channel, with pipelined stepping.
+
+    Construct with :meth:`create` (or the constructor followed by
+    ``await env.connect()``); the arguments are those of :class:`LuckyEnv`.
+    """
+
+    def _connect(self, host: str, port: int, timeout: float) -> None:
+        # Deferred to connect(): __init__ cannot await.
+        self._address = (host, port, timeout)
+        self._session: Optional[AsyncSession] = None
+        self._pending: Optional[asyncio.Future] = None
+
+    @classmethod
+    async def create(cls, **kwargs: Any) -> "AsyncLuckyEnv":
+        """Construct and connect an env (keyword arguments as for :class:`LuckyEnv`)."""
+        env = cls(**kwargs)
+        await env.connect()
+        return env
+
+    async def connect(self) -> None:
+        """Connect, size the spaces from the agent schema and negotiate the contract."""
+        host, port, timeout = self._address
+        self._session = AsyncSession(host=host, port=port)
+        await self._session.connect(timeout_s=timeout)
+
+        self._init_spaces(await self._session.get_agent_schema(self._agent_name))
+        if self._needs_contract():
+            self._adopt_contract(await self._session.negotiate_task(self._task_contract()))
+        self._log_initialized()
+
+    def _require_session(self) -> AsyncSession:
+        if self._session is None:
+            raise RuntimeError(
+                "AsyncLuckyEnv is not connected — call `await env.connect()` first."
+            )
+        return self._session
+
+    async def reset(
+        self,
+        *,
+        seed: Optional[int] = None,
+        options: Optional[dict] = None,
+    ) -> tuple[np.ndarray, dict]:
+        """Reset the environment. A step still in flight is awaited and discarded."""
+        session = self._require_session()
+        await self._drain()
+        self._step_count = 0
+
+        resp = await session.reset_agent(
+            agent_name=self._agent_name,
+            randomization_cfg=self._randomization_cfg,
+        )
+        if not resp.success:
+            raise RuntimeError(f"ResetAgent failed: {resp.message}")
+        obs_response = await session.step(
+            actions=[0.0] * self._act_size,
+            agent_name=self._agent_name,
+            timeout=self._address[2],
+        )
+        return self._reset_result(obs_response)
+
+    async def step_async(self, action: np.ndarray) -> asyncio.Future:
+        """Send one step and return a future for its transition.
+
+        Returns once the Step request has been handed to gRPC, so the caller
+        can compute the next action while the engine steps. Only one step may
+        be in flight; await its future before sending another.
+
+        Returns:
+            Future resolving to ``(obs, reward, terminated, truncated, info)``.
+        """
+        session = self._require_session()
+        if self._pending is not None and not self._pending.done():
+            raise RuntimeError(
+                "AsyncLuckyEnv already has a step in flight; await it before sending another"
+            )
+        self._step_count += 1
+        timeout = self._address[2]
+        call = session._start_step(
+            actions=self._action_list(action),
+            agent_name=self._agent_name,
+            num_substeps=self._decimation,
+            substep_reduction=self._substep_reduction,
+            timeout=timeout,
+        )
+        self._pending = asyncio.ensure_future(self._finish(call, timeout))
+        # One loop iteration lets the aio call start its batch on the wire.
+        await asyncio.sleep(0)
+        return self._pending
+
+    async def _finish(self, call, timeout: float) -> tuple[np.ndarray, float, bool, bool, dict]:
+        obs_response = await self._session._finish_step(call, self._agent_name, False, timeout)
+        return self._transition(obs_response)
+
+    async def step(self, action: np.ndarray) -> tuple[np.ndarray, float, bool, bool, dict]:
+        """Take a step and wait for its transition (lock-step :meth:`LuckyEnv.step`)."""
+        return await (await self.step_async(action))
+
+    async def _drain(self) -> None:
+        pending, self._pending = self._pending, None
+        if pending is not None:
+            try:
+                await pending
+            except Exception as e:
+                logger.debug("Discarding failed in-flight step: %s", e)
+
+    async def close(self) -> None:
+        """Await any in-flight step and close the channel."""
+        if self._session is not None:
+            await self._drain()
+            await self._session.close()
+            self._session = None
+
+    async def __aenter__(self) -> "AsyncLuckyEnv":
+        if self._session is None:
+            await self.connect()
+        return self
+
+    async def __aexit__(self, exc_type, exc_val, exc_tb) -> bool:
+        await self.close()
+        return False
+
+    def __enter__(self):
+        raise TypeError("AsyncLuckyEnv is an async context manager; use `async with`")
+
+    def __del__(self):
+        # close() is a coroutine; an unclosed aio channel is released by grpc.
+        pass
+
+
+class AsyncPolicyEnv(PolicyEnv):
+    """:class:`PolicyEnv` over an ``AsyncSession`` and ``AsyncRobotController``.
+
+    Construct with ``await AsyncPolicyEnv.create(session, ...)``; the
+    arguments are those of :class:`PolicyEnv`. In ``full_state_filtered``
+    mode ``observation_space`` is sized by the first :meth:`reset`.
+    """
+
+    def __init__(self, session: AsyncSession, *args: Any, controllers: list, **kwargs: Any):
+        self._controllers = controllers
+        super().__init__(session, *args, **kwargs)
+
+    @classmethod
+    async def create(
+        cls,
+        session: AsyncSession,
+        robot_entity_id: int,
+        slot: Union[int, str],
+        command_names: list[str],
+        reward_fn,
+        **kwargs: Any,
+    ) -> "AsyncPolicyEnv":
+        """Look up the robot controller and construct the env."""
+        controllers = await session.list_robot_controllers()
+        return cls(
+            session, robot_entity_id, slot, command_names, reward_fn,
+            controllers=controllers, **kwargs,
+        )
+
+    def _list_controllers(self):
+        return self._controllers
+
+    def _controller_from_state(self, state):
+        from .async_robots import AsyncRobotController
+        return AsyncRobotController.from_state(self._session, state)
+
+    def _build_scene(self):
+        from .async_scene import AsyncMujocoScene
+        return AsyncMujocoScene(self._session)
+
+    def _compute_full_state_obs_size(self) -> int:
+        # Placeholder until reset() reads the first state.
+        return len(self._command_names)
+
+    async def _scene_state_obs(self) -> np.ndarray:
+        assert self._scene is not None
+        try:
+            snap = await self._scene.state(filter={"filter_by_slot_id": self._slot_id})
+        except Exception:
+            snap = await self._scene.state()
+        return np.concatenate(
+            [snap.qpos.astype(np.float32), snap.qvel.astype(np.float32)]
+        )
+
+    async def _last_action_obs(self) -> np.ndarray:
+        try:
+            action_values, _names = await self._robot.get_last_action(self._slot_id)
+            return np.asarray(action_values, dtype=np.float32)
+        except LookupError:
+            return np.zeros(self.observation_space.shape, dtype=np.float32)
+
+    async def _build_observation(self, step_response) -> np.ndarray:
+        if self._observation_mode == "full_state_filtered":
+            obs = self._inline_state_obs(step_response)
+            return obs if obs is not None else await self._scene_state_obs()
+        return await self._last_action_obs()
+
+    async def reset(
+        self,
+        *,
+        seed: Optional[int] = None,
+        options: Optional[dict] = None,
+    ) -> tuple[np.ndarray, dict]:
+        """Reset the environment (see :meth:`PolicyEnv.reset`)."""
+        if _HAS_GYMNASIUM:
+            super(PolicyEnv, self).reset(seed=seed)
+        self._step_count = 0
+        try:
+            await self._session.reset()
+        except Exception as exc:  # pragma: no cover - defensive only
+            logger.debug("AsyncPolicyEnv.reset(): session.reset() failed: %s", exc)
+
+        if self._observation_mode == "full_state_filtered":
+            obs = await self._scene_state_obs()
+        else:
+            obs = await self._last_action_obs()
+        self._maybe_resize_obs_space(obs)
+        return obs, {"step_count": self._step_count}
+
+    async def step(
+        self, action: np.ndarray
+    ) -> tuple[np.ndarray, float, bool, bool, dict]:
+        """Write the commands as one ApplyRobotCommands call, step, build the transition."""
+        self._step_count += 1
+        action_list = self._action_values(action)
+
+        async with self._robot.buffered():
+            for cmd_id, value in zip(self._command_ids, action_list):
+                await self._robot.set_command_float(self._slot_id, cmd_id, float(value))
+
+        step_response = await self._session.agent.Step(
+            self._step_request(), timeout=self._step_rpc_timeout()
+        )
+        return self._transition(step_response, await self._build_observation(step_response))
+
+    async def close(self) -> None:
+        """Release the slot we drove."""
+        try:
+            await self._robot.set_policy_active(self._slot_id, False)
+        except Exception:
+            pass
+
+    async def __aenter__(self) -> "AsyncPolicyEnv":
+        return self
+
+    async def __aexit__(self, exc_type, exc_val, exc_tb) -> bool:
+        await self.close()
+        return False
+
+    def __enter__(self):
+        raise TypeError("AsyncPolicyEnv is an async context manager; use `async with`")
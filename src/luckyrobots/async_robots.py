@@ -15,12 +15,18 @@ Quick start:
         robot = AsyncRobotController.from_state(sess, controllers[0])
         await robot.set_policy_active("Walker", True)
         await robot.set_command_float("Walker", 1, 0.5)
+
+        async with robot.buffered():              # one ApplyRobotCommands call
+            await robot.set_command_float("Walker", 1, 0.5)
+            await robot.set_command_bool("Walker", 2, True)
 """
 
 from __future__ import annotations
 
-from typing import AsyncIterator, Iterable, List, Mapping, Tuple, Union
+from contextlib import asynccontextmanager
+from typing import AsyncIterator, Iterable, List, Mapping, Optional, Tuple, Union
 
+import grpc
 import numpy as np
 
 from .grpc.generated import agent_pb2 as _agent_pb2
@@ -28,13 +34,19 @@ from .grpc.generated import common_pb2 as _common_pb2
 from .robots.robot_controller import (
     PolicyCommandIdEntry,  # re-exported for convenience
     PolicySlotState,
+    RobotCommandBatch,
+    RobotCommandResult,
     RobotControllerState,
+    _COMMAND_RPCS,
+    _add_gain_overrides,
+    _motion_graph_value,
     _string_to_command_type,
 )
 
 # Silence "imported but unused" — re-exported for callers that want to
 # build their own helpers on top of the dataclasses.
 __all__ = [
+    "AsyncRobotCommandBatch",
     "AsyncRobotController",
     "PolicyCommandIdEntry",
     "PolicySlotState",
@@ -45,6 +57,45 @@ __all__ = [
 SlotId = Union[int, str]
 
 
+class AsyncRobotCommandBatch(RobotCommandBatch):
+    """Asyncio flavour of :class:`luckyrobots.robots.RobotCommandBatch`.
+
+    Same queueing and atomicity; :meth:`flush` is a coroutine and the batch
+    is an ``async with`` context manager.
+    """
+
+    def _stub(self):
+        return self._session.agent
+
+    def _unsupported_rpcs(self) -> set:
+        return self._session._codec._unsupported_rpcs
+
+    async def flush(self) -> RobotCommandResult:
+        if not self._commands:
+            return RobotCommandResult(applied_count=0, frame_number=0)
+        req = self._take_request()
+        stub = self._stub()
+        if "ApplyRobotCommands" not in self._unsupported_rpcs():
+            try:
+                return self._finish(await stub.ApplyRobotCommands(req))
+            except grpc.RpcError as e:
+                if not self._batch_unimplemented(e):
+                    raise
+        errors: list = []
+        for index, (rpc, cmd_req) in enumerate(self._unary_calls(req)):
+            self._unary_ack(index, await getattr(stub, rpc)(cmd_req), errors)
+        return self._unary_result(len(req.commands), errors)
+
+    async def __aenter__(self) -> "AsyncRobotCommandBatch":
+        return self
+
+    async def __aexit__(self, exc_type, exc, tb) -> None:
+        if exc_type is None:
+            await self.flush()
+        else:
+            self.discard()
+
+
 class AsyncRobotController:
     """Asyncio mirror of :class:`luckyrobots.robots.RobotController`.
 
@@ -57,6 +108,7 @@ class AsyncRobotController:
         self._session = session
         self._entity_id = int(entity_id)
         self._slot_name_cache: dict[str, int] = {}
+        self._batch: Optional[AsyncRobotCommandBatch] = None
 
     # ---- construction helpers ----
 
@@ -96,6 +148,13 @@ class AsyncRobotController:
         if not ack.success:
             raise RuntimeError(f"Policy RPC failed: {ack.message}")
 
+    async def _send(self, field: str, req) -> None:
+        """Queue ``req`` on the active batch, or send it via its unary RPC."""
+        if self._batch is not None:
+            self._batch._add(field, req)
+            return
+        self._check_ack(await getattr(self._stub(), _COMMAND_RPCS[field])(req))
+
     # ---- introspection ----
 
     @property
@@ -139,7 +198,7 @@ class AsyncRobotController:
         req = _agent_pb2.SetPolicyActiveRequest(
             entity=self._entity(), slot_id=slot_id, active=active
         )
-        self._check_ack(await self._stub().SetPolicyActive(req))
+        await self._send("policy_active", req)
 
     async def set_policy_descriptor(self, slot: SlotId, descriptor_path: str) -> None:
         slot_id = await self._resolve_slot(slot)
@@ -188,7 +247,7 @@ class AsyncRobotController:
             command_id=int(command_id),
             value=float(value),
         )
-        self._check_ack(await self._stub().SetPolicyCommandFloat(req))
+        await self._send("command_float", req)
 
     async def set_command_bool(
         self, slot: SlotId, command_id: int, value: bool
@@ -200,7 +259,7 @@ class AsyncRobotController:
             command_id=int(command_id),
             value=bool(value),
         )
-        self._check_ack(await self._stub().SetPolicyCommandBool(req))
+        await self._send("command_bool", req)
 
     async def get_command_float(self, slot: SlotId, command_id: int) -> float:
         slot_id = await self._resolve_slot(slot)
@@ -240,21 +299,15 @@ class AsyncRobotController:
         req = _agent_pb2.SetPolicyGainsRequest(
             entity=self._entity(), slot_id=slot_id
         )
-        for joint_name, fields in overrides.items():
-            ov = req.overrides.add()
-            ov.joint_name = joint_name
-            for key in ("kp", "kd", "effort_limit", "action_scale", "default_pos"):
-                v = fields.get(key)
-                if v is not None:
-                    setattr(ov, key, float(v))
-        self._check_ack(await self._stub().SetPolicyGains(req))
+        _add_gain_overrides(req, overrides)
+        await self._send("gains", req)
 
     async def clear_policy_gains(self, slot: SlotId) -> None:
         slot_id = await self._resolve_slot(slot)
         req = _agent_pb2.ClearPolicyGainsRequest(
             entity=self._entity(), slot_id=slot_id
         )
-        self._check_ack(await self._stub().ClearPolicyGains(req))
+        await self._send("clear_gains", req)
 
     # ---- motion graph ----
     #
@@ -277,31 +330,15 @@ class AsyncRobotController:
         req = _agent_pb2.SetMotionGraphActiveRequest(
             entity=self._entity(), active=active
         )
-        self._check_ack(await self._stub().SetMotionGraphActive(req))
+        await self._send("motion_graph_active", req)
 
     async def set_motion_graph_input(self, input_id: int, value) -> None:
         """Set a motion-graph input. Mirrors the sync version's oneof
         type-detection: ``bool`` / ``int`` / ``float`` / 3-tuple-or-list."""
-        mg = _agent_pb2.MotionGraphInputValue()
-        # ``bool`` is a subclass of ``int`` in Python, so check it first.
-        if isinstance(value, bool):
-            mg.bool_val = value
-        elif isinstance(value, int):
-            mg.int_val = value
-        elif isinstance(value, float):
-            mg.float_val = value
-        elif isinstance(value, (tuple, list)) and len(value) == 3:
-            mg.vec3_val.x = float(value[0])
-            mg.vec3_val.y = float(value[1])
-            mg.vec3_val.z = float(value[2])
-        else:
-            raise TypeError(
-                f"Unsupported motion graph input value type: {type(value).__name__}"
-            )
         req = _agent_pb2.SetMotionGraphInputRequest(
-            entity=self._entity(), input_id=int(input_id), value=mg
+            entity=self._entity(), input_id=int(input_id), value=_motion_graph_value(value)
         )
-        self._check_ack(await self._stub().SetMotionGraphInput(req))
+        await self._send("motion_graph_input", req)
 
     async def get_motion_graph_input(self, input_id: int, type_hint: str = "float"):
         type_enum = _string_to_command_type(type_hint)
@@ -329,7 +366,33 @@ class AsyncRobotController:
         req = _agent_pb2.FireMotionGraphTriggerRequest(
             entity=self._entity(), input_id=int(input_id)
         )
-        self._check_ack(await self._stub().FireMotionGraphTrigger(req))
+        await self._send("motion_graph_trigger", req)
+
+    # ---- coalesced writes ----
+
+    @asynccontextmanager
+    async def buffered(
+        self, batch: Optional[AsyncRobotCommandBatch] = None, *, allow_partial: bool = False
+    ):
+        """Async sibling of :meth:`RobotController.buffered`: writes awaited
+        inside the block are queued and sent as one ``ApplyRobotCommands``
+        call on exit. Pass a shared :class:`AsyncRobotCommandBatch` to
+        coalesce several controllers."""
+        if batch is None and self._batch is not None:
+            yield self._batch
+            return
+        own = batch is None
+        if own:
+            batch = AsyncRobotCommandBatch(self._session, allow_partial=allow_partial)
+        prior, self._batch = self._batch, batch
+        try:
+            if own:
+                async with batch:
+                    yield batch
+            else:
+                yield batch
+        finally:
+            self._batch = prior
 
     # ---- runtime diagnostics ----
 
@@ -0,0 +1,103 @@
+"""Async mirror of :class:`luckyrobots.scene.MujocoScene`.
+
+Covers the read side an async training loop needs — model introspection,
+full-state snapshots and spatial queries — with the same frozen dataclasses
+as the sync wrapper:
+
+    from luckyrobots.async_scene import AsyncMujocoScene
+
+    async with AsyncSession() as sess:
+        await sess.connect()
+        scene = AsyncMujocoScene(sess)
+        model = await scene.model_info()
+        snap = await scene.state(filter={"filter_by_slot_id": 1})
+"""
+
+from __future__ import annotations
+
+from typing import Any, Mapping, Optional
+
+from .grpc.generated import mujoco_scene_pb2 as _ms_pb2
+from .scene.mujoco_scene import (
+    ActuatorInfo,
+    ContactSet,
+    FullStateSnapshot,
+    HeightScan,
+    JointInfo,
+    ModelInfo,
+    NameOrIndex,
+    RaycastResult,
+    _contacts_request,
+    _full_state_request,
+    _height_scan_request,
+    _raycast_request,
+)
+
+__all__ = ["AsyncMujocoScene"]
+
+
+class AsyncMujocoScene:
+    """Asyncio flavour of :class:`MujocoScene` bound to an ``AsyncSession``."""
+
+    def __init__(self, session) -> None:
+        self._session = session
+        self._cached_model: Optional[ModelInfo] = None
+
+    def _stub(self):
+        return self._session.mujoco_scene
+
+    @staticmethod
+    def _check_ok(resp) -> None:
+        if not resp.success:
+            raise RuntimeError(resp.message or "MujocoSceneService RPC failed")
+
+    async def model_info(self, refresh: bool = False) -> ModelInfo:
+        """Fetch (and cache) the engine's mjModel summary.
+
+        Pass ``refresh=True`` after a scene change to invalidate the cache.
+        """
+        if self._cached_model is not None and not refresh:
+            return self._cached_model
+        resp = await self._stub().GetModelInfo(_ms_pb2.GetModelInfoRequest())
+        self._check_ok(resp)
+        self._cached_model = ModelInfo._from_pb(resp)
+        return self._cached_model
+
+    async def joint(self, name_or_index: NameOrIndex) -> JointInfo:
+        """Look up a joint via the cached :class:`ModelInfo`."""
+        return (await self.model_info()).joint(name_or_index)
+
+    async def actuator(self, name_or_index: NameOrIndex) -> ActuatorInfo:
+        """Look up an actuator via the cached :class:`ModelInfo`."""
+        return (await self.model_info()).actuator(name_or_index)
+
+    async def state(
+        self,
+        filter: Optional[Mapping[str, object]] = None,
+        include_qpos: bool = True,
+        include_qvel: bool = True,
+        include_ctrl: bool = True,
+    ) -> FullStateSnapshot:
+        """Fetch a single ``FullState`` snapshot (see :meth:`MujocoScene.state`)."""
+        req = _full_state_request(filter, include_qpos, include_qvel, include_ctrl)
+        resp = await self._stub().GetFullState(req)
+        self._check_ok(resp)
+        return FullStateSnapshot._from_pb(resp)
+
+    async def raycast(self, origins, directions, **options: Any) -> RaycastResult:
+        """Cast a batch of rays (arguments as for :meth:`MujocoScene.raycast`)."""
+        resp = await self._stub().Raycast(_raycast_request(origins, directions, **options))
+        self._check_ok(resp)
+        return RaycastResult._from_pb(resp)
+
+    async def height_scan(self, body: str, **options: Any) -> HeightScan:
+        """Body-following height grid (arguments as for :meth:`MujocoScene.height_scan`)."""
+        resp = await self._stub().HeightScan(_height_scan_request(body, **options))
+        self._check_ok(resp)
+        return HeightScan._from_pb(resp)
+
+    async def contacts(self, **options: Any) -> ContactSet:
+        """Current contact list (arguments as for :meth:`MujocoScene.contacts`)."""
+        resp = await self._stub().GetContacts(_contacts_request(**options))
+        self._check_ok(resp)
+        return ContactSet._from_pb(resp)
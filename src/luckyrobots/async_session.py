@@ -30,10 +30,13 @@ from __future__ import annotations
 
 import asyncio
 import logging
-from typing import List, Optional
+from typing import TYPE_CHECKING, Any, List, Mapping, Optional, Union
 
+import grpc  # type: ignore
 import grpc.aio as grpc_aio
 
+from .client import LuckyEngineClient, _step_deadline_error
+
 from .grpc.generated import (
     agent_pb2,
     agent_pb2_grpc,
@@ -46,8 +49,15 @@ from .grpc.generated import (
 )
 from .robots.robot_controller import (
     PolicyDescriptorInfo,
+    PolicyInferenceConfig,
     RobotControllerState,
 )
+from .scene.mujoco_scene import SceneSnapshot
+
+if TYPE_CHECKING:  # pragma: no cover - typing only
+    from .models import ObservationResponse
+    from .step_arrays import StepArrays
+    from .step_stream import AsyncStepStream
 
 logger = logging.getLogger("luckyrobots.async_session")
 
@@ -72,6 +82,12 @@ class AsyncSession:
         self._mujoco_scene: Optional[mujoco_scene_pb2_grpc.MujocoSceneServiceStub] = None
         self._debug: Optional[debug_pb2_grpc.DebugServiceStub] = None
 
+        # Never-connected sync client reused for StepRequest building and
+        # StepResponse decoding, so negotiated schemas / packed layouts /
+        # reward orders are interpreted exactly as LuckyEngineClient does.
+        self._codec = LuckyEngineClient(host=host, port=port)
+        self._codec._metadata_cache = None
+
     # ---- lifecycle ----
 
     async def connect(self, timeout_s: float = 30.0) -> None:
@@ -180,6 +196,170 @@ class AsyncSession:
         resp = await stub.ListPolicyDescriptors(agent_pb2.ListPolicyDescriptorsRequest())
         return [PolicyDescriptorInfo._from_pb(p) for p in resp.policies]
 
+    async def set_policy_inference_config(
+        self,
+        batch_across_slots: bool = True,
+        execution_provider: str = "",
+        max_batch_size: int = 0,
+    ) -> PolicyInferenceConfig:
+        """Configure batched PolicySlot inference; returns the applied config."""
+        stub = self.agent
+        resp = await stub.SetPolicyInferenceConfig(
+            agent_pb2.PolicyInferenceConfig(
+                batch_across_slots=batch_across_slots,
+                execution_provider=execution_provider,
+                max_batch_size=max_batch_size,
+            )
+        )
+        if not resp.success:
+            raise RuntimeError(f"SetPolicyInferenceConfig failed: {resp.message}")
+        return PolicyInferenceConfig._from_pb(resp)
+
+    # ---- RL surface (mirrors LuckyEngineClient / Session) ----
+
+    async def get_agent_schema(self, agent_name: str = ""):
+        """Agent observation/action sizes and names (``GetAgentSchemaResponse``).
+
+        Cached so :meth:`step` can label observation values."""
+        resp = await self.agent.GetAgentSchema(
+            agent_pb2.GetAgentSchemaRequest(agent_name=agent_name)
+        )
+        self._codec._cache_agent_schema(agent_name, resp)
+        return resp
+
+    async def negotiate_task(self, contract: dict) -> dict:
+        """Validate and configure the engine for a task contract.
+
+        Takes and returns the same dicts as
+        ``LuckyEngineClient.negotiate_task``; the negotiated layouts decode
+        this session's :meth:`step` responses. Raises RuntimeError when the
+        contract is rejected."""
+        codec = self._codec
+        resp = await self.agent.NegotiateTask(
+            agent_pb2.NegotiateTaskRequest(contract=codec._build_task_contract(contract))
+        )
+        if not resp.success:
+            raise RuntimeError(f"Task contract negotiation failed: {resp.message}")
+        return codec._negotiated_session(resp)
+
+    async def reset_agent(
+        self,
+        agent_name: str = "",
+        randomization_cfg: Optional[Any] = None,
+        model_randomization: Optional[Mapping[str, Any]] = None,
+    ):
+        """Reset one agent; returns the raw ``ResetAgentResponse``."""
+        return await self.agent.ResetAgent(
+            self._codec._reset_agent_request(agent_name, randomization_cfg, model_randomization)
+        )
+
+    async def reset(
+        self,
+        agent_name: str = "",
+        randomization_cfg: Optional[Any] = None,
+        return_numpy: bool = False,
+    ):
+        """Reset the agent and return a fresh observation (mirrors ``Session.reset``).
+
+        Retries for up to 10 s while the engine reports the batch is not
+        ready yet, then raises RuntimeError."""
+        loop = asyncio.get_running_loop()
+        deadline = loop.time() + 10.0
+        while True:
+            resp = await self.reset_agent(
+                agent_name=agent_name, randomization_cfg=randomization_cfg
+            )
+            if not resp.success:
+                if "not ready yet" in resp.message and loop.time() < deadline:
+                    await asyncio.sleep(0.25)
+                    continue
+                raise RuntimeError(f"Reset failed: {resp.message}")
+            break
+
+        schema = await self.get_agent_schema(agent_name)
+        action_size = schema.schema.action_size if schema.schema else 12
+        return await self.step(
+            actions=[0.0] * action_size, agent_name=agent_name, return_numpy=return_numpy
+        )
+
+    async def step(
+        self,
+        actions: Optional[List[float]] = None,
+        agent_name: str = "",
+        action_groups: Optional[List[dict]] = None,
+        num_substeps: int = 1,
+        substep_reduction: str = "sum",
+        return_numpy: bool = False,
+        profile: bool = False,
+        state: bool | Mapping[str, Any] | None = None,
+        raycasts: Optional[List[Mapping[str, Any]]] = None,
+        height_scans: Optional[List[Mapping[str, Any]]] = None,
+        contacts: bool | Mapping[str, Any] | None = None,
+        step_timeout_s: float = 0.0,
+        timeout: Optional[float] = None,
+    ) -> "ObservationResponse | StepArrays":
+        """RL step: apply action, wait for physics, return observation.
+
+        Same arguments and return types as ``LuckyEngineClient.step``.
+        ``timeout`` is the client-side deadline (None = wait indefinitely)."""
+        call = self._start_step(
+            actions=actions,
+            agent_name=agent_name,
+            step_timeout_s=step_timeout_s,
+            action_groups=action_groups,
+            num_substeps=num_substeps,
+            substep_reduction=substep_reduction,
+            profile=profile,
+            state=state,
+            raycasts=raycasts,
+            height_scans=height_scans,
+            contacts=contacts,
+            timeout=timeout,
+        )
+        return await self._finish_step(call, agent_name, return_numpy, timeout)
+
+    def _start_step(self, *, timeout: Optional[float] = None, **request_options):
+        """Issue a Step RPC and return the in-flight aio call without awaiting it."""
+        if hasattr(request_options.get("actions"), "tolist"):
+            request_options["actions"] = request_options["actions"].tolist()
+        request = self._codec._build_step_request(**request_options)
+        return self.agent.Step(request, timeout=timeout)
+
+    async def _finish_step(self, call, agent_name: str, return_numpy: bool,
+                           timeout: Optional[float]):
+        """Await a call from :meth:`_start_step` and decode its StepResponse."""
+        try:
+            resp = await call
+        except grpc.RpcError as e:
+            if e.code() == grpc.StatusCode.DEADLINE_EXCEEDED:
+                raise _step_deadline_error(timeout) from e
+            raise
+        if return_numpy:
+            return self._codec._arrays_from_step_response(resp, agent_name)
+        return self._codec._observation_from_step_response(resp, agent_name)
+
+    # ---- persistent step channel ----
+
+    def step_stream(
+        self,
+        agent_name: str = "",
+        max_in_flight: int = 1,
+        step_timeout_s: float = 0.0,
+    ) -> "AsyncStepStream":
+        """Open a persistent bidirectional step channel (AgentService.StepStream).
+
+        Mirrors ``LuckyEngineClient.step_stream``: ``await stream.send(...)``
+        / ``await stream.recv()``, or ``await stream.step(...)`` for lock-step
+        use. Up to ``max_in_flight`` actions may be pipelined."""
+        from .step_stream import AsyncStepStream
+
+        return AsyncStepStream(
+            self,
+            agent_name=agent_name,
+            max_in_flight=max_in_flight,
+            step_timeout_s=step_timeout_s,
+        )
+
     # ---- editor lifecycle / scene reset ----
 
     async def enter_play_mode(self):
@@ -205,3 +385,39 @@ class AsyncSession:
         return await self.mujoco_scene.ResetScene(
             mujoco_scene_pb2.ResetSceneRequest(preserve_time=preserve_time)
         )
+
+    async def save_snapshot(
+        self,
+        handle: Union[int, SceneSnapshot] = 0,
+        include_policy_state: bool = True,
+        export: bool = False,
+    ) -> SceneSnapshot:
+        """Capture full mjData + policy state into the engine snapshot pool.
+        Mirrors ``MujocoScene.save_snapshot``; raises RuntimeError if the
+        engine refuses."""
+        if isinstance(handle, SceneSnapshot):
+            handle = handle.handle
+        resp = await self.mujoco_scene.SaveSnapshot(
+            mujoco_scene_pb2.SaveSnapshotRequest(
+                handle=int(handle),
+                exclude_policy_state=not include_policy_state,
+                export_blob=bool(export),
+            )
+        )
+        if not resp.success:
+            raise RuntimeError(f"SaveSnapshot failed: {resp.message}")
+        return SceneSnapshot._from_pb(resp)
+
+    async def restore_snapshot(self, snapshot: Union[SceneSnapshot, int, bytes]):
+        """Restore a pooled snapshot by handle, or an exported blob (bytes).
+        Raises RuntimeError if the engine refuses (e.g. an unknown handle)."""
+        if isinstance(snapshot, SceneSnapshot):
+            snapshot = snapshot.handle
+        if isinstance(snapshot, (bytes, bytearray, memoryview)):
+            req = mujoco_scene_pb2.RestoreSnapshotRequest(blob=bytes(snapshot))
+        else:
+            req = mujoco_scene_pb2.RestoreSnapshotRequest(handle=int(snapshot))
+        resp = await self.mujoco_scene.RestoreSnapshot(req)
+        if not resp.success:
+            raise RuntimeError(f"RestoreSnapshot failed: {resp.message}")
+        return resp
@@ -7,6 +7,7 @@ imported when the relevant subcommand is invoked.
 
 import click
 
+from .bench import bench_main as bench_main
 from .inspect import inspect_main as inspect_main
 
 
@@ -34,7 +35,58 @@ def inspect(address: str):
     raise SystemExit(inspect_main(host, port))
 
 
-__all__ = ["cli", "inspect_main"]
+def _parse_resolutions(value: str) -> list:
+    out = []
+    for item in value.split(","):
+        w, sep, h = item.strip().partition("x")
+        if not sep or not w.isdigit() or not h.isdigit():
+            raise click.BadParameter(f"expected WIDTHxHEIGHT, got {item!r}")
+        out.append((int(w), int(h)))
+    return out
+
+
+@cli.command()
+@click.argument("address")
+@click.option("--only", "groups", default="step,state,control,camera,telemetry",
+              show_default=True, help="Comma-separated case groups to run.")
+@click.option("--duration", type=float, default=3.0, show_default=True,
+              help="Seconds per case.")
+@click.option("--camera", default="", help="Camera entity for camera cases (skipped if empty).")
+@click.option("--resolutions", default="320x240,640x480,1280x720", show_default=True,
+              help="Comma-separated WIDTHxHEIGHT list for camera cases.")
+@click.option("--formats", default="raw,jpeg", show_default=True,
+              help="Comma-separated StreamCamera formats.")
+@click.option("--stream-fps", type=int, default=1000, show_default=True,
+              help="target_fps requested for stream cases.")
+@click.option("--json", "json_path", type=click.Path(dir_okay=False),
+              help="Write the machine-readable report here.")
+@click.option("--baseline", "baseline_path", type=click.Path(exists=True, dir_okay=False),
+              help="Previous --json report to compare against.")
+@click.option("--max-regression", type=float, default=None,
+              help="Exit 1 if any case's throughput drops by more than this fraction "
+                   "of the baseline (e.g. 0.1).")
+def bench(address: str, groups: str, duration: float, camera: str, resolutions: str,
+          formats: str, stream_fps: int, json_path, baseline_path, max_regression):
+    """Benchmark RPCs and streams of a running LuckyEngine. ADDRESS is host:port."""
+    host, _, port_s = address.partition(":")
+    port = int(port_s) if port_s else 50051
+
+    raise SystemExit(bench_main(
+        host,
+        port,
+        groups=[g.strip() for g in groups.split(",") if g.strip()],
+        duration_s=duration,
+        camera=camera,
+        resolutions=_parse_resolutions(resolutions),
+        formats=[f.strip() for f in formats.split(",") if f.strip()],
+        stream_fps=stream_fps,
+        json_path=json_path,
+        baseline_path=baseline_path,
+        max_regression=max_regression,
+    ))
+
+
+__all__ = ["cli", "bench_main", "inspect_main"]
 
 
 if __name__ == "__main__":
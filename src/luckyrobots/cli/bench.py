@@ -0,0 +1,457 @@
+"""``luckyrobots bench <host:port>`` — performance matrix over the engine RPCs.
+
+Cases (grouped; pick with ``--only``):
+  - step:      Step without cameras, then with one camera per resolution
+  - state:     GetFullState without a filter and with each StateFilter mode
+  - control:   SetControl by bulk vector, by index and by actuator name
+  - camera:    StreamCamera for every resolution x format
+  - telemetry: StreamTelemetry, plain and delta-encoded
+
+Each case runs for a fixed wall-clock duration after a short warmup and
+reports calls, throughput, latency percentiles and mean request / response
+bytes. Streams report inter-arrival time as latency. A case that fails
+(missing camera, RPC not served) records its error and the suite moves on.
+
+``--json`` writes the report for nightly diffs; ``--baseline`` compares
+against a previous report and ``--max-regression`` turns a throughput drop
+into a non-zero exit code.
+"""
+
+from __future__ import annotations
+
+import json
+import math
+import platform
+import sys
+import time
+from dataclasses import asdict, dataclass, field
+from typing import Callable, Dict, Iterable, List, Optional, Sequence, Tuple
+
+GROUPS = ("step", "state", "control", "camera", "telemetry")
+DEFAULT_RESOLUTIONS: Tuple[Tuple[int, int], ...] = ((320, 240), (640, 480), (1280, 720))
+DEFAULT_FORMATS: Tuple[str, ...] = ("raw", "jpeg")
+
+# StateFilter modes benchmarked by the "state" group (None = no filter).
+STATE_FILTERS: Tuple[Tuple[str, Optional[dict]], ...] = (
+    ("none", None),
+    ("policy_claimed", {"include_only_policy_claimed_joints": True}),
+    ("unclaimed", {"include_only_unclaimed_joints": True}),
+    ("slot", {"filter_by_slot_id": 1}),
+)
+
+REPORT_VERSION = 1
+
+
+@dataclass
+class BenchCaseResult:
+    """Statistics of one benchmark case (one entry of the JSON report)."""
+
+    name: str
+    group: str
+    params: Dict[str, object] = field(default_factory=dict)
+    calls: int = 0
+    duration_s: float = 0.0
+    throughput_hz: float = 0.0
+    latency_ms: Dict[str, float] = field(default_factory=dict)
+    request_bytes: float = 0.0
+    response_bytes: float = 0.0
+    error: Optional[str] = None
+
+
+def latency_summary(latencies_ms: Sequence[float]) -> Dict[str, float]:
+    """mean / min / p50 / p90 / p99 / max of a latency sample."""
+    if not latencies_ms:
+        return {}
+    ordered = sorted(latencies_ms)
+    n = len(ordered)
+
+    def pct(q: float) -> float:
+        return ordered[int(math.floor(q * (n - 1)))]
+
+    return {
+        "mean": sum(ordered) / n,
+        "min": ordered[0],
+        "p50": pct(0.50),
+        "p90": pct(0.90),
+        "p99": pct(0.99),
+        "max": ordered[-1],
+    }
+
+
+def _finish(
+    result: BenchCaseResult,
+    latencies_ms: List[float],
+    request_bytes: int,
+    response_bytes: int,
+    elapsed: float,
+) -> BenchCaseResult:
+    n = len(latencies_ms)
+    result.calls = n
+    result.duration_s = elapsed
+    result.throughput_hz = n / elapsed if elapsed > 0 else 0.0
+    result.latency_ms = latency_summary(latencies_ms)
+    result.request_bytes = request_bytes / n if n else 0.0
+    result.response_bytes = response_bytes / n if n else 0.0
+    return result
+
+
+def measure_calls(
+    result: BenchCaseResult,
+    call: Callable[[], Tuple[int, int]],
+    duration_s: float,
+    warmup: int = 5,
+) -> BenchCaseResult:
+    """Call ``call`` in a tight loop; it returns (request bytes, response bytes)."""
+    for _ in range(warmup):
+        call()
+    latencies: List[float] = []
+    req_total = resp_total = 0
+    start = time.perf_counter()
+    deadline = start + duration_s
+    while time.perf_counter() < deadline:
+        t0 = time.perf_counter()
+        req_bytes, resp_bytes = call()
+        latencies.append((time.perf_counter() - t0) * 1000.0)
+        req_total += req_bytes
+        resp_total += resp_bytes
+    return _finish(result, latencies, req_total, resp_total, time.perf_counter() - start)
+
+
+def measure_stream(
+    result: BenchCaseResult,
+    stream: Iterable,
+    size: Callable[[object], int],
+    duration_s: float,
+    warmup: int = 2,
+) -> BenchCaseResult:
+    """Drain ``stream`` for ``duration_s``; latency is message inter-arrival time."""
+    latencies: List[float] = []
+    resp_total = 0
+    start = last = None
+    try:
+        for i, msg in enumerate(stream):
+            now = time.perf_counter()
+            if i < warmup:
+                start = last = now
+                continue
+            if start is None:
+                start = now
+            else:
+                latencies.append((now - last) * 1000.0)
+            last = now
+            resp_total += size(msg)
+            if now - start >= duration_s:
+                break
+    finally:
+        cancel = getattr(stream, "cancel", None)
+        if cancel is not None:
+            cancel()
+    elapsed = (last - start) if start is not None else 0.0
+    return _finish(result, latencies, 0, resp_total, elapsed)
+
+
+def _run_case(
+    results: List[BenchCaseResult],
+    result: BenchCaseResult,
+    body: Callable[[BenchCaseResult], BenchCaseResult],
+    log: Callable[[str], None],
+) -> None:
+    try:
+        body(result)
+    except Exception as e:  # one failing case must not stop the suite
+        result.error = f"{type(e).__name__}: {e}"
+    results.append(result)
+    log(format_result(result))
+
+
+# ---- cases ------------------------------------------------------------------
+
+
+def _bench_step(client, camera, resolutions, duration_s, results, log) -> None:
+    action_size = client.get_agent_schema().schema.action_size
+    actions = [0.0] * action_size
+
+    def call() -> Tuple[int, int]:
+        req = client._build_step_request(actions=actions)
+        resp = client.agent.Step(req, timeout=client.timeout)
+        client._observation_from_step_response(resp)
+        return req.ByteSize(), resp.ByteSize()
+
+    _run_case(results, BenchCaseResult("step", "step", {"action_size": action_size}),
+              lambda r: measure_calls(r, call, duration_s), log)
+    if not camera:
+        return
+    for w, h in resolutions:
+        params = {"action_size": action_size, "camera": camera, "width": w, "height": h}
+
+        def body(r: BenchCaseResult, w=w, h=h) -> BenchCaseResult:
+            client.configure_cameras([{"name": camera, "width": w, "height": h}])
+            try:
+                return measure_calls(r, call, duration_s)
+            finally:
+                client.configure_cameras([])
+
+        _run_case(results, BenchCaseResult(f"step_camera_{w}x{h}", "step", params), body, log)
+
+
+def _bench_state(client, duration_s, results, log) -> None:
+    from ..scene.mujoco_scene import FullStateSnapshot, _build_state_filter
+
+    for label, filter_dict in STATE_FILTERS:
+        req = client.pb.mujoco_scene.GetFullStateRequest(
+            include_qpos=True, include_qvel=True, include_ctrl=True
+        )
+        sf = _build_state_filter(filter_dict)
+        if sf is not None:
+            req.filter.CopyFrom(sf)
+
+        def call(req=req) -> Tuple[int, int]:
+            resp = client.mujoco_scene.GetFullState(req, timeout=client.timeout)
+            if not resp.success:
+                raise RuntimeError(resp.message)
+            FullStateSnapshot._from_pb(resp)
+            return req.ByteSize(), resp.ByteSize()
+
+        _run_case(results, BenchCaseResult(f"get_full_state_{label}", "state",
+                                           {"filter": filter_dict or {}}),
+                  lambda r, call=call: measure_calls(r, call, duration_s), log)
+
+
+def _bench_control(client, scene, duration_s, results, log) -> None:
+    # Write back the current ctrl so benchmarking doesn't disturb the scene.
+    info = scene.model_info()
+    ctrl = [float(v) for v in scene.state().ctrl]
+    ctrl += [0.0] * (info.nu - len(ctrl))
+    pb = client.pb.mujoco_scene
+    requests = {
+        "bulk": pb.SetControlRequest(bulk=ctrl),
+        "indexed": pb.SetControlRequest(indexed=[
+            pb.IndexedControlEntry(actuator_index=i, value=v) for i, v in enumerate(ctrl)
+        ]),
+        "named": pb.SetControlRequest(named=[
+            pb.NamedControlEntry(actuator_name=a.name, value=ctrl[a.index])
+            for a in info.actuators
+        ]),
+    }
+    for mode, req in requests.items():
+        def call(req=req) -> Tuple[int, int]:
+            resp = client.mujoco_scene.SetControl(req, timeout=client.timeout)
+            if not resp.success:
+                raise RuntimeError(resp.message)
+            return req.ByteSize(), resp.ByteSize()
+
+        _run_case(results, BenchCaseResult(f"set_control_{mode}", "control", {"nu": info.nu}),
+                  lambda r, call=call: measure_calls(r, call, duration_s), log)
+
+
+def _bench_camera(client, camera, resolutions, formats, fps, duration_s, results, log) -> None:
+    if not camera:
+        log("  camera: skipped (no --camera given)")
+        return
+    for fmt in formats:
+        for w, h in resolutions:
+            params = {"camera": camera, "width": w, "height": h, "format": fmt,
+                      "target_fps": fps}
+
+            def body(r: BenchCaseResult, w=w, h=h, fmt=fmt) -> BenchCaseResult:
+                stream = client.stream_camera(
+                    name=camera, target_fps=fps, width=w, height=h, format=fmt
+                )
+                return measure_stream(r, stream, lambda m: m.ByteSize(), duration_s)
+
+            _run_case(results, BenchCaseResult(f"stream_camera_{fmt}_{w}x{h}", "camera", params),
+                      body, log)
+
+
+def _bench_telemetry(client, fps, duration_s, results, log) -> None:
+    from ..delta import TelemetryDeltaDecoder, delta_stream_options
+
+    def plain(r: BenchCaseResult) -> BenchCaseResult:
+        return measure_stream(r, client.stream_telemetry(target_fps=fps),
+                              lambda m: m.ByteSize(), duration_s)
+
+    def delta(r: BenchCaseResult) -> BenchCaseResult:
+        req = client.pb.telemetry.StreamTelemetryRequest(target_fps=fps)
+        req.delta.CopyFrom(delta_stream_options(0, 0.0, 0.0))
+        decoder = TelemetryDeltaDecoder(())
+
+        def size(frame) -> int:
+            decoder.decode(frame)
+            return frame.ByteSize()
+
+        return measure_stream(r, client.telemetry.StreamTelemetry(req), size, duration_s)
+
+    params = {"target_fps": fps}
+    _run_case(results, BenchCaseResult("stream_telemetry", "telemetry", dict(params)),
+              plain, log)
+    _run_case(results, BenchCaseResult("stream_telemetry_delta", "telemetry", dict(params)),
+              delta, log)
+
+
+def _check_groups(groups: Sequence[str]) -> None:
+    unknown = [g for g in groups if g not in GROUPS]
+    if unknown:
+        raise ValueError(
+            f"Unknown bench group(s) {unknown}; "
+            f"expected any of {list(GROUPS)}"
+        )
+
+
+class _ClientSession:
+    """The part of Session that MujocoScene uses, over a bare client.
+
+    ``bench`` needs no robot, so it connects without ``Session.connect``.
+    """
+
+    def __init__(self, client) -> None:
+        self.engine_client = client
+
+
+def run_suite(
+    sess,
+    groups: Sequence[str] = GROUPS,
+    duration_s: float = 3.0,
+    camera: str = "",
+    resolutions: Sequence[Tuple[int, int]] = DEFAULT_RESOLUTIONS,
+    formats: Sequence[str] = DEFAULT_FORMATS,
+    stream_fps: int = 1000,
+    log: Callable[[str], None] = print,
+) -> List[BenchCaseResult]:
+    """Run the selected case groups against a connected Session (or anything
+    with a connected ``engine_client``)."""
+    from luckyrobots.scene import MujocoScene
+
+    _check_groups(groups)
+    client = sess.engine_client
+    results: List[BenchCaseResult] = []
+    if "step" in groups:
+        _bench_step(client, camera, resolutions, duration_s, results, log)
+    if "state" in groups:
+        _bench_state(client, duration_s, results, log)
+    if "control" in groups:
+        _bench_control(client, MujocoScene(sess), duration_s, results, log)
+    if "camera" in groups:
+        _bench_camera(client, camera, resolutions, formats, stream_fps, duration_s, results, log)
+    if "telemetry" in groups:
+        _bench_telemetry(client, stream_fps, duration_s, results, log)
+    return results
+
+
+# ---- reporting --------------------------------------------------------------
+
+
+def format_result(r: BenchCaseResult) -> str:
+    if r.error:
+        return f"  {r.name:<32} ERROR {r.error}"
+    lat = r.latency_ms
+    return (
+        f"  {r.name:<32} {r.throughput_hz:>9.1f}/s"
+        f"  p50 {lat.get('p50', 0.0):>7.2f}  p99 {lat.get('p99', 0.0):>7.2f} ms"
+        f"  {r.request_bytes:>9.0f} B out {r.response_bytes:>10.0f} B in"
+    )
+
+
+def build_report(host: str, port: int, results: Sequence[BenchCaseResult]) -> dict:
+    try:
+        from importlib.metadata import version
+
+        client_version = version("luckyrobots")
+    except Exception:  # running from a source tree
+        client_version = ""
+    return {
+        "version": REPORT_VERSION,
+        "luckyrobots_version": client_version,
+        "python": platform.python_version(),
+        "engine": f"{host}:{port}",
+        "started_at": time.time(),
+        "results": [asdict(r) for r in results],
+    }
+
+
+def compare_reports(current: dict, baseline: dict) -> List[dict]:
+    """Per-case relative throughput / p50 change against ``baseline``.
+
+    Cases missing from either report, or that errored in either, are skipped.
+    """
+    previous = {r["name"]: r for r in baseline.get("results", []) if not r.get("error")}
+    rows = []
+    for r in current.get("results", []):
+        old = previous.get(r["name"])
+        if r.get("error") or old is None or not old.get("throughput_hz"):
+            continue
+        old_p50 = old.get("latency_ms", {}).get("p50") or 0.0
+        new_p50 = r.get("latency_ms", {}).get("p50") or 0.0
+        rows.append({
+            "name": r["name"],
+            "throughput_change": r["throughput_hz"] / old["throughput_hz"] - 1.0,
+            "p50_change": (new_p50 / old_p50 - 1.0) if old_p50 else 0.0,
+        })
+    return rows
+
+
+def bench_main(
+    host: str,
+    port: int,
+    groups: Sequence[str] = GROUPS,
+    duration_s: float = 3.0,
+    camera: str = "",
+    resolutions: Sequence[Tuple[int, int]] = DEFAULT_RESOLUTIONS,
+    formats: Sequence[str] = DEFAULT_FORMATS,
+    stream_fps: int = 1000,
+    json_path: Optional[str] = None,
+    baseline_path: Optional[str] = None,
+    max_regression: Optional[float] = None,
+) -> int:
+    """Run the suite and report. Returns a process exit code.
+
+    0 on success, 1 when a case regressed past ``max_regression`` (fraction
+    of baseline throughput), 2 on bad arguments or connection failure.
+    """
+    from luckyrobots import LuckyEngineClient
+
+    try:
+        _check_groups(groups)
+    except ValueError as e:
+        print(e, file=sys.stderr)
+        return 2
+
+    print(f"Connecting to {host}:{port}...")
+    client = LuckyEngineClient(host=host, port=port)
+    if not client.wait_for_server(timeout=10.0):
+        print(f"  FAILED: no LuckyEngine gRPC server at {host}:{port} after 10s",
+              file=sys.stderr)
+        client.close()
+        return 2
+
+    # Only the channel is closed: the engine may be a user's running session.
+    try:
+        results = run_suite(
+            _ClientSession(client), groups=groups, duration_s=duration_s, camera=camera,
+            resolutions=resolutions, formats=formats, stream_fps=stream_fps,
+        )
+    finally:
+        client.close()
+    report = build_report(host, port, results)
+    if json_path:
+        with open(json_path, "w", encoding="utf-8") as f:
+            json.dump(report, f, indent=2)
+        print(f"\nWrote {json_path}")
+
+    if not baseline_path:
+        return 0
+    with open(baseline_path, encoding="utf-8") as f:
+        baseline = json.load(f)
+    rows = compare_reports(report, baseline)
+    print(f"\nAgainst {baseline_path}:")
+    regressed = []
+    for row in rows:
+        print(
+            f"  {row['name']:<32} throughput {row['throughput_change']:+7.1%}"
+            f"  p50 {row['p50_change']:+7.1%}"
+        )
+        if max_regression is not None and row["throughput_change"] < -max_regression:
+            regressed.append(row["name"])
+    if regressed:
+        print(f"\nRegressed past {max_regression:.0%}: {', '.join(regressed)}", file=sys.stderr)
+        return 1
+    return 0
@@ -7,14 +7,16 @@ Uses checked-in Python stubs generated from the `.proto` files under
 
 from __future__ import annotations
 
+import dataclasses
 import logging
 import math
 import statistics
 import time
 from types import SimpleNamespace
-from typing import Any, Optional
+from typing import TYPE_CHECKING, Any, Iterable, Mapping, Optional, Sequence
 
 import grpc  # type: ignore
+import numpy as np
 
 logger = logging.getLogger("luckyrobots.client")
 
@@ -30,6 +32,8 @@ try:
     from .grpc.generated import mujoco_pb2_grpc  # type: ignore
     from .grpc.generated import mujoco_scene_pb2  # type: ignore
     from .grpc.generated import mujoco_scene_pb2_grpc  # type: ignore
+    from .grpc.generated import recorder_pb2  # type: ignore
+    from .grpc.generated import recorder_pb2_grpc  # type: ignore
     from .grpc.generated import scene_pb2  # type: ignore
     from .grpc.generated import scene_pb2_grpc  # type: ignore
     from .grpc.generated import telemetry_pb2  # type: ignore
@@ -44,9 +48,517 @@ except Exception as e:  # pragma: no cover
     ) from e
 
 from .models import ObservationResponse
-from .models.observation import CameraFrame
-from .models.benchmark import BenchmarkResult
+from .models.observation import BatchObservation, CameraFrame, PhysicsThreadTiming
+from .models.randomization import AppliedRandomization
+from .models.benchmark import BenchmarkResult, StepProfile, StepSample, stage_histograms
+from .scene.mujoco_scene import (
+    ContactSet,
+    FullStateSnapshot,
+    HeightScan,
+    RaycastResult,
+    _build_state_filter,
+    _contacts_request,
+    _height_scan_request,
+    _raycast_request,
+)
+from .delta import TelemetryDeltaDecoder, delta_stream_options
+from .metadata_cache import MetadataCache, cache_from_env, cache_key
 from . import sim_contract
+from .packed import PackedStep, PackedStepLayout
+from .shm import SharedMemoryRing, is_local_host
+from .step_arrays import StepArrayDecoder, StepArrays
+from .video import VideoStreamDecoder, is_video_format
+
+if TYPE_CHECKING:  # pragma: no cover - typing only
+    from .step_stream import StepStream
+
+
+_CAMERA_COLOR_FORMATS = {
+    "rgba8": media_pb2.PIXEL_FORMAT_RGBA8,
+    "rgb8": media_pb2.PIXEL_FORMAT_RGB8,
+}
+_CAMERA_DEPTH_FORMATS = {
+    "f16": media_pb2.PIXEL_FORMAT_DEPTH_F16,
+    "u16": media_pb2.PIXEL_FORMAT_DEPTH_U16,
+}
+_CAMERA_SEGMENTATION_FORMATS = {
+    "u8": media_pb2.PIXEL_FORMAT_SEGMENTATION_U8,
+    "u16": media_pb2.PIXEL_FORMAT_SEGMENTATION_U16,
+}
+
+
+def _camera_format(camera: dict, key: str, formats: dict, default: str) -> int:
+    """Resolve one configure_cameras() format key to a PixelFormat (0 = not requested)."""
+    value = camera.get(key, default if key == "color" else None)
+    if not value:
+        return 0
+    if value is True:
+        value = default
+    if value not in formats:
+        raise ValueError(
+            f"Camera {camera.get('name')!r}: {key}={value!r}, expected one of {sorted(formats)}"
+        )
+    return formats[value]
+
+
+_SUBSTEP_REDUCTIONS = {
+    "sum": agent_pb2.SUBSTEP_REDUCTION_SUM,
+    "mean": agent_pb2.SUBSTEP_REDUCTION_MEAN,
+    "last": agent_pb2.SUBSTEP_REDUCTION_LAST,
+}
+
+
+_PHYSICS_BACKENDS = {
+    "cpu": agent_pb2.PHYSICS_BACKEND_CPU,
+    "gpu": agent_pb2.PHYSICS_BACKEND_GPU,
+    "mjx": agent_pb2.PHYSICS_BACKEND_MJX,
+    "mujoco_warp": agent_pb2.PHYSICS_BACKEND_MUJOCO_WARP,
+}
+_PHYSICS_BACKEND_NAMES = {v: k for k, v in _PHYSICS_BACKENDS.items()}
+
+
+_OBSERVATION_NOISE_TYPES = {
+    "none": agent_pb2.OBSERVATION_NOISE_NONE,
+    "gaussian": agent_pb2.OBSERVATION_NOISE_GAUSSIAN,
+    "uniform": agent_pb2.OBSERVATION_NOISE_UNIFORM,
+}
+
+
+def _observation_term_pb(t: dict):
+    """ObservationTermRequest from a contract dict entry (noise / clip / scale optional)."""
+    term = agent_pb2.ObservationTermRequest(
+        name=t["name"],
+        params=t.get("params", {}),
+        group=t.get("group", "policy"),
+        clip=float(t.get("clip", 0.0)),
+        scale=float(t.get("scale", 0.0)),
+    )
+    noise = t.get("noise")
+    if noise:
+        kind = noise.get("type", "gaussian")
+        if kind not in _OBSERVATION_NOISE_TYPES:
+            raise ValueError(
+                f"Unknown observation noise type {kind!r}; "
+                f"expected one of {sorted(_OBSERVATION_NOISE_TYPES)}"
+            )
+        term.noise.CopyFrom(agent_pb2.ObservationNoise(
+            type=_OBSERVATION_NOISE_TYPES[kind],
+            std=float(noise.get("std", 0.0)),
+            low=float(noise.get("low", 0.0)),
+            high=float(noise.get("high", 0.0)),
+        ))
+    return term
+
+
+MODEL_RANDOMIZATION_FIELDS = {
+    "geom_friction": agent_pb2.MODEL_RANDOMIZATION_FIELD_GEOM_FRICTION,
+    "body_mass": agent_pb2.MODEL_RANDOMIZATION_FIELD_BODY_MASS,
+    "dof_damping": agent_pb2.MODEL_RANDOMIZATION_FIELD_DOF_DAMPING,
+    "dof_armature": agent_pb2.MODEL_RANDOMIZATION_FIELD_DOF_ARMATURE,
+    "dof_frictionloss": agent_pb2.MODEL_RANDOMIZATION_FIELD_DOF_FRICTIONLOSS,
+    "actuator_gain": agent_pb2.MODEL_RANDOMIZATION_FIELD_ACTUATOR_GAIN,
+    "actuator_damping": agent_pb2.MODEL_RANDOMIZATION_FIELD_ACTUATOR_DAMPING,
+}
+_MODEL_RANDOMIZATION_FIELD_NAMES = {v: k for k, v in MODEL_RANDOMIZATION_FIELDS.items()}
+
+_RANDOMIZATION_OPERATIONS = {
+    "scale": agent_pb2.RANDOMIZATION_OPERATION_SCALE,
+    "add": agent_pb2.RANDOMIZATION_OPERATION_ADD,
+    "set": agent_pb2.RANDOMIZATION_OPERATION_SET,
+}
+
+_RANDOMIZATION_DISTRIBUTIONS = {
+    "uniform": agent_pb2.RANDOMIZATION_DISTRIBUTION_UNIFORM,
+    "log_uniform": agent_pb2.RANDOMIZATION_DISTRIBUTION_LOG_UNIFORM,
+    "gaussian": agent_pb2.RANDOMIZATION_DISTRIBUTION_GAUSSIAN,
+}
+
+
+def _step_deadline_error(timeout: Optional[float]) -> RuntimeError:
+    """The error raised when a Step RPC exceeds its client-side deadline."""
+    return RuntimeError(
+        f"Client-side gRPC timeout ({timeout}s): the server did not respond in time. "
+        "This usually means the engine is frozen or the network is unreachable."
+    )
+
+
+def _lookup(table: dict, kind: str, value: str) -> int:
+    if value not in table:
+        raise ValueError(
+            f"Unknown {kind} {value!r}; "
+            f"expected one of {sorted(table)}"
+        )
+    return table[value]
+
+
+def _model_randomization_pb(config: Mapping[str, Any]):
+    """ModelRandomizationConfig from ``{"terms": [...], "seed": ..., "table_size": ...}``.
+
+    Each term: ``{"field": "body_mass", "targets": ["trunk"], "range": [0.9, 1.1],
+    "operation": "scale", "distribution": "uniform", "shared": False}``.
+    """
+    terms = []
+    for t in config.get("terms", []):
+        low, high = t.get("range", (1.0, 1.0))
+        terms.append(agent_pb2.ModelRandomization(
+            field=_lookup(MODEL_RANDOMIZATION_FIELDS, "randomization field", t["field"]),
+            targets=list(t.get("targets", [])),
+            operation=_lookup(
+                _RANDOMIZATION_OPERATIONS, "randomization operation", t.get("operation", "scale")
+            ),
+            distribution=_lookup(
+                _RANDOMIZATION_DISTRIBUTIONS, "randomization distribution",
+                t.get("distribution", "uniform"),
+            ),
+            low=float(low),
+            high=float(high),
+            shared=bool(t.get("shared", False)),
+        ))
+    return agent_pb2.ModelRandomizationConfig(
+        terms=terms,
+        seed=int(config.get("seed", 0)),
+        table_size=int(config.get("table_size", 0)),
+    )
+
+
+def _applied_randomization(pb) -> Optional[AppliedRandomization]:
+    if not pb.columns:
+        return None
+    return AppliedRandomization._from_pb(pb, _MODEL_RANDOMIZATION_FIELD_NAMES)
+
+
+def _observation_program_to_dict(program) -> dict:
+    return {
+        "observation_size": program.observation_size,
+        "fused_kernels": program.fused_kernels,
+        "compile_time_us": program.compile_time_us,
+        "kernels": [
+            {
+                "kernel": k.kernel,
+                "terms": list(k.terms),
+                "offset": k.offset,
+                "size": k.size,
+                "noise": k.noise,
+                "clip": k.clip,
+            }
+            for k in program.kernels
+        ],
+    }
+
+
+def _step_state_request(state):
+    """StepRequest.state from ``True`` (whole model) or a StateFilter dict."""
+    req = mujoco_scene_pb2.GetFullStateRequest(
+        include_qpos=True, include_qvel=True, include_ctrl=True
+    )
+    sf = _build_state_filter(state if isinstance(state, Mapping) else None)
+    if sf is not None:
+        req.filter.CopyFrom(sf)
+    return req
+
+
+def _substep_reduction(name: str) -> int:
+    try:
+        return _SUBSTEP_REDUCTIONS[name]
+    except KeyError:
+        raise ValueError(
+            f"substep_reduction must be one of {sorted(_SUBSTEP_REDUCTIONS)}, got {name!r}"
+        ) from None
+
+
+def _pixel_format_name(value: int) -> str:
+    """ImageFrame.pixel_format enum value -> CameraFrame.pixel_format string."""
+    if not value:
+        return ""
+    return media_pb2.PixelFormat.Name(value)[len("PIXEL_FORMAT_"):].lower()
+
+
+def _camera_frame_from_pb(
+    name: str, frame, latency_steps: int = 0, render_targets=()
+) -> CameraFrame:
+    """Build a CameraFrame (with its depth / segmentation targets) from an ImageFrame."""
+    targets = {}
+    for target in render_targets:
+        tf = _camera_frame_from_pb(name, target, latency_steps)
+        targets[tf.kind] = tf
+    return CameraFrame(
+        name=name,
+        data=bytes(frame.data),
+        width=frame.width,
+        height=frame.height,
+        channels=frame.channels,
+        frame_number=frame.frame_number,
+        latency_steps=latency_steps,
+        pixel_format=_pixel_format_name(frame.pixel_format),
+        depth_scale=frame.depth_scale,
+        render_targets=targets,
+    )
+
+
+_PHYSICS_PARTITIONINGS = {
+    "auto": scene_pb2.PHYSICS_PARTITIONING_AUTO,
+    "none": scene_pb2.PHYSICS_PARTITIONING_NONE,
+    "islands": scene_pb2.PHYSICS_PARTITIONING_ISLANDS,
+    "env_replicas": scene_pb2.PHYSICS_PARTITIONING_ENV_REPLICAS,
+}
+
+
+def _physics_threading_to_dict(resp) -> dict:
+    names = {v: k for k, v in _PHYSICS_PARTITIONINGS.items()}
+    return {
+        "num_threads": resp.config.num_threads,
+        "partitioning": names.get(resp.config.partitioning, "unknown"),
+        "hardware_threads": resp.hardware_threads,
+        "partition_count": resp.partition_count,
+    }
+
+
+# Generated stub class per LuckyEngineClient service property (see bulk_stub).
+_SERVICE_STUBS = {
+    "scene": scene_pb2_grpc.SceneServiceStub,
+    "mujoco": mujoco_pb2_grpc.MujocoServiceStub,
+    "mujoco_scene": mujoco_scene_pb2_grpc.MujocoSceneServiceStub,
+    "agent": agent_pb2_grpc.AgentServiceStub,
+    "debug": debug_pb2_grpc.DebugServiceStub,
+    "camera": camera_pb2_grpc.CameraServiceStub,
+    "telemetry": telemetry_pb2_grpc.TelemetryServiceStub,
+    "viewport": viewport_pb2_grpc.ViewportServiceStub,
+    "recorder": recorder_pb2_grpc.RecorderServiceStub,
+}
+
+_RPC_PRIORITY_CLASSES = {
+    "control": scene_pb2.RPC_PRIORITY_CLASS_CONTROL,
+    "default": scene_pb2.RPC_PRIORITY_CLASS_DEFAULT,
+    "bulk": scene_pb2.RPC_PRIORITY_CLASS_BULK,
+}
+
+_RPC_CLASS_LIMITS = (
+    "num_threads",
+    "max_bytes_per_second",
+    "max_messages_per_second",
+    "max_queue_depth",
+)
+
+_RPC_CLASS_METRICS = (
+    "num_threads",
+    "queue_depth",
+    "max_queue_depth",
+    "active_calls",
+    "completed_calls",
+    "messages_sent",
+    "bytes_sent",
+    "throttled_messages",
+    "dropped_messages",
+    "queue_wait_p50_us",
+    "queue_wait_p99_us",
+    "latency_p50_us",
+    "latency_p99_us",
+)
+
+
+def _rpc_priority_class(name: str) -> int:
+    return _lookup(_RPC_PRIORITY_CLASSES, "RPC priority class", name)
+
+
+def _rpc_qos_config_pb(
+    classes: Optional[Mapping[str, Mapping[str, int]]],
+    method_classes: Optional[Mapping[str, str]],
+):
+    config = scene_pb2.RpcQosConfig()
+    for name, limits in (classes or {}).items():
+        unknown = set(limits) - set(_RPC_CLASS_LIMITS)
+        if unknown:
+            raise ValueError(
+                f"Unknown RPC class setting(s) {sorted(unknown)}; "
+                f"expected {list(_RPC_CLASS_LIMITS)}"
+            )
+        config.classes.add(
+            priority_class=_rpc_priority_class(name),
+            **{k: int(v) for k, v in limits.items()},
+        )
+    for method, name in (method_classes or {}).items():
+        config.method_classes.add(method=method, priority_class=_rpc_priority_class(name))
+    return config
+
+
+def _rpc_qos_to_dict(resp) -> dict:
+    names = {v: k for k, v in _RPC_PRIORITY_CLASSES.items()}
+    return {
+        "classes": {
+            names.get(c.priority_class, "unknown"): {k: getattr(c, k) for k in _RPC_CLASS_LIMITS}
+            for c in resp.config.classes
+        },
+        "method_classes": {
+            m.method: names.get(m.priority_class, "unknown") for m in resp.config.method_classes
+        },
+    }
+
+
+def _rpc_qos_metrics_to_dict(resp) -> dict:
+    names = {v: k for k, v in _RPC_PRIORITY_CLASSES.items()}
+    return {
+        "window_s": resp.window_s,
+        "classes": {
+            names.get(c.priority_class, "unknown"): {k: getattr(c, k) for k in _RPC_CLASS_METRICS}
+            for c in resp.classes
+        },
+    }
+
+
+_RECORDING_FORMATS = {
+    "lerobot": recorder_pb2.RECORDING_FORMAT_LEROBOT,
+    "parquet_mp4": recorder_pb2.RECORDING_FORMAT_PARQUET_MP4,
+}
+
+_RECORDING_OVERFLOW = {
+    "drop": recorder_pb2.RECORDING_OVERFLOW_DROP,
+    "block": recorder_pb2.RECORDING_OVERFLOW_BLOCK,
+}
+
+
+_REPLAY_SCHEDULES = {
+    "frame": recorder_pb2.REPLAY_SCHEDULE_FRAME,
+    "time": recorder_pb2.REPLAY_SCHEDULE_TIME,
+}
+
+
+def _recording_status_to_dict(status) -> dict:
+    return {
+        "recording_id": status.recording_id,
+        "active": status.active,
+        "output_dir": status.output_dir,
+        "rows_recorded": status.rows_recorded,
+        "rows_dropped": status.rows_dropped,
+        "video_frames_dropped": status.video_frames_dropped,
+        "episodes": status.episodes,
+        "files_written": status.files_written,
+        "bytes_written": status.bytes_written,
+        "buffer_bytes": status.buffer_bytes,
+        "max_buffer_bytes": status.max_buffer_bytes,
+        "physics_thread_time_us": status.physics_thread_time_us,
+    }
+
+
+def _mdp_component_to_dict(d) -> dict:
+    return {
+        "name": d.name,
+        "description": d.description,
+        "category": d.category,
+        "gpu_kernel": d.gpu_kernel,
+    }
+
+
+def _physics_threads_from_pb(timings) -> list[PhysicsThreadTiming]:
+    return [
+        PhysicsThreadTiming(
+            thread_index=t.thread_index,
+            busy_us=t.busy_us,
+            partitions=t.partitions,
+            stolen_partitions=t.stolen_partitions,
+        )
+        for t in timings
+    ]
+
+
+def step_response_to_observation(
+    resp,
+    agent_name: str = "agent_0",
+    observation_names: Optional[list[str]] = None,
+    action_names: Optional[list[str]] = None,
+    observation_array: Optional[np.ndarray] = None,
+    extra_camera_frames: Optional[list[CameraFrame]] = None,
+    packed: Optional[PackedStep] = None,
+) -> ObservationResponse:
+    """Decode a StepResponse proto into an ObservationResponse.
+
+    Shared by the unary, streaming and async step paths. ``packed`` is the
+    decoded ``packed_step`` buffer of a STEP_ENCODING_PACKED session.
+    """
+    agent_frame = resp.observation
+    observations = list(agent_frame.observations) if agent_frame.observations else []
+    actions_out = list(agent_frame.actions) if agent_frame.actions else []
+    timestamp_ms = getattr(agent_frame, "timestamp_ms", 0)
+    frame_number = getattr(agent_frame, "frame_number", 0)
+
+    camera_frames = [
+        _camera_frame_from_pb(nf.name, nf.frame, nf.latency_steps, nf.render_targets)
+        for nf in resp.camera_frames
+    ]
+    if extra_camera_frames:
+        camera_frames.extend(extra_camera_frames)
+
+    # Extract enriched step data if present
+    reward_signals = dict(resp.reward_signals) if resp.reward_signals else None
+    terminated = resp.terminated
+    truncated = resp.truncated
+    info = dict(resp.info) if resp.info else None
+    termination_flags = dict(resp.termination_flags) if resp.termination_flags else None
+
+    if packed is not None:
+        observation_array = packed.observation
+        reward_signals = packed.reward_dict() or None
+        info = packed.info_dict() or None
+        termination_flags = packed.termination_dict() or None
+
+    return ObservationResponse(
+        observation=observations,
+        actions=actions_out,
+        timestamp_ms=timestamp_ms,
+        frame_number=frame_number,
+        agent_name=agent_name,
+        observation_names=observation_names,
+        action_names=action_names,
+        camera_frames=camera_frames,
+        reward_signals=reward_signals,
+        terminated=terminated,
+        truncated=truncated,
+        info=info,
+        termination_flags=termination_flags,
+        observation_array=observation_array,
+        substeps_completed=resp.substeps_completed or 1,
+        physics_step_duration_us=resp.physics_step_duration_us,
+        physics_threads=_physics_threads_from_pb(resp.physics_threads),
+        step_profile=StepProfile._from_pb(resp.profile) if resp.HasField("profile") else None,
+        full_state=_full_state_from_step(resp),
+        **_step_queries(resp),
+    )
+
+
+def _step_queries(resp) -> dict:
+    """Raycasts / height scans / contacts attached to a StepResponse.
+
+    A failed query decodes to None in its place and its message goes into
+    ``query_errors`` under ``"raycasts[i]"``, ``"height_scans[i]"`` or
+    ``"contacts"``, so one bad query loses neither the step nor the others.
+    """
+    errors: dict[str, str] = {}
+
+    def decode(result_cls, pb, key: str):
+        if pb.success:
+            return result_cls._from_pb(pb)
+        errors[key] = pb.message
+        return None
+
+    return {
+        "raycasts": [
+            decode(RaycastResult, r, f"raycasts[{i}]") for i, r in enumerate(resp.raycasts)
+        ],
+        "height_scans": [
+            decode(HeightScan, h, f"height_scans[{i}]") for i, h in enumerate(resp.height_scans)
+        ],
+        "contacts": (
+            decode(ContactSet, resp.contacts, "contacts") if resp.HasField("contacts") else None
+        ),
+        "query_errors": errors,
+    }
+
+
+def _full_state_from_step(resp) -> Optional[FullStateSnapshot]:
+    if not resp.HasField("state"):
+        return None
+    if not resp.state.success:
+        raise RuntimeError(f"Step state attachment failed: {resp.state.message}")
+    return FullStateSnapshot._from_pb(resp.state)
 
 
 class GrpcConnectionError(Exception):
@@ -84,6 +596,7 @@ class LuckyEngineClient:
         timeout: float = 5.0,
         *,
         robot_name: Optional[str] = None,
+        bulk_connection: bool = False,
     ) -> None:
         """
         Initialize the LuckyEngine gRPC client.
@@ -93,6 +606,10 @@ class LuckyEngineClient:
             port: gRPC server port.
             timeout: Default timeout for RPC calls in seconds.
             robot_name: Default robot name for calls that require it.
+            bulk_connection: Open a second TCP connection for server streams
+                (cameras, viewport, full state, telemetry, monitors), so
+                large stream frames never queue ahead of Step responses in
+                the shared HTTP/2 connection. See :meth:`bulk_stub`.
         """
         self.host = host
         self.port = port
@@ -100,6 +617,9 @@ class LuckyEngineClient:
         self._robot_name = robot_name
 
         self._channel = None
+        self._bulk_connection = bulk_connection
+        self._bulk_channel = None
+        self._bulk_stubs: dict[str, Any] = {}
 
         # Service stubs (created lazily on first property access)
         self._scene = None
@@ -110,6 +630,7 @@ class LuckyEngineClient:
         self._debug = None
         self._telemetry = None
         self._viewport = None
+        self._recorder = None
 
         # Additional user-registered stubs (see register_stub).
         self._extra_stubs: dict[str, Any] = {}
@@ -119,6 +640,30 @@ class LuckyEngineClient:
 
         # Camera requests included on every Step RPC (configured via configure_cameras).
         self._camera_requests: list = []
+        self._camera_capture_mode = agent_pb2.CAMERA_CAPTURE_SYNC
+
+        # Packed Step layout of the latest STEP_ENCODING_PACKED negotiation.
+        self._packed_layout: Optional[PackedStepLayout] = None
+
+        # Shared-memory Step transport (see enable_shared_memory).
+        self._shm: Optional[SharedMemoryRing] = None
+
+        # Negotiated reward term order per session_id ("" = latest), used to
+        # label the packed reward columns returned by BatchStep.
+        self._session_reward_terms: dict[str, list[str]] = {}
+
+        # Per-agent numpy buffers for step(return_numpy=True).
+        self._step_decoders: dict[str, StepArrayDecoder] = {}
+
+        # On-disk metadata cache (see enable_metadata_cache) and this
+        # connection's EngineFingerprint (None = not fetched, False = the
+        # engine has no GetEngineFingerprint).
+        self._metadata_cache: Optional[MetadataCache] = cache_from_env()
+        self._engine_fingerprint: Any = None
+
+        # RPCs this engine answered UNIMPLEMENTED, so callers with a unary
+        # fallback (RobotCommandBatch) stop retrying them.
+        self._unsupported_rpcs: set[str] = set()
 
         # Protobuf modules (for discoverability + explicit imports).
         self._pb = SimpleNamespace(
@@ -131,6 +676,7 @@ class LuckyEngineClient:
             camera=camera_pb2,
             telemetry=telemetry_pb2,
             viewport=viewport_pb2,
+            recorder=recorder_pb2,
             media=media_pb2,
         )
 
@@ -148,6 +694,13 @@ class LuckyEngineClient:
         logger.info(f"Connecting to LuckyEngine gRPC server at {target}")
 
         self._channel = grpc.insecure_channel(target)
+        if self._bulk_connection:
+            # A local subchannel pool keeps gRPC from reusing the control
+            # channel's connection.
+            self._bulk_channel = grpc.insecure_channel(
+                target, options=[("grpc.use_local_subchannel_pool", 1)]
+            )
+        self._bulk_stubs = {}
 
         # Drop any cached stubs so a reconnect re-binds them to the new channel.
         self._scene = None
@@ -158,12 +711,24 @@ class LuckyEngineClient:
         self._debug = None
         self._telemetry = None
         self._viewport = None
+        self._recorder = None
         self._extra_stubs: dict[str, Any] = {}
+        self._engine_fingerprint = None
+        self._unsupported_rpcs = set()
 
         logger.info(f"Channel opened to {target} (server not verified yet)")
 
     def close(self) -> None:
         """Close the gRPC channel."""
+        if self._shm is not None:
+            self.disable_shared_memory()
+        if self._bulk_channel is not None:
+            try:
+                self._bulk_channel.close()
+            except Exception as e:
+                logger.debug(f"Error closing bulk gRPC channel: {e}")
+            self._bulk_channel = None
+            self._bulk_stubs = {}
         if self._channel is not None:
             try:
                 self._channel.close()
@@ -231,6 +796,13 @@ class LuckyEngineClient:
 
             if self.health_check(timeout=min(poll_interval, timeout - (time.perf_counter() - start))):
                 logger.info(f"Connected to LuckyEngine gRPC server at {self.host}:{self.port}")
+                if self._metadata_cache is not None:
+                    # Fetch the fingerprint up front so reflection probes
+                    # (Session.has_rpc) are answered from the cache too.
+                    try:
+                        self._fingerprint()
+                    except grpc.RpcError as e:
+                        logger.debug(f"GetEngineFingerprint failed: {e}")
                 return True
 
             time.sleep(poll_interval)
@@ -331,6 +903,28 @@ class LuckyEngineClient:
             self._viewport = viewport_pb2_grpc.ViewportServiceStub(self.channel)
         return self._viewport
 
+    @property
+    def recorder(self) -> Any:
+        """RecorderService stub (lazy) — engine-side dataset recording."""
+        if self._recorder is None:
+            self._recorder = recorder_pb2_grpc.RecorderServiceStub(self.channel)
+        return self._recorder
+
+    def bulk_stub(self, service: str) -> Any:
+        """Stub for ``service`` (``"camera"``, ``"agent"``, ...) to open bulk streams on.
+
+        Bound to the second connection when the client was created with
+        ``bulk_connection=True``, otherwise the same stub as
+        ``client.<service>``. The ``stream_*`` helpers and
+        :class:`~luckyrobots.monitor.PolicyMonitor` use it.
+        """
+        if self._bulk_channel is None:
+            return getattr(self, service)
+        stub = self._bulk_stubs.get(service)
+        if stub is None:
+            stub = self._bulk_stubs[service] = _SERVICE_STUBS[service](self._bulk_channel)
+        return stub
+
     # ── Extension seam for user-provided services ──
 
     def register_stub(self, name: str, stub_class: Any) -> Any:
@@ -381,20 +975,44 @@ class LuckyEngineClient:
 
     # ── Camera configuration ──
 
-    def configure_cameras(self, cameras: list[dict]) -> None:
+    def configure_cameras(self, cameras: list[dict], pipelined: bool = False) -> None:
         """Configure cameras to capture on every Step RPC.
 
+        The engine renders all configured cameras in one batched pass with a
+        single readback, so adding cameras does not add per-camera GPU stalls.
+
         Args:
             cameras: List of camera configs. Each dict has keys:
                 name: Camera entity name in the scene.
                 width: Desired image width (0 = native resolution).
                 height: Desired image height (0 = native resolution).
+                color: ``"rgba8"`` (default) or ``"rgb8"`` to drop alpha.
+                depth: ``"f16"`` (metres) or ``"u16"`` (scaled), or True for f16.
+                segmentation: ``"u8"`` or ``"u16"`` ids, or True for u16.
+                Depth and segmentation are rendered in the same pass and
+                returned as ``CameraFrame.depth`` / ``CameraFrame.segmentation``.
+            pipelined: Overlap the readback with the next physics step
+                (CAMERA_CAPTURE_PIPELINED). Frames then arrive one step late,
+                tagged ``CameraFrame.latency_steps == 1``, and the first step
+                after configuring returns none.
         """
+        self._camera_capture_mode = (
+            agent_pb2.CAMERA_CAPTURE_PIPELINED if pipelined else agent_pb2.CAMERA_CAPTURE_SYNC
+        )
         self._camera_requests = [
             self.pb.agent.GetCameraFrameRequest(
                 name=c["name"],
                 width=c.get("width", 0),
                 height=c.get("height", 0),
+                color_format=_camera_format(c, "color", _CAMERA_COLOR_FORMATS, "rgba8"),
+                render_targets=[
+                    fmt
+                    for fmt in (
+                        _camera_format(c, "depth", _CAMERA_DEPTH_FORMATS, "f16"),
+                        _camera_format(c, "segmentation", _CAMERA_SEGMENTATION_FORMATS, "u16"),
+                    )
+                    if fmt
+                ],
             )
             for c in cameras
         ]
@@ -415,6 +1033,75 @@ class LuckyEngineClient:
             for c in resp.cameras
         ]
 
+    # ── Shared-memory Step transport ──
+
+    def enable_shared_memory(
+        self,
+        agent_name: str = "",
+        slot_count: int = 4,
+        include_camera_frames: bool = True,
+        timeout: Optional[float] = None,
+    ) -> None:
+        """Switch step() to the same-host shared-memory transport.
+
+        The engine writes each step's observation and camera pixels into a
+        ring of ``slot_count`` slots; the StepResponse only carries offsets.
+        ``ObservationResponse.observation_array`` and ``CameraFrame.data``
+        then are zero-copy views that stay valid for ``slot_count - 1``
+        further steps. ``ObservationResponse.observation`` is left empty;
+        read the vector with ``to_numpy()``.
+
+        Args:
+            agent_name: Agent name (empty = default agent).
+            slot_count: Ring depth.
+            include_camera_frames: Also route camera pixels through the ring.
+            timeout: RPC timeout in seconds.
+
+        Raises:
+            ValueError: If the client is not connected over loopback.
+            RuntimeError: If the engine refuses the transport.
+        """
+        if not is_local_host(self.host):
+            raise ValueError(
+                f"Shared-memory transport requires a same-host engine, got host={self.host!r}"
+            )
+        if self._shm is not None:
+            self.disable_shared_memory(timeout=timeout)
+
+        timeout = timeout or self.timeout
+        resp = self.agent.OpenSharedMemoryTransport(
+            self.pb.agent.OpenSharedMemoryTransportRequest(
+                agent_name=agent_name,
+                slot_count=slot_count,
+                include_camera_frames=include_camera_frames,
+            ),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"OpenSharedMemoryTransport failed: {resp.message}")
+
+        self._shm = SharedMemoryRing._from_pb(resp)
+        logger.info(
+            "Shared-memory transport %s: region=%s slots=%d x %d bytes",
+            resp.transport_id, resp.region_name, resp.slot_count, resp.slot_size,
+        )
+
+    def disable_shared_memory(self, timeout: Optional[float] = None) -> None:
+        """Release the shared-memory transport and return to inline payloads."""
+        ring, self._shm = self._shm, None
+        if ring is None:
+            return
+        try:
+            self.agent.CloseSharedMemoryTransport(
+                self.pb.agent.CloseSharedMemoryTransportRequest(
+                    transport_id=ring.transport_id
+                ),
+                timeout=timeout or self.timeout,
+            )
+        except Exception as e:
+            logger.debug("CloseSharedMemoryTransport failed (non-fatal): %s", e)
+        ring.close()
+
     # ── Multi-policy action groups ──
 
     def set_action_group(
@@ -500,9 +1187,15 @@ class LuckyEngineClient:
         joints, and actuator names the agent API doesn't expose.
         """
         timeout = timeout or self.timeout
-        return self.mujoco_scene.GetModelInfo(
-            self.pb.mujoco_scene.GetModelInfoRequest(),
-            timeout=timeout,
+        return self._cached_metadata(
+            "model_info",
+            "model_hash",
+            (),
+            self.pb.mujoco_scene.GetModelInfoResponse,
+            lambda: self.mujoco_scene.GetModelInfo(
+                self.pb.mujoco_scene.GetModelInfoRequest(),
+                timeout=timeout,
+            ),
         )
 
     def get_full_state(
@@ -538,7 +1231,7 @@ class LuckyEngineClient:
             for resp in client.stream_full_state(target_fps=60):
                 qpos = list(resp.state.qpos)
         """
-        return self.mujoco_scene.StreamFullState(
+        return self.bulk_stub("mujoco_scene").StreamFullState(
             self.pb.mujoco_scene.StreamFullStateRequest(
                 target_fps=target_fps,
                 include_qpos=include_qpos,
@@ -635,6 +1328,124 @@ class LuckyEngineClient:
             for a in info.actuators
         ]
 
+    def batch_rollout(
+        self,
+        ctrl: np.ndarray,
+        parameters: Sequence[Any],
+        candidates: np.ndarray,
+        *,
+        timestep: float = 0.0,
+        from_current_state: bool = False,
+        num_threads: int = 0,
+        timeout: Optional[float] = None,
+    ) -> tuple[np.ndarray, np.ndarray]:
+        """Roll one control sequence out under many parameter sets in parallel.
+
+        Each candidate runs engine-side on its own model / data clone, so the
+        live scene is untouched.
+
+        Args:
+            ctrl: (num_steps, nu) controls.
+            parameters: Objects with ``element``, ``mj_name`` and
+                ``attribute`` (e.g. :class:`luckyrobots.sysid.ParamSpec`).
+            candidates: (num_candidates, len(parameters)) parameter values.
+            timestep: Physics timestep for the rollouts (0 = model timestep).
+            from_current_state: Start from the live state, not mj_resetData.
+            num_threads: Engine worker threads (0 = physics pool size).
+            timeout: RPC timeout in seconds; covers the whole batch.
+
+        Returns:
+            ``(qpos, qvel)`` float64 arrays of shape (num_candidates,
+            num_steps, nq) and (num_candidates, num_steps, nv), the state
+            after each step.
+
+        Raises:
+            ValueError: If ``candidates`` doesn't have one column per parameter.
+            RuntimeError: If the engine rejected the batch.
+        """
+        timeout = timeout or self.timeout
+        ctrl = np.ascontiguousarray(ctrl, dtype="<f8")
+        candidates = np.ascontiguousarray(np.atleast_2d(candidates), dtype="<f8")
+        if ctrl.ndim != 2:
+            raise ValueError(f"ctrl must be (num_steps, nu), got shape {ctrl.shape}")
+        if candidates.shape[1] != len(parameters):
+            raise ValueError(
+                f"candidates has {candidates.shape[1]} columns for {len(parameters)} parameters"
+            )
+        pb = self.pb.mujoco_scene
+        resp = self.mujoco_scene.BatchRollout(
+            pb.BatchRolloutRequest(
+                ctrl=ctrl.tobytes(),
+                num_steps=ctrl.shape[0],
+                nu=ctrl.shape[1],
+                timestep=timestep,
+                parameters=[
+                    pb.RolloutParameter(element=p.element, name=p.mj_name, attribute=p.attribute)
+                    for p in parameters
+                ],
+                candidates=candidates.tobytes(),
+                num_candidates=candidates.shape[0],
+                from_current_state=from_current_state,
+                num_threads=num_threads,
+            ),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"BatchRollout failed: {resp.message}")
+        shape = (resp.num_candidates, resp.num_steps)
+        qpos = np.frombuffer(resp.qpos, dtype="<f8").reshape(*shape, resp.nq)
+        qvel = np.frombuffer(resp.qvel, dtype="<f8").reshape(*shape, resp.nv)
+        return qpos, qvel
+
+    def play_control_sequence(
+        self,
+        ctrl: np.ndarray,
+        dt: float = 0.0,
+        *,
+        reset: bool = True,
+        timeout: Optional[float] = None,
+    ) -> dict:
+        """Play controls open-loop on the live scene and record the response.
+
+        One RPC for the whole sequence instead of a step and a state query
+        per row.
+
+        Args:
+            ctrl: (num_steps, nu) controls written to ``mjData.ctrl``.
+            dt: Seconds each row is held (0 = one physics step per row).
+            reset: ResetScene before playing.
+            timeout: RPC timeout in seconds; covers the whole sequence.
+
+        Returns:
+            Dict with float64 ``times`` (num_steps,), ``qpos`` (num_steps, nq)
+            and ``qvel`` (num_steps, nv), sampled after each row.
+
+        Raises:
+            ValueError: If ``ctrl`` is not 2-D.
+            RuntimeError: If the engine rejected the sequence.
+        """
+        timeout = timeout or self.timeout
+        ctrl = np.ascontiguousarray(ctrl, dtype="<f8")
+        if ctrl.ndim != 2:
+            raise ValueError(f"ctrl must be (num_steps, nu), got shape {ctrl.shape}")
+        resp = self.mujoco_scene.PlayControlSequence(
+            self.pb.mujoco_scene.PlayControlSequenceRequest(
+                ctrl=ctrl.tobytes(),
+                num_steps=ctrl.shape[0],
+                nu=ctrl.shape[1],
+                dt=dt,
+                reset=reset,
+            ),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"PlayControlSequence failed: {resp.message}")
+        return {
+            "times": np.frombuffer(resp.times, dtype="<f8"),
+            "qpos": np.frombuffer(resp.qpos, dtype="<f8").reshape(resp.num_steps, resp.nq),
+            "qvel": np.frombuffer(resp.qvel, dtype="<f8").reshape(resp.num_steps, resp.nv),
+        }
+
     # ── AgentService RPCs ──
 
     def get_agent_schema(self, agent_name: str = "", timeout: Optional[float] = None):
@@ -656,8 +1467,11 @@ class LuckyEngineClient:
             self.pb.agent.GetAgentSchemaRequest(agent_name=agent_name),
             timeout=timeout,
         )
+        self._cache_agent_schema(agent_name, resp)
+        return resp
 
-        # Cache the schema for named observation access
+    def _cache_agent_schema(self, agent_name: str, resp) -> None:
+        """Remember a GetAgentSchemaResponse for named observation access."""
         schema = getattr(resp, "schema", None)
         if schema is not None:
             cache_key = agent_name or "agent_0"
@@ -671,13 +1485,12 @@ class LuckyEngineClient:
                 len(action_names),
             )
 
-        return resp
-
     def reset_agent(
         self,
         agent_name: str = "",
         randomization_cfg: Optional[Any] = None,
         timeout: Optional[float] = None,
+        model_randomization: Optional[Mapping[str, Any]] = None,
     ):
         """
         Reset a specific agent.
@@ -686,22 +1499,76 @@ class LuckyEngineClient:
             agent_name: Agent logical name. Empty string means default agent.
             randomization_cfg: Optional simulation contract config for this reset.
             timeout: Timeout in seconds (uses default if None).
+            model_randomization: Replace the session's in-place model
+                randomization from this reset on (see :meth:`reset_agents`).
 
         Returns:
-            ResetAgentResponse with success and message fields.
+            ResetAgentResponse with success and message fields, plus
+            ``applied_randomization`` when model randomization is configured.
         """
         timeout = timeout or self.timeout
+        return self.agent.ResetAgent(
+            self._reset_agent_request(agent_name, randomization_cfg, model_randomization),
+            timeout=timeout,
+        )
+
+    def reset_agents(
+        self,
+        env_ids: Optional[Sequence[int]] = None,
+        agent_name: str = "",
+        model_randomization: Optional[Mapping[str, Any]] = None,
+        randomization_cfg: Optional[Any] = None,
+        timeout: Optional[float] = None,
+    ) -> Optional[AppliedRandomization]:
+        """Reset several env replicas in one ResetAgent call and report their model values.
+
+        The engine randomizes friction, mass, damping and actuator gains by
+        writing each replica's mjModel fields in place from per-env sample
+        tables precomputed from the seed. Nothing is recompiled or reloaded,
+        so this is cheap enough to run on every episode.
+
+        Args:
+            env_ids: Replicas of the negotiated session to reset (None = the agent).
+            agent_name: Agent logical name when ``env_ids`` is None.
+            model_randomization: ``{"terms": [...], "seed": int, "table_size": int}``
+                replacing the configured randomization (normally set once via
+                the contract's ``randomization.model``). Each term is
+                ``{"field", "targets", "range": [low, high], "operation",
+                "distribution", "shared"}``; fields are the keys of
+                ``MODEL_RANDOMIZATION_FIELDS``.
+            randomization_cfg: Optional simulation contract config, as in :meth:`reset_agent`.
+            timeout: RPC timeout in seconds.
+
+        Returns:
+            AppliedRandomization with one row per reset env, or None when no
+            model randomization is configured.
+
+        Raises:
+            RuntimeError: If the reset fails.
+        """
+        timeout = timeout or self.timeout
+        request = self._reset_agent_request(agent_name, randomization_cfg, model_randomization)
+        request.env_ids.extend(int(e) for e in env_ids or ())
+        resp = self.agent.ResetAgent(request, timeout=timeout)
+        if not resp.success:
+            raise RuntimeError(f"ResetAgent failed: {resp.message}")
+        return _applied_randomization(resp.applied_randomization)
 
-        request_kwargs = {"agent_name": agent_name}
+    def _reset_agent_request(
+        self,
+        agent_name: str,
+        randomization_cfg: Optional[Any],
+        model_randomization: Optional[Mapping[str, Any]],
+    ):
+        request_kwargs: dict[str, Any] = {"agent_name": agent_name}
 
         if randomization_cfg is not None:
             contract = sim_contract.to_proto(self.pb.agent, randomization_cfg)
             request_kwargs["simulation_contract"] = contract
+        if model_randomization is not None:
+            request_kwargs["model_randomization"] = _model_randomization_pb(model_randomization)
 
-        return self.agent.ResetAgent(
-            self.pb.agent.ResetAgentRequest(**request_kwargs),
-            timeout=timeout,
-        )
+        return self.pb.agent.ResetAgentRequest(**request_kwargs)
 
     def step(
         self,
@@ -710,7 +1577,15 @@ class LuckyEngineClient:
         step_timeout_s: float = 0.0,
         timeout: Optional[float] = None,
         action_groups: list[dict] | None = None,
-    ) -> ObservationResponse:
+        num_substeps: int = 1,
+        substep_reduction: str = "sum",
+        return_numpy: bool = False,
+        profile: bool = False,
+        state: bool | Mapping[str, Any] | None = None,
+        raycasts: Sequence[Mapping[str, Any]] | None = None,
+        height_scans: Sequence[Mapping[str, Any]] | None = None,
+        contacts: bool | Mapping[str, Any] | None = None,
+    ) -> ObservationResponse | StepArrays:
         """
         Synchronous RL step: apply action, wait for physics, return observation.
 
@@ -723,12 +1598,115 @@ class LuckyEngineClient:
             action_groups: Optional list of action group dicts, each with keys:
                 group_name: str, actions: list[float], action_indices: list[int].
                 Groups are applied on top of actions (if provided) or default positions.
+            num_substeps: Action repeat / decimation. The engine runs this many
+                physics substeps with the same action in one RPC and returns the
+                final observation. Stops early if the episode ends.
+            substep_reduction: How reward signals combine across substeps:
+                ``"sum"`` (default), ``"mean"`` or ``"last"``.
+            return_numpy: Skip the ObservationResponse and return a
+                :class:`~luckyrobots.step_arrays.StepArrays` tuple whose
+                arrays are per-agent buffers overwritten by the next step.
+                Rewards follow the negotiated reward term order. Camera
+                frames, info, termination flags and spatial queries are
+                not decoded.
+            profile: Ask the engine for per-stage timings of this step
+                (``ObservationResponse.step_profile``). Costs a few clock
+                reads on the engine; off by default.
+            state: Attach the post-step mjData state to the response
+                (``ObservationResponse.full_state``, a FullStateSnapshot):
+                ``True`` for the whole model, or a StateFilter dict as in
+                :meth:`MujocoScene.state`. Replaces a GetFullState call.
+            raycasts: Ray batches evaluated after the last substep, each a
+                dict of :meth:`MujocoScene.raycast` arguments
+                (``{"origins": ..., "directions": ..., ...}``); results in
+                ``ObservationResponse.raycasts``.
+            height_scans: Height-scan grids, each a dict of
+                :meth:`MujocoScene.height_scan` arguments (``{"body": ...}``);
+                results in ``ObservationResponse.height_scans``.
+            contacts: Attach the contact list (``ObservationResponse.contacts``):
+                ``True``, or a dict of :meth:`MujocoScene.contacts` arguments.
+                A query the engine could not run comes back as None, with
+                its message in ``ObservationResponse.query_errors``.
 
         Returns:
-            ObservationResponse with observation after physics step.
+            ObservationResponse with observation after the last physics substep
+            (or StepArrays with ``return_numpy=True``).
         """
         timeout = timeout or self.timeout
 
+        request = self._build_step_request(
+            actions=actions,
+            agent_name=agent_name,
+            step_timeout_s=step_timeout_s,
+            action_groups=action_groups,
+            num_substeps=num_substeps,
+            substep_reduction=substep_reduction,
+            profile=profile,
+            state=state,
+            raycasts=raycasts,
+            height_scans=height_scans,
+            contacts=contacts,
+        )
+
+        try:
+            resp = self.agent.Step(request, timeout=timeout)
+        except grpc.RpcError as e:
+            if e.code() == grpc.StatusCode.DEADLINE_EXCEEDED:
+                raise _step_deadline_error(timeout) from e
+            raise
+
+        if return_numpy:
+            return self._arrays_from_step_response(resp, agent_name)
+        return self._observation_from_step_response(resp, agent_name)
+
+    def step_stream(
+        self,
+        agent_name: str = "",
+        max_in_flight: int = 1,
+        step_timeout_s: float = 0.0,
+    ) -> "StepStream":
+        """
+        Open a persistent bidirectional step channel (AgentService.StepStream).
+
+        One long-lived HTTP/2 stream carries every step, avoiding the
+        per-call setup cost of unary step(). With ``max_in_flight > 1`` up to
+        that many actions may be sent before their observations are read.
+
+        Args:
+            agent_name: Agent name (empty = default agent).
+            max_in_flight: Maximum number of sent-but-unread steps.
+            step_timeout_s: Server-side timeout for each physics step (seconds).
+
+        Returns:
+            An open StepStream. Close it (or use it as a context manager) when done.
+        """
+        from .step_stream import StepStream
+
+        return StepStream(
+            self,
+            agent_name=agent_name,
+            max_in_flight=max_in_flight,
+            step_timeout_s=step_timeout_s,
+        )
+
+    def _build_step_request(
+        self,
+        actions: list[float] | None = None,
+        agent_name: str = "",
+        step_timeout_s: float = 0.0,
+        action_groups: list[dict] | None = None,
+        sequence: int = 0,
+        num_substeps: int = 1,
+        substep_reduction: str = "sum",
+        profile: bool = False,
+        state: bool | Mapping[str, Any] | None = None,
+        raycasts: Sequence[Mapping[str, Any]] | None = None,
+        height_scans: Sequence[Mapping[str, Any]] | None = None,
+        contacts: bool | Mapping[str, Any] | None = None,
+    ):
+        """Build a StepRequest carrying the configured cameras / shm transport."""
+        if num_substeps < 1:
+            raise ValueError(f"num_substeps must be >= 1, got {num_substeps}")
         # Build inline action groups if provided
         proto_groups = []
         if action_groups:
@@ -750,73 +1728,202 @@ class LuckyEngineClient:
                     )
                 )
 
-        try:
-            resp = self.agent.Step(
-                self.pb.agent.StepRequest(
-                    agent_name=agent_name,
-                    actions=actions or [],
-                    timeout_s=step_timeout_s,
-                    camera_requests=self._camera_requests,
-                    action_groups=proto_groups,
-                ),
-                timeout=timeout,
-            )
-        except grpc.RpcError as e:
-            if e.code() == grpc.StatusCode.DEADLINE_EXCEEDED:
-                raise RuntimeError(
-                    f"Client-side gRPC timeout ({timeout}s): the server did not respond in time. "
-                    "This usually means the engine is frozen or the network is unreachable."
-                ) from e
-            raise
+        return self.pb.agent.StepRequest(
+            agent_name=agent_name,
+            actions=actions or [],
+            timeout_s=step_timeout_s,
+            camera_requests=self._camera_requests,
+            camera_capture_mode=self._camera_capture_mode,
+            action_groups=proto_groups,
+            shm_transport_id=self._shm.transport_id if self._shm else "",
+            sequence=sequence,
+            num_substeps=num_substeps,
+            substep_reduction=_substep_reduction(substep_reduction),
+            profile=profile,
+            state=_step_state_request(state) if state not in (None, False) else None,
+            raycasts=[_raycast_request(**spec) for spec in raycasts or ()],
+            height_scans=[_height_scan_request(**spec) for spec in height_scans or ()],
+            contacts=(
+                _contacts_request(**(contacts if isinstance(contacts, Mapping) else {}))
+                if contacts not in (None, False)
+                else None
+            ),
+        )
 
+    def _observation_from_step_response(self, resp, agent_name: str = "") -> ObservationResponse:
+        """Convert a StepResponse into an ObservationResponse (raises on failure)."""
         if not resp.success:
             raise RuntimeError(
                 f"Server-side physics timeout: {resp.message} "
                 f"(server waited up to its configured timeout for the physics step to complete)"
             )
 
-        agent_frame = resp.observation
-        observations = list(agent_frame.observations) if agent_frame.observations else []
-        actions_out = list(agent_frame.actions) if agent_frame.actions else []
-        timestamp_ms = getattr(agent_frame, "timestamp_ms", 0)
-        frame_number = getattr(agent_frame, "frame_number", 0)
-
         cache_key = agent_name or "agent_0"
         obs_names, action_names = self._schema_cache.get(cache_key, (None, None))
 
-        camera_frames = [
-            CameraFrame(
-                name=nf.name,
-                data=bytes(nf.frame.data),
-                width=nf.frame.width,
-                height=nf.frame.height,
-                channels=nf.frame.channels,
-                frame_number=nf.frame.frame_number,
-            )
-            for nf in resp.camera_frames
-        ]
+        observation_array = None
+        camera_frames: list[CameraFrame] = []
+        if self._shm is not None and resp.HasField("shm_slot"):
+            observation_array, camera_frames = self._read_shm_slot(resp.shm_slot)
 
-        # Extract enriched step data if present
-        reward_signals = dict(resp.reward_signals) if resp.reward_signals else None
-        terminated = resp.terminated
-        truncated = resp.truncated
-        info = dict(resp.info) if resp.info else None
-        termination_flags = dict(resp.termination_flags) if resp.termination_flags else None
-
-        return ObservationResponse(
-            observation=observations,
-            actions=actions_out,
-            timestamp_ms=timestamp_ms,
-            frame_number=frame_number,
+        packed = None
+        if resp.packed_step and self._packed_layout is not None:
+            packed = self._packed_layout.decode(resp.packed_step)
+
+        return step_response_to_observation(
+            resp,
             agent_name=cache_key,
             observation_names=obs_names,
             action_names=action_names,
-            camera_frames=camera_frames,
+            observation_array=observation_array,
+            extra_camera_frames=camera_frames,
+            packed=packed,
+        )
+
+    def _arrays_from_step_response(self, resp, agent_name: str = "") -> StepArrays:
+        """Decode a StepResponse into reused numpy buffers (raises on failure)."""
+        if not resp.success:
+            raise RuntimeError(
+                f"Server-side physics timeout: {resp.message} "
+                f"(server waited up to its configured timeout for the physics step to complete)"
+            )
+
+        cache_key = agent_name or "agent_0"
+        decoder = self._step_decoders.get(cache_key)
+        if decoder is None:
+            decoder = StepArrayDecoder(self._session_reward_terms.get("", ()))
+            self._step_decoders[cache_key] = decoder
+
+        observation = rewards = None
+        if self._shm is not None and resp.HasField("shm_slot"):
+            slot = resp.shm_slot
+            if not self._shm.is_current(slot):
+                raise RuntimeError(
+                    f"Shared-memory slot {slot.slot_index} was overwritten before it was read "
+                    f"(expected sequence {slot.sequence}); increase slot_count"
+                )
+            observation = self._shm.floats(slot.observation_offset, slot.observation_count)
+        if resp.packed_step and self._packed_layout is not None:
+            packed = self._packed_layout.decode(resp.packed_step)
+            observation, rewards = packed.observation, packed.rewards
+        return decoder.decode(resp, observation=observation, rewards=rewards)
+
+    def _read_shm_slot(self, slot) -> tuple[np.ndarray, list[CameraFrame]]:
+        """Build zero-copy views over a SharedMemorySlot of the active ring."""
+        ring = self._shm
+        if not ring.is_current(slot):
+            raise RuntimeError(
+                f"Shared-memory slot {slot.slot_index} was overwritten before it was read "
+                f"(expected sequence {slot.sequence}); increase slot_count"
+            )
+        observation_array = ring.floats(slot.observation_offset, slot.observation_count)
+
+        # Depth / segmentation targets are extra entries sharing the camera
+        # name; fold them into the color frame rendered in the same pass.
+        primary: dict[str, CameraFrame] = {}
+        targets: dict[str, dict[str, CameraFrame]] = {}
+        for img in slot.camera_frames:
+            frame = CameraFrame(
+                name=img.name,
+                data=ring.bytes_view(img.offset, img.size),
+                width=img.width,
+                height=img.height,
+                channels=img.channels,
+                frame_number=img.frame_number,
+                latency_steps=img.latency_steps,
+                pixel_format=_pixel_format_name(img.pixel_format),
+                depth_scale=img.depth_scale,
+            )
+            if frame.kind == "color" and img.name not in primary:
+                primary[img.name] = frame
+            else:
+                targets.setdefault(img.name, {})[frame.kind] = frame
+        frames = [
+            dataclasses.replace(frame, render_targets=targets.get(name, {}))
+            for name, frame in primary.items()
+        ]
+        return observation_array, frames
+
+    def batch_step(
+        self,
+        actions: Any,
+        session_id: str = "",
+        reset_env_ids: Optional[list[int]] = None,
+        step_timeout_s: float = 0.0,
+        timeout: Optional[float] = None,
+        num_substeps: int = 1,
+        substep_reduction: str = "sum",
+    ) -> BatchObservation:
+        """
+        Vectorized RL step across every env replica of a negotiated session.
+
+        Args:
+            actions: Action tensor of shape (num_envs, action_dim).
+            session_id: Negotiated session to step (empty = latest negotiated session).
+            reset_env_ids: Replicas to reset instead of stepping. Their rows in the
+                result hold the first observation of the new episode.
+            step_timeout_s: Server-side timeout for waiting for the physics step (seconds).
+                0 means use server default.
+            timeout: RPC timeout in seconds.
+            num_substeps: Physics substeps per action (action repeat / decimation).
+            substep_reduction: ``"sum"``, ``"mean"`` or ``"last"`` over substep rewards.
+
+        Returns:
+            BatchObservation with (num_envs, ...) numpy arrays.
+        """
+        timeout = timeout or self.timeout
+        if num_substeps < 1:
+            raise ValueError(f"num_substeps must be >= 1, got {num_substeps}")
+
+        actions_arr = np.asarray(actions, dtype=np.float32)
+        if actions_arr.ndim != 2:
+            raise ValueError(
+                f"batch_step expects actions of shape (num_envs, action_dim), "
+                f"got {actions_arr.shape}"
+            )
+        num_envs, action_dim = actions_arr.shape
+
+        try:
+            resp = self.agent.BatchStep(
+                self.pb.agent.BatchStepRequest(
+                    session_id=session_id,
+                    num_envs=num_envs,
+                    action_dim=action_dim,
+                    actions=actions_arr.ravel().tolist(),
+                    timeout_s=step_timeout_s,
+                    reset_env_ids=list(reset_env_ids or []),
+                    num_substeps=num_substeps,
+                    substep_reduction=_substep_reduction(substep_reduction),
+                ),
+                timeout=timeout,
+            )
+        except grpc.RpcError as e:
+            if e.code() == grpc.StatusCode.DEADLINE_EXCEEDED:
+                raise _step_deadline_error(timeout) from e
+            raise
+
+        if not resp.success:
+            raise RuntimeError(f"BatchStep failed: {resp.message}")
+
+        n = int(resp.num_envs) or num_envs
+        reward_terms = self._session_reward_terms.get(session_id, [])
+
+        observations = np.asarray(resp.observations, dtype=np.float32).reshape(n, -1)
+        reward_signals = np.asarray(resp.reward_signals, dtype=np.float32).reshape(n, -1)
+        if len(reward_terms) != reward_signals.shape[1]:
+            # Session negotiated elsewhere (or not at all) — fall back to positional names.
+            reward_terms = [f"reward_{i}" for i in range(reward_signals.shape[1])]
+
+        return BatchObservation(
+            observations=observations,
             reward_signals=reward_signals,
-            terminated=terminated,
-            truncated=truncated,
-            info=info,
-            termination_flags=termination_flags,
+            terminated=np.asarray(resp.terminated, dtype=bool),
+            truncated=np.asarray(resp.truncated, dtype=bool),
+            reward_terms=list(reward_terms),
+            frame_number=resp.frame_number,
+            physics_step_duration_us=resp.physics_step_duration_us,
+            physics_threads=_physics_threads_from_pb(resp.physics_threads),
+            applied_randomization=_applied_randomization(resp.applied_randomization),
         )
 
     # ── Progress reporting ──
@@ -860,6 +1967,100 @@ class LuckyEngineClient:
         except Exception as e:
             logger.debug("report_progress failed (non-fatal): %s", e)
 
+    # ── Engine fingerprint + metadata cache ──
+
+    @property
+    def metadata_cache(self) -> Optional[MetadataCache]:
+        """The on-disk metadata cache in use (None = disabled)."""
+        return self._metadata_cache
+
+    def enable_metadata_cache(self, directory: Optional[str] = None) -> MetadataCache:
+        """Reuse engine metadata across connections.
+
+        Capability manifests, contract validations, negotiated layouts,
+        ``GetModelInfo`` and reflection results are stored on disk under the
+        engine's ``EngineFingerprint`` hashes. A later connection to an
+        identical engine costs one ``GetEngineFingerprint`` call instead of a
+        round trip per payload. Setting ``LUCKYROBOTS_METADATA_CACHE`` (to a
+        directory, or ``1`` for the default) enables it for every client.
+
+        Engines without ``GetEngineFingerprint`` are served uncached.
+
+        Args:
+            directory: Cache root (default ``~/.cache/luckyrobots/metadata``).
+                Safe to share between processes.
+        """
+        self._metadata_cache = MetadataCache(directory)
+        self._attach_reflection_cache()
+        return self._metadata_cache
+
+    def get_engine_fingerprint(
+        self, refresh: bool = False, timeout: Optional[float] = None
+    ) -> Optional[dict]:
+        """Content hashes identifying the engine's metadata.
+
+        Fetched once per connection; pass ``refresh=True`` after loading a
+        different scene.
+
+        Returns:
+            Dict with engine_version, model_hash, manifest_hash, api_hash and
+            fingerprint, or None if the engine predates ``GetEngineFingerprint``.
+        """
+        fp = self._fingerprint(refresh=refresh, timeout=timeout)
+        if fp is None:
+            return None
+        return {
+            "engine_version": fp.engine_version,
+            "model_hash": fp.model_hash,
+            "manifest_hash": fp.manifest_hash,
+            "api_hash": fp.api_hash,
+            "fingerprint": fp.fingerprint,
+        }
+
+    def _fingerprint(self, refresh: bool = False, timeout: Optional[float] = None):
+        """This connection's ``EngineFingerprint`` proto, or None if unsupported."""
+        if self._engine_fingerprint is None or refresh:
+            try:
+                resp = self.agent.GetEngineFingerprint(
+                    self.pb.agent.GetEngineFingerprintRequest(),
+                    timeout=timeout or self.timeout,
+                )
+            except grpc.RpcError as e:
+                if e.code() != grpc.StatusCode.UNIMPLEMENTED:
+                    raise
+                logger.debug("Engine has no GetEngineFingerprint; metadata cache bypassed")
+                self._engine_fingerprint = False
+            else:
+                fp = resp.fingerprint
+                self._engine_fingerprint = fp if fp.fingerprint else False
+                self._attach_reflection_cache()
+        return self._engine_fingerprint or None
+
+    def _attach_reflection_cache(self) -> None:
+        if self._metadata_cache is None or not self._engine_fingerprint or self._channel is None:
+            return
+        from . import reflection as _reflection
+
+        _reflection.attach_metadata_cache(
+            self._channel, self._metadata_cache, self._engine_fingerprint.api_hash
+        )
+
+    def _cached_metadata(self, kind: str, hash_field: str, parts: tuple, message_cls, fetch):
+        """``fetch()``, served from the metadata cache when the engine's
+        ``fingerprint.<hash_field>`` and ``parts`` match a stored entry."""
+        cache = self._metadata_cache
+        fp = self._fingerprint() if cache is not None else None
+        if fp is None:
+            return fetch()
+        key = cache_key(getattr(fp, hash_field), *parts)
+        msg = cache.load(kind, key, message_cls)
+        if msg is None:
+            msg = fetch()
+            # Failed lookups (success=False) are not worth remembering.
+            if getattr(msg, "success", True):
+                cache.store(kind, key, msg)
+        return msg
+
     # ── Task Contract RPCs ──
 
     def get_capability_manifest(
@@ -876,32 +2077,30 @@ class LuckyEngineClient:
             timeout: RPC timeout in seconds.
 
         Returns:
-            Dict with observations, rewards, terminations, randomizations lists.
+            Dict with observations, rewards, terminations, randomizations
+            lists (terms carry ``gpu_kernel``) and ``physics_backends``.
         """
         timeout = timeout or self.timeout
-        resp = self.agent.GetCapabilityManifest(
-            self.pb.agent.GetCapabilityManifestRequest(
-                robot_name=robot_name,
-                scene=scene,
+        resp = self._cached_metadata(
+            "manifest",
+            "manifest_hash",
+            (robot_name, scene),
+            self.pb.agent.GetCapabilityManifestResponse,
+            lambda: self.agent.GetCapabilityManifest(
+                self.pb.agent.GetCapabilityManifestRequest(
+                    robot_name=robot_name,
+                    scene=scene,
+                ),
+                timeout=timeout,
             ),
-            timeout=timeout,
         )
         manifest = resp.manifest
         return {
             "engine_version": manifest.engine_version,
             "manifest_version": manifest.manifest_version,
-            "observations": [
-                {"name": d.name, "description": d.description, "category": d.category}
-                for d in manifest.observations
-            ],
-            "rewards": [
-                {"name": d.name, "description": d.description, "category": d.category}
-                for d in manifest.rewards
-            ],
-            "terminations": [
-                {"name": d.name, "description": d.description, "category": d.category}
-                for d in manifest.terminations
-            ],
+            "observations": [_mdp_component_to_dict(d) for d in manifest.observations],
+            "rewards": [_mdp_component_to_dict(d) for d in manifest.rewards],
+            "terminations": [_mdp_component_to_dict(d) for d in manifest.terminations],
             "randomizations": [
                 {
                     "name": d.base.name,
@@ -911,6 +2110,17 @@ class LuckyEngineClient:
                 }
                 for d in manifest.randomizations
             ],
+            "physics_backends": [
+                {
+                    "backend": _PHYSICS_BACKEND_NAMES.get(b.backend, "unknown"),
+                    "name": b.name,
+                    "device": b.device,
+                    "device_memory_bytes": b.device_memory_bytes,
+                    "max_num_envs": b.max_num_envs,
+                    "supports_cameras": b.supports_cameras,
+                }
+                for b in manifest.physics_backends
+            ],
         }
 
     def validate_task_contract(
@@ -935,9 +2145,15 @@ class LuckyEngineClient:
         """
         timeout = timeout or self.timeout
         proto_contract = self._build_task_contract(contract)
-        resp = self.agent.ValidateTaskContract(
-            self.pb.agent.ValidateTaskContractRequest(contract=proto_contract),
-            timeout=timeout,
+        resp = self._cached_metadata(
+            "validation",
+            "fingerprint",
+            (proto_contract.SerializeToString(deterministic=True),),
+            self.pb.agent.ValidateTaskContractResponse,
+            lambda: self.agent.ValidateTaskContract(
+                self.pb.agent.ValidateTaskContractRequest(contract=proto_contract),
+                timeout=timeout,
+            ),
         )
         result = resp.result
         return {
@@ -978,7 +2194,15 @@ class LuckyEngineClient:
             timeout: RPC timeout in seconds.
 
         Returns:
-            Dict with session_id, reward_terms, termination_terms on success.
+            Dict with session_id, reward_terms, termination_terms, num_envs,
+            observation_layout and step_encoding on success (plus packed_layout
+            when the engine accepted ``step_encoding="packed"``, and
+            observation_program when the engine compiled the observation terms).
+
+        Observation terms may carry ``"scale"``, ``"clip"`` and ``"noise"``
+        (``{"type": "gaussian", "std": ...}`` or ``{"type": "uniform",
+        "low": ..., "high": ...}``); the engine applies them inside the
+        term's kernel.
 
         Raises:
             RuntimeError: If contract validation fails.
@@ -988,20 +2212,79 @@ class LuckyEngineClient:
         # Build protobuf contract from dict
         proto_contract = self._build_task_contract(contract)
 
+        # With a metadata cache, offer the session negotiated last time for
+        # this engine + contract; the engine then omits the layouts it would
+        # resolve identically.
+        cache = self._metadata_cache
+        fp = self._fingerprint() if cache is not None else None
+        session_key = cached_session = None
+        if fp is not None:
+            session_key = cache_key(
+                fp.fingerprint, proto_contract.SerializeToString(deterministic=True)
+            )
+            cached_session = cache.load(
+                "session", session_key, self.pb.agent.NegotiatedTaskSession
+            )
+
         resp = self.agent.NegotiateTask(
-            self.pb.agent.NegotiateTaskRequest(contract=proto_contract),
+            self.pb.agent.NegotiateTaskRequest(
+                contract=proto_contract,
+                cached_session_hash=cached_session.session_hash if cached_session else "",
+            ),
             timeout=timeout,
         )
 
         if not resp.success:
             raise RuntimeError(f"Task contract negotiation failed: {resp.message}")
 
+        if resp.session.layout_omitted and cached_session is not None:
+            session_id = resp.session.session_id
+            resp.session.CopyFrom(cached_session)
+            resp.session.session_id = session_id
+        elif session_key is not None and resp.session.session_hash:
+            cache.store("session", session_key, resp.session)
+
+        return self._negotiated_session(resp)
+
+    def _negotiated_session(self, resp) -> dict:
+        """Adopt a successful NegotiateTaskResponse and return its result dict."""
         result = {
             "session_id": resp.session.session_id if resp.session else "",
             "reward_terms": list(resp.session.reward_terms) if resp.session else [],
             "termination_terms": list(resp.session.termination_terms) if resp.session else [],
+            "num_envs": max(int(resp.session.num_envs), 1) if resp.session else 1,
+            "physics_backend": _PHYSICS_BACKEND_NAMES.get(
+                resp.session.physics_backend, "unknown"
+            ),
         }
 
+        result["observation_layout"] = [
+            {"name": o.name, "group": o.group, "offset": o.offset, "size": o.size}
+            for o in resp.session.observation_layout
+        ]
+        if resp.session.HasField("observation_program"):
+            result["observation_program"] = _observation_program_to_dict(
+                resp.session.observation_program
+            )
+
+        # Remember the reward column order for batch_step()
+        self._session_reward_terms[result["session_id"]] = result["reward_terms"]
+        self._session_reward_terms[""] = result["reward_terms"]
+        self._step_decoders.clear()
+
+        # Packed Step encoding: the layout is fixed for the session's lifetime.
+        packed = resp.session.step_encoding == self.pb.agent.STEP_ENCODING_PACKED
+        result["step_encoding"] = "packed" if packed else "proto"
+        if packed:
+            self._packed_layout = PackedStepLayout._from_pb(
+                resp.session.packed_layout,
+                reward_terms=result["reward_terms"],
+                termination_terms=result["termination_terms"],
+            )
+            result["packed_layout"] = self._packed_layout.to_dict()
+        else:
+            self._packed_layout = None
+
         # Include warnings if any
         if resp.validation and resp.validation.warnings:
             result["warnings"] = [
@@ -1024,22 +2307,8 @@ class LuckyEngineClient:
         obs_contract = None
         if "observations" in contract:
             obs = contract["observations"]
-            required = [
-                pb.ObservationTermRequest(
-                    name=t["name"],
-                    params=t.get("params", {}),
-                    group=t.get("group", "policy"),
-                )
-                for t in obs.get("required", [])
-            ]
-            optional = [
-                pb.ObservationTermRequest(
-                    name=t["name"],
-                    params=t.get("params", {}),
-                    group=t.get("group", "policy"),
-                )
-                for t in obs.get("optional", [])
-            ]
+            required = [_observation_term_pb(t) for t in obs.get("required", [])]
+            optional = [_observation_term_pb(t) for t in obs.get("optional", [])]
             obs_contract = pb.ObservationContract(required=required, optional=optional)
 
         # Build reward contract
@@ -1103,6 +2372,8 @@ class LuckyEngineClient:
             rand_contract = pb.RandomizationContract(
                 custom_randomizations=custom_rands,
             )
+            if "model" in rand:
+                rand_contract.model.CopyFrom(_model_randomization_pb(rand["model"]))
 
         # Build auxiliary data requests
         aux_data = []
@@ -1115,6 +2386,21 @@ class LuckyEngineClient:
                 for a in contract["auxiliary_data"]
             ]
 
+        # Step payload encoding
+        encodings = {"proto": pb.STEP_ENCODING_PROTO, "packed": pb.STEP_ENCODING_PACKED}
+        encoding_name = contract.get("step_encoding", "proto")
+        if encoding_name not in encodings:
+            raise ValueError(
+                f"Unknown step_encoding '{encoding_name}'. Available: {list(encodings)}"
+            )
+        step_encoding = encodings[encoding_name]
+
+        backend_name = contract.get("physics_backend", "cpu")
+        if backend_name not in _PHYSICS_BACKENDS:
+            raise ValueError(
+                f"Unknown physics_backend '{backend_name}'. Available: {list(_PHYSICS_BACKENDS)}"
+            )
+
         return pb.TaskContract(
             task_id=contract.get("task_id", ""),
             robot=contract.get("robot", ""),
@@ -1125,6 +2411,9 @@ class LuckyEngineClient:
             terminations=term_contract,
             randomization=rand_contract,
             auxiliary_data=aux_data,
+            num_envs=contract.get("num_envs", 0),
+            step_encoding=step_encoding,
+            physics_backend=_PHYSICS_BACKENDS[backend_name],
         )
 
     # ── SceneService RPCs ──
@@ -1175,6 +2464,148 @@ class LuckyEngineClient:
         )
         return {0: "realtime", 1: "deterministic", 2: "fast"}.get(resp.mode, "unknown")
 
+    def set_physics_threading(
+        self,
+        num_threads: int = 0,
+        partitioning: str = "auto",
+        timeout: Optional[float] = None,
+    ) -> dict:
+        """Configure multi-threaded physics stepping.
+
+        Args:
+            num_threads: Pool size. 0 = one per physical core, 1 = single-threaded.
+            partitioning: ``"auto"``, ``"none"``, ``"islands"`` (independent
+                kinematic islands of one mjModel) or ``"env_replicas"`` (one
+                cloned mjData per BatchStep replica).
+            timeout: RPC timeout in seconds.
+
+        Returns:
+            The effective config, see :meth:`get_physics_threading`.
+
+        Raises:
+            ValueError: If ``partitioning`` is unknown.
+            RuntimeError: If the engine rejected the config.
+        """
+        timeout = timeout or self.timeout
+        try:
+            mode = _PHYSICS_PARTITIONINGS[partitioning.lower()]
+        except KeyError:
+            raise ValueError(
+                f"Unknown partitioning {partitioning!r}; "
+                f"expected one of {sorted(_PHYSICS_PARTITIONINGS)}"
+            ) from None
+        pb = self.pb.scene
+        resp = self.scene.SetPhysicsThreading(
+            pb.SetPhysicsThreadingRequest(
+                config=pb.PhysicsThreadingConfig(num_threads=num_threads, partitioning=mode)
+            ),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"SetPhysicsThreading failed: {resp.message}")
+        return _physics_threading_to_dict(resp)
+
+    def get_physics_threading(self, timeout: Optional[float] = None) -> dict:
+        """Query the physics thread pool.
+
+        Returns:
+            Dict with ``num_threads``, ``partitioning``, ``hardware_threads``
+            and ``partition_count`` (partitions in the current scene).
+
+        Raises:
+            RuntimeError: If the engine could not report the config.
+        """
+        timeout = timeout or self.timeout
+        resp = self.scene.GetPhysicsThreading(
+            self.pb.scene.GetPhysicsThreadingRequest(),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"GetPhysicsThreading failed: {resp.message}")
+        return _physics_threading_to_dict(resp)
+
+    def set_rpc_qos(
+        self,
+        classes: Optional[Mapping[str, Mapping[str, int]]] = None,
+        method_classes: Optional[Mapping[str, str]] = None,
+        timeout: Optional[float] = None,
+    ) -> dict:
+        """Configure the engine's per-class RPC scheduling.
+
+        The gRPC host serves ``"control"`` RPCs (Step, SetControl,
+        SetActionGroup, ApplyRobotCommands, ...) from their own thread pool
+        ahead of ``"default"`` unary calls and ``"bulk"`` server streams
+        (cameras, viewport, full state, slot-state monitors), so attached
+        dashboards and recorders do not add Step jitter:
+
+            client.set_rpc_qos(
+                classes={"bulk": {"num_threads": 1, "max_bytes_per_second": 40_000_000}},
+                method_classes={"hazel.rpc.AgentService/StreamSynchronized": "control"},
+            )
+
+        Args:
+            classes: ``{class: settings}`` with any of ``num_threads``,
+                ``max_bytes_per_second``, ``max_messages_per_second`` and
+                ``max_queue_depth`` (0 = server default / unlimited). Classes
+                not listed are left as they are.
+            method_classes: ``{"package.Service/Method": class}`` overrides of
+                the server's method table.
+            timeout: RPC timeout in seconds.
+
+        Returns:
+            The effective config, see :meth:`get_rpc_qos`.
+
+        Raises:
+            ValueError: If a class or setting name is unknown.
+            RuntimeError: If the engine rejected the config.
+        """
+        timeout = timeout or self.timeout
+        resp = self.scene.SetRpcQos(
+            self.pb.scene.SetRpcQosRequest(config=_rpc_qos_config_pb(classes, method_classes)),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"SetRpcQos failed: {resp.message}")
+        return _rpc_qos_to_dict(resp)
+
+    def get_rpc_qos(self, timeout: Optional[float] = None) -> dict:
+        """Query the RPC scheduling config.
+
+        Returns:
+            Dict with ``classes`` (``{class: settings}`` for every class) and
+            ``method_classes`` (the full ``{method: class}`` table).
+
+        Raises:
+            RuntimeError: If the engine reported a failure.
+        """
+        timeout = timeout or self.timeout
+        resp = self.scene.GetRpcQos(self.pb.scene.GetRpcQosRequest(), timeout=timeout)
+        if not resp.success:
+            raise RuntimeError(f"GetRpcQos failed: {resp.message}")
+        return _rpc_qos_to_dict(resp)
+
+    def get_rpc_qos_metrics(self, reset: bool = False, timeout: Optional[float] = None) -> dict:
+        """Per-class queue depth, throughput and latency counters.
+
+        Args:
+            reset: Zero the counters and histograms after reading them, so the
+                next call covers a fresh window.
+            timeout: RPC timeout in seconds.
+
+        Returns:
+            Dict with ``window_s`` and ``classes``: ``{class: metrics}`` where
+            metrics has ``queue_depth`` / ``max_queue_depth``,
+            ``active_calls``, ``completed_calls``, ``messages_sent``,
+            ``bytes_sent``, ``throttled_messages``, ``dropped_messages`` and
+            the ``queue_wait_*`` / ``latency_*`` p50 / p99 (microseconds).
+        """
+        timeout = timeout or self.timeout
+        resp = self.scene.GetRpcQosMetrics(
+            self.pb.scene.GetRpcQosMetricsRequest(reset=reset),
+            timeout=timeout,
+        )
+        return _rpc_qos_metrics_to_dict(resp)
+
     def enter_play_mode(self, timeout: Optional[float] = None):
         """Trigger the editor's Edit -> Play transition over gRPC.
 
@@ -1235,7 +2666,11 @@ class LuckyEngineClient:
         )
 
     def get_scene_info(self, timeout: Optional[float] = None) -> dict:
-        """Return the active scene's name, path, and entity count."""
+        """Return the active scene's name, path, and entity count, plus the
+        engine's run mode, startup timing and resident memory.
+
+        Timing and memory fields are 0 on engines that don't report them.
+        """
         timeout = timeout or self.timeout
         resp = self.scene.GetSceneInfo(
             self.pb.scene.GetSceneInfoRequest(),
@@ -1245,6 +2680,13 @@ class LuckyEngineClient:
             "scene_name": resp.scene_name,
             "scene_path": resp.scene_path,
             "entity_count": resp.entity_count,
+            "headless": resp.headless,
+            "rendering_enabled": resp.rendering_enabled,
+            "startup_duration_ms": resp.startup_duration_ms,
+            "scene_load_duration_ms": resp.scene_load_duration_ms,
+            "scene_cache_hit": resp.scene_cache_hit,
+            "resident_memory_bytes": resp.resident_memory_bytes,
+            "peak_resident_memory_bytes": resp.peak_resident_memory_bytes,
         }
 
     def list_entities(
@@ -1383,17 +2825,40 @@ class LuckyEngineClient:
             "nu": s.nu,
         }
 
-    def stream_telemetry(self, target_fps: int = 30):
+    def stream_telemetry(
+        self,
+        target_fps: int = 30,
+        delta: bool = False,
+        keyframe_interval: int = 0,
+        epsilon: float = 0.0,
+        quantization_step: float = 0.0,
+    ):
         """Iterate over server-streamed :class:`TelemetryFrame` protos.
 
         Each frame carries ``timestamp_ms``, ``frame_number``,
         ``observation_qpos`` (full mjData qpos), and ``action_ctrl``
         (last-applied ctrl). Cancellation-safe — break out of the loop to
         terminate the stream.
+
+        With ``delta=True`` the engine sends only changed entries between
+        periodic keyframes and the return value is a
+        :class:`~luckyrobots.delta.TelemetryDeltaDecoder` yielding
+        :class:`~luckyrobots.delta.TelemetrySample` objects whose ``qpos`` /
+        ``ctrl`` arrays are rebuilt in reused buffers.
+
+        Args:
+            target_fps: Desired sampling rate.
+            delta: Enable change-only encoding.
+            keyframe_interval: Frames between keyframes (0 = server default).
+            epsilon: Changes at or below this magnitude are not sent.
+            quantization_step: Send changes as multiples of this step
+                (0 = float32 values).
         """
-        return self.telemetry.StreamTelemetry(
-            self.pb.telemetry.StreamTelemetryRequest(target_fps=target_fps),
-        )
+        req = self.pb.telemetry.StreamTelemetryRequest(target_fps=target_fps)
+        if not delta:
+            return self.bulk_stub("telemetry").StreamTelemetry(req)
+        req.delta.CopyFrom(delta_stream_options(keyframe_interval, epsilon, quantization_step))
+        return TelemetryDeltaDecoder(self.bulk_stub("telemetry").StreamTelemetry(req))
 
     # ── ViewportService RPCs ──
 
@@ -1426,6 +2891,10 @@ class LuckyEngineClient:
         width: int = 0,
         height: int = 0,
         format: str = "raw",
+        keyframe_interval: int = 0,
+        bitrate_kbps: int = 0,
+        require_hardware: bool = False,
+        decode: bool = False,
     ):
         """Iterate over server-streamed :class:`ImageFrame` protos for a viewport.
 
@@ -1434,17 +2903,234 @@ class LuckyEngineClient:
                 engine branch).
             target_fps: Desired frame rate; server may clamp.
             width / height: Desired resolution. ``0`` = native.
-            format: ``"raw"`` (RGBA bytes) or ``"jpeg"``.
+            format: ``"raw"`` (RGBA bytes), ``"jpeg"``, or a video codec
+                (``"h264"``, ``"hevc"``, ``"av1"``).
+            keyframe_interval: Frames between keyframes for video formats
+                (``0`` = server default).
+            bitrate_kbps: Target bitrate for video formats (``0`` = server default).
+            require_hardware: Fail rather than fall back to a software encoder.
+            decode: For video formats, yield decoded RGB :class:`CameraFrame`
+                objects via :class:`~luckyrobots.video.VideoStreamDecoder`
+                instead of encoded packets. Requires PyAV.
         """
-        return self.viewport.StreamViewport(
+        stream = self.bulk_stub("viewport").StreamViewport(
             self.pb.viewport.StartViewportStreamRequest(
                 viewport_name=viewport_name,
                 target_fps=target_fps,
                 width=width,
                 height=height,
                 format=format,
+                video=self._video_encoder_settings(
+                    keyframe_interval, bitrate_kbps, require_hardware
+                ),
             ),
         )
+        return self._maybe_decode_video(stream, format, decode, name=viewport_name)
+
+    # ── RecorderService RPCs ──
+
+    def start_recording(
+        self,
+        output_dir: str,
+        format: str = "lerobot",
+        columns: Optional[list[str]] = None,
+        cameras: Optional[list[dict]] = None,
+        every_n_steps: int = 1,
+        rows_per_file: int = 0,
+        max_buffer_bytes: int = 0,
+        overflow: str = "drop",
+        task: str = "",
+        timeout: Optional[float] = None,
+    ) -> dict:
+        """Start the engine-side dataset recorder.
+
+        Rows are sampled on the physics thread into a bounded ring and written
+        by a background I/O thread, so recording never goes through this
+        client and (with ``overflow="drop"``) never stalls physics. Episodes
+        split automatically on every reset / snapshot restore.
+
+        Args:
+            output_dir: Directory on the engine host (created if missing).
+            format: ``"lerobot"`` (LeRobot dataset layout) or ``"parquet_mp4"``
+                (one Parquet + one MP4 per camera per episode).
+            columns: Columns to write; ``None`` = all of ``qpos``, ``qvel``,
+                ``ctrl``, ``observation``, ``action``, ``reward_signals``,
+                ``terminated``, ``truncated``, ``frame_flags``.
+            cameras: Cameras to encode. Each dict has keys ``name`` plus
+                optional ``width`` / ``height`` (0 = native), ``codec``
+                (``"h264"``, ``"hevc"``, ``"av1"``), ``every_n_rows`` and
+                ``bitrate_kbps``.
+            every_n_steps: Record every Nth physics step.
+            rows_per_file: Rows per file before rolling over (0 = server default).
+            max_buffer_bytes: Recorder memory bound (0 = server default, 256 MiB).
+            overflow: ``"drop"`` (count and drop rows while the ring is full)
+                or ``"block"`` (lossless; stalls physics on slow disks).
+            task: Task description stored in the dataset metadata.
+            timeout: RPC timeout in seconds.
+
+        Returns:
+            Dict with ``recording_id`` and the resolved ``output_dir``.
+
+        Raises:
+            ValueError: If ``format`` or ``overflow`` is unknown.
+            RuntimeError: If the engine rejected the request (e.g. a recording
+                is already active).
+        """
+        timeout = timeout or self.timeout
+        try:
+            fmt = _RECORDING_FORMATS[format.lower()]
+        except KeyError:
+            raise ValueError(
+                f"Unknown recording format {format!r}; "
+                f"expected one of {sorted(_RECORDING_FORMATS)}"
+            ) from None
+        try:
+            policy = _RECORDING_OVERFLOW[overflow.lower()]
+        except KeyError:
+            raise ValueError(
+                f"Unknown overflow policy {overflow!r}; "
+                f"expected one of {sorted(_RECORDING_OVERFLOW)}"
+            ) from None
+        pb = self.pb.recorder
+        resp = self.recorder.StartRecording(
+            pb.StartRecordingRequest(
+                output_dir=output_dir,
+                format=fmt,
+                columns=list(columns or ()),
+                cameras=[
+                    pb.RecordingCamera(
+                        name=c["name"],
+                        width=c.get("width", 0),
+                        height=c.get("height", 0),
+                        codec=c.get("codec", ""),
+                        every_n_rows=c.get("every_n_rows", 0),
+                        bitrate_kbps=c.get("bitrate_kbps", 0),
+                    )
+                    for c in cameras or ()
+                ],
+                every_n_steps=every_n_steps,
+                rows_per_file=rows_per_file,
+                max_buffer_bytes=max_buffer_bytes,
+                overflow=policy,
+                task=task,
+            ),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"StartRecording failed: {resp.message}")
+        return {"recording_id": resp.recording_id, "output_dir": resp.output_dir}
+
+    def stop_recording(self, recording_id: str = "", timeout: Optional[float] = None) -> dict:
+        """Flush and finalize the recording; returns its final status.
+
+        The RPC returns only once every buffered row is on disk, so pass a
+        generous ``timeout`` when ``max_buffer_bytes`` is large.
+
+        Raises:
+            RuntimeError: If no such recording is active.
+        """
+        timeout = timeout or self.timeout
+        resp = self.recorder.StopRecording(
+            self.pb.recorder.StopRecordingRequest(recording_id=recording_id),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"StopRecording failed: {resp.message}")
+        return _recording_status_to_dict(resp.status)
+
+    def get_recording_status(
+        self, recording_id: str = "", timeout: Optional[float] = None
+    ) -> dict:
+        """Rows written / dropped, files, bytes and buffer fill of a recording."""
+        timeout = timeout or self.timeout
+        resp = self.recorder.GetRecordingStatus(
+            self.pb.recorder.GetRecordingStatusRequest(recording_id=recording_id),
+            timeout=timeout,
+        )
+        if not resp.success:
+            raise RuntimeError(f"GetRecordingStatus failed: {resp.message}")
+        return _recording_status_to_dict(resp.status)
+
+    def replay_command_log(
+        self,
+        commands: Iterable[tuple],
+        speed: float = 0.0,
+        schedule: str = "frame",
+        stop_on_error: bool = False,
+        chunk_size: int = 1024,
+        timeout: Optional[float] = None,
+    ) -> dict:
+        """Replay a recorded command log inside the engine in one RPC.
+
+        The engine applies each command at its recorded frame (or sim time)
+        and steps physics in between, so a long recording replays as fast as
+        physics allows instead of sleeping through thousands of timed calls.
+
+        Args:
+            commands: ``(timestamp_s, frame_number, rpc, request_bytes)``
+                tuples in log order; ``frame_number`` -1 = unknown. See
+                :meth:`SessionRecording.replay` / :meth:`RecordingLog.replay`
+                with ``fast_forward=True``.
+            speed: 0 = as fast as physics allows, otherwise a multiple of
+                real time.
+            schedule: ``"frame"`` (apply at the recorded frame_number) or
+                ``"time"`` (apply at the recorded sim time).
+            stop_on_error: Abort at the first rejected command.
+            chunk_size: Commands per streamed chunk.
+            timeout: RPC deadline covering the whole replay.
+
+        Returns:
+            Dict with ``commands_applied``, ``commands_skipped``, ``errors``
+            (list of ``(index, rpc, message)``), ``final_frame_number``,
+            ``sim_time`` and ``wall_duration_us``.
+
+        Raises:
+            ValueError: If ``schedule`` is unknown or ``speed`` is negative.
+            RuntimeError: If the engine aborted the replay.
+        """
+        timeout = timeout or self.timeout
+        try:
+            mode = _REPLAY_SCHEDULES[schedule.lower()]
+        except KeyError:
+            raise ValueError(
+                f"Unknown replay schedule {schedule!r}; expected one of {sorted(_REPLAY_SCHEDULES)}"
+            ) from None
+        if speed < 0:
+            raise ValueError(f"speed must be >= 0, got {speed}")
+        if chunk_size < 1:
+            raise ValueError(f"chunk_size must be >= 1, got {chunk_size}")
+        pb = self.pb.recorder
+
+        def chunks():
+            chunk = pb.ReplayCommandChunk(
+                options=pb.ReplayOptions(
+                    schedule=mode, speed=speed, stop_on_error=stop_on_error
+                )
+            )
+            for timestamp_s, frame_number, rpc, request in commands:
+                chunk.commands.add(
+                    timestamp_s=timestamp_s,
+                    frame_number=frame_number,
+                    rpc=rpc,
+                    request=bytes(request),
+                )
+                if len(chunk.commands) >= chunk_size:
+                    yield chunk
+                    chunk = pb.ReplayCommandChunk()
+            if len(chunk.commands) or chunk.HasField("options"):
+                yield chunk
+
+        resp = self.recorder.ReplayCommandLog(chunks(), timeout=timeout)
+        if not resp.success:
+            raise RuntimeError(f"ReplayCommandLog failed: {resp.message}")
+        return {
+            "commands_applied": resp.commands_applied,
+            "commands_skipped": resp.commands_skipped,
+            "errors": [(e.index, e.rpc, e.message) for e in resp.errors],
+            "final_frame_number": resp.final_frame_number,
+            "sim_time": resp.sim_time,
+            "wall_duration_us": resp.wall_duration_us,
+        }
 
     # ── CameraService streaming ──
 
@@ -1456,15 +3142,21 @@ class LuckyEngineClient:
         width: int = 0,
         height: int = 0,
         format: str = "raw",
+        keyframe_interval: int = 0,
+        bitrate_kbps: int = 0,
+        require_hardware: bool = False,
+        decode: bool = False,
     ):
         """Iterate over server-streamed :class:`ImageFrame` protos for a camera.
 
         Identify by name (camera entity tag) or by numeric entity id. For
         synchronous in-step capture use :meth:`configure_cameras` plus
-        :meth:`step` instead.
+        :meth:`step` instead. The video options behave as in
+        :meth:`stream_viewport`.
         """
         if (name is None) == (entity_id is None):
             raise ValueError("Pass exactly one of `name` or `entity_id`.")
+        video = self._video_encoder_settings(keyframe_interval, bitrate_kbps, require_hardware)
         if entity_id is not None:
             req = self.pb.camera.StreamCameraRequest(
                 id=self.pb.common.EntityId(id=entity_id),
@@ -1472,6 +3164,7 @@ class LuckyEngineClient:
                 width=width,
                 height=height,
                 format=format,
+                video=video,
             )
         else:
             req = self.pb.camera.StreamCameraRequest(
@@ -1480,8 +3173,63 @@ class LuckyEngineClient:
                 width=width,
                 height=height,
                 format=format,
+                video=video,
             )
-        return self.camera.StreamCamera(req)
+        stream = self.bulk_stub("camera").StreamCamera(req)
+        return self._maybe_decode_video(
+            stream, format, decode, name=name if name is not None else str(entity_id)
+        )
+
+    def stream_synchronized(
+        self,
+        sources: Mapping[str, Any],
+        decimation: int = 1,
+        max_in_flight: int = 1,
+    ):
+        """Stream several sources captured at the same physics tick.
+
+        One ``StreamSynchronized`` call replaces N independent server-streams:
+        every ``decimation`` physics ticks the engine captures each source at
+        the same frame_number and sends them as one message. Frames the client
+        is too slow to read are skipped at the source (gRPC flow control, with
+        ``max_in_flight`` frames of slack) and counted rather than produced
+        and dropped.
+
+        Args:
+            sources: ``{name: source}`` built with
+                :func:`~luckyrobots.streams.camera_source`,
+                :func:`~luckyrobots.streams.full_state_source` or
+                :func:`~luckyrobots.streams.robot_controller_source`.
+            decimation: Physics ticks between frames.
+            max_in_flight: Frames the engine may buffer ahead of the client.
+
+        Returns:
+            A :class:`~luckyrobots.streams.SynchronizedStream` yielding
+            :class:`~luckyrobots.streams.SyncFrame` objects.
+        """
+        from .streams import SynchronizedStream, build_synchronized_request
+
+        req = build_synchronized_request(sources, decimation, max_in_flight)
+        return SynchronizedStream(self.bulk_stub("agent").StreamSynchronized(req))
+
+    def _video_encoder_settings(
+        self, keyframe_interval: int, bitrate_kbps: int, require_hardware: bool
+    ):
+        if keyframe_interval < 0 or bitrate_kbps < 0:
+            raise ValueError("keyframe_interval and bitrate_kbps must be >= 0")
+        return self.pb.media.VideoEncoderSettings(
+            keyframe_interval=keyframe_interval,
+            bitrate_kbps=bitrate_kbps,
+            require_hardware=require_hardware,
+        )
+
+    @staticmethod
+    def _maybe_decode_video(stream, format: str, decode: bool, name: str):
+        if not decode:
+            return stream
+        if not is_video_format(format):
+            raise ValueError(f"decode=True needs a video format (h264/hevc/av1), got {format!r}")
+        return VideoStreamDecoder(stream, codec=format, name=name)
 
     # ── MujocoService streaming ──
 
@@ -1496,7 +3244,7 @@ class LuckyEngineClient:
         streaming use :meth:`stream_full_state` on the MujocoScene wrapper.
         """
         robot = robot_name if robot_name is not None else (self._robot_name or "")
-        return self.mujoco.StreamJointState(
+        return self.bulk_stub("mujoco").StreamJointState(
             self.pb.mujoco.GetJointStateRequest(robot_name=robot),
         )
 
@@ -1507,6 +3255,9 @@ class LuckyEngineClient:
         duration_seconds: float = 5.0,
         method: str = "step",
         print_results: bool = False,
+        actions: Optional[list[float]] = None,
+        profile: bool = False,
+        trace_path: Optional[str] = None,
     ) -> BenchmarkResult:
         """Benchmark a client method by calling it in a tight loop.
 
@@ -1514,6 +3265,12 @@ class LuckyEngineClient:
             duration_seconds: How long to run the benchmark.
             method: Method to benchmark. Currently supports "step".
             print_results: Print results to stdout.
+            actions: Action vector sent every step. Default: zeros sized from
+                the agent schema.
+            profile: Request per-stage engine timings on every step and
+                aggregate them into ``BenchmarkResult.stages``.
+            trace_path: Write a Chrome trace of the run to this file (see
+                :meth:`BenchmarkResult.to_chrome_trace`).
 
         Returns:
             BenchmarkResult with timing statistics.
@@ -1522,24 +3279,35 @@ class LuckyEngineClient:
             ValueError: If method is not recognized.
         """
         if method == "step":
-            # Use zero actions for benchmarking
-            call_fn = lambda: self.step(actions=[0.0] * 12)
+            if actions is None:
+                _, action_names = self._schema_cache.get("agent_0", (None, None))
+                if action_names:
+                    action_size = len(action_names)
+                else:
+                    action_size = self.get_agent_schema().schema.action_size
+                actions = [0.0] * action_size
+            call_fn = lambda: self.step(actions=actions, profile=profile)
         else:
             raise ValueError(
                 f"Unknown method '{method}'. Supported: 'step'"
             )
 
-        latencies: list[float] = []
+        samples: list[StepSample] = []
         start = time.perf_counter()
         deadline = start + duration_seconds
 
         while time.perf_counter() < deadline:
             t0 = time.perf_counter()
-            call_fn()
+            obs = call_fn()
             t1 = time.perf_counter()
-            latencies.append((t1 - t0) * 1000.0)  # ms
+            samples.append(StepSample(
+                start_us=t0 * 1e6,
+                latency_us=(t1 - t0) * 1e6,
+                profile=getattr(obs, "step_profile", None),
+            ))
 
         elapsed = time.perf_counter() - start
+        latencies = [s.latency_us / 1000.0 for s in samples]  # ms
         count = len(latencies)
 
         if count == 0:
@@ -1571,6 +3339,8 @@ class LuckyEngineClient:
                 std_latency_ms=statistics.stdev(latencies) if count > 1 else 0.0,
                 p50_latency_ms=sorted_lat[p50_idx],
                 p99_latency_ms=sorted_lat[p99_idx],
+                stages=stage_histograms(samples),
+                samples=samples,
             )
 
         if print_results:
@@ -1583,5 +3353,12 @@ class LuckyEngineClient:
             print(f"  Std:    {result.std_latency_ms:.2f} ms")
             print(f"  P50:    {result.p50_latency_ms:.2f} ms")
             print(f"  P99:    {result.p99_latency_ms:.2f} ms")
+            if result.stages:
+                print("  Stages (us):          p50      p99      max")
+                for name, h in result.stages.items():
+                    print(f"    {name:<18} {h.p50_us:>8.0f} {h.p99_us:>8.0f} {h.max_us:>8.0f}")
+
+        if trace_path is not None:
+            result.to_chrome_trace(trace_path)
 
         return result
@@ -1,5 +1,6 @@
 """Engine lifecycle management for LuckyEngine."""
 
+from luckyrobots.engine.manager import EngineProcess as EngineProcess
 from luckyrobots.engine.manager import (
     find_luckyengine_executable as find_luckyengine_executable,
 )
@@ -28,16 +28,29 @@ class EngineProcess:
 
     Encapsulates process state that was previously held in module globals.
     A default instance is created at module level for backwards compatibility.
+
+    Args:
+        grpc_port: Scope the instance to one engine on this port, so several
+            can run side by side (see ``EnginePool``). It gets its own lock
+            file (``luckyengine_lock_<port>``), and ``stop()`` only kills its
+            own process. ``None`` keeps the single-engine behaviour: the
+            shared ``LOCK_FILE``, with a kill-all fallback on stop.
     """
 
-    def __init__(self) -> None:
+    def __init__(self, grpc_port: Optional[int] = None) -> None:
         self._process: Optional[subprocess.Popen] = None
         self._monitor_thread: Optional[threading.Thread] = None
         self._shutdown_event = threading.Event()
+        self.grpc_port = grpc_port
+        self.lock_file = LOCK_FILE if grpc_port is None else f"{LOCK_FILE}_{grpc_port}"
 
     def is_running(self) -> bool:
         """Check if LuckyEngine is currently running."""
-        return os.path.exists(LOCK_FILE)
+        return os.path.exists(self.lock_file)
+
+    def is_alive(self) -> bool:
+        """True while the process this instance launched has not exited."""
+        return self._process is not None and self._process.poll() is None
 
     def get_stderr(self) -> Optional[str]:
         """Get stderr output from the engine process (if captured)."""
@@ -58,8 +71,9 @@ class EngineProcess:
         windowed: bool = True,
         verbose: bool = False,
         auto_play: bool = True,
-        grpc_port: int = 50051,
+        grpc_port: Optional[int] = None,
         sim_mode: str = "realtime",
+        scene_cache: Optional[str] = None,
     ) -> bool:
         """Launch LuckyEngine with the specified parameters.
 
@@ -68,21 +82,30 @@ class EngineProcess:
             robot: Robot name to spawn.
             task: Optional task name.
             executable_path: Path to executable (auto-detected if None).
-            headless: Run without rendering.
+            headless: Run as a render-free training worker: no window,
+                renderer, editor UI or asset thumbnails. Camera RPCs are
+                unavailable in this mode.
             windowed: Run in windowed mode (vs fullscreen).
             verbose: Show engine output.
             auto_play: Automatically enter Play mode and start gRPC.
-            grpc_port: Port for the gRPC server.
+            grpc_port: Port for the gRPC server (default: the instance's
+                ``grpc_port``, else 50051).
             sim_mode: Simulation time mode (realtime, deterministic, fast).
+            scene_cache: Directory of precooked binary scenes. Scenes found
+                there load without parsing or compiling source assets; misses
+                are cooked into it on first load so later workers hit.
 
         Returns:
             True if launch succeeded, False otherwise.
         """
+        if grpc_port is None:
+            grpc_port = self.grpc_port if self.grpc_port is not None else 50051
+
         if self.is_running():
             logger.error(
                 "LuckyEngine is already running. "
                 "Stop the existing instance or remove the lock file at "
-                f"{LOCK_FILE}"
+                f"{self.lock_file}"
             )
             return False
 
@@ -128,6 +151,12 @@ class EngineProcess:
 
             if headless:
                 command.append("-Headless")
+                command.append("--no-render=1")
+                command.append("--no-editor-ui=1")
+                command.append("--no-thumbnails=1")
+
+            if scene_cache:
+                command.append(f"--scene-cache={os.path.abspath(scene_cache)}")
 
             logger.info(f"Command: {' '.join(command)}")
 
@@ -159,10 +188,12 @@ class EngineProcess:
             )
             self._monitor_thread.start()
 
-            _create_lock_file(self._process.pid)
+            _create_lock_file(self._process.pid, self.lock_file)
 
             logger.info(f"LuckyEngine started successfully (PID: {self._process.pid})")
             logger.info(f"Scene: {scene}, Robot: {robot}, Task: {task or 'None'}")
+            if headless:
+                logger.info("Headless mode: rendering and editor UI disabled")
 
             return True
 
@@ -193,9 +224,13 @@ class EngineProcess:
                 except Exception:
                     logger.info("Graceful termination failed, using kill_processes...")
 
-                _kill_processes()
+                if self.grpc_port is None:
+                    _kill_processes()
+                elif self._process.poll() is None:
+                    # Pool worker: never touch the other engines.
+                    self._process.kill()
 
-            _remove_lock_file()
+            _remove_lock_file(self.lock_file)
             return True
         except Exception as e:
             logger.error(f"Error stopping LuckyEngine: {e}")
@@ -213,7 +248,7 @@ class EngineProcess:
             logger.error(f"Error in process monitor: {e}")
         finally:
             if not self._shutdown_event.is_set():
-                _remove_lock_file()
+                _remove_lock_file(self.lock_file)
 
 
 # ============================================================================
@@ -330,17 +365,17 @@ def _get_system_paths(is_wsl: bool) -> list[str]:
     return paths
 
 
-def _create_lock_file(pid: int) -> None:
+def _create_lock_file(pid: int, path: str = LOCK_FILE) -> None:
     """Create a lock file with the process ID."""
-    with open(LOCK_FILE, "w") as f:
+    with open(path, "w") as f:
         f.write(str(pid))
 
 
-def _remove_lock_file() -> None:
+def _remove_lock_file(path: str = LOCK_FILE) -> None:
     """Remove the lock file."""
     try:
-        if os.path.exists(LOCK_FILE):
-            os.remove(LOCK_FILE)
+        if os.path.exists(path):
+            os.remove(path)
             logger.debug("Lock file removed successfully")
         else:
             logger.debug("Lock file doesn't exist, nothing to remove")
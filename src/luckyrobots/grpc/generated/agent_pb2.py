@@ -22,13 +22,15 @@ _runtime_version.ValidateProtobufRuntimeVersion(
 _sym_db = _symbol_database.Default()
 
 
+from . import camera_pb2 as camera__pb2
 from . import common_pb2 as common__pb2
 from . import media_pb2 as media__pb2
 from . import mujoco_pb2 as mujoco__pb2
+from . import mujoco_scene_pb2 as mujoco__scene__pb2
 from . import telemetry_pb2 as telemetry__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0b\x61gent.proto\x12\thazel.rpc\x1a\x0c\x63ommon.proto\x1a\x0bmedia.proto\x1a\x0cmujoco.proto\x1a\x0ftelemetry.proto\"\x81\x01\n\x0b\x41gentSchema\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12\x19\n\x11observation_names\x18\x02 \x03(\t\x12\x14\n\x0c\x61\x63tion_names\x18\x03 \x03(\t\x12\x18\n\x10observation_size\x18\x04 \x01(\r\x12\x13\n\x0b\x61\x63tion_size\x18\x05 \x01(\r\"+\n\x15GetAgentSchemaRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\"@\n\x16GetAgentSchemaResponse\x12&\n\x06schema\x18\x01 \x01(\x0b\x32\x16.hazel.rpc.AgentSchema\"\xc8\x04\n\x12SimulationContract\x12\x1b\n\x13pose_position_noise\x18\x01 \x03(\x02\x12\x1e\n\x16pose_orientation_noise\x18\x02 \x01(\x02\x12\x1c\n\x14joint_position_noise\x18\x03 \x01(\x02\x12\x1c\n\x14joint_velocity_noise\x18\x04 \x01(\x02\x12\x16\n\x0e\x66riction_range\x18\x05 \x03(\x02\x12\x19\n\x11restitution_range\x18\x06 \x03(\x02\x12\x18\n\x10mass_scale_range\x18\x07 \x03(\x02\x12\x18\n\x10\x63om_offset_range\x18\x08 \x03(\x02\x12\x1c\n\x14motor_strength_range\x18\t \x03(\x02\x12\x1a\n\x12motor_offset_range\x18\n \x03(\x02\x12\x1b\n\x13push_interval_range\x18\x0b \x03(\x02\x12\x1b\n\x13push_velocity_range\x18\x0c \x03(\x02\x12\x14\n\x0cterrain_type\x18\r \x01(\t\x12\x1a\n\x12terrain_difficulty\x18\x0e \x01(\x02\x12\x1b\n\x13vel_command_x_range\x18\x0f \x03(\x02\x12\x1b\n\x13vel_command_y_range\x18\x10 \x03(\x02\x12\x1d\n\x15vel_command_yaw_range\x18\x11 \x03(\x02\x12)\n!vel_command_resampling_time_range\x18\x12 \x03(\x02\x12(\n vel_command_standing_probability\x18\x13 \x01(\x02\"c\n\x11ResetAgentRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12:\n\x13simulation_contract\x18\x02 \x01(\x0b\x32\x1d.hazel.rpc.SimulationContract\"6\n\x12ResetAgentResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"\x87\x01\n\nAgentFrame\x12\x14\n\x0ctimestamp_ms\x18\x01 \x01(\x04\x12\x14\n\x0c\x66rame_number\x18\x02 \x01(\r\x12\x14\n\x0cobservations\x18\x03 \x03(\x02\x12\x0f\n\x07\x61\x63tions\x18\x04 \x03(\x02\x12\x12\n\nagent_name\x18\x05 \x01(\t\x12\x12\n\ntarget_fps\x18\x06 \x01(\r\"\x87\x01\n\x15GetCameraFrameRequest\x12!\n\x02id\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityIdH\x00\x12\x0e\n\x04name\x18\x02 \x01(\tH\x00\x12\r\n\x05width\x18\x03 \x01(\r\x12\x0e\n\x06height\x18\x04 \x01(\r\x12\x0e\n\x06\x66ormat\x18\x05 \x01(\tB\x0c\n\nidentifier\"_\n\x17GetViewportFrameRequest\x12\x15\n\rviewport_name\x18\x01 \x01(\t\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x0e\n\x06\x66ormat\x18\x04 \x01(\t\"O\n\x10\x41\x63tionGroupEntry\x12\x12\n\ngroup_name\x18\x01 \x01(\t\x12\x0f\n\x07\x61\x63tions\x18\x02 \x03(\x02\x12\x16\n\x0e\x61\x63tion_indices\x18\x03 \x03(\x05\"W\n\x15SetActionGroupRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12*\n\x05group\x18\x02 \x01(\x0b\x32\x1b.hazel.rpc.ActionGroupEntry\":\n\x16SetActionGroupResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"\xb4\x01\n\x0bStepRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12\x0f\n\x07\x61\x63tions\x18\x02 \x03(\x02\x12\x11\n\ttimeout_s\x18\x03 \x01(\x02\x12\x39\n\x0f\x63\x61mera_requests\x18\x04 \x03(\x0b\x32 .hazel.rpc.GetCameraFrameRequest\x12\x32\n\raction_groups\x18\x05 \x03(\x0b\x32\x1b.hazel.rpc.ActionGroupEntry\"\xb3\x04\n\x0cStepResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12*\n\x0bobservation\x18\x03 \x01(\x0b\x32\x15.hazel.rpc.AgentFrame\x12 \n\x18physics_step_duration_us\x18\x04 \x01(\x04\x12\x31\n\rcamera_frames\x18\x05 \x03(\x0b\x32\x1a.hazel.rpc.NamedImageFrame\x12\x42\n\x0ereward_signals\x18\x06 \x03(\x0b\x32*.hazel.rpc.StepResponse.RewardSignalsEntry\x12\x12\n\nterminated\x18\x07 \x01(\x08\x12\x11\n\ttruncated\x18\x08 \x01(\x08\x12/\n\x04info\x18\t \x03(\x0b\x32!.hazel.rpc.StepResponse.InfoEntry\x12H\n\x11termination_flags\x18\n \x03(\x0b\x32-.hazel.rpc.StepResponse.TerminationFlagsEntry\x1a\x34\n\x12RewardSignalsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x02:\x02\x38\x01\x1a+\n\tInfoEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x02:\x02\x38\x01\x1a\x37\n\x15TerminationFlagsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x08:\x02\x38\x01\"\xeb\x01\n\x0eProgressReport\x12\x0e\n\x06run_id\x18\x01 \x01(\t\x12\x11\n\ttask_name\x18\x02 \x01(\t\x12\x13\n\x0bpolicy_name\x18\x03 \x01(\t\x12\r\n\x05phase\x18\x04 \x01(\t\x12\x17\n\x0f\x63urrent_episode\x18\x05 \x01(\x05\x12\x16\n\x0etotal_episodes\x18\x06 \x01(\x05\x12\x14\n\x0c\x63urrent_step\x18\x07 \x01(\x05\x12\x11\n\tmax_steps\x18\x08 \x01(\x05\x12\x11\n\telapsed_s\x18\t \x01(\x02\x12\x13\n\x0bstatus_text\x18\n \x01(\t\x12\x10\n\x08\x66inished\x18\x0b \x01(\x08\"\x1f\n\x0bProgressAck\x12\x10\n\x08\x61\x63\x63\x65pted\x18\x01 \x01(\x08\"\xf3\x02\n\x0cTaskContract\x12\x0f\n\x07task_id\x18\x01 \x01(\t\x12\r\n\x05robot\x18\x02 \x01(\t\x12\r\n\x05scene\x18\x03 \x01(\t\x12\x34\n\x0cobservations\x18\x04 \x01(\x0b\x32\x1e.hazel.rpc.ObservationContract\x12*\n\x07\x61\x63tions\x18\x05 \x01(\x0b\x32\x19.hazel.rpc.ActionContract\x12*\n\x07rewards\x18\x06 \x01(\x0b\x32\x19.hazel.rpc.RewardContract\x12\x34\n\x0cterminations\x18\x07 \x01(\x0b\x32\x1e.hazel.rpc.TerminationContract\x12\x37\n\rrandomization\x18\x08 \x01(\x0b\x32 .hazel.rpc.RandomizationContract\x12\x37\n\x0e\x61uxiliary_data\x18\t \x03(\x0b\x32\x1f.hazel.rpc.AuxiliaryDataRequest\"\x7f\n\x13ObservationContract\x12\x33\n\x08required\x18\x01 \x03(\x0b\x32!.hazel.rpc.ObservationTermRequest\x12\x33\n\x08optional\x18\x02 \x03(\x0b\x32!.hazel.rpc.ObservationTermRequest\"\xa3\x01\n\x16ObservationTermRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12=\n\x06params\x18\x02 \x03(\x0b\x32-.hazel.rpc.ObservationTermRequest.ParamsEntry\x12\r\n\x05group\x18\x03 \x01(\t\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"=\n\x0e\x41\x63tionContract\x12+\n\x05terms\x18\x01 \x03(\x0b\x32\x1c.hazel.rpc.ActionTermRequest\"\xb0\x01\n\x11\x41\x63tionTermRequest\x12\x0c\n\x04type\x18\x01 \x01(\t\x12\x15\n\rjoint_pattern\x18\x02 \x01(\t\x12\x38\n\x06params\x18\x03 \x03(\x0b\x32(.hazel.rpc.ActionTermRequest.ParamsEntry\x12\r\n\x05group\x18\x04 \x01(\t\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"Z\n\x0eRewardContract\x12\x32\n\x0c\x65ngine_terms\x18\x01 \x03(\x0b\x32\x1c.hazel.rpc.RewardTermRequest\x12\x14\n\x0cpython_terms\x18\x02 \x03(\t\"\x9a\x01\n\x11RewardTermRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06weight\x18\x02 \x01(\x02\x12\x38\n\x06params\x18\x03 \x03(\x0b\x32(.hazel.rpc.RewardTermRequest.ParamsEntry\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"G\n\x13TerminationContract\x12\x30\n\x05terms\x18\x01 \x03(\x0b\x32!.hazel.rpc.TerminationTermRequest\"\xa8\x01\n\x16TerminationTermRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x12\n\nis_timeout\x18\x02 \x01(\x08\x12=\n\x06params\x18\x03 \x03(\x0b\x32-.hazel.rpc.TerminationTermRequest.ParamsEntry\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"y\n\x15RandomizationContract\x12!\n\x19simulation_contract_bytes\x18\x01 \x01(\x0c\x12=\n\x15\x63ustom_randomizations\x18\x02 \x03(\x0b\x32\x1e.hazel.rpc.CustomRandomization\"Y\n\x13\x43ustomRandomization\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x11\n\trange_min\x18\x02 \x01(\x02\x12\x11\n\trange_max\x18\x03 \x01(\x02\x12\x0e\n\x06target\x18\x04 \x01(\t\"\x90\x01\n\x14\x41uxiliaryDataRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12;\n\x06params\x18\x02 \x03(\x0b\x32+.hazel.rpc.AuxiliaryDataRequest.ParamsEntry\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\xcd\x03\n\x18\x45ngineCapabilityManifest\x12\x16\n\x0e\x65ngine_version\x18\x01 \x01(\t\x12\x18\n\x10manifest_version\x18\x02 \x01(\x05\x12\x37\n\x0cobservations\x18\x03 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12\x32\n\x07\x61\x63tions\x18\x04 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12\x32\n\x07rewards\x18\x05 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12\x37\n\x0cterminations\x18\x06 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12=\n\x0erandomizations\x18\x07 \x03(\x0b\x32%.hazel.rpc.MdpRandomizationDescriptor\x12\x39\n\x0e\x61uxiliary_data\x18\x08 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12+\n\nrobot_info\x18\t \x01(\x0b\x32\x17.hazel.rpc.MdpRobotInfo\"\xaa\x02\n\x16MdpComponentDescriptor\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x13\n\x0b\x64\x65scription\x18\x02 \x01(\t\x12\x10\n\x08\x63\x61tegory\x18\x03 \x01(\t\x12J\n\rparams_schema\x18\x04 \x03(\x0b\x32\x33.hazel.rpc.MdpComponentDescriptor.ParamsSchemaEntry\x12\x14\n\x0coutput_shape\x18\x05 \x03(\x05\x12\x10\n\x08requires\x18\x06 \x03(\t\x12\x13\n\x0brobot_types\x18\x07 \x03(\t\x1aR\n\x11ParamsSchemaEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12,\n\x05value\x18\x02 \x01(\x0b\x32\x1d.hazel.rpc.MdpParamDescriptor:\x02\x38\x01\"\x87\x01\n\x12MdpParamDescriptor\x12\x0c\n\x04type\x18\x01 \x01(\t\x12\x15\n\rdefault_value\x18\x02 \x01(\t\x12\x13\n\x0b\x64\x65scription\x18\x03 \x01(\t\x12\x11\n\trange_min\x18\x04 \x01(\x02\x12\x11\n\trange_max\x18\x05 \x01(\x02\x12\x11\n\thas_range\x18\x06 \x01(\x08\"\x9a\x01\n\x1aMdpRandomizationDescriptor\x12/\n\x04\x62\x61se\x18\x01 \x01(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12\x19\n\x11\x64\x65\x66\x61ult_range_min\x18\x02 \x01(\x02\x12\x19\n\x11\x64\x65\x66\x61ult_range_max\x18\x03 \x01(\x02\x12\x15\n\rengine_target\x18\x04 \x01(\t\"\xd7\x01\n\x0cMdpRobotInfo\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x13\n\x0bjoint_names\x18\x02 \x03(\t\x12\x16\n\x0e\x61\x63tuator_names\x18\x03 \x03(\t\x12\x34\n\x0f\x61\x63tuator_limits\x18\x04 \x03(\x0b\x32\x1b.hazel.rpc.MdpActuatorLimit\x12\x12\n\nbody_names\x18\x05 \x03(\t\x12\x12\n\nsite_names\x18\x06 \x03(\t\x12\x14\n\x0csensor_names\x18\x07 \x03(\t\x12\x18\n\x10\x61vailable_scenes\x18\x08 \x03(\t\"V\n\x10MdpActuatorLimit\x12\r\n\x05lower\x18\x01 \x01(\x02\x12\r\n\x05upper\x18\x02 \x01(\x02\x12\x15\n\rdefault_value\x18\x03 \x01(\x02\x12\r\n\x05scale\x18\x04 \x01(\x02\"\x8a\x02\n\x18\x43ontractValidationResult\x12\x10\n\x08is_valid\x18\x01 \x01(\x08\x12\x34\n\x13negotiated_contract\x18\x02 \x01(\x0b\x32\x17.hazel.rpc.TaskContract\x12\x34\n\x06\x65rrors\x18\x03 \x03(\x0b\x32$.hazel.rpc.ContractValidationMessage\x12\x36\n\x08warnings\x18\x04 \x03(\x0b\x32$.hazel.rpc.ContractValidationMessage\x12\x1a\n\x12resolved_optionals\x18\x05 \x03(\t\x12\x1c\n\x14unresolved_optionals\x18\x06 \x03(\t\"x\n\x19\x43ontractValidationMessage\x12\x10\n\x08severity\x18\x01 \x01(\t\x12\x11\n\tcomponent\x18\x02 \x01(\t\x12\x11\n\tterm_name\x18\x03 \x01(\t\x12\x0f\n\x07message\x18\x04 \x01(\t\x12\x12\n\nsuggestion\x18\x05 \x01(\t\"\xfb\x01\n\x15NegotiatedTaskSession\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12\x32\n\x11resolved_contract\x18\x02 \x01(\x0b\x32\x17.hazel.rpc.TaskContract\x12\x36\n\x12observation_layout\x18\x03 \x03(\x0b\x32\x1a.hazel.rpc.ObservationSlot\x12\x14\n\x0creward_terms\x18\x04 \x03(\t\x12\x19\n\x11termination_terms\x18\x05 \x03(\t\x12\x31\n\raction_layout\x18\x06 \x03(\x0b\x32\x1a.hazel.rpc.ActionGroupSlot\"L\n\x0fObservationSlot\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05group\x18\x02 \x01(\t\x12\x0e\n\x06offset\x18\x03 \x01(\x05\x12\x0c\n\x04size\x18\x04 \x01(\x05\"S\n\x0f\x41\x63tionGroupSlot\x12\x12\n\ngroup_name\x18\x01 \x01(\t\x12\x14\n\x0c\x61\x63tion_names\x18\x02 \x03(\t\x12\x16\n\x0e\x61\x63tion_indices\x18\x03 \x03(\x05\"A\n\x1cGetCapabilityManifestRequest\x12\x12\n\nrobot_name\x18\x01 \x01(\t\x12\r\n\x05scene\x18\x02 \x01(\t\"V\n\x1dGetCapabilityManifestResponse\x12\x35\n\x08manifest\x18\x01 \x01(\x0b\x32#.hazel.rpc.EngineCapabilityManifest\"H\n\x1bValidateTaskContractRequest\x12)\n\x08\x63ontract\x18\x01 \x01(\x0b\x32\x17.hazel.rpc.TaskContract\"S\n\x1cValidateTaskContractResponse\x12\x33\n\x06result\x18\x01 \x01(\x0b\x32#.hazel.rpc.ContractValidationResult\"A\n\x14NegotiateTaskRequest\x12)\n\x08\x63ontract\x18\x01 \x01(\x0b\x32\x17.hazel.rpc.TaskContract\"\xa5\x01\n\x15NegotiateTaskResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x31\n\x07session\x18\x03 \x01(\x0b\x32 .hazel.rpc.NegotiatedTaskSession\x12\x37\n\nvalidation\x18\x04 \x01(\x0b\x32#.hazel.rpc.ContractValidationResult\"\\\n\x14PolicyCommandIdEntry\x12\n\n\x02id\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\x12*\n\x04type\x18\x03 \x01(\x0e\x32\x1c.hazel.rpc.PolicyCommandType\"B\n\x16PolicyObservationField\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04type\x18\x02 \x01(\t\x12\x0c\n\x04size\x18\x03 \x01(\r\"\xb2\x02\n\x11PolicySlotSummary\x12\x0f\n\x07slot_id\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x17\n\x0f\x64\x65scriptor_path\x18\x03 \x01(\t\x12\x0e\n\x06\x61\x63tive\x18\x04 \x01(\x08\x12\x10\n\x08priority\x18\x05 \x01(\x05\x12\x15\n\rdriven_joints\x18\x06 \x03(\t\x12.\n&clamp_observation_for_unclaimed_joints\x18\x07 \x01(\x08\x12\r\n\x05ready\x18\x08 \x01(\x08\x12\x18\n\x10\x61\x63tive_policy_id\x18\t \x01(\t\x12\x37\n\x0e\x63ommand_id_map\x18\n \x03(\x0b\x32\x1f.hazel.rpc.PolicyCommandIdEntry\x12\x1a\n\x12policy_joint_names\x18\x0b \x03(\t\"\x9c\x01\n\x16RobotControllerSummary\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x13\n\x0b\x65ntity_name\x18\x02 \x01(\t\x12\x1b\n\x13motion_graph_active\x18\x03 \x01(\x08\x12+\n\x05slots\x18\x04 \x03(\x0b\x32\x1c.hazel.rpc.PolicySlotSummary\"\xe7\x02\n\x13PolicyRegistryEntry\x12\x11\n\tpolicy_id\x18\x01 \x01(\t\x12\x17\n\x0f\x64\x65scriptor_path\x18\x02 \x01(\t\x12\x0e\n\x06joints\x18\x03 \x03(\t\x12\x37\n\x0e\x63ommand_id_map\x18\x04 \x03(\x0b\x32\x1f.hazel.rpc.PolicyCommandIdEntry\x12;\n\x10observation_spec\x18\x05 \x03(\x0b\x32!.hazel.rpc.PolicyObservationField\x12\x1a\n\x12\x66reeze_joint_names\x18\x06 \x03(\t\x12K\n\x0f\x63ommand_aliases\x18\x07 \x03(\x0b\x32\x32.hazel.rpc.PolicyRegistryEntry.CommandAliasesEntry\x1a\x35\n\x13\x43ommandAliasesEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\x94\x01\n\x15MotionGraphInputValue\x12\x12\n\x08\x62ool_val\x18\x01 \x01(\x08H\x00\x12\x11\n\x07int_val\x18\x02 \x01(\x05H\x00\x12\x13\n\tfloat_val\x18\x03 \x01(\x02H\x00\x12#\n\x08vec3_val\x18\x04 \x01(\x0b\x32\x0f.hazel.rpc.Vec3H\x00\x12\x11\n\x07trigger\x18\x05 \x01(\x08H\x00\x42\x07\n\x05value\"6\n\x12PolicyOperationAck\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"\x1d\n\x1bListRobotControllersRequest\"V\n\x1cListRobotControllersResponse\x12\x36\n\x0b\x63ontrollers\x18\x01 \x03(\x0b\x32!.hazel.rpc.RobotControllerSummary\"@\n\x19GetRobotControllerRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\"b\n\x1aGetRobotControllerResponse\x12\r\n\x05\x66ound\x18\x01 \x01(\x08\x12\x35\n\ncontroller\x18\x02 \x01(\x0b\x32!.hazel.rpc.RobotControllerSummary\"\x1e\n\x1cListPolicyDescriptorsRequest\"Q\n\x1dListPolicyDescriptorsResponse\x12\x30\n\x08policies\x18\x01 \x03(\x0b\x32\x1e.hazel.rpc.PolicyRegistryEntry\"^\n\x16SetPolicyActiveRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x0e\n\x06\x61\x63tive\x18\x03 \x01(\x08\"k\n\x1aSetPolicyDescriptorRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x17\n\x0f\x64\x65scriptor_path\x18\x03 \x01(\t\"i\n\x1cSetPolicyDrivenJointsRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x13\n\x0bjoint_names\x18\x03 \x03(\t\"\x88\x01\n SetPolicyClampObservationRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12.\n&clamp_observation_for_unclaimed_joints\x18\x03 \x01(\x08\"b\n\x18SetPolicyPriorityRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x10\n\x08priority\x18\x03 \x01(\x05\"w\n\x1cSetPolicyCommandFloatRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ncommand_id\x18\x03 \x01(\r\x12\r\n\x05value\x18\x04 \x01(\x02\"v\n\x1bSetPolicyCommandBoolRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ncommand_id\x18\x03 \x01(\r\x12\r\n\x05value\x18\x04 \x01(\x08\"\xd9\x01\n\x11JointGainOverride\x12\x12\n\njoint_name\x18\x01 \x01(\t\x12\x0f\n\x02kp\x18\x02 \x01(\x02H\x00\x88\x01\x01\x12\x0f\n\x02kd\x18\x03 \x01(\x02H\x01\x88\x01\x01\x12\x19\n\x0c\x65\x66\x66ort_limit\x18\x04 \x01(\x02H\x02\x88\x01\x01\x12\x19\n\x0c\x61\x63tion_scale\x18\x05 \x01(\x02H\x03\x88\x01\x01\x12\x18\n\x0b\x64\x65\x66\x61ult_pos\x18\x06 \x01(\x02H\x04\x88\x01\x01\x42\x05\n\x03_kpB\x05\n\x03_kdB\x0f\n\r_effort_limitB\x0f\n\r_action_scaleB\x0e\n\x0c_default_pos\"~\n\x15SetPolicyGainsRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12/\n\toverrides\x18\x03 \x03(\x0b\x32\x1c.hazel.rpc.JointGainOverride\"O\n\x17\x43learPolicyGainsRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\"h\n\x1cGetPolicyCommandFloatRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ncommand_id\x18\x03 \x01(\r\"J\n\x17PolicyCommandFloatValue\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\r\n\x05value\x18\x02 \x01(\x02\x12\x0f\n\x07message\x18\x03 \x01(\t\"g\n\x1bGetPolicyCommandBoolRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ncommand_id\x18\x03 \x01(\r\"I\n\x16PolicyCommandBoolValue\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\r\n\x05value\x18\x02 \x01(\x08\x12\x0f\n\x07message\x18\x03 \x01(\t\"R\n\x1bSetMotionGraphActiveRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0e\n\x06\x61\x63tive\x18\x02 \x01(\x08\"B\n\x1bGetMotionGraphActiveRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\"P\n\x1cGetMotionGraphActiveResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0e\n\x06\x61\x63tive\x18\x02 \x01(\x08\x12\x0f\n\x07message\x18\x03 \x01(\t\"\x84\x01\n\x1aSetMotionGraphInputRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x10\n\x08input_id\x18\x02 \x01(\r\x12/\n\x05value\x18\x03 \x01(\x0b\x32 .hazel.rpc.MotionGraphInputValue\"\x84\x01\n\x1aGetMotionGraphInputRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x10\n\x08input_id\x18\x02 \x01(\r\x12/\n\ttype_hint\x18\x03 \x01(\x0e\x32\x1c.hazel.rpc.PolicyCommandType\"p\n\x1bGetMotionGraphInputResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12/\n\x05value\x18\x02 \x01(\x0b\x32 .hazel.rpc.MotionGraphInputValue\x12\x0f\n\x07message\x18\x03 \x01(\t\"V\n\x1d\x46ireMotionGraphTriggerRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x10\n\x08input_id\x18\x02 \x01(\r\"h\n\x1cStreamPolicySlotStateRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ntarget_fps\x18\x03 \x01(\r\"W\n\x1cStreamRobotControllerRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x12\n\ntarget_fps\x18\x02 \x01(\r\"P\n\x18GetPolicyBasePoseRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\"\x81\x01\n\x0ePolicyBasePose\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\t\n\x01x\x18\x03 \x01(\x02\x12\t\n\x01y\x18\x04 \x01(\x02\x12\x0b\n\x03yaw\x18\x05 \x01(\x02\x12\x0c\n\x04x_hz\x18\x06 \x01(\x02\x12\x0c\n\x04z_hz\x18\x07 \x01(\x02\x12\x0e\n\x06yaw_hz\x18\x08 \x01(\x02\"R\n\x1aGetPolicyLastActionRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\"]\n\x10PolicyLastAction\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x12\n\x06\x61\x63tion\x18\x03 \x03(\x02\x42\x02\x10\x01\x12\x13\n\x0bjoint_names\x18\x04 \x03(\t*\xbd\x01\n\x11PolicyCommandType\x12\x14\n\x10POLICY_CMD_FLOAT\x10\x00\x12\x13\n\x0fPOLICY_CMD_BOOL\x10\x01\x12\x12\n\x0ePOLICY_CMD_INT\x10\x02\x12\x13\n\x0fPOLICY_CMD_UINT\x10\x03\x12\x13\n\x0fPOLICY_CMD_VEC2\x10\x04\x12\x13\n\x0fPOLICY_CMD_VEC3\x10\x05\x12\x13\n\x0fPOLICY_CMD_VEC4\x10\x06\x12\x15\n\x11POLICY_CMD_STRING\x10\x07\x32\xd5\x16\n\x0c\x41gentService\x12U\n\x0eGetAgentSchema\x12 .hazel.rpc.GetAgentSchemaRequest\x1a!.hazel.rpc.GetAgentSchemaResponse\x12I\n\nResetAgent\x12\x1c.hazel.rpc.ResetAgentRequest\x1a\x1d.hazel.rpc.ResetAgentResponse\x12\x37\n\x04Step\x12\x16.hazel.rpc.StepRequest\x1a\x17.hazel.rpc.StepResponse\x12U\n\x0eSetActionGroup\x12 .hazel.rpc.SetActionGroupRequest\x1a!.hazel.rpc.SetActionGroupResponse\x12\x43\n\x0eReportProgress\x12\x19.hazel.rpc.ProgressReport\x1a\x16.hazel.rpc.ProgressAck\x12j\n\x15GetCapabilityManifest\x12\'.hazel.rpc.GetCapabilityManifestRequest\x1a(.hazel.rpc.GetCapabilityManifestResponse\x12g\n\x14ValidateTaskContract\x12&.hazel.rpc.ValidateTaskContractRequest\x1a\'.hazel.rpc.ValidateTaskContractResponse\x12R\n\rNegotiateTask\x12\x1f.hazel.rpc.NegotiateTaskRequest\x1a .hazel.rpc.NegotiateTaskResponse\x12g\n\x14ListRobotControllers\x12&.hazel.rpc.ListRobotControllersRequest\x1a\'.hazel.rpc.ListRobotControllersResponse\x12\x61\n\x12GetRobotController\x12$.hazel.rpc.GetRobotControllerRequest\x1a%.hazel.rpc.GetRobotControllerResponse\x12j\n\x15ListPolicyDescriptors\x12\'.hazel.rpc.ListPolicyDescriptorsRequest\x1a(.hazel.rpc.ListPolicyDescriptorsResponse\x12S\n\x0fSetPolicyActive\x12!.hazel.rpc.SetPolicyActiveRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12[\n\x13SetPolicyDescriptor\x12%.hazel.rpc.SetPolicyDescriptorRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12_\n\x15SetPolicyDrivenJoints\x12\'.hazel.rpc.SetPolicyDrivenJointsRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12g\n\x19SetPolicyClampObservation\x12+.hazel.rpc.SetPolicyClampObservationRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12W\n\x11SetPolicyPriority\x12#.hazel.rpc.SetPolicyPriorityRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12_\n\x15SetPolicyCommandFloat\x12\'.hazel.rpc.SetPolicyCommandFloatRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12]\n\x14SetPolicyCommandBool\x12&.hazel.rpc.SetPolicyCommandBoolRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12Q\n\x0eSetPolicyGains\x12 .hazel.rpc.SetPolicyGainsRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12U\n\x10\x43learPolicyGains\x12\".hazel.rpc.ClearPolicyGainsRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12\x64\n\x15GetPolicyCommandFloat\x12\'.hazel.rpc.GetPolicyCommandFloatRequest\x1a\".hazel.rpc.PolicyCommandFloatValue\x12\x61\n\x14GetPolicyCommandBool\x12&.hazel.rpc.GetPolicyCommandBoolRequest\x1a!.hazel.rpc.PolicyCommandBoolValue\x12]\n\x14SetMotionGraphActive\x12&.hazel.rpc.SetMotionGraphActiveRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12g\n\x14GetMotionGraphActive\x12&.hazel.rpc.GetMotionGraphActiveRequest\x1a\'.hazel.rpc.GetMotionGraphActiveResponse\x12[\n\x13SetMotionGraphInput\x12%.hazel.rpc.SetMotionGraphInputRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12\x64\n\x13GetMotionGraphInput\x12%.hazel.rpc.GetMotionGraphInputRequest\x1a&.hazel.rpc.GetMotionGraphInputResponse\x12\x61\n\x16\x46ireMotionGraphTrigger\x12(.hazel.rpc.FireMotionGraphTriggerRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12S\n\x11GetPolicyBasePose\x12#.hazel.rpc.GetPolicyBasePoseRequest\x1a\x19.hazel.rpc.PolicyBasePose\x12Y\n\x13GetPolicyLastAction\x12%.hazel.rpc.GetPolicyLastActionRequest\x1a\x1b.hazel.rpc.PolicyLastAction\x12`\n\x15StreamPolicySlotState\x12\'.hazel.rpc.StreamPolicySlotStateRequest\x1a\x1c.hazel.rpc.PolicySlotSummary0\x01\x12\x65\n\x15StreamRobotController\x12\'.hazel.rpc.StreamRobotControllerRequest\x1a!.hazel.rpc.RobotControllerSummary0\x01\x42\x03\xf8\x01\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0b\x61gent.proto\x12\thazel.rpc\x1a\x0c\x63\x61mera.proto\x1a\x0c\x63ommon.proto\x1a\x0bmedia.proto\x1a\x0cmujoco.proto\x1a\x12mujoco_scene.proto\x1a\x0ftelemetry.proto\"\x81\x01\n\x0b\x41gentSchema\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12\x19\n\x11observation_names\x18\x02 \x03(\t\x12\x14\n\x0c\x61\x63tion_names\x18\x03 \x03(\t\x12\x18\n\x10observation_size\x18\x04 \x01(\r\x12\x13\n\x0b\x61\x63tion_size\x18\x05 \x01(\r\"+\n\x15GetAgentSchemaRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\"@\n\x16GetAgentSchemaResponse\x12&\n\x06schema\x18\x01 \x01(\x0b\x32\x16.hazel.rpc.AgentSchema\"\xc8\x04\n\x12SimulationContract\x12\x1b\n\x13pose_position_noise\x18\x01 \x03(\x02\x12\x1e\n\x16pose_orientation_noise\x18\x02 \x01(\x02\x12\x1c\n\x14joint_position_noise\x18\x03 \x01(\x02\x12\x1c\n\x14joint_velocity_noise\x18\x04 \x01(\x02\x12\x16\n\x0e\x66riction_range\x18\x05 \x03(\x02\x12\x19\n\x11restitution_range\x18\x06 \x03(\x02\x12\x18\n\x10mass_scale_range\x18\x07 \x03(\x02\x12\x18\n\x10\x63om_offset_range\x18\x08 \x03(\x02\x12\x1c\n\x14motor_strength_range\x18\t \x03(\x02\x12\x1a\n\x12motor_offset_range\x18\n \x03(\x02\x12\x1b\n\x13push_interval_range\x18\x0b \x03(\x02\x12\x1b\n\x13push_velocity_range\x18\x0c \x03(\x02\x12\x14\n\x0cterrain_type\x18\r \x01(\t\x12\x1a\n\x12terrain_difficulty\x18\x0e \x01(\x02\x12\x1b\n\x13vel_command_x_range\x18\x0f \x03(\x02\x12\x1b\n\x13vel_command_y_range\x18\x10 \x03(\x02\x12\x1d\n\x15vel_command_yaw_range\x18\x11 \x03(\x02\x12)\n!vel_command_resampling_time_range\x18\x12 \x03(\x02\x12(\n vel_command_standing_probability\x18\x13 \x01(\x02\"\xba\x01\n\x11ResetAgentRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12:\n\x13simulation_contract\x18\x02 \x01(\x0b\x32\x1d.hazel.rpc.SimulationContract\x12\x13\n\x07\x65nv_ids\x18\x03 \x03(\rB\x02\x10\x01\x12@\n\x13model_randomization\x18\x04 \x01(\x0b\x32#.hazel.rpc.ModelRandomizationConfig\"v\n\x12ResetAgentResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12>\n\x15\x61pplied_randomization\x18\x03 \x01(\x0b\x32\x1f.hazel.rpc.AppliedRandomization\"\xf5\x01\n\x12ModelRandomization\x12\x31\n\x05\x66ield\x18\x01 \x01(\x0e\x32\".hazel.rpc.ModelRandomizationField\x12\x0f\n\x07targets\x18\x02 \x03(\t\x12\x34\n\toperation\x18\x03 \x01(\x0e\x32!.hazel.rpc.RandomizationOperation\x12:\n\x0c\x64istribution\x18\x04 \x01(\x0e\x32$.hazel.rpc.RandomizationDistribution\x12\x0b\n\x03low\x18\x05 \x01(\x02\x12\x0c\n\x04high\x18\x06 \x01(\x02\x12\x0e\n\x06shared\x18\x07 \x01(\x08\"j\n\x18ModelRandomizationConfig\x12,\n\x05terms\x18\x01 \x03(\x0b\x32\x1d.hazel.rpc.ModelRandomization\x12\x0c\n\x04seed\x18\x02 \x01(\x04\x12\x12\n\ntable_size\x18\x03 \x01(\r\"\x87\x01\n\x13RandomizationColumn\x12\x31\n\x05\x66ield\x18\x01 \x01(\x0e\x32\".hazel.rpc.ModelRandomizationField\x12\x0f\n\x07\x65lement\x18\x02 \x01(\t\x12\x15\n\relement_index\x18\x03 \x01(\x05\x12\x15\n\rdefault_value\x18\x04 \x01(\x02\"\xa7\x01\n\x14\x41ppliedRandomization\x12/\n\x07\x63olumns\x18\x01 \x03(\x0b\x32\x1e.hazel.rpc.RandomizationColumn\x12\x13\n\x07\x65nv_ids\x18\x02 \x03(\rB\x02\x10\x01\x12\x1a\n\x0esample_indices\x18\x03 \x03(\x04\x42\x02\x10\x01\x12\x12\n\x06values\x18\x04 \x03(\x02\x42\x02\x10\x01\x12\x19\n\x11\x61pply_duration_us\x18\x05 \x01(\x04\"\x87\x01\n\nAgentFrame\x12\x14\n\x0ctimestamp_ms\x18\x01 \x01(\x04\x12\x14\n\x0c\x66rame_number\x18\x02 \x01(\r\x12\x14\n\x0cobservations\x18\x03 \x03(\x02\x12\x0f\n\x07\x61\x63tions\x18\x04 \x03(\x02\x12\x12\n\nagent_name\x18\x05 \x01(\t\x12\x12\n\ntarget_fps\x18\x06 \x01(\r\"\xe5\x01\n\x15GetCameraFrameRequest\x12!\n\x02id\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityIdH\x00\x12\x0e\n\x04name\x18\x02 \x01(\tH\x00\x12\r\n\x05width\x18\x03 \x01(\r\x12\x0e\n\x06height\x18\x04 \x01(\r\x12\x0e\n\x06\x66ormat\x18\x05 \x01(\t\x12,\n\x0c\x63olor_format\x18\x06 \x01(\x0e\x32\x16.hazel.rpc.PixelFormat\x12.\n\x0erender_targets\x18\x07 \x03(\x0e\x32\x16.hazel.rpc.PixelFormatB\x0c\n\nidentifier\"_\n\x17GetViewportFrameRequest\x12\x15\n\rviewport_name\x18\x01 \x01(\t\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x0e\n\x06\x66ormat\x18\x04 \x01(\t\"O\n\x10\x41\x63tionGroupEntry\x12\x12\n\ngroup_name\x18\x01 \x01(\t\x12\x0f\n\x07\x61\x63tions\x18\x02 \x03(\x02\x12\x16\n\x0e\x61\x63tion_indices\x18\x03 \x03(\x05\"W\n\x15SetActionGroupRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12*\n\x05group\x18\x02 \x01(\x0b\x32\x1b.hazel.rpc.ActionGroupEntry\":\n\x16SetActionGroupResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"\xbb\x04\n\x0bStepRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12\x0f\n\x07\x61\x63tions\x18\x02 \x03(\x02\x12\x11\n\ttimeout_s\x18\x03 \x01(\x02\x12\x39\n\x0f\x63\x61mera_requests\x18\x04 \x03(\x0b\x32 .hazel.rpc.GetCameraFrameRequest\x12\x32\n\raction_groups\x18\x05 \x03(\x0b\x32\x1b.hazel.rpc.ActionGroupEntry\x12\x18\n\x10shm_transport_id\x18\x06 \x01(\t\x12\x10\n\x08sequence\x18\x07 \x01(\x04\x12\x39\n\x13\x63\x61mera_capture_mode\x18\x08 \x01(\x0e\x32\x1c.hazel.rpc.CameraCaptureMode\x12\x14\n\x0cnum_substeps\x18\t \x01(\r\x12\x36\n\x11substep_reduction\x18\n \x01(\x0e\x32\x1b.hazel.rpc.SubstepReduction\x12\x0f\n\x07profile\x18\x0b \x01(\x08\x12-\n\x05state\x18\x0c \x01(\x0b\x32\x1e.hazel.rpc.GetFullStateRequest\x12+\n\x08raycasts\x18\r \x03(\x0b\x32\x19.hazel.rpc.RaycastRequest\x12\x32\n\x0cheight_scans\x18\x0e \x03(\x0b\x32\x1c.hazel.rpc.HeightScanRequest\x12/\n\x08\x63ontacts\x18\x0f \x01(\x0b\x32\x1d.hazel.rpc.GetContactsRequest\"\xd8\x07\n\x0cStepResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12*\n\x0bobservation\x18\x03 \x01(\x0b\x32\x15.hazel.rpc.AgentFrame\x12 \n\x18physics_step_duration_us\x18\x04 \x01(\x04\x12\x31\n\rcamera_frames\x18\x05 \x03(\x0b\x32\x1a.hazel.rpc.NamedImageFrame\x12\x42\n\x0ereward_signals\x18\x06 \x03(\x0b\x32*.hazel.rpc.StepResponse.RewardSignalsEntry\x12\x12\n\nterminated\x18\x07 \x01(\x08\x12\x11\n\ttruncated\x18\x08 \x01(\x08\x12/\n\x04info\x18\t \x03(\x0b\x32!.hazel.rpc.StepResponse.InfoEntry\x12H\n\x11termination_flags\x18\n \x03(\x0b\x32-.hazel.rpc.StepResponse.TerminationFlagsEntry\x12-\n\x08shm_slot\x18\x0b \x01(\x0b\x32\x1b.hazel.rpc.SharedMemorySlot\x12\x10\n\x08sequence\x18\x0c \x01(\x04\x12\x13\n\x0bpacked_step\x18\r \x01(\x0c\x12\x1a\n\x12substeps_completed\x18\x10 \x01(\r\x12\x37\n\x0fphysics_threads\x18\x11 \x03(\x0b\x32\x1e.hazel.rpc.PhysicsThreadTiming\x12\'\n\x07profile\x18\x12 \x01(\x0b\x32\x16.hazel.rpc.StepProfile\x12.\n\x05state\x18\x13 \x01(\x0b\x32\x1f.hazel.rpc.GetFullStateResponse\x12,\n\x08raycasts\x18\x14 \x03(\x0b\x32\x1a.hazel.rpc.RaycastResponse\x12\x33\n\x0cheight_scans\x18\x15 \x03(\x0b\x32\x1d.hazel.rpc.HeightScanResponse\x12\x30\n\x08\x63ontacts\x18\x16 \x01(\x0b\x32\x1e.hazel.rpc.GetContactsResponse\x1a\x34\n\x12RewardSignalsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x02:\x02\x38\x01\x1a+\n\tInfoEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x02:\x02\x38\x01\x1a\x37\n\x15TerminationFlagsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x08:\x02\x38\x01J\x04\x08\x0e\x10\x0fJ\x04\x08\x0f\x10\x10\"\xfa\x01\n\x0bStepProfile\x12\x15\n\rqueue_wait_us\x18\x01 \x01(\x04\x12\x19\n\x11\x61pply_controls_us\x18\x02 \x01(\x04\x12\x12\n\nphysics_us\x18\x03 \x01(\x04\x12\x17\n\x0freward_terms_us\x18\x04 \x01(\x04\x12\x16\n\x0eobservation_us\x18\x05 \x01(\x04\x12\x18\n\x10\x63\x61mera_render_us\x18\x06 \x01(\x04\x12\x1a\n\x12\x63\x61mera_readback_us\x18\x07 \x01(\x04\x12\x14\n\x0cserialize_us\x18\x08 \x01(\x04\x12\x10\n\x08total_us\x18\t \x01(\x04\x12\x16\n\x0ereceived_at_us\x18\n \x01(\x04\"k\n\x13PhysicsThreadTiming\x12\x14\n\x0cthread_index\x18\x01 \x01(\r\x12\x0f\n\x07\x62usy_us\x18\x02 \x01(\x04\x12\x12\n\npartitions\x18\x03 \x01(\r\x12\x19\n\x11stolen_partitions\x18\x04 \x01(\r\"i\n OpenSharedMemoryTransportRequest\x12\x12\n\nagent_name\x18\x01 \x01(\t\x12\x12\n\nslot_count\x18\x02 \x01(\r\x12\x1d\n\x15include_camera_frames\x18\x03 \x01(\x08\"\xac\x01\n!OpenSharedMemoryTransportResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x14\n\x0ctransport_id\x18\x03 \x01(\t\x12\x13\n\x0bregion_name\x18\x04 \x01(\t\x12\x13\n\x0bregion_size\x18\x05 \x01(\x04\x12\x12\n\nslot_count\x18\x06 \x01(\r\x12\x11\n\tslot_size\x18\x07 \x01(\x04\"9\n!CloseSharedMemoryTransportRequest\x12\x14\n\x0ctransport_id\x18\x01 \x01(\t\"F\n\"CloseSharedMemoryTransportResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"\xe0\x01\n\x11SharedMemoryImage\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06offset\x18\x02 \x01(\x04\x12\x0c\n\x04size\x18\x03 \x01(\x04\x12\r\n\x05width\x18\x04 \x01(\r\x12\x0e\n\x06height\x18\x05 \x01(\r\x12\x10\n\x08\x63hannels\x18\x06 \x01(\r\x12\x14\n\x0c\x66rame_number\x18\x07 \x01(\r\x12\x15\n\rlatency_steps\x18\x08 \x01(\r\x12,\n\x0cpixel_format\x18\t \x01(\x0e\x32\x16.hazel.rpc.PixelFormat\x12\x13\n\x0b\x64\x65pth_scale\x18\n \x01(\x02\"\xbd\x01\n\x10SharedMemorySlot\x12\x12\n\nslot_index\x18\x01 \x01(\r\x12\x10\n\x08sequence\x18\x02 \x01(\x04\x12\x17\n\x0fsequence_offset\x18\x03 \x01(\x04\x12\x1a\n\x12observation_offset\x18\x04 \x01(\x04\x12\x19\n\x11observation_count\x18\x05 \x01(\r\x12\x33\n\rcamera_frames\x18\x06 \x03(\x0b\x32\x1c.hazel.rpc.SharedMemoryImage\"\xdd\x01\n\x10\x42\x61tchStepRequest\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12\x10\n\x08num_envs\x18\x02 \x01(\r\x12\x12\n\naction_dim\x18\x03 \x01(\r\x12\x13\n\x07\x61\x63tions\x18\x04 \x03(\x02\x42\x02\x10\x01\x12\x11\n\ttimeout_s\x18\x05 \x01(\x02\x12\x19\n\rreset_env_ids\x18\x06 \x03(\rB\x02\x10\x01\x12\x14\n\x0cnum_substeps\x18\x07 \x01(\r\x12\x36\n\x11substep_reduction\x18\x08 \x01(\x0e\x32\x1b.hazel.rpc.SubstepReduction\"\xf6\x02\n\x11\x42\x61tchStepResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x10\n\x08num_envs\x18\x03 \x01(\r\x12\x17\n\x0fobservation_dim\x18\x04 \x01(\r\x12\x18\n\x0cobservations\x18\x05 \x03(\x02\x42\x02\x10\x01\x12\x1a\n\x0ereward_signals\x18\x06 \x03(\x02\x42\x02\x10\x01\x12\x16\n\nterminated\x18\x07 \x03(\x08\x42\x02\x10\x01\x12\x15\n\ttruncated\x18\x08 \x03(\x08\x42\x02\x10\x01\x12\x14\n\x0c\x66rame_number\x18\t \x01(\r\x12 \n\x18physics_step_duration_us\x18\n \x01(\x04\x12\x37\n\x0fphysics_threads\x18\x0b \x03(\x0b\x32\x1e.hazel.rpc.PhysicsThreadTiming\x12>\n\x15\x61pplied_randomization\x18\x0c \x01(\x0b\x32\x1f.hazel.rpc.AppliedRandomization\"\xeb\x01\n\x0eProgressReport\x12\x0e\n\x06run_id\x18\x01 \x01(\t\x12\x11\n\ttask_name\x18\x02 \x01(\t\x12\x13\n\x0bpolicy_name\x18\x03 \x01(\t\x12\r\n\x05phase\x18\x04 \x01(\t\x12\x17\n\x0f\x63urrent_episode\x18\x05 \x01(\x05\x12\x16\n\x0etotal_episodes\x18\x06 \x01(\x05\x12\x14\n\x0c\x63urrent_step\x18\x07 \x01(\x05\x12\x11\n\tmax_steps\x18\x08 \x01(\x05\x12\x11\n\telapsed_s\x18\t \x01(\x02\x12\x13\n\x0bstatus_text\x18\n \x01(\t\x12\x10\n\x08\x66inished\x18\x0b \x01(\x08\"\x1f\n\x0bProgressAck\x12\x10\n\x08\x61\x63\x63\x65pted\x18\x01 \x01(\x08\"\xe9\x03\n\x0cTaskContract\x12\x0f\n\x07task_id\x18\x01 \x01(\t\x12\r\n\x05robot\x18\x02 \x01(\t\x12\r\n\x05scene\x18\x03 \x01(\t\x12\x34\n\x0cobservations\x18\x04 \x01(\x0b\x32\x1e.hazel.rpc.ObservationContract\x12*\n\x07\x61\x63tions\x18\x05 \x01(\x0b\x32\x19.hazel.rpc.ActionContract\x12*\n\x07rewards\x18\x06 \x01(\x0b\x32\x19.hazel.rpc.RewardContract\x12\x34\n\x0cterminations\x18\x07 \x01(\x0b\x32\x1e.hazel.rpc.TerminationContract\x12\x37\n\rrandomization\x18\x08 \x01(\x0b\x32 .hazel.rpc.RandomizationContract\x12\x37\n\x0e\x61uxiliary_data\x18\t \x03(\x0b\x32\x1f.hazel.rpc.AuxiliaryDataRequest\x12\x10\n\x08num_envs\x18\n \x01(\r\x12.\n\rstep_encoding\x18\x0b \x01(\x0e\x32\x17.hazel.rpc.StepEncoding\x12\x32\n\x0fphysics_backend\x18\x0c \x01(\x0e\x32\x19.hazel.rpc.PhysicsBackend\"\x7f\n\x13ObservationContract\x12\x33\n\x08required\x18\x01 \x03(\x0b\x32!.hazel.rpc.ObservationTermRequest\x12\x33\n\x08optional\x18\x02 \x03(\x0b\x32!.hazel.rpc.ObservationTermRequest\"\xec\x01\n\x16ObservationTermRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12=\n\x06params\x18\x02 \x03(\x0b\x32-.hazel.rpc.ObservationTermRequest.ParamsEntry\x12\r\n\x05group\x18\x03 \x01(\t\x12*\n\x05noise\x18\x04 \x01(\x0b\x32\x1b.hazel.rpc.ObservationNoise\x12\x0c\n\x04\x63lip\x18\x05 \x01(\x02\x12\r\n\x05scale\x18\x06 \x01(\x02\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"i\n\x10ObservationNoise\x12-\n\x04type\x18\x01 \x01(\x0e\x32\x1f.hazel.rpc.ObservationNoiseType\x12\x0b\n\x03std\x18\x02 \x01(\x02\x12\x0b\n\x03low\x18\x03 \x01(\x02\x12\x0c\n\x04high\x18\x04 \x01(\x02\"=\n\x0e\x41\x63tionContract\x12+\n\x05terms\x18\x01 \x03(\x0b\x32\x1c.hazel.rpc.ActionTermRequest\"\xb0\x01\n\x11\x41\x63tionTermRequest\x12\x0c\n\x04type\x18\x01 \x01(\t\x12\x15\n\rjoint_pattern\x18\x02 \x01(\t\x12\x38\n\x06params\x18\x03 \x03(\x0b\x32(.hazel.rpc.ActionTermRequest.ParamsEntry\x12\r\n\x05group\x18\x04 \x01(\t\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"Z\n\x0eRewardContract\x12\x32\n\x0c\x65ngine_terms\x18\x01 \x03(\x0b\x32\x1c.hazel.rpc.RewardTermRequest\x12\x14\n\x0cpython_terms\x18\x02 \x03(\t\"\x9a\x01\n\x11RewardTermRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06weight\x18\x02 \x01(\x02\x12\x38\n\x06params\x18\x03 \x03(\x0b\x32(.hazel.rpc.RewardTermRequest.ParamsEntry\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"G\n\x13TerminationContract\x12\x30\n\x05terms\x18\x01 \x03(\x0b\x32!.hazel.rpc.TerminationTermRequest\"\xa8\x01\n\x16TerminationTermRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x12\n\nis_timeout\x18\x02 \x01(\x08\x12=\n\x06params\x18\x03 \x03(\x0b\x32-.hazel.rpc.TerminationTermRequest.ParamsEntry\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\xad\x01\n\x15RandomizationContract\x12!\n\x19simulation_contract_bytes\x18\x01 \x01(\x0c\x12=\n\x15\x63ustom_randomizations\x18\x02 \x03(\x0b\x32\x1e.hazel.rpc.CustomRandomization\x12\x32\n\x05model\x18\x03 \x01(\x0b\x32#.hazel.rpc.ModelRandomizationConfig\"Y\n\x13\x43ustomRandomization\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x11\n\trange_min\x18\x02 \x01(\x02\x12\x11\n\trange_max\x18\x03 \x01(\x02\x12\x0e\n\x06target\x18\x04 \x01(\t\"\x90\x01\n\x14\x41uxiliaryDataRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12;\n\x06params\x18\x02 \x03(\x0b\x32+.hazel.rpc.AuxiliaryDataRequest.ParamsEntry\x1a-\n\x0bParamsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\x8c\x04\n\x18\x45ngineCapabilityManifest\x12\x16\n\x0e\x65ngine_version\x18\x01 \x01(\t\x12\x18\n\x10manifest_version\x18\x02 \x01(\x05\x12\x37\n\x0cobservations\x18\x03 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12\x32\n\x07\x61\x63tions\x18\x04 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12\x32\n\x07rewards\x18\x05 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12\x37\n\x0cterminations\x18\x06 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12=\n\x0erandomizations\x18\x07 \x03(\x0b\x32%.hazel.rpc.MdpRandomizationDescriptor\x12\x39\n\x0e\x61uxiliary_data\x18\x08 \x03(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12+\n\nrobot_info\x18\t \x01(\x0b\x32\x17.hazel.rpc.MdpRobotInfo\x12=\n\x10physics_backends\x18\n \x03(\x0b\x32#.hazel.rpc.PhysicsBackendDescriptor\"\xb1\x01\n\x18PhysicsBackendDescriptor\x12*\n\x07\x62\x61\x63kend\x18\x01 \x01(\x0e\x32\x19.hazel.rpc.PhysicsBackend\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x0e\n\x06\x64\x65vice\x18\x03 \x01(\t\x12\x1b\n\x13\x64\x65vice_memory_bytes\x18\x04 \x01(\x04\x12\x14\n\x0cmax_num_envs\x18\x05 \x01(\r\x12\x18\n\x10supports_cameras\x18\x06 \x01(\x08\"\xbe\x02\n\x16MdpComponentDescriptor\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x13\n\x0b\x64\x65scription\x18\x02 \x01(\t\x12\x10\n\x08\x63\x61tegory\x18\x03 \x01(\t\x12J\n\rparams_schema\x18\x04 \x03(\x0b\x32\x33.hazel.rpc.MdpComponentDescriptor.ParamsSchemaEntry\x12\x14\n\x0coutput_shape\x18\x05 \x03(\x05\x12\x10\n\x08requires\x18\x06 \x03(\t\x12\x13\n\x0brobot_types\x18\x07 \x03(\t\x12\x12\n\ngpu_kernel\x18\x08 \x01(\x08\x1aR\n\x11ParamsSchemaEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12,\n\x05value\x18\x02 \x01(\x0b\x32\x1d.hazel.rpc.MdpParamDescriptor:\x02\x38\x01\"\x87\x01\n\x12MdpParamDescriptor\x12\x0c\n\x04type\x18\x01 \x01(\t\x12\x15\n\rdefault_value\x18\x02 \x01(\t\x12\x13\n\x0b\x64\x65scription\x18\x03 \x01(\t\x12\x11\n\trange_min\x18\x04 \x01(\x02\x12\x11\n\trange_max\x18\x05 \x01(\x02\x12\x11\n\thas_range\x18\x06 \x01(\x08\"\x9a\x01\n\x1aMdpRandomizationDescriptor\x12/\n\x04\x62\x61se\x18\x01 \x01(\x0b\x32!.hazel.rpc.MdpComponentDescriptor\x12\x19\n\x11\x64\x65\x66\x61ult_range_min\x18\x02 \x01(\x02\x12\x19\n\x11\x64\x65\x66\x61ult_range_max\x18\x03 \x01(\x02\x12\x15\n\rengine_target\x18\x04 \x01(\t\"\xd7\x01\n\x0cMdpRobotInfo\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x13\n\x0bjoint_names\x18\x02 \x03(\t\x12\x16\n\x0e\x61\x63tuator_names\x18\x03 \x03(\t\x12\x34\n\x0f\x61\x63tuator_limits\x18\x04 \x03(\x0b\x32\x1b.hazel.rpc.MdpActuatorLimit\x12\x12\n\nbody_names\x18\x05 \x03(\t\x12\x12\n\nsite_names\x18\x06 \x03(\t\x12\x14\n\x0csensor_names\x18\x07 \x03(\t\x12\x18\n\x10\x61vailable_scenes\x18\x08 \x03(\t\"V\n\x10MdpActuatorLimit\x12\r\n\x05lower\x18\x01 \x01(\x02\x12\r\n\x05upper\x18\x02 \x01(\x02\x12\x15\n\rdefault_value\x18\x03 \x01(\x02\x12\r\n\x05scale\x18\x04 \x01(\x02\"\x8a\x02\n\x18\x43ontractValidationResult\x12\x10\n\x08is_valid\x18\x01 \x01(\x08\x12\x34\n\x13negotiated_contract\x18\x02 \x01(\x0b\x32\x17.hazel.rpc.TaskContract\x12\x34\n\x06\x65rrors\x18\x03 \x03(\x0b\x32$.hazel.rpc.ContractValidationMessage\x12\x36\n\x08warnings\x18\x04 \x03(\x0b\x32$.hazel.rpc.ContractValidationMessage\x12\x1a\n\x12resolved_optionals\x18\x05 \x03(\t\x12\x1c\n\x14unresolved_optionals\x18\x06 \x03(\t\"x\n\x19\x43ontractValidationMessage\x12\x10\n\x08severity\x18\x01 \x01(\t\x12\x11\n\tcomponent\x18\x02 \x01(\t\x12\x11\n\tterm_name\x18\x03 \x01(\t\x12\x0f\n\x07message\x18\x04 \x01(\t\x12\x12\n\nsuggestion\x18\x05 \x01(\t\"\x8f\x04\n\x15NegotiatedTaskSession\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12\x32\n\x11resolved_contract\x18\x02 \x01(\x0b\x32\x17.hazel.rpc.TaskContract\x12\x36\n\x12observation_layout\x18\x03 \x03(\x0b\x32\x1a.hazel.rpc.ObservationSlot\x12\x14\n\x0creward_terms\x18\x04 \x03(\t\x12\x19\n\x11termination_terms\x18\x05 \x03(\t\x12\x31\n\raction_layout\x18\x06 \x03(\x0b\x32\x1a.hazel.rpc.ActionGroupSlot\x12\x10\n\x08num_envs\x18\x07 \x01(\r\x12.\n\rstep_encoding\x18\x08 \x01(\x0e\x32\x17.hazel.rpc.StepEncoding\x12\x32\n\rpacked_layout\x18\t \x01(\x0b\x32\x1b.hazel.rpc.PackedStepLayout\x12\x32\n\x0fphysics_backend\x18\n \x01(\x0e\x32\x19.hazel.rpc.PhysicsBackend\x12:\n\x13observation_program\x18\x0b \x01(\x0b\x32\x1d.hazel.rpc.ObservationProgram\x12\x14\n\x0csession_hash\x18\x0c \x01(\t\x12\x16\n\x0elayout_omitted\x18\r \x01(\x08\"\x8d\x01\n\x12ObservationProgram\x12-\n\x07kernels\x18\x01 \x03(\x0b\x32\x1c.hazel.rpc.ObservationKernel\x12\x18\n\x10observation_size\x18\x02 \x01(\r\x12\x15\n\rfused_kernels\x18\x03 \x01(\r\x12\x17\n\x0f\x63ompile_time_us\x18\x04 \x01(\x04\"m\n\x11ObservationKernel\x12\x0e\n\x06kernel\x18\x01 \x01(\t\x12\r\n\x05terms\x18\x02 \x03(\t\x12\x0e\n\x06offset\x18\x03 \x01(\x05\x12\x0c\n\x04size\x18\x04 \x01(\x05\x12\r\n\x05noise\x18\x05 \x01(\x08\x12\x0c\n\x04\x63lip\x18\x06 \x01(\x08\"\xb9\x01\n\x10PackedStepLayout\x12\x12\n\ntotal_size\x18\x01 \x01(\r\x12\x1a\n\x12observation_offset\x18\x02 \x01(\r\x12\x19\n\x11observation_count\x18\x03 \x01(\r\x12\x15\n\rreward_offset\x18\x04 \x01(\r\x12\x13\n\x0binfo_offset\x18\x05 \x01(\r\x12\x12\n\ninfo_names\x18\x06 \x03(\t\x12\x1a\n\x12termination_offset\x18\x07 \x01(\r\"L\n\x0fObservationSlot\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05group\x18\x02 \x01(\t\x12\x0e\n\x06offset\x18\x03 \x01(\x05\x12\x0c\n\x04size\x18\x04 \x01(\x05\"S\n\x0f\x41\x63tionGroupSlot\x12\x12\n\ngroup_name\x18\x01 \x01(\t\x12\x14\n\x0c\x61\x63tion_names\x18\x02 \x03(\t\x12\x16\n\x0e\x61\x63tion_indices\x18\x03 \x03(\x05\"A\n\x1cGetCapabilityManifestRequest\x12\x12\n\nrobot_name\x18\x01 \x01(\t\x12\r\n\x05scene\x18\x02 \x01(\t\"V\n\x1dGetCapabilityManifestResponse\x12\x35\n\x08manifest\x18\x01 \x01(\x0b\x32#.hazel.rpc.EngineCapabilityManifest\"H\n\x1bValidateTaskContractRequest\x12)\n\x08\x63ontract\x18\x01 \x01(\x0b\x32\x17.hazel.rpc.TaskContract\"S\n\x1cValidateTaskContractResponse\x12\x33\n\x06result\x18\x01 \x01(\x0b\x32#.hazel.rpc.ContractValidationResult\"^\n\x14NegotiateTaskRequest\x12)\n\x08\x63ontract\x18\x01 \x01(\x0b\x32\x17.hazel.rpc.TaskContract\x12\x1b\n\x13\x63\x61\x63hed_session_hash\x18\x02 \x01(\t\"\xa5\x01\n\x15NegotiateTaskResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x31\n\x07session\x18\x03 \x01(\x0b\x32 .hazel.rpc.NegotiatedTaskSession\x12\x37\n\nvalidation\x18\x04 \x01(\x0b\x32#.hazel.rpc.ContractValidationResult\"}\n\x11\x45ngineFingerprint\x12\x16\n\x0e\x65ngine_version\x18\x01 \x01(\t\x12\x12\n\nmodel_hash\x18\x02 \x01(\t\x12\x15\n\rmanifest_hash\x18\x03 \x01(\t\x12\x10\n\x08\x61pi_hash\x18\x04 \x01(\t\x12\x13\n\x0b\x66ingerprint\x18\x05 \x01(\t\"\x1d\n\x1bGetEngineFingerprintRequest\"Q\n\x1cGetEngineFingerprintResponse\x12\x31\n\x0b\x66ingerprint\x18\x01 \x01(\x0b\x32\x1c.hazel.rpc.EngineFingerprint\"\\\n\x14PolicyCommandIdEntry\x12\n\n\x02id\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\x12*\n\x04type\x18\x03 \x01(\x0e\x32\x1c.hazel.rpc.PolicyCommandType\"B\n\x16PolicyObservationField\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04type\x18\x02 \x01(\t\x12\x0c\n\x04size\x18\x03 \x01(\r\"\xe6\x02\n\x11PolicySlotSummary\x12\x0f\n\x07slot_id\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x17\n\x0f\x64\x65scriptor_path\x18\x03 \x01(\t\x12\x0e\n\x06\x61\x63tive\x18\x04 \x01(\x08\x12\x10\n\x08priority\x18\x05 \x01(\x05\x12\x15\n\rdriven_joints\x18\x06 \x03(\t\x12.\n&clamp_observation_for_unclaimed_joints\x18\x07 \x01(\x08\x12\r\n\x05ready\x18\x08 \x01(\x08\x12\x18\n\x10\x61\x63tive_policy_id\x18\t \x01(\t\x12\x37\n\x0e\x63ommand_id_map\x18\n \x03(\x0b\x32\x1f.hazel.rpc.PolicyCommandIdEntry\x12\x1a\n\x12policy_joint_names\x18\x0b \x03(\t\x12\x32\n\tinference\x18\x0c \x01(\x0b\x32\x1f.hazel.rpc.PolicyInferenceStats\"\x91\x01\n\x14PolicyInferenceStats\x12\x17\n\x0flast_latency_us\x18\x01 \x01(\x02\x12\x17\n\x0fmean_latency_us\x18\x02 \x01(\x02\x12\x12\n\nbatch_size\x18\x03 \x01(\r\x12\x1a\n\x12\x65xecution_provider\x18\x04 \x01(\t\x12\x17\n\x0finference_count\x18\x05 \x01(\x04\"r\n\x14PolicyInferenceBatch\x12\x11\n\tpolicy_id\x18\x01 \x01(\t\x12\x12\n\nbatch_size\x18\x02 \x01(\r\x12\x17\n\x0flast_latency_us\x18\x03 \x01(\x02\x12\x1a\n\x12\x65xecution_provider\x18\x04 \x01(\t\"\x9c\x01\n\x16RobotControllerSummary\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x13\n\x0b\x65ntity_name\x18\x02 \x01(\t\x12\x1b\n\x13motion_graph_active\x18\x03 \x01(\x08\x12+\n\x05slots\x18\x04 \x03(\x0b\x32\x1c.hazel.rpc.PolicySlotSummary\"\xe7\x02\n\x13PolicyRegistryEntry\x12\x11\n\tpolicy_id\x18\x01 \x01(\t\x12\x17\n\x0f\x64\x65scriptor_path\x18\x02 \x01(\t\x12\x0e\n\x06joints\x18\x03 \x03(\t\x12\x37\n\x0e\x63ommand_id_map\x18\x04 \x03(\x0b\x32\x1f.hazel.rpc.PolicyCommandIdEntry\x12;\n\x10observation_spec\x18\x05 \x03(\x0b\x32!.hazel.rpc.PolicyObservationField\x12\x1a\n\x12\x66reeze_joint_names\x18\x06 \x03(\t\x12K\n\x0f\x63ommand_aliases\x18\x07 \x03(\x0b\x32\x32.hazel.rpc.PolicyRegistryEntry.CommandAliasesEntry\x1a\x35\n\x13\x43ommandAliasesEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\x94\x01\n\x15MotionGraphInputValue\x12\x12\n\x08\x62ool_val\x18\x01 \x01(\x08H\x00\x12\x11\n\x07int_val\x18\x02 \x01(\x05H\x00\x12\x13\n\tfloat_val\x18\x03 \x01(\x02H\x00\x12#\n\x08vec3_val\x18\x04 \x01(\x0b\x32\x0f.hazel.rpc.Vec3H\x00\x12\x11\n\x07trigger\x18\x05 \x01(\x08H\x00\x42\x07\n\x05value\"6\n\x12PolicyOperationAck\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"\x1d\n\x1bListRobotControllersRequest\"\x92\x01\n\x1cListRobotControllersResponse\x12\x36\n\x0b\x63ontrollers\x18\x01 \x03(\x0b\x32!.hazel.rpc.RobotControllerSummary\x12:\n\x11inference_batches\x18\x02 \x03(\x0b\x32\x1f.hazel.rpc.PolicyInferenceBatch\"g\n\x15PolicyInferenceConfig\x12\x1a\n\x12\x62\x61tch_across_slots\x18\x01 \x01(\x08\x12\x1a\n\x12\x65xecution_provider\x18\x02 \x01(\t\x12\x16\n\x0emax_batch_size\x18\x03 \x01(\r\"!\n\x1fGetPolicyInferenceConfigRequest\"\x9a\x01\n\x1dPolicyInferenceConfigResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x30\n\x06\x63onfig\x18\x03 \x01(\x0b\x32 .hazel.rpc.PolicyInferenceConfig\x12%\n\x1d\x61vailable_execution_providers\x18\x04 \x03(\t\"@\n\x19GetRobotControllerRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\"b\n\x1aGetRobotControllerResponse\x12\r\n\x05\x66ound\x18\x01 \x01(\x08\x12\x35\n\ncontroller\x18\x02 \x01(\x0b\x32!.hazel.rpc.RobotControllerSummary\"\x1e\n\x1cListPolicyDescriptorsRequest\"Q\n\x1dListPolicyDescriptorsResponse\x12\x30\n\x08policies\x18\x01 \x03(\x0b\x32\x1e.hazel.rpc.PolicyRegistryEntry\"^\n\x16SetPolicyActiveRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x0e\n\x06\x61\x63tive\x18\x03 \x01(\x08\"k\n\x1aSetPolicyDescriptorRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x17\n\x0f\x64\x65scriptor_path\x18\x03 \x01(\t\"i\n\x1cSetPolicyDrivenJointsRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x13\n\x0bjoint_names\x18\x03 \x03(\t\"\x88\x01\n SetPolicyClampObservationRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12.\n&clamp_observation_for_unclaimed_joints\x18\x03 \x01(\x08\"b\n\x18SetPolicyPriorityRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x10\n\x08priority\x18\x03 \x01(\x05\"w\n\x1cSetPolicyCommandFloatRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ncommand_id\x18\x03 \x01(\r\x12\r\n\x05value\x18\x04 \x01(\x02\"v\n\x1bSetPolicyCommandBoolRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ncommand_id\x18\x03 \x01(\r\x12\r\n\x05value\x18\x04 \x01(\x08\"\xd9\x01\n\x11JointGainOverride\x12\x12\n\njoint_name\x18\x01 \x01(\t\x12\x0f\n\x02kp\x18\x02 \x01(\x02H\x00\x88\x01\x01\x12\x0f\n\x02kd\x18\x03 \x01(\x02H\x01\x88\x01\x01\x12\x19\n\x0c\x65\x66\x66ort_limit\x18\x04 \x01(\x02H\x02\x88\x01\x01\x12\x19\n\x0c\x61\x63tion_scale\x18\x05 \x01(\x02H\x03\x88\x01\x01\x12\x18\n\x0b\x64\x65\x66\x61ult_pos\x18\x06 \x01(\x02H\x04\x88\x01\x01\x42\x05\n\x03_kpB\x05\n\x03_kdB\x0f\n\r_effort_limitB\x0f\n\r_action_scaleB\x0e\n\x0c_default_pos\"~\n\x15SetPolicyGainsRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12/\n\toverrides\x18\x03 \x03(\x0b\x32\x1c.hazel.rpc.JointGainOverride\"O\n\x17\x43learPolicyGainsRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\"h\n\x1cGetPolicyCommandFloatRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ncommand_id\x18\x03 \x01(\r\"J\n\x17PolicyCommandFloatValue\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\r\n\x05value\x18\x02 \x01(\x02\x12\x0f\n\x07message\x18\x03 \x01(\t\"g\n\x1bGetPolicyCommandBoolRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ncommand_id\x18\x03 \x01(\r\"I\n\x16PolicyCommandBoolValue\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\r\n\x05value\x18\x02 \x01(\x08\x12\x0f\n\x07message\x18\x03 \x01(\t\"R\n\x1bSetMotionGraphActiveRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0e\n\x06\x61\x63tive\x18\x02 \x01(\x08\"B\n\x1bGetMotionGraphActiveRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\"P\n\x1cGetMotionGraphActiveResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0e\n\x06\x61\x63tive\x18\x02 \x01(\x08\x12\x0f\n\x07message\x18\x03 \x01(\t\"\x84\x01\n\x1aSetMotionGraphInputRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x10\n\x08input_id\x18\x02 \x01(\r\x12/\n\x05value\x18\x03 \x01(\x0b\x32 .hazel.rpc.MotionGraphInputValue\"\x84\x01\n\x1aGetMotionGraphInputRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x10\n\x08input_id\x18\x02 \x01(\r\x12/\n\ttype_hint\x18\x03 \x01(\x0e\x32\x1c.hazel.rpc.PolicyCommandType\"p\n\x1bGetMotionGraphInputResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12/\n\x05value\x18\x02 \x01(\x0b\x32 .hazel.rpc.MotionGraphInputValue\x12\x0f\n\x07message\x18\x03 \x01(\t\"V\n\x1d\x46ireMotionGraphTriggerRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x10\n\x08input_id\x18\x02 \x01(\r\"h\n\x1cStreamPolicySlotStateRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\x12\x12\n\ntarget_fps\x18\x03 \x01(\r\"W\n\x1cStreamRobotControllerRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x12\n\ntarget_fps\x18\x02 \x01(\r\"P\n\x18GetPolicyBasePoseRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\"\x81\x01\n\x0ePolicyBasePose\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\t\n\x01x\x18\x03 \x01(\x02\x12\t\n\x01y\x18\x04 \x01(\x02\x12\x0b\n\x03yaw\x18\x05 \x01(\x02\x12\x0c\n\x04x_hz\x18\x06 \x01(\x02\x12\x0c\n\x04z_hz\x18\x07 \x01(\x02\x12\x0e\n\x06yaw_hz\x18\x08 \x01(\x02\"R\n\x1aGetPolicyLastActionRequest\x12#\n\x06\x65ntity\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0f\n\x07slot_id\x18\x02 \x01(\r\"]\n\x10PolicyLastAction\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x12\n\x06\x61\x63tion\x18\x03 \x03(\x02\x42\x02\x10\x01\x12\x13\n\x0bjoint_names\x18\x04 \x03(\t\"\x9b\x04\n\x0cRobotCommand\x12@\n\rcommand_float\x18\x01 \x01(\x0b\x32\'.hazel.rpc.SetPolicyCommandFloatRequestH\x00\x12>\n\x0c\x63ommand_bool\x18\x02 \x01(\x0b\x32&.hazel.rpc.SetPolicyCommandBoolRequestH\x00\x12\x43\n\x12motion_graph_input\x18\x03 \x01(\x0b\x32%.hazel.rpc.SetMotionGraphInputRequestH\x00\x12H\n\x14motion_graph_trigger\x18\x04 \x01(\x0b\x32(.hazel.rpc.FireMotionGraphTriggerRequestH\x00\x12\x31\n\x05gains\x18\x05 \x01(\x0b\x32 .hazel.rpc.SetPolicyGainsRequestH\x00\x12\x39\n\x0b\x63lear_gains\x18\x06 \x01(\x0b\x32\".hazel.rpc.ClearPolicyGainsRequestH\x00\x12:\n\rpolicy_active\x18\x07 \x01(\x0b\x32!.hazel.rpc.SetPolicyActiveRequestH\x00\x12\x45\n\x13motion_graph_active\x18\x08 \x01(\x0b\x32&.hazel.rpc.SetMotionGraphActiveRequestH\x00\x42\t\n\x07\x63ommand\"]\n\x19\x41pplyRobotCommandsRequest\x12)\n\x08\x63ommands\x18\x01 \x03(\x0b\x32\x17.hazel.rpc.RobotCommand\x12\x15\n\rallow_partial\x18\x02 \x01(\x08\"3\n\x11RobotCommandError\x12\r\n\x05index\x18\x01 \x01(\r\x12\x0f\n\x07message\x18\x02 \x01(\t\"\x9f\x01\n\x1a\x41pplyRobotCommandsResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x15\n\rapplied_count\x18\x03 \x01(\r\x12\x1a\n\x12\x61pply_frame_number\x18\x04 \x01(\x04\x12,\n\x06\x65rrors\x18\x05 \x03(\x0b\x32\x1c.hazel.rpc.RobotCommandError\"\xd7\x01\n\rSyncSubStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x30\n\x06\x63\x61mera\x18\x02 \x01(\x0b\x32\x1e.hazel.rpc.StreamCameraRequestH\x00\x12\x37\n\nfull_state\x18\x03 \x01(\x0b\x32!.hazel.rpc.StreamFullStateRequestH\x00\x12\x43\n\x10robot_controller\x18\x04 \x01(\x0b\x32\'.hazel.rpc.StreamRobotControllerRequestH\x00\x42\x08\n\x06source\"q\n\x19StreamSynchronizedRequest\x12)\n\x07streams\x18\x01 \x03(\x0b\x32\x18.hazel.rpc.SyncSubStream\x12\x12\n\ndecimation\x18\x02 \x01(\r\x12\x15\n\rmax_in_flight\x18\x03 \x01(\r\"\xd4\x01\n\x0bSyncPayload\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\'\n\x06\x63\x61mera\x18\x02 \x01(\x0b\x32\x15.hazel.rpc.ImageFrameH\x00\x12\x35\n\nfull_state\x18\x03 \x01(\x0b\x32\x1f.hazel.rpc.GetFullStateResponseH\x00\x12=\n\x10robot_controller\x18\x04 \x01(\x0b\x32!.hazel.rpc.RobotControllerSummaryH\x00\x12\r\n\x05\x65rror\x18\x05 \x01(\tB\t\n\x07payload\"V\n\x0fSyncStreamStats\x12\x13\n\x0b\x66rames_sent\x18\x01 \x01(\x04\x12\x16\n\x0e\x66rames_skipped\x18\x02 \x01(\x04\x12\x16\n\x0e\x66rames_dropped\x18\x03 \x01(\x04\"\xc2\x01\n\x11SynchronizedFrame\x12\x14\n\x0c\x66rame_number\x18\x01 \x01(\x04\x12\x10\n\x08sim_time\x18\x02 \x01(\x01\x12\x14\n\x0ctimestamp_ms\x18\x03 \x01(\x04\x12(\n\x08payloads\x18\x04 \x03(\x0b\x32\x16.hazel.rpc.SyncPayload\x12\x1a\n\x12skipped_since_last\x18\x05 \x01(\r\x12)\n\x05stats\x18\x06 \x01(\x0b\x32\x1a.hazel.rpc.SyncStreamStats*\xd3\x02\n\x17ModelRandomizationField\x12+\n\'MODEL_RANDOMIZATION_FIELD_GEOM_FRICTION\x10\x00\x12\'\n#MODEL_RANDOMIZATION_FIELD_BODY_MASS\x10\x01\x12)\n%MODEL_RANDOMIZATION_FIELD_DOF_DAMPING\x10\x02\x12*\n&MODEL_RANDOMIZATION_FIELD_DOF_ARMATURE\x10\x03\x12.\n*MODEL_RANDOMIZATION_FIELD_DOF_FRICTIONLOSS\x10\x04\x12+\n\'MODEL_RANDOMIZATION_FIELD_ACTUATOR_GAIN\x10\x05\x12.\n*MODEL_RANDOMIZATION_FIELD_ACTUATOR_DAMPING\x10\x06*}\n\x16RandomizationOperation\x12!\n\x1dRANDOMIZATION_OPERATION_SCALE\x10\x00\x12\x1f\n\x1bRANDOMIZATION_OPERATION_ADD\x10\x01\x12\x1f\n\x1bRANDOMIZATION_OPERATION_SET\x10\x02*\x98\x01\n\x19RandomizationDistribution\x12&\n\"RANDOMIZATION_DISTRIBUTION_UNIFORM\x10\x00\x12*\n&RANDOMIZATION_DISTRIBUTION_LOG_UNIFORM\x10\x01\x12\'\n#RANDOMIZATION_DISTRIBUTION_GAUSSIAN\x10\x02*e\n\x10SubstepReduction\x12\x19\n\x15SUBSTEP_REDUCTION_SUM\x10\x00\x12\x1a\n\x16SUBSTEP_REDUCTION_MEAN\x10\x01\x12\x1a\n\x16SUBSTEP_REDUCTION_LAST\x10\x02*J\n\x11\x43\x61meraCaptureMode\x12\x17\n\x13\x43\x41MERA_CAPTURE_SYNC\x10\x00\x12\x1c\n\x18\x43\x41MERA_CAPTURE_PIPELINED\x10\x01*A\n\x0cStepEncoding\x12\x17\n\x13STEP_ENCODING_PROTO\x10\x00\x12\x18\n\x14STEP_ENCODING_PACKED\x10\x01*|\n\x0ePhysicsBackend\x12\x17\n\x13PHYSICS_BACKEND_CPU\x10\x00\x12\x17\n\x13PHYSICS_BACKEND_GPU\x10\x01\x12\x17\n\x13PHYSICS_BACKEND_MJX\x10\x02\x12\x1f\n\x1bPHYSICS_BACKEND_MUJOCO_WARP\x10\x03*q\n\x14ObservationNoiseType\x12\x1a\n\x16OBSERVATION_NOISE_NONE\x10\x00\x12\x1e\n\x1aOBSERVATION_NOISE_GAUSSIAN\x10\x01\x12\x1d\n\x19OBSERVATION_NOISE_UNIFORM\x10\x02*\xbd\x01\n\x11PolicyCommandType\x12\x14\n\x10POLICY_CMD_FLOAT\x10\x00\x12\x13\n\x0fPOLICY_CMD_BOOL\x10\x01\x12\x12\n\x0ePOLICY_CMD_INT\x10\x02\x12\x13\n\x0fPOLICY_CMD_UINT\x10\x03\x12\x13\n\x0fPOLICY_CMD_VEC2\x10\x04\x12\x13\n\x0fPOLICY_CMD_VEC3\x10\x05\x12\x13\n\x0fPOLICY_CMD_VEC4\x10\x06\x12\x15\n\x11POLICY_CMD_STRING\x10\x07\x32\xd5\x1d\n\x0c\x41gentService\x12U\n\x0eGetAgentSchema\x12 .hazel.rpc.GetAgentSchemaRequest\x1a!.hazel.rpc.GetAgentSchemaResponse\x12I\n\nResetAgent\x12\x1c.hazel.rpc.ResetAgentRequest\x1a\x1d.hazel.rpc.ResetAgentResponse\x12\x37\n\x04Step\x12\x16.hazel.rpc.StepRequest\x1a\x17.hazel.rpc.StepResponse\x12\x41\n\nStepStream\x12\x16.hazel.rpc.StepRequest\x1a\x17.hazel.rpc.StepResponse(\x01\x30\x01\x12\x46\n\tBatchStep\x12\x1b.hazel.rpc.BatchStepRequest\x1a\x1c.hazel.rpc.BatchStepResponse\x12v\n\x19OpenSharedMemoryTransport\x12+.hazel.rpc.OpenSharedMemoryTransportRequest\x1a,.hazel.rpc.OpenSharedMemoryTransportResponse\x12y\n\x1a\x43loseSharedMemoryTransport\x12,.hazel.rpc.CloseSharedMemoryTransportRequest\x1a-.hazel.rpc.CloseSharedMemoryTransportResponse\x12U\n\x0eSetActionGroup\x12 .hazel.rpc.SetActionGroupRequest\x1a!.hazel.rpc.SetActionGroupResponse\x12\x43\n\x0eReportProgress\x12\x19.hazel.rpc.ProgressReport\x1a\x16.hazel.rpc.ProgressAck\x12j\n\x15GetCapabilityManifest\x12\'.hazel.rpc.GetCapabilityManifestRequest\x1a(.hazel.rpc.GetCapabilityManifestResponse\x12g\n\x14ValidateTaskContract\x12&.hazel.rpc.ValidateTaskContractRequest\x1a\'.hazel.rpc.ValidateTaskContractResponse\x12R\n\rNegotiateTask\x12\x1f.hazel.rpc.NegotiateTaskRequest\x1a .hazel.rpc.NegotiateTaskResponse\x12g\n\x14GetEngineFingerprint\x12&.hazel.rpc.GetEngineFingerprintRequest\x1a\'.hazel.rpc.GetEngineFingerprintResponse\x12g\n\x14ListRobotControllers\x12&.hazel.rpc.ListRobotControllersRequest\x1a\'.hazel.rpc.ListRobotControllersResponse\x12\x61\n\x12GetRobotController\x12$.hazel.rpc.GetRobotControllerRequest\x1a%.hazel.rpc.GetRobotControllerResponse\x12j\n\x15ListPolicyDescriptors\x12\'.hazel.rpc.ListPolicyDescriptorsRequest\x1a(.hazel.rpc.ListPolicyDescriptorsResponse\x12S\n\x0fSetPolicyActive\x12!.hazel.rpc.SetPolicyActiveRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12[\n\x13SetPolicyDescriptor\x12%.hazel.rpc.SetPolicyDescriptorRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12_\n\x15SetPolicyDrivenJoints\x12\'.hazel.rpc.SetPolicyDrivenJointsRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12g\n\x19SetPolicyClampObservation\x12+.hazel.rpc.SetPolicyClampObservationRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12W\n\x11SetPolicyPriority\x12#.hazel.rpc.SetPolicyPriorityRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12_\n\x15SetPolicyCommandFloat\x12\'.hazel.rpc.SetPolicyCommandFloatRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12]\n\x14SetPolicyCommandBool\x12&.hazel.rpc.SetPolicyCommandBoolRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12Q\n\x0eSetPolicyGains\x12 .hazel.rpc.SetPolicyGainsRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12U\n\x10\x43learPolicyGains\x12\".hazel.rpc.ClearPolicyGainsRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12\x64\n\x15GetPolicyCommandFloat\x12\'.hazel.rpc.GetPolicyCommandFloatRequest\x1a\".hazel.rpc.PolicyCommandFloatValue\x12\x61\n\x14GetPolicyCommandBool\x12&.hazel.rpc.GetPolicyCommandBoolRequest\x1a!.hazel.rpc.PolicyCommandBoolValue\x12]\n\x14SetMotionGraphActive\x12&.hazel.rpc.SetMotionGraphActiveRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12g\n\x14GetMotionGraphActive\x12&.hazel.rpc.GetMotionGraphActiveRequest\x1a\'.hazel.rpc.GetMotionGraphActiveResponse\x12[\n\x13SetMotionGraphInput\x12%.hazel.rpc.SetMotionGraphInputRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12\x64\n\x13GetMotionGraphInput\x12%.hazel.rpc.GetMotionGraphInputRequest\x1a&.hazel.rpc.GetMotionGraphInputResponse\x12\x61\n\x16\x46ireMotionGraphTrigger\x12(.hazel.rpc.FireMotionGraphTriggerRequest\x1a\x1d.hazel.rpc.PolicyOperationAck\x12\x61\n\x12\x41pplyRobotCommands\x12$.hazel.rpc.ApplyRobotCommandsRequest\x1a%.hazel.rpc.ApplyRobotCommandsResponse\x12S\n\x11GetPolicyBasePose\x12#.hazel.rpc.GetPolicyBasePoseRequest\x1a\x19.hazel.rpc.PolicyBasePose\x12Y\n\x13GetPolicyLastAction\x12%.hazel.rpc.GetPolicyLastActionRequest\x1a\x1b.hazel.rpc.PolicyLastAction\x12`\n\x15StreamPolicySlotState\x12\'.hazel.rpc.StreamPolicySlotStateRequest\x1a\x1c.hazel.rpc.PolicySlotSummary0\x01\x12\x65\n\x15StreamRobotController\x12\'.hazel.rpc.StreamRobotControllerRequest\x1a!.hazel.rpc.RobotControllerSummary0\x01\x12Z\n\x12StreamSynchronized\x12$.hazel.rpc.StreamSynchronizedRequest\x1a\x1c.hazel.rpc.SynchronizedFrame0\x01\x12p\n\x18GetPolicyInferenceConfig\x12*.hazel.rpc.GetPolicyInferenceConfigRequest\x1a(.hazel.rpc.PolicyInferenceConfigResponse\x12\x66\n\x18SetPolicyInferenceConfig\x12 .hazel.rpc.PolicyInferenceConfig\x1a(.hazel.rpc.PolicyInferenceConfigResponseB\x03\xf8\x01\x01\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -36,12 +38,32 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'agent_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   _globals['DESCRIPTOR']._loaded_options = None
   _globals['DESCRIPTOR']._serialized_options = b'\370\001\001'
+  _globals['_RESETAGENTREQUEST'].fields_by_name['env_ids']._loaded_options = None
+  _globals['_RESETAGENTREQUEST'].fields_by_name['env_ids']._serialized_options = b'\020\001'
+  _globals['_APPLIEDRANDOMIZATION'].fields_by_name['env_ids']._loaded_options = None
+  _globals['_APPLIEDRANDOMIZATION'].fields_by_name['env_ids']._serialized_options = b'\020\001'
+  _globals['_APPLIEDRANDOMIZATION'].fields_by_name['sample_indices']._loaded_options = None
+  _globals['_APPLIEDRANDOMIZATION'].fields_by_name['sample_indices']._serialized_options = b'\020\001'
+  _globals['_APPLIEDRANDOMIZATION'].fields_by_name['values']._loaded_options = None
+  _globals['_APPLIEDRANDOMIZATION'].fields_by_name['values']._serialized_options = b'\020\001'
   _globals['_STEPRESPONSE_REWARDSIGNALSENTRY']._loaded_options = None
   _globals['_STEPRESPONSE_REWARDSIGNALSENTRY']._serialized_options = b'8\001'
   _globals['_STEPRESPONSE_INFOENTRY']._loaded_options = None
   _globals['_STEPRESPONSE_INFOENTRY']._serialized_options = b'8\001'
   _globals['_STEPRESPONSE_TERMINATIONFLAGSENTRY']._loaded_options = None
   _globals['_STEPRESPONSE_TERMINATIONFLAGSENTRY']._serialized_options = b'8\001'
+  _globals['_BATCHSTEPREQUEST'].fields_by_name['actions']._loaded_options = None
+  _globals['_BATCHSTEPREQUEST'].fields_by_name['actions']._serialized_options = b'\020\001'
+  _globals['_BATCHSTEPREQUEST'].fields_by_name['reset_env_ids']._loaded_options = None
+  _globals['_BATCHSTEPREQUEST'].fields_by_name['reset_env_ids']._serialized_options = b'\020\001'
+  _globals['_BATCHSTEPRESPONSE'].fields_by_name['observations']._loaded_options = None
+  _globals['_BATCHSTEPRESPONSE'].fields_by_name['observations']._serialized_options = b'\020\001'
+  _globals['_BATCHSTEPRESPONSE'].fields_by_name['reward_signals']._loaded_options = None
+  _globals['_BATCHSTEPRESPONSE'].fields_by_name['reward_signals']._serialized_options = b'\020\001'
+  _globals['_BATCHSTEPRESPONSE'].fields_by_name['terminated']._loaded_options = None
+  _globals['_BATCHSTEPRESPONSE'].fields_by_name['terminated']._serialized_options = b'\020\001'
+  _globals['_BATCHSTEPRESPONSE'].fields_by_name['truncated']._loaded_options = None
+  _globals['_BATCHSTEPRESPONSE'].fields_by_name['truncated']._serialized_options = b'\020\001'
   _globals['_OBSERVATIONTERMREQUEST_PARAMSENTRY']._loaded_options = None
   _globals['_OBSERVATIONTERMREQUEST_PARAMSENTRY']._serialized_options = b'8\001'
   _globals['_ACTIONTERMREQUEST_PARAMSENTRY']._loaded_options = None
@@ -58,198 +80,286 @@ if not _descriptor._USE_C_DESCRIPTORS:
   _globals['_POLICYREGISTRYENTRY_COMMANDALIASESENTRY']._serialized_options = b'8\001'
   _globals['_POLICYLASTACTION'].fields_by_name['action']._loaded_options = None
   _globals['_POLICYLASTACTION'].fields_by_name['action']._serialized_options = b'\020\001'
-  _globals['_POLICYCOMMANDTYPE']._serialized_start=11659
-  _globals['_POLICYCOMMANDTYPE']._serialized_end=11848
-  _globals['_AGENTSCHEMA']._serialized_start=85
-  _globals['_AGENTSCHEMA']._serialized_end=214
-  _globals['_GETAGENTSCHEMAREQUEST']._serialized_start=216
-  _globals['_GETAGENTSCHEMAREQUEST']._serialized_end=259
-  _globals['_GETAGENTSCHEMARESPONSE']._serialized_start=261
-  _globals['_GETAGENTSCHEMARESPONSE']._serialized_end=325
-  _globals['_SIMULATIONCONTRACT']._serialized_start=328
-  _globals['_SIMULATIONCONTRACT']._serialized_end=912
-  _globals['_RESETAGENTREQUEST']._serialized_start=914
-  _globals['_RESETAGENTREQUEST']._serialized_end=1013
-  _globals['_RESETAGENTRESPONSE']._serialized_start=1015
-  _globals['_RESETAGENTRESPONSE']._serialized_end=1069
-  _globals['_AGENTFRAME']._serialized_start=1072
-  _globals['_AGENTFRAME']._serialized_end=1207
-  _globals['_GETCAMERAFRAMEREQUEST']._serialized_start=1210
-  _globals['_GETCAMERAFRAMEREQUEST']._serialized_end=1345
-  _globals['_GETVIEWPORTFRAMEREQUEST']._serialized_start=1347
-  _globals['_GETVIEWPORTFRAMEREQUEST']._serialized_end=1442
-  _globals['_ACTIONGROUPENTRY']._serialized_start=1444
-  _globals['_ACTIONGROUPENTRY']._serialized_end=1523
-  _globals['_SETACTIONGROUPREQUEST']._serialized_start=1525
-  _globals['_SETACTIONGROUPREQUEST']._serialized_end=1612
-  _globals['_SETACTIONGROUPRESPONSE']._serialized_start=1614
-  _globals['_SETACTIONGROUPRESPONSE']._serialized_end=1672
-  _globals['_STEPREQUEST']._serialized_start=1675
-  _globals['_STEPREQUEST']._serialized_end=1855
-  _globals['_STEPRESPONSE']._serialized_start=1858
-  _globals['_STEPRESPONSE']._serialized_end=2421
-  _globals['_STEPRESPONSE_REWARDSIGNALSENTRY']._serialized_start=2267
-  _globals['_STEPRESPONSE_REWARDSIGNALSENTRY']._serialized_end=2319
-  _globals['_STEPRESPONSE_INFOENTRY']._serialized_start=2321
-  _globals['_STEPRESPONSE_INFOENTRY']._serialized_end=2364
-  _globals['_STEPRESPONSE_TERMINATIONFLAGSENTRY']._serialized_start=2366
-  _globals['_STEPRESPONSE_TERMINATIONFLAGSENTRY']._serialized_end=2421
-  _globals['_PROGRESSREPORT']._serialized_start=2424
-  _globals['_PROGRESSREPORT']._serialized_end=2659
-  _globals['_PROGRESSACK']._serialized_start=2661
-  _globals['_PROGRESSACK']._serialized_end=2692
-  _globals['_TASKCONTRACT']._serialized_start=2695
-  _globals['_TASKCONTRACT']._serialized_end=3066
-  _globals['_OBSERVATIONCONTRACT']._serialized_start=3068
-  _globals['_OBSERVATIONCONTRACT']._serialized_end=3195
-  _globals['_OBSERVATIONTERMREQUEST']._serialized_start=3198
-  _globals['_OBSERVATIONTERMREQUEST']._serialized_end=3361
-  _globals['_OBSERVATIONTERMREQUEST_PARAMSENTRY']._serialized_start=3316
-  _globals['_OBSERVATIONTERMREQUEST_PARAMSENTRY']._serialized_end=3361
-  _globals['_ACTIONCONTRACT']._serialized_start=3363
-  _globals['_ACTIONCONTRACT']._serialized_end=3424
-  _globals['_ACTIONTERMREQUEST']._serialized_start=3427
-  _globals['_ACTIONTERMREQUEST']._serialized_end=3603
-  _globals['_ACTIONTERMREQUEST_PARAMSENTRY']._serialized_start=3316
-  _globals['_ACTIONTERMREQUEST_PARAMSENTRY']._serialized_end=3361
-  _globals['_REWARDCONTRACT']._serialized_start=3605
-  _globals['_REWARDCONTRACT']._serialized_end=3695
-  _globals['_REWARDTERMREQUEST']._serialized_start=3698
-  _globals['_REWARDTERMREQUEST']._serialized_end=3852
-  _globals['_REWARDTERMREQUEST_PARAMSENTRY']._serialized_start=3316
-  _globals['_REWARDTERMREQUEST_PARAMSENTRY']._serialized_end=3361
-  _globals['_TERMINATIONCONTRACT']._serialized_start=3854
-  _globals['_TERMINATIONCONTRACT']._serialized_end=3925
-  _globals['_TERMINATIONTERMREQUEST']._serialized_start=3928
-  _globals['_TERMINATIONTERMREQUEST']._serialized_end=4096
-  _globals['_TERMINATIONTERMREQUEST_PARAMSENTRY']._serialized_start=3316
-  _globals['_TERMINATIONTERMREQUEST_PARAMSENTRY']._serialized_end=3361
-  _globals['_RANDOMIZATIONCONTRACT']._serialized_start=4098
-  _globals['_RANDOMIZATIONCONTRACT']._serialized_end=4219
-  _globals['_CUSTOMRANDOMIZATION']._serialized_start=4221
-  _globals['_CUSTOMRANDOMIZATION']._serialized_end=4310
-  _globals['_AUXILIARYDATAREQUEST']._serialized_start=4313
-  _globals['_AUXILIARYDATAREQUEST']._serialized_end=4457
-  _globals['_AUXILIARYDATAREQUEST_PARAMSENTRY']._serialized_start=3316
-  _globals['_AUXILIARYDATAREQUEST_PARAMSENTRY']._serialized_end=3361
-  _globals['_ENGINECAPABILITYMANIFEST']._serialized_start=4460
-  _globals['_ENGINECAPABILITYMANIFEST']._serialized_end=4921
-  _globals['_MDPCOMPONENTDESCRIPTOR']._serialized_start=4924
-  _globals['_MDPCOMPONENTDESCRIPTOR']._serialized_end=5222
-  _globals['_MDPCOMPONENTDESCRIPTOR_PARAMSSCHEMAENTRY']._serialized_start=5140
-  _globals['_MDPCOMPONENTDESCRIPTOR_PARAMSSCHEMAENTRY']._serialized_end=5222
-  _globals['_MDPPARAMDESCRIPTOR']._serialized_start=5225
-  _globals['_MDPPARAMDESCRIPTOR']._serialized_end=5360
-  _globals['_MDPRANDOMIZATIONDESCRIPTOR']._serialized_start=5363
-  _globals['_MDPRANDOMIZATIONDESCRIPTOR']._serialized_end=5517
-  _globals['_MDPROBOTINFO']._serialized_start=5520
-  _globals['_MDPROBOTINFO']._serialized_end=5735
-  _globals['_MDPACTUATORLIMIT']._serialized_start=5737
-  _globals['_MDPACTUATORLIMIT']._serialized_end=5823
-  _globals['_CONTRACTVALIDATIONRESULT']._serialized_start=5826
-  _globals['_CONTRACTVALIDATIONRESULT']._serialized_end=6092
-  _globals['_CONTRACTVALIDATIONMESSAGE']._serialized_start=6094
-  _globals['_CONTRACTVALIDATIONMESSAGE']._serialized_end=6214
-  _globals['_NEGOTIATEDTASKSESSION']._serialized_start=6217
-  _globals['_NEGOTIATEDTASKSESSION']._serialized_end=6468
-  _globals['_OBSERVATIONSLOT']._serialized_start=6470
-  _globals['_OBSERVATIONSLOT']._serialized_end=6546
-  _globals['_ACTIONGROUPSLOT']._serialized_start=6548
-  _globals['_ACTIONGROUPSLOT']._serialized_end=6631
-  _globals['_GETCAPABILITYMANIFESTREQUEST']._serialized_start=6633
-  _globals['_GETCAPABILITYMANIFESTREQUEST']._serialized_end=6698
-  _globals['_GETCAPABILITYMANIFESTRESPONSE']._serialized_start=6700
-  _globals['_GETCAPABILITYMANIFESTRESPONSE']._serialized_end=6786
-  _globals['_VALIDATETASKCONTRACTREQUEST']._serialized_start=6788
-  _globals['_VALIDATETASKCONTRACTREQUEST']._serialized_end=6860
-  _globals['_VALIDATETASKCONTRACTRESPONSE']._serialized_start=6862
-  _globals['_VALIDATETASKCONTRACTRESPONSE']._serialized_end=6945
-  _globals['_NEGOTIATETASKREQUEST']._serialized_start=6947
-  _globals['_NEGOTIATETASKREQUEST']._serialized_end=7012
-  _globals['_NEGOTIATETASKRESPONSE']._serialized_start=7015
-  _globals['_NEGOTIATETASKRESPONSE']._serialized_end=7180
-  _globals['_POLICYCOMMANDIDENTRY']._serialized_start=7182
-  _globals['_POLICYCOMMANDIDENTRY']._serialized_end=7274
-  _globals['_POLICYOBSERVATIONFIELD']._serialized_start=7276
-  _globals['_POLICYOBSERVATIONFIELD']._serialized_end=7342
-  _globals['_POLICYSLOTSUMMARY']._serialized_start=7345
-  _globals['_POLICYSLOTSUMMARY']._serialized_end=7651
-  _globals['_ROBOTCONTROLLERSUMMARY']._serialized_start=7654
-  _globals['_ROBOTCONTROLLERSUMMARY']._serialized_end=7810
-  _globals['_POLICYREGISTRYENTRY']._serialized_start=7813
-  _globals['_POLICYREGISTRYENTRY']._serialized_end=8172
-  _globals['_POLICYREGISTRYENTRY_COMMANDALIASESENTRY']._serialized_start=8119
-  _globals['_POLICYREGISTRYENTRY_COMMANDALIASESENTRY']._serialized_end=8172
-  _globals['_MOTIONGRAPHINPUTVALUE']._serialized_start=8175
-  _globals['_MOTIONGRAPHINPUTVALUE']._serialized_end=8323
-  _globals['_POLICYOPERATIONACK']._serialized_start=8325
-  _globals['_POLICYOPERATIONACK']._serialized_end=8379
-  _globals['_LISTROBOTCONTROLLERSREQUEST']._serialized_start=8381
-  _globals['_LISTROBOTCONTROLLERSREQUEST']._serialized_end=8410
-  _globals['_LISTROBOTCONTROLLERSRESPONSE']._serialized_start=8412
-  _globals['_LISTROBOTCONTROLLERSRESPONSE']._serialized_end=8498
-  _globals['_GETROBOTCONTROLLERREQUEST']._serialized_start=8500
-  _globals['_GETROBOTCONTROLLERREQUEST']._serialized_end=8564
-  _globals['_GETROBOTCONTROLLERRESPONSE']._serialized_start=8566
-  _globals['_GETROBOTCONTROLLERRESPONSE']._serialized_end=8664
-  _globals['_LISTPOLICYDESCRIPTORSREQUEST']._serialized_start=8666
-  _globals['_LISTPOLICYDESCRIPTORSREQUEST']._serialized_end=8696
-  _globals['_LISTPOLICYDESCRIPTORSRESPONSE']._serialized_start=8698
-  _globals['_LISTPOLICYDESCRIPTORSRESPONSE']._serialized_end=8779
-  _globals['_SETPOLICYACTIVEREQUEST']._serialized_start=8781
-  _globals['_SETPOLICYACTIVEREQUEST']._serialized_end=8875
-  _globals['_SETPOLICYDESCRIPTORREQUEST']._serialized_start=8877
-  _globals['_SETPOLICYDESCRIPTORREQUEST']._serialized_end=8984
-  _globals['_SETPOLICYDRIVENJOINTSREQUEST']._serialized_start=8986
-  _globals['_SETPOLICYDRIVENJOINTSREQUEST']._serialized_end=9091
-  _globals['_SETPOLICYCLAMPOBSERVATIONREQUEST']._serialized_start=9094
-  _globals['_SETPOLICYCLAMPOBSERVATIONREQUEST']._serialized_end=9230
-  _globals['_SETPOLICYPRIORITYREQUEST']._serialized_start=9232
-  _globals['_SETPOLICYPRIORITYREQUEST']._serialized_end=9330
-  _globals['_SETPOLICYCOMMANDFLOATREQUEST']._serialized_start=9332
-  _globals['_SETPOLICYCOMMANDFLOATREQUEST']._serialized_end=9451
-  _globals['_SETPOLICYCOMMANDBOOLREQUEST']._serialized_start=9453
-  _globals['_SETPOLICYCOMMANDBOOLREQUEST']._serialized_end=9571
-  _globals['_JOINTGAINOVERRIDE']._serialized_start=9574
-  _globals['_JOINTGAINOVERRIDE']._serialized_end=9791
-  _globals['_SETPOLICYGAINSREQUEST']._serialized_start=9793
-  _globals['_SETPOLICYGAINSREQUEST']._serialized_end=9919
-  _globals['_CLEARPOLICYGAINSREQUEST']._serialized_start=9921
-  _globals['_CLEARPOLICYGAINSREQUEST']._serialized_end=10000
-  _globals['_GETPOLICYCOMMANDFLOATREQUEST']._serialized_start=10002
-  _globals['_GETPOLICYCOMMANDFLOATREQUEST']._serialized_end=10106
-  _globals['_POLICYCOMMANDFLOATVALUE']._serialized_start=10108
-  _globals['_POLICYCOMMANDFLOATVALUE']._serialized_end=10182
-  _globals['_GETPOLICYCOMMANDBOOLREQUEST']._serialized_start=10184
-  _globals['_GETPOLICYCOMMANDBOOLREQUEST']._serialized_end=10287
-  _globals['_POLICYCOMMANDBOOLVALUE']._serialized_start=10289
-  _globals['_POLICYCOMMANDBOOLVALUE']._serialized_end=10362
-  _globals['_SETMOTIONGRAPHACTIVEREQUEST']._serialized_start=10364
-  _globals['_SETMOTIONGRAPHACTIVEREQUEST']._serialized_end=10446
-  _globals['_GETMOTIONGRAPHACTIVEREQUEST']._serialized_start=10448
-  _globals['_GETMOTIONGRAPHACTIVEREQUEST']._serialized_end=10514
-  _globals['_GETMOTIONGRAPHACTIVERESPONSE']._serialized_start=10516
-  _globals['_GETMOTIONGRAPHACTIVERESPONSE']._serialized_end=10596
-  _globals['_SETMOTIONGRAPHINPUTREQUEST']._serialized_start=10599
-  _globals['_SETMOTIONGRAPHINPUTREQUEST']._serialized_end=10731
-  _globals['_GETMOTIONGRAPHINPUTREQUEST']._serialized_start=10734
-  _globals['_GETMOTIONGRAPHINPUTREQUEST']._serialized_end=10866
-  _globals['_GETMOTIONGRAPHINPUTRESPONSE']._serialized_start=10868
-  _globals['_GETMOTIONGRAPHINPUTRESPONSE']._serialized_end=10980
-  _globals['_FIREMOTIONGRAPHTRIGGERREQUEST']._serialized_start=10982
-  _globals['_FIREMOTIONGRAPHTRIGGERREQUEST']._serialized_end=11068
-  _globals['_STREAMPOLICYSLOTSTATEREQUEST']._serialized_start=11070
-  _globals['_STREAMPOLICYSLOTSTATEREQUEST']._serialized_end=11174
-  _globals['_STREAMROBOTCONTROLLERREQUEST']._serialized_start=11176
-  _globals['_STREAMROBOTCONTROLLERREQUEST']._serialized_end=11263
-  _globals['_GETPOLICYBASEPOSEREQUEST']._serialized_start=11265
-  _globals['_GETPOLICYBASEPOSEREQUEST']._serialized_end=11345
-  _globals['_POLICYBASEPOSE']._serialized_start=11348
-  _globals['_POLICYBASEPOSE']._serialized_end=11477
-  _globals['_GETPOLICYLASTACTIONREQUEST']._serialized_start=11479
-  _globals['_GETPOLICYLASTACTIONREQUEST']._serialized_end=11561
-  _globals['_POLICYLASTACTION']._serialized_start=11563
-  _globals['_POLICYLASTACTION']._serialized_end=11656
-  _globals['_AGENTSERVICE']._serialized_start=11851
-  _globals['_AGENTSERVICE']._serialized_end=14752
+  _globals['_MODELRANDOMIZATIONFIELD']._serialized_start=19172
+  _globals['_MODELRANDOMIZATIONFIELD']._serialized_end=19511
+  _globals['_RANDOMIZATIONOPERATION']._serialized_start=19513
+  _globals['_RANDOMIZATIONOPERATION']._serialized_end=19638
+  _globals['_RANDOMIZATIONDISTRIBUTION']._serialized_start=19641
+  _globals['_RANDOMIZATIONDISTRIBUTION']._serialized_end=19793
+  _globals['_SUBSTEPREDUCTION']._serialized_start=19795
+  _globals['_SUBSTEPREDUCTION']._serialized_end=19896
+  _globals['_CAMERACAPTUREMODE']._serialized_start=19898
+  _globals['_CAMERACAPTUREMODE']._serialized_end=19972
+  _globals['_STEPENCODING']._serialized_start=19974
+  _globals['_STEPENCODING']._serialized_end=20039
+  _globals['_PHYSICSBACKEND']._serialized_start=20041
+  _globals['_PHYSICSBACKEND']._serialized_end=20165
+  _globals['_OBSERVATIONNOISETYPE']._serialized_start=20167
+  _globals['_OBSERVATIONNOISETYPE']._serialized_end=20280
+  _globals['_POLICYCOMMANDTYPE']._serialized_start=20283
+  _globals['_POLICYCOMMANDTYPE']._serialized_end=20472
+  _globals['_AGENTSCHEMA']._serialized_start=119
+  _globals['_AGENTSCHEMA']._serialized_end=248
+  _globals['_GETAGENTSCHEMAREQUEST']._serialized_start=250
+  _globals['_GETAGENTSCHEMAREQUEST']._serialized_end=293
+  _globals['_GETAGENTSCHEMARESPONSE']._serialized_start=295
+  _globals['_GETAGENTSCHEMARESPONSE']._serialized_end=359
+  _globals['_SIMULATIONCONTRACT']._serialized_start=362
+  _globals['_SIMULATIONCONTRACT']._serialized_end=946
+  _globals['_RESETAGENTREQUEST']._serialized_start=949
+  _globals['_RESETAGENTREQUEST']._serialized_end=1135
+  _globals['_RESETAGENTRESPONSE']._serialized_start=1137
+  _globals['_RESETAGENTRESPONSE']._serialized_end=1255
+  _globals['_MODELRANDOMIZATION']._serialized_start=1258
+  _globals['_MODELRANDOMIZATION']._serialized_end=1503
+  _globals['_MODELRANDOMIZATIONCONFIG']._serialized_start=1505
+  _globals['_MODELRANDOMIZATIONCONFIG']._serialized_end=1611
+  _globals['_RANDOMIZATIONCOLUMN']._serialized_start=1614
+  _globals['_RANDOMIZATIONCOLUMN']._serialized_end=1749
+  _globals['_APPLIEDRANDOMIZATION']._serialized_start=1752
+  _globals['_APPLIEDRANDOMIZATION']._serialized_end=1919
+  _globals['_AGENTFRAME']._serialized_start=1922
+  _globals['_AGENTFRAME']._serialized_end=2057
+  _globals['_GETCAMERAFRAMEREQUEST']._serialized_start=2060
+  _globals['_GETCAMERAFRAMEREQUEST']._serialized_end=2289
+  _globals['_GETVIEWPORTFRAMEREQUEST']._serialized_start=2291
+  _globals['_GETVIEWPORTFRAMEREQUEST']._serialized_end=2386
+  _globals['_ACTIONGROUPENTRY']._serialized_start=2388
+  _globals['_ACTIONGROUPENTRY']._serialized_end=2467
+  _globals['_SETACTIONGROUPREQUEST']._serialized_start=2469
+  _globals['_SETACTIONGROUPREQUEST']._serialized_end=2556
+  _globals['_SETACTIONGROUPRESPONSE']._serialized_start=2558
+  _globals['_SETACTIONGROUPRESPONSE']._serialized_end=2616
+  _globals['_STEPREQUEST']._serialized_start=2619
+  _globals['_STEPREQUEST']._serialized_end=3190
+  _globals['_STEPRESPONSE']._serialized_start=3193
+  _globals['_STEPRESPONSE']._serialized_end=4177
+  _globals['_STEPRESPONSE_REWARDSIGNALSENTRY']._serialized_start=4011
+  _globals['_STEPRESPONSE_REWARDSIGNALSENTRY']._serialized_end=4063
+  _globals['_STEPRESPONSE_INFOENTRY']._serialized_start=4065
+  _globals['_STEPRESPONSE_INFOENTRY']._serialized_end=4108
+  _globals['_STEPRESPONSE_TERMINATIONFLAGSENTRY']._serialized_start=4110
+  _globals['_STEPRESPONSE_TERMINATIONFLAGSENTRY']._serialized_end=4165
+  _globals['_STEPPROFILE']._serialized_start=4180
+  _globals['_STEPPROFILE']._serialized_end=4430
+  _globals['_PHYSICSTHREADTIMING']._serialized_start=4432
+  _globals['_PHYSICSTHREADTIMING']._serialized_end=4539
+  _globals['_OPENSHAREDMEMORYTRANSPORTREQUEST']._serialized_start=4541
+  _globals['_OPENSHAREDMEMORYTRANSPORTREQUEST']._serialized_end=4646
+  _globals['_OPENSHAREDMEMORYTRANSPORTRESPONSE']._serialized_start=4649
+  _globals['_OPENSHAREDMEMORYTRANSPORTRESPONSE']._serialized_end=4821
+  _globals['_CLOSESHAREDMEMORYTRANSPORTREQUEST']._serialized_start=4823
+  _globals['_CLOSESHAREDMEMORYTRANSPORTREQUEST']._serialized_end=4880
+  _globals['_CLOSESHAREDMEMORYTRANSPORTRESPONSE']._serialized_start=4882
+  _globals['_CLOSESHAREDMEMORYTRANSPORTRESPONSE']._serialized_end=4952
+  _globals['_SHAREDMEMORYIMAGE']._serialized_start=4955
+  _globals['_SHAREDMEMORYIMAGE']._serialized_end=5179
+  _globals['_SHAREDMEMORYSLOT']._serialized_start=5182
+  _globals['_SHAREDMEMORYSLOT']._serialized_end=5371
+  _globals['_BATCHSTEPREQUEST']._serialized_start=5374
+  _globals['_BATCHSTEPREQUEST']._serialized_end=5595
+  _globals['_BATCHSTEPRESPONSE']._serialized_start=5598
+  _globals['_BATCHSTEPRESPONSE']._serialized_end=5972
+  _globals['_PROGRESSREPORT']._serialized_start=5975
+  _globals['_PROGRESSREPORT']._serialized_end=6210
+  _globals['_PROGRESSACK']._serialized_start=6212
+  _globals['_PROGRESSACK']._serialized_end=6243
+  _globals['_TASKCONTRACT']._serialized_start=6246
+  _globals['_TASKCONTRACT']._serialized_end=6735
+  _globals['_OBSERVATIONCONTRACT']._serialized_start=6737
+  _globals['_OBSERVATIONCONTRACT']._serialized_end=6864
+  _globals['_OBSERVATIONTERMREQUEST']._serialized_start=6867
+  _globals['_OBSERVATIONTERMREQUEST']._serialized_end=7103
+  _globals['_OBSERVATIONTERMREQUEST_PARAMSENTRY']._serialized_start=7058
+  _globals['_OBSERVATIONTERMREQUEST_PARAMSENTRY']._serialized_end=7103
+  _globals['_OBSERVATIONNOISE']._serialized_start=7105
+  _globals['_OBSERVATIONNOISE']._serialized_end=7210
+  _globals['_ACTIONCONTRACT']._serialized_start=7212
+  _globals['_ACTIONCONTRACT']._serialized_end=7273
+  _globals['_ACTIONTERMREQUEST']._serialized_start=7276
+  _globals['_ACTIONTERMREQUEST']._serialized_end=7452
+  _globals['_ACTIONTERMREQUEST_PARAMSENTRY']._serialized_start=7058
+  _globals['_ACTIONTERMREQUEST_PARAMSENTRY']._serialized_end=7103
+  _globals['_REWARDCONTRACT']._serialized_start=7454
+  _globals['_REWARDCONTRACT']._serialized_end=7544
+  _globals['_REWARDTERMREQUEST']._serialized_start=7547
+  _globals['_REWARDTERMREQUEST']._serialized_end=7701
+  _globals['_REWARDTERMREQUEST_PARAMSENTRY']._serialized_start=7058
+  _globals['_REWARDTERMREQUEST_PARAMSENTRY']._serialized_end=7103
+  _globals['_TERMINATIONCONTRACT']._serialized_start=7703
+  _globals['_TERMINATIONCONTRACT']._serialized_end=7774
+  _globals['_TERMINATIONTERMREQUEST']._serialized_start=7777
+  _globals['_TERMINATIONTERMREQUEST']._serialized_end=7945
+  _globals['_TERMINATIONTERMREQUEST_PARAMSENTRY']._serialized_start=7058
+  _globals['_TERMINATIONTERMREQUEST_PARAMSENTRY']._serialized_end=7103
+  _globals['_RANDOMIZATIONCONTRACT']._serialized_start=7948
+  _globals['_RANDOMIZATIONCONTRACT']._serialized_end=8121
+  _globals['_CUSTOMRANDOMIZATION']._serialized_start=8123
+  _globals['_CUSTOMRANDOMIZATION']._serialized_end=8212
+  _globals['_AUXILIARYDATAREQUEST']._serialized_start=8215
+  _globals['_AUXILIARYDATAREQUEST']._serialized_end=8359
+  _globals['_AUXILIARYDATAREQUEST_PARAMSENTRY']._serialized_start=7058
+  _globals['_AUXILIARYDATAREQUEST_PARAMSENTRY']._serialized_end=7103
+  _globals['_ENGINECAPABILITYMANIFEST']._serialized_start=8362
+  _globals['_ENGINECAPABILITYMANIFEST']._serialized_end=8886
+  _globals['_PHYSICSBACKENDDESCRIPTOR']._serialized_start=8889
+  _globals['_PHYSICSBACKENDDESCRIPTOR']._serialized_end=9066
+  _globals['_MDPCOMPONENTDESCRIPTOR']._serialized_start=9069
+  _globals['_MDPCOMPONENTDESCRIPTOR']._serialized_end=9387
+  _globals['_MDPCOMPONENTDESCRIPTOR_PARAMSSCHEMAENTRY']._serialized_start=9305
+  _globals['_MDPCOMPONENTDESCRIPTOR_PARAMSSCHEMAENTRY']._serialized_end=9387
+  _globals['_MDPPARAMDESCRIPTOR']._serialized_start=9390
+  _globals['_MDPPARAMDESCRIPTOR']._serialized_end=9525
+  _globals['_MDPRANDOMIZATIONDESCRIPTOR']._serialized_start=9528
+  _globals['_MDPRANDOMIZATIONDESCRIPTOR']._serialized_end=9682
+  _globals['_MDPROBOTINFO']._serialized_start=9685
+  _globals['_MDPROBOTINFO']._serialized_end=9900
+  _globals['_MDPACTUATORLIMIT']._serialized_start=9902
+  _globals['_MDPACTUATORLIMIT']._serialized_end=9988
+  _globals['_CONTRACTVALIDATIONRESULT']._serialized_start=9991
+  _globals['_CONTRACTVALIDATIONRESULT']._serialized_end=10257
+  _globals['_CONTRACTVALIDATIONMESSAGE']._serialized_start=10259
+  _globals['_CONTRACTVALIDATIONMESSAGE']._serialized_end=10379
+  _globals['_NEGOTIATEDTASKSESSION']._serialized_start=10382
+  _globals['_NEGOTIATEDTASKSESSION']._serialized_end=10909
+  _globals['_OBSERVATIONPROGRAM']._serialized_start=10912
+  _globals['_OBSERVATIONPROGRAM']._serialized_end=11053
+  _globals['_OBSERVATIONKERNEL']._serialized_start=11055
+  _globals['_OBSERVATIONKERNEL']._serialized_end=11164
+  _globals['_PACKEDSTEPLAYOUT']._serialized_start=11167
+  _globals['_PACKEDSTEPLAYOUT']._serialized_end=11352
+  _globals['_OBSERVATIONSLOT']._serialized_start=11354
+  _globals['_OBSERVATIONSLOT']._serialized_end=11430
+  _globals['_ACTIONGROUPSLOT']._serialized_start=11432
+  _globals['_ACTIONGROUPSLOT']._serialized_end=11515
+  _globals['_GETCAPABILITYMANIFESTREQUEST']._serialized_start=11517
+  _globals['_GETCAPABILITYMANIFESTREQUEST']._serialized_end=11582
+  _globals['_GETCAPABILITYMANIFESTRESPONSE']._serialized_start=11584
+  _globals['_GETCAPABILITYMANIFESTRESPONSE']._serialized_end=11670
+  _globals['_VALIDATETASKCONTRACTREQUEST']._serialized_start=11672
+  _globals['_VALIDATETASKCONTRACTREQUEST']._serialized_end=11744
+  _globals['_VALIDATETASKCONTRACTRESPONSE']._serialized_start=11746
+  _globals['_VALIDATETASKCONTRACTRESPONSE']._serialized_end=11829
+  _globals['_NEGOTIATETASKREQUEST']._serialized_start=11831
+  _globals['_NEGOTIATETASKREQUEST']._serialized_end=11925
+  _globals['_NEGOTIATETASKRESPONSE']._serialized_start=11928
+  _globals['_NEGOTIATETASKRESPONSE']._serialized_end=12093
+  _globals['_ENGINEFINGERPRINT']._serialized_start=12095
+  _globals['_ENGINEFINGERPRINT']._serialized_end=12220
+  _globals['_GETENGINEFINGERPRINTREQUEST']._serialized_start=12222
+  _globals['_GETENGINEFINGERPRINTREQUEST']._serialized_end=12251
+  _globals['_GETENGINEFINGERPRINTRESPONSE']._serialized_start=12253
+  _globals['_GETENGINEFINGERPRINTRESPONSE']._serialized_end=12334
+  _globals['_POLICYCOMMANDIDENTRY']._serialized_start=12336
+  _globals['_POLICYCOMMANDIDENTRY']._serialized_end=12428
+  _globals['_POLICYOBSERVATIONFIELD']._serialized_start=12430
+  _globals['_POLICYOBSERVATIONFIELD']._serialized_end=12496
+  _globals['_POLICYSLOTSUMMARY']._serialized_start=12499
+  _globals['_POLICYSLOTSUMMARY']._serialized_end=12857
+  _globals['_POLICYINFERENCESTATS']._serialized_start=12860
+  _globals['_POLICYINFERENCESTATS']._serialized_end=13005
+  _globals['_POLICYINFERENCEBATCH']._serialized_start=13007
+  _globals['_POLICYINFERENCEBATCH']._serialized_end=13121
+  _globals['_ROBOTCONTROLLERSUMMARY']._serialized_start=13124
+  _globals['_ROBOTCONTROLLERSUMMARY']._serialized_end=13280
+  _globals['_POLICYREGISTRYENTRY']._serialized_start=13283
+  _globals['_POLICYREGISTRYENTRY']._serialized_end=13642
+  _globals['_POLICYREGISTRYENTRY_COMMANDALIASESENTRY']._serialized_start=13589
+  _globals['_POLICYREGISTRYENTRY_COMMANDALIASESENTRY']._serialized_end=13642
+  _globals['_MOTIONGRAPHINPUTVALUE']._serialized_start=13645
+  _globals['_MOTIONGRAPHINPUTVALUE']._serialized_end=13793
+  _globals['_POLICYOPERATIONACK']._serialized_start=13795
+  _globals['_POLICYOPERATIONACK']._serialized_end=13849
+  _globals['_LISTROBOTCONTROLLERSREQUEST']._serialized_start=13851
+  _globals['_LISTROBOTCONTROLLERSREQUEST']._serialized_end=13880
+  _globals['_LISTROBOTCONTROLLERSRESPONSE']._serialized_start=13883
+  _globals['_LISTROBOTCONTROLLERSRESPONSE']._serialized_end=14029
+  _globals['_POLICYINFERENCECONFIG']._serialized_start=14031
+  _globals['_POLICYINFERENCECONFIG']._serialized_end=14134
+  _globals['_GETPOLICYINFERENCECONFIGREQUEST']._serialized_start=14136
+  _globals['_GETPOLICYINFERENCECONFIGREQUEST']._serialized_end=14169
+  _globals['_POLICYINFERENCECONFIGRESPONSE']._serialized_start=14172
+  _globals['_POLICYINFERENCECONFIGRESPONSE']._serialized_end=14326
+  _globals['_GETROBOTCONTROLLERREQUEST']._serialized_start=14328
+  _globals['_GETROBOTCONTROLLERREQUEST']._serialized_end=14392
+  _globals['_GETROBOTCONTROLLERRESPONSE']._serialized_start=14394
+  _globals['_GETROBOTCONTROLLERRESPONSE']._serialized_end=14492
+  _globals['_LISTPOLICYDESCRIPTORSREQUEST']._serialized_start=14494
+  _globals['_LISTPOLICYDESCRIPTORSREQUEST']._serialized_end=14524
+  _globals['_LISTPOLICYDESCRIPTORSRESPONSE']._serialized_start=14526
+  _globals['_LISTPOLICYDESCRIPTORSRESPONSE']._serialized_end=14607
+  _globals['_SETPOLICYACTIVEREQUEST']._serialized_start=14609
+  _globals['_SETPOLICYACTIVEREQUEST']._serialized_end=14703
+  _globals['_SETPOLICYDESCRIPTORREQUEST']._serialized_start=14705
+  _globals['_SETPOLICYDESCRIPTORREQUEST']._serialized_end=14812
+  _globals['_SETPOLICYDRIVENJOINTSREQUEST']._serialized_start=14814
+  _globals['_SETPOLICYDRIVENJOINTSREQUEST']._serialized_end=14919
+  _globals['_SETPOLICYCLAMPOBSERVATIONREQUEST']._serialized_start=14922
+  _globals['_SETPOLICYCLAMPOBSERVATIONREQUEST']._serialized_end=15058
+  _globals['_SETPOLICYPRIORITYREQUEST']._serialized_start=15060
+  _globals['_SETPOLICYPRIORITYREQUEST']._serialized_end=15158
+  _globals['_SETPOLICYCOMMANDFLOATREQUEST']._serialized_start=15160
+  _globals['_SETPOLICYCOMMANDFLOATREQUEST']._serialized_end=15279
+  _globals['_SETPOLICYCOMMANDBOOLREQUEST']._serialized_start=15281
+  _globals['_SETPOLICYCOMMANDBOOLREQUEST']._serialized_end=15399
+  _globals['_JOINTGAINOVERRIDE']._serialized_start=15402
+  _globals['_JOINTGAINOVERRIDE']._serialized_end=15619
+  _globals['_SETPOLICYGAINSREQUEST']._serialized_start=15621
+  _globals['_SETPOLICYGAINSREQUEST']._serialized_end=15747
+  _globals['_CLEARPOLICYGAINSREQUEST']._serialized_start=15749
+  _globals['_CLEARPOLICYGAINSREQUEST']._serialized_end=15828
+  _globals['_GETPOLICYCOMMANDFLOATREQUEST']._serialized_start=15830
+  _globals['_GETPOLICYCOMMANDFLOATREQUEST']._serialized_end=15934
+  _globals['_POLICYCOMMANDFLOATVALUE']._serialized_start=15936
+  _globals['_POLICYCOMMANDFLOATVALUE']._serialized_end=16010
+  _globals['_GETPOLICYCOMMANDBOOLREQUEST']._serialized_start=16012
+  _globals['_GETPOLICYCOMMANDBOOLREQUEST']._serialized_end=16115
+  _globals['_POLICYCOMMANDBOOLVALUE']._serialized_start=16117
+  _globals['_POLICYCOMMANDBOOLVALUE']._serialized_end=16190
+  _globals['_SETMOTIONGRAPHACTIVEREQUEST']._serialized_start=16192
+  _globals['_SETMOTIONGRAPHACTIVEREQUEST']._serialized_end=16274
+  _globals['_GETMOTIONGRAPHACTIVEREQUEST']._serialized_start=16276
+  _globals['_GETMOTIONGRAPHACTIVEREQUEST']._serialized_end=16342
+  _globals['_GETMOTIONGRAPHACTIVERESPONSE']._serialized_start=16344
+  _globals['_GETMOTIONGRAPHACTIVERESPONSE']._serialized_end=16424
+  _globals['_SETMOTIONGRAPHINPUTREQUEST']._serialized_start=16427
+  _globals['_SETMOTIONGRAPHINPUTREQUEST']._serialized_end=16559
+  _globals['_GETMOTIONGRAPHINPUTREQUEST']._serialized_start=16562
+  _globals['_GETMOTIONGRAPHINPUTREQUEST']._serialized_end=16694
+  _globals['_GETMOTIONGRAPHINPUTRESPONSE']._serialized_start=16696
+  _globals['_GETMOTIONGRAPHINPUTRESPONSE']._serialized_end=16808
+  _globals['_FIREMOTIONGRAPHTRIGGERREQUEST']._serialized_start=16810
+  _globals['_FIREMOTIONGRAPHTRIGGERREQUEST']._serialized_end=16896
+  _globals['_STREAMPOLICYSLOTSTATEREQUEST']._serialized_start=16898
+  _globals['_STREAMPOLICYSLOTSTATEREQUEST']._serialized_end=17002
+  _globals['_STREAMROBOTCONTROLLERREQUEST']._serialized_start=17004
+  _globals['_STREAMROBOTCONTROLLERREQUEST']._serialized_end=17091
+  _globals['_GETPOLICYBASEPOSEREQUEST']._serialized_start=17093
+  _globals['_GETPOLICYBASEPOSEREQUEST']._serialized_end=17173
+  _globals['_POLICYBASEPOSE']._serialized_start=17176
+  _globals['_POLICYBASEPOSE']._serialized_end=17305
+  _globals['_GETPOLICYLASTACTIONREQUEST']._serialized_start=17307
+  _globals['_GETPOLICYLASTACTIONREQUEST']._serialized_end=17389
+  _globals['_POLICYLASTACTION']._serialized_start=17391
+  _globals['_POLICYLASTACTION']._serialized_end=17484
+  _globals['_ROBOTCOMMAND']._serialized_start=17487
+  _globals['_ROBOTCOMMAND']._serialized_end=18026
+  _globals['_APPLYROBOTCOMMANDSREQUEST']._serialized_start=18028
+  _globals['_APPLYROBOTCOMMANDSREQUEST']._serialized_end=18121
+  _globals['_ROBOTCOMMANDERROR']._serialized_start=18123
+  _globals['_ROBOTCOMMANDERROR']._serialized_end=18174
+  _globals['_APPLYROBOTCOMMANDSRESPONSE']._serialized_start=18177
+  _globals['_APPLYROBOTCOMMANDSRESPONSE']._serialized_end=18336
+  _globals['_SYNCSUBSTREAM']._serialized_start=18339
+  _globals['_SYNCSUBSTREAM']._serialized_end=18554
+  _globals['_STREAMSYNCHRONIZEDREQUEST']._serialized_start=18556
+  _globals['_STREAMSYNCHRONIZEDREQUEST']._serialized_end=18669
+  _globals['_SYNCPAYLOAD']._serialized_start=18672
+  _globals['_SYNCPAYLOAD']._serialized_end=18884
+  _globals['_SYNCSTREAMSTATS']._serialized_start=18886
+  _globals['_SYNCSTREAMSTATS']._serialized_end=18972
+  _globals['_SYNCHRONIZEDFRAME']._serialized_start=18975
+  _globals['_SYNCHRONIZEDFRAME']._serialized_end=19169
+  _globals['_AGENTSERVICE']._serialized_start=20475
+  _globals['_AGENTSERVICE']._serialized_end=24272
 # @@protoc_insertion_point(module_scope)
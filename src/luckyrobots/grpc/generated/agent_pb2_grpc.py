@@ -50,6 +50,26 @@ class AgentServiceStub(object):
                 request_serializer=agent__pb2.StepRequest.SerializeToString,
                 response_deserializer=agent__pb2.StepResponse.FromString,
                 _registered_method=True)
+        self.StepStream = channel.stream_stream(
+                '/hazel.rpc.AgentService/StepStream',
+                request_serializer=agent__pb2.StepRequest.SerializeToString,
+                response_deserializer=agent__pb2.StepResponse.FromString,
+                _registered_method=True)
+        self.BatchStep = channel.unary_unary(
+                '/hazel.rpc.AgentService/BatchStep',
+                request_serializer=agent__pb2.BatchStepRequest.SerializeToString,
+                response_deserializer=agent__pb2.BatchStepResponse.FromString,
+                _registered_method=True)
+        self.OpenSharedMemoryTransport = channel.unary_unary(
+                '/hazel.rpc.AgentService/OpenSharedMemoryTransport',
+                request_serializer=agent__pb2.OpenSharedMemoryTransportRequest.SerializeToString,
+                response_deserializer=agent__pb2.OpenSharedMemoryTransportResponse.FromString,
+                _registered_method=True)
+        self.CloseSharedMemoryTransport = channel.unary_unary(
+                '/hazel.rpc.AgentService/CloseSharedMemoryTransport',
+                request_serializer=agent__pb2.CloseSharedMemoryTransportRequest.SerializeToString,
+                response_deserializer=agent__pb2.CloseSharedMemoryTransportResponse.FromString,
+                _registered_method=True)
         self.SetActionGroup = channel.unary_unary(
                 '/hazel.rpc.AgentService/SetActionGroup',
                 request_serializer=agent__pb2.SetActionGroupRequest.SerializeToString,
@@ -75,6 +95,11 @@ class AgentServiceStub(object):
                 request_serializer=agent__pb2.NegotiateTaskRequest.SerializeToString,
                 response_deserializer=agent__pb2.NegotiateTaskResponse.FromString,
                 _registered_method=True)
+        self.GetEngineFingerprint = channel.unary_unary(
+                '/hazel.rpc.AgentService/GetEngineFingerprint',
+                request_serializer=agent__pb2.GetEngineFingerprintRequest.SerializeToString,
+                response_deserializer=agent__pb2.GetEngineFingerprintResponse.FromString,
+                _registered_method=True)
         self.ListRobotControllers = channel.unary_unary(
                 '/hazel.rpc.AgentService/ListRobotControllers',
                 request_serializer=agent__pb2.ListRobotControllersRequest.SerializeToString,
@@ -170,6 +195,11 @@ class AgentServiceStub(object):
                 request_serializer=agent__pb2.FireMotionGraphTriggerRequest.SerializeToString,
                 response_deserializer=agent__pb2.PolicyOperationAck.FromString,
                 _registered_method=True)
+        self.ApplyRobotCommands = channel.unary_unary(
+                '/hazel.rpc.AgentService/ApplyRobotCommands',
+                request_serializer=agent__pb2.ApplyRobotCommandsRequest.SerializeToString,
+                response_deserializer=agent__pb2.ApplyRobotCommandsResponse.FromString,
+                _registered_method=True)
         self.GetPolicyBasePose = channel.unary_unary(
                 '/hazel.rpc.AgentService/GetPolicyBasePose',
                 request_serializer=agent__pb2.GetPolicyBasePoseRequest.SerializeToString,
@@ -190,6 +220,21 @@ class AgentServiceStub(object):
                 request_serializer=agent__pb2.StreamRobotControllerRequest.SerializeToString,
                 response_deserializer=agent__pb2.RobotControllerSummary.FromString,
                 _registered_method=True)
+        self.StreamSynchronized = channel.unary_stream(
+                '/hazel.rpc.AgentService/StreamSynchronized',
+                request_serializer=agent__pb2.StreamSynchronizedRequest.SerializeToString,
+                response_deserializer=agent__pb2.SynchronizedFrame.FromString,
+                _registered_method=True)
+        self.GetPolicyInferenceConfig = channel.unary_unary(
+                '/hazel.rpc.AgentService/GetPolicyInferenceConfig',
+                request_serializer=agent__pb2.GetPolicyInferenceConfigRequest.SerializeToString,
+                response_deserializer=agent__pb2.PolicyInferenceConfigResponse.FromString,
+                _registered_method=True)
+        self.SetPolicyInferenceConfig = channel.unary_unary(
+                '/hazel.rpc.AgentService/SetPolicyInferenceConfig',
+                request_serializer=agent__pb2.PolicyInferenceConfig.SerializeToString,
+                response_deserializer=agent__pb2.PolicyInferenceConfigResponse.FromString,
+                _registered_method=True)
 
 
 class AgentServiceServicer(object):
@@ -220,6 +265,37 @@ class AgentServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def StepStream(self, request_iterator, context):
+        """Persistent bidirectional step loop: one long-lived stream per agent instead
+        of a unary call per tick. Each StepRequest yields exactly one StepResponse,
+        in request order; clients may pipeline several requests before reading.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def BatchStep(self, request, context):
+        """Vectorized step: apply an [N, action_dim] action tensor to every env replica
+        of a negotiated session and return [N, obs_dim] observations with packed
+        reward signals and terminated/truncated flags.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def OpenSharedMemoryTransport(self, request, context):
+        """Negotiate / release a same-host shared-memory ring for Step payloads.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def CloseSharedMemoryTransport(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def SetActionGroup(self, request, context):
         """Preload actions for a named group without triggering physics.
         Use with Step() for multi-policy control (e.g., separate locomotion + manipulation policies).
@@ -257,6 +333,14 @@ class AgentServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def GetEngineFingerprint(self, request, context):
+        """Content hashes of the model, capability manifest and API surface; one
+        cheap call that lets clients reuse cached metadata (see EngineFingerprint).
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def ListRobotControllers(self, request, context):
         """------------------------------------------------------------------------
         Robot Controller / Policy RPCs (multi-slot PolicySlot + MotionGraph)
@@ -384,6 +468,15 @@ class AgentServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def ApplyRobotCommands(self, request, context):
+        """Coalesced writes: a batch of typed command / gain / motion-graph writes
+        for any number of controllers and slots, validated up front and applied
+        together at the start of the next physics tick (never split across ticks).
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def GetPolicyBasePose(self, request, context):
         """Missing associated documentation comment in .proto file."""
         context.set_code(grpc.StatusCode.UNIMPLEMENTED)
@@ -408,6 +501,29 @@ class AgentServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def StreamSynchronized(self, request, context):
+        """Lock-step multi-source stream: one SynchronizedFrame per `decimation`
+        physics ticks carrying every requested sub-stream captured at the same
+        frame_number. Flow-controlled — ticks the client can't keep up with are
+        skipped at the source and counted in SyncStreamStats.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetPolicyInferenceConfig(self, request, context):
+        """Scene-wide batching / execution-provider settings for PolicySlot inference.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def SetPolicyInferenceConfig(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
 
 def add_AgentServiceServicer_to_server(servicer, server):
     rpc_method_handlers = {
@@ -426,6 +542,26 @@ def add_AgentServiceServicer_to_server(servicer, server):
                     request_deserializer=agent__pb2.StepRequest.FromString,
                     response_serializer=agent__pb2.StepResponse.SerializeToString,
             ),
+            'StepStream': grpc.stream_stream_rpc_method_handler(
+                    servicer.StepStream,
+                    request_deserializer=agent__pb2.StepRequest.FromString,
+                    response_serializer=agent__pb2.StepResponse.SerializeToString,
+            ),
+            'BatchStep': grpc.unary_unary_rpc_method_handler(
+                    servicer.BatchStep,
+                    request_deserializer=agent__pb2.BatchStepRequest.FromString,
+                    response_serializer=agent__pb2.BatchStepResponse.SerializeToString,
+            ),
+            'OpenSharedMemoryTransport': grpc.unary_unary_rpc_method_handler(
+                    servicer.OpenSharedMemoryTransport,
+                    request_deserializer=agent__pb2.OpenSharedMemoryTransportRequest.FromString,
+                    response_serializer=agent__pb2.OpenSharedMemoryTransportResponse.SerializeToString,
+            ),
+            'CloseSharedMemoryTransport': grpc.unary_unary_rpc_method_handler(
+                    servicer.CloseSharedMemoryTransport,
+                    request_deserializer=agent__pb2.CloseSharedMemoryTransportRequest.FromString,
+                    response_serializer=agent__pb2.CloseSharedMemoryTransportResponse.SerializeToString,
+            ),
             'SetActionGroup': grpc.unary_unary_rpc_method_handler(
                     servicer.SetActionGroup,
                     request_deserializer=agent__pb2.SetActionGroupRequest.FromString,
@@ -451,6 +587,11 @@ def add_AgentServiceServicer_to_server(servicer, server):
                     request_deserializer=agent__pb2.NegotiateTaskRequest.FromString,
                     response_serializer=agent__pb2.NegotiateTaskResponse.SerializeToString,
             ),
+            'GetEngineFingerprint': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetEngineFingerprint,
+                    request_deserializer=agent__pb2.GetEngineFingerprintRequest.FromString,
+                    response_serializer=agent__pb2.GetEngineFingerprintResponse.SerializeToString,
+            ),
             'ListRobotControllers': grpc.unary_unary_rpc_method_handler(
                     servicer.ListRobotControllers,
                     request_deserializer=agent__pb2.ListRobotControllersRequest.FromString,
@@ -546,6 +687,11 @@ def add_AgentServiceServicer_to_server(servicer, server):
                     request_deserializer=agent__pb2.FireMotionGraphTriggerRequest.FromString,
                     response_serializer=agent__pb2.PolicyOperationAck.SerializeToString,
             ),
+            'ApplyRobotCommands': grpc.unary_unary_rpc_method_handler(
+                    servicer.ApplyRobotCommands,
+                    request_deserializer=agent__pb2.ApplyRobotCommandsRequest.FromString,
+                    response_serializer=agent__pb2.ApplyRobotCommandsResponse.SerializeToString,
+            ),
             'GetPolicyBasePose': grpc.unary_unary_rpc_method_handler(
                     servicer.GetPolicyBasePose,
                     request_deserializer=agent__pb2.GetPolicyBasePoseRequest.FromString,
@@ -566,6 +712,21 @@ def add_AgentServiceServicer_to_server(servicer, server):
                     request_deserializer=agent__pb2.StreamRobotControllerRequest.FromString,
                     response_serializer=agent__pb2.RobotControllerSummary.SerializeToString,
             ),
+            'StreamSynchronized': grpc.unary_stream_rpc_method_handler(
+                    servicer.StreamSynchronized,
+                    request_deserializer=agent__pb2.StreamSynchronizedRequest.FromString,
+                    response_serializer=agent__pb2.SynchronizedFrame.SerializeToString,
+            ),
+            'GetPolicyInferenceConfig': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetPolicyInferenceConfig,
+                    request_deserializer=agent__pb2.GetPolicyInferenceConfigRequest.FromString,
+                    response_serializer=agent__pb2.PolicyInferenceConfigResponse.SerializeToString,
+            ),
+            'SetPolicyInferenceConfig': grpc.unary_unary_rpc_method_handler(
+                    servicer.SetPolicyInferenceConfig,
+                    request_deserializer=agent__pb2.PolicyInferenceConfig.FromString,
+                    response_serializer=agent__pb2.PolicyInferenceConfigResponse.SerializeToString,
+            ),
     }
     generic_handler = grpc.method_handlers_generic_handler(
             'hazel.rpc.AgentService', rpc_method_handlers)
@@ -659,6 +820,114 @@ class AgentService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def StepStream(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(
+            request_iterator,
+            target,
+            '/hazel.rpc.AgentService/StepStream',
+            agent__pb2.StepRequest.SerializeToString,
+            agent__pb2.StepResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def BatchStep(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.AgentService/BatchStep',
+            agent__pb2.BatchStepRequest.SerializeToString,
+            agent__pb2.BatchStepResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def OpenSharedMemoryTransport(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.AgentService/OpenSharedMemoryTransport',
+            agent__pb2.OpenSharedMemoryTransportRequest.SerializeToString,
+            agent__pb2.OpenSharedMemoryTransportResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def CloseSharedMemoryTransport(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.AgentService/CloseSharedMemoryTransport',
+            agent__pb2.CloseSharedMemoryTransportRequest.SerializeToString,
+            agent__pb2.CloseSharedMemoryTransportResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def SetActionGroup(request,
             target,
@@ -794,6 +1063,33 @@ class AgentService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def GetEngineFingerprint(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.AgentService/GetEngineFingerprint',
+            agent__pb2.GetEngineFingerprintRequest.SerializeToString,
+            agent__pb2.GetEngineFingerprintResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def ListRobotControllers(request,
             target,
@@ -1307,6 +1603,33 @@ class AgentService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def ApplyRobotCommands(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.AgentService/ApplyRobotCommands',
+            agent__pb2.ApplyRobotCommandsRequest.SerializeToString,
+            agent__pb2.ApplyRobotCommandsResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def GetPolicyBasePose(request,
             target,
@@ -1414,3 +1737,84 @@ class AgentService(object):
             timeout,
             metadata,
             _registered_method=True)
+
+    @staticmethod
+    def StreamSynchronized(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_stream(
+            request,
+            target,
+            '/hazel.rpc.AgentService/StreamSynchronized',
+            agent__pb2.StreamSynchronizedRequest.SerializeToString,
+            agent__pb2.SynchronizedFrame.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetPolicyInferenceConfig(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.AgentService/GetPolicyInferenceConfig',
+            agent__pb2.GetPolicyInferenceConfigRequest.SerializeToString,
+            agent__pb2.PolicyInferenceConfigResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def SetPolicyInferenceConfig(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.AgentService/SetPolicyInferenceConfig',
+            agent__pb2.PolicyInferenceConfig.SerializeToString,
+            agent__pb2.PolicyInferenceConfigResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
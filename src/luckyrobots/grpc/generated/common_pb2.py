@@ -24,7 +24,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0c\x63ommon.proto\x12\thazel.rpc\"\x16\n\x08\x45ntityId\x12\n\n\x02id\x18\x01 \x01(\x04\"\'\n\x04Vec3\x12\t\n\x01x\x18\x01 \x01(\x02\x12\t\n\x01y\x18\x02 \x01(\x02\x12\t\n\x01z\x18\x03 \x01(\x02\"2\n\x04Quat\x12\t\n\x01x\x18\x01 \x01(\x02\x12\t\n\x01y\x18\x02 \x01(\x02\x12\t\n\x01z\x18\x03 \x01(\x02\x12\t\n\x01w\x18\x04 \x01(\x02\"q\n\tTransform\x12!\n\x08position\x18\x01 \x01(\x0b\x32\x0f.hazel.rpc.Vec3\x12!\n\x08rotation\x18\x02 \x01(\x0b\x32\x0f.hazel.rpc.Quat\x12\x1e\n\x05scale\x18\x03 \x01(\x0b\x32\x0f.hazel.rpc.Vec3B\x03\xf8\x01\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0c\x63ommon.proto\x12\thazel.rpc\"\x16\n\x08\x45ntityId\x12\n\n\x02id\x18\x01 \x01(\x04\"\'\n\x04Vec3\x12\t\n\x01x\x18\x01 \x01(\x02\x12\t\n\x01y\x18\x02 \x01(\x02\x12\t\n\x01z\x18\x03 \x01(\x02\"2\n\x04Quat\x12\t\n\x01x\x18\x01 \x01(\x02\x12\t\n\x01y\x18\x02 \x01(\x02\x12\t\n\x01z\x18\x03 \x01(\x02\x12\t\n\x01w\x18\x04 \x01(\x02\"q\n\tTransform\x12!\n\x08position\x18\x01 \x01(\x0b\x32\x0f.hazel.rpc.Vec3\x12!\n\x08rotation\x18\x02 \x01(\x0b\x32\x0f.hazel.rpc.Quat\x12\x1e\n\x05scale\x18\x03 \x01(\x0b\x32\x0f.hazel.rpc.Vec3\"l\n\x12\x44\x65ltaStreamOptions\x12\x0f\n\x07\x65nabled\x18\x01 \x01(\x08\x12\x19\n\x11keyframe_interval\x18\x02 \x01(\r\x12\x0f\n\x07\x65psilon\x18\x03 \x01(\x02\x12\x19\n\x11quantization_step\x18\x04 \x01(\x02\"g\n\nDeltaArray\x12\x13\n\x07indices\x18\x01 \x03(\rB\x02\x10\x01\x12\x12\n\x06values\x18\x02 \x03(\x02\x42\x02\x10\x01\x12\x15\n\tquantized\x18\x03 \x03(\x11\x42\x02\x10\x01\x12\x19\n\x11quantization_step\x18\x04 \x01(\x02\x42\x03\xf8\x01\x01\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -32,6 +32,12 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'common_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   _globals['DESCRIPTOR']._loaded_options = None
   _globals['DESCRIPTOR']._serialized_options = b'\370\001\001'
+  _globals['_DELTAARRAY'].fields_by_name['indices']._loaded_options = None
+  _globals['_DELTAARRAY'].fields_by_name['indices']._serialized_options = b'\020\001'
+  _globals['_DELTAARRAY'].fields_by_name['values']._loaded_options = None
+  _globals['_DELTAARRAY'].fields_by_name['values']._serialized_options = b'\020\001'
+  _globals['_DELTAARRAY'].fields_by_name['quantized']._loaded_options = None
+  _globals['_DELTAARRAY'].fields_by_name['quantized']._serialized_options = b'\020\001'
   _globals['_ENTITYID']._serialized_start=27
   _globals['_ENTITYID']._serialized_end=49
   _globals['_VEC3']._serialized_start=51
@@ -40,4 +46,8 @@ if not _descriptor._USE_C_DESCRIPTORS:
   _globals['_QUAT']._serialized_end=142
   _globals['_TRANSFORM']._serialized_start=144
   _globals['_TRANSFORM']._serialized_end=257
+  _globals['_DELTASTREAMOPTIONS']._serialized_start=259
+  _globals['_DELTASTREAMOPTIONS']._serialized_end=367
+  _globals['_DELTAARRAY']._serialized_start=369
+  _globals['_DELTAARRAY']._serialized_end=472
 # @@protoc_insertion_point(module_scope)
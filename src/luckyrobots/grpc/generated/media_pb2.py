@@ -24,7 +24,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0bmedia.proto\x12\thazel.rpc\"\x87\x01\n\nImageFrame\x12\x0c\n\x04\x64\x61ta\x18\x01 \x01(\x0c\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x10\n\x08\x63hannels\x18\x04 \x01(\r\x12\x0e\n\x06\x66ormat\x18\x05 \x01(\t\x12\x14\n\x0ctimestamp_ms\x18\x06 \x01(\x04\x12\x14\n\x0c\x66rame_number\x18\x07 \x01(\r\"E\n\x0fNamedImageFrame\x12\x0c\n\x04name\x18\x01 \x01(\t\x12$\n\x05\x66rame\x18\x02 \x01(\x0b\x32\x15.hazel.rpc.ImageFrameB\x03\xf8\x01\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0bmedia.proto\x12\thazel.rpc\"\xfb\x01\n\nImageFrame\x12\x0c\n\x04\x64\x61ta\x18\x01 \x01(\x0c\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x10\n\x08\x63hannels\x18\x04 \x01(\r\x12\x0e\n\x06\x66ormat\x18\x05 \x01(\t\x12\x14\n\x0ctimestamp_ms\x18\x06 \x01(\x04\x12\x14\n\x0c\x66rame_number\x18\x07 \x01(\r\x12/\n\x0bpacket_type\x18\x08 \x01(\x0e\x32\x1a.hazel.rpc.ImagePacketType\x12,\n\x0cpixel_format\x18\t \x01(\x0e\x32\x16.hazel.rpc.PixelFormat\x12\x13\n\x0b\x64\x65pth_scale\x18\n \x01(\x02\"a\n\x14VideoEncoderSettings\x12\x19\n\x11keyframe_interval\x18\x01 \x01(\r\x12\x14\n\x0c\x62itrate_kbps\x18\x02 \x01(\r\x12\x18\n\x10require_hardware\x18\x03 \x01(\x08\"\x8b\x01\n\x0fNamedImageFrame\x12\x0c\n\x04name\x18\x01 \x01(\t\x12$\n\x05\x66rame\x18\x02 \x01(\x0b\x32\x15.hazel.rpc.ImageFrame\x12\x15\n\rlatency_steps\x18\x03 \x01(\r\x12-\n\x0erender_targets\x18\x04 \x03(\x0b\x32\x15.hazel.rpc.ImageFrame*{\n\x0fImagePacketType\x12\x16\n\x12IMAGE_PACKET_FRAME\x10\x00\x12\x1d\n\x19IMAGE_PACKET_CODEC_CONFIG\x10\x01\x12\x19\n\x15IMAGE_PACKET_KEYFRAME\x10\x02\x12\x16\n\x12IMAGE_PACKET_DELTA\x10\x03*\xd7\x01\n\x0bPixelFormat\x12\x1c\n\x18PIXEL_FORMAT_UNSPECIFIED\x10\x00\x12\x16\n\x12PIXEL_FORMAT_RGBA8\x10\x01\x12\x15\n\x11PIXEL_FORMAT_RGB8\x10\x02\x12\x1a\n\x16PIXEL_FORMAT_DEPTH_F16\x10\x03\x12\x1a\n\x16PIXEL_FORMAT_DEPTH_U16\x10\x04\x12 \n\x1cPIXEL_FORMAT_SEGMENTATION_U8\x10\x05\x12!\n\x1dPIXEL_FORMAT_SEGMENTATION_U16\x10\x06\x42\x03\xf8\x01\x01\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -32,8 +32,14 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'media_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   _globals['DESCRIPTOR']._loaded_options = None
   _globals['DESCRIPTOR']._serialized_options = b'\370\001\001'
+  _globals['_IMAGEPACKETTYPE']._serialized_start=521
+  _globals['_IMAGEPACKETTYPE']._serialized_end=644
+  _globals['_PIXELFORMAT']._serialized_start=647
+  _globals['_PIXELFORMAT']._serialized_end=862
   _globals['_IMAGEFRAME']._serialized_start=27
-  _globals['_IMAGEFRAME']._serialized_end=162
-  _globals['_NAMEDIMAGEFRAME']._serialized_start=164
-  _globals['_NAMEDIMAGEFRAME']._serialized_end=233
+  _globals['_IMAGEFRAME']._serialized_end=278
+  _globals['_VIDEOENCODERSETTINGS']._serialized_start=280
+  _globals['_VIDEOENCODERSETTINGS']._serialized_end=377
+  _globals['_NAMEDIMAGEFRAME']._serialized_start=380
+  _globals['_NAMEDIMAGEFRAME']._serialized_end=519
 # @@protoc_insertion_point(module_scope)
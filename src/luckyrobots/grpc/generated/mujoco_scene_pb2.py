@@ -22,9 +22,10 @@ _runtime_version.ValidateProtobufRuntimeVersion(
 _sym_db = _symbol_database.Default()
 
 
+from . import common_pb2 as common__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x12mujoco_scene.proto\x12\thazel.rpc\"\xed\x01\n\x0fJointDescriptor\x12\r\n\x05index\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\x12$\n\x04type\x18\x03 \x01(\x0e\x32\x16.hazel.rpc.MjJointType\x12\x10\n\x08qpos_adr\x18\x04 \x01(\r\x12\x10\n\x08qvel_adr\x18\x05 \x01(\r\x12\x0f\n\x07limited\x18\x06 \x01(\x08\x12\x10\n\x08range_lo\x18\x07 \x01(\x02\x12\x10\n\x08range_hi\x18\x08 \x01(\x02\x12!\n\x19\x63laimed_by_policy_slot_id\x18\t \x01(\r\x12\x1b\n\x13\x63laimed_by_rl_agent\x18\n \x01(\x08\"\xd1\x01\n\x12\x41\x63tuatorDescriptor\x12\r\n\x05index\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x14\n\x0c\x63trl_limited\x18\x03 \x01(\x08\x12\x15\n\rctrl_range_lo\x18\x04 \x01(\x02\x12\x15\n\rctrl_range_hi\x18\x05 \x01(\x02\x12\x1a\n\x12target_joint_index\x18\x06 \x01(\x05\x12!\n\x19\x63laimed_by_policy_slot_id\x18\x07 \x01(\r\x12\x1b\n\x13\x63laimed_by_rl_agent\x18\x08 \x01(\x08\"\x15\n\x13GetModelInfoRequest\"\xc8\x01\n\x14GetModelInfoResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\n\n\x02nq\x18\x03 \x01(\r\x12\n\n\x02nv\x18\x04 \x01(\r\x12\n\n\x02nu\x18\x05 \x01(\r\x12\x0c\n\x04njnt\x18\x06 \x01(\r\x12*\n\x06joints\x18\x07 \x03(\x0b\x32\x1a.hazel.rpc.JointDescriptor\x12\x30\n\tactuators\x18\x08 \x03(\x0b\x32\x1d.hazel.rpc.ActuatorDescriptor\"e\n\tFullState\x12\x10\n\x04qpos\x18\x01 \x03(\x02\x42\x02\x10\x01\x12\x10\n\x04qvel\x18\x02 \x03(\x02\x42\x02\x10\x01\x12\x10\n\x04\x63trl\x18\x03 \x03(\x02\x42\x02\x10\x01\x12\x0c\n\x04time\x18\x04 \x01(\x01\x12\x14\n\x0c\x66rame_number\x18\x05 \x01(\x04\"\x7f\n\x13GetFullStateRequest\x12\x14\n\x0cinclude_qpos\x18\x01 \x01(\x08\x12\x14\n\x0cinclude_qvel\x18\x02 \x01(\x08\x12\x14\n\x0cinclude_ctrl\x18\x03 \x01(\x08\x12&\n\x06\x66ilter\x18\x04 \x01(\x0b\x32\x16.hazel.rpc.StateFilter\"\xa0\x01\n\x14GetFullStateResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12#\n\x05state\x18\x03 \x01(\x0b\x32\x14.hazel.rpc.FullState\x12\x1e\n\x16included_joint_indices\x18\x04 \x03(\r\x12!\n\x19included_actuator_indices\x18\x05 \x03(\r\"\x96\x01\n\x16StreamFullStateRequest\x12\x12\n\ntarget_fps\x18\x01 \x01(\r\x12\x14\n\x0cinclude_qpos\x18\x02 \x01(\x08\x12\x14\n\x0cinclude_qvel\x18\x03 \x01(\x08\x12\x14\n\x0cinclude_ctrl\x18\x04 \x01(\x08\x12&\n\x06\x66ilter\x18\x05 \x01(\x0b\x32\x16.hazel.rpc.StateFilter\"{\n\x0bStateFilter\x12*\n\"include_only_policy_claimed_joints\x18\x01 \x01(\x08\x12%\n\x1dinclude_only_unclaimed_joints\x18\x02 \x01(\x08\x12\x19\n\x11\x66ilter_by_slot_id\x18\x03 \x01(\r\"9\n\x11NamedControlEntry\x12\x15\n\ractuator_name\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x02\"<\n\x13IndexedControlEntry\x12\x16\n\x0e\x61\x63tuator_index\x18\x01 \x01(\r\x12\r\n\x05value\x18\x02 \x01(\x02\"\xb9\x01\n\x11SetControlRequest\x12\x10\n\x04\x62ulk\x18\x01 \x03(\x02\x42\x02\x10\x01\x12/\n\x07indexed\x18\x02 \x03(\x0b\x32\x1e.hazel.rpc.IndexedControlEntry\x12+\n\x05named\x18\x03 \x03(\x0b\x32\x1c.hazel.rpc.NamedControlEntry\x12\x1a\n\x12wait_for_next_step\x18\x04 \x01(\x08\x12\x18\n\x10skip_range_clamp\x18\x05 \x01(\x08\"m\n\x12SetControlResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x19\n\x11\x61\x63tuators_written\x18\x03 \x01(\r\x12\x1a\n\x12rejected_actuators\x18\x04 \x03(\t\"5\n\x10IndexedQposEntry\x12\x12\n\nqpos_index\x18\x01 \x01(\r\x12\r\n\x05value\x18\x02 \x01(\x02\"{\n\x0eSetQposRequest\x12\x10\n\x04\x62ulk\x18\x01 \x03(\x02\x42\x02\x10\x01\x12,\n\x07indexed\x18\x02 \x03(\x0b\x32\x1b.hazel.rpc.IndexedQposEntry\x12\r\n\x05\x66orce\x18\x03 \x01(\x08\x12\x1a\n\x12skip_policy_reseed\x18\x04 \x01(\x08\"K\n\x0fSetQposResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x16\n\x0evalues_written\x18\x03 \x01(\r\"~\n\x10\x41\x63tuatorGainInfo\x12\x16\n\x0e\x61\x63tuator_index\x18\x01 \x01(\r\x12\x15\n\ractuator_name\x18\x02 \x01(\t\x12\x12\n\ngain_prm_0\x18\x03 \x01(\x02\x12\x12\n\nbias_prm_0\x18\x04 \x01(\x02\x12\x13\n\x0bneutralized\x18\x05 \x01(\x08\"\x19\n\x17GetActuatorGainsRequest\"l\n\x18GetActuatorGainsResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12.\n\tactuators\x18\x03 \x03(\x0b\x32\x1b.hazel.rpc.ActuatorGainInfo\"*\n\x11ResetSceneRequest\x12\x15\n\rpreserve_time\x18\x01 \x01(\x08\"6\n\x12ResetSceneResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t*g\n\x0bMjJointType\x12\x0f\n\x0bMJ_JNT_FREE\x10\x00\x12\x0f\n\x0bMJ_JNT_BALL\x10\x01\x12\x10\n\x0cMJ_JNT_SLIDE\x10\x02\x12\x10\n\x0cMJ_JNT_HINGE\x10\x03\x12\x12\n\x0eMJ_JNT_UNKNOWN\x10\x63\x32\xc4\x04\n\x12MujocoSceneService\x12O\n\x0cGetModelInfo\x12\x1e.hazel.rpc.GetModelInfoRequest\x1a\x1f.hazel.rpc.GetModelInfoResponse\x12O\n\x0cGetFullState\x12\x1e.hazel.rpc.GetFullStateRequest\x1a\x1f.hazel.rpc.GetFullStateResponse\x12W\n\x0fStreamFullState\x12!.hazel.rpc.StreamFullStateRequest\x1a\x1f.hazel.rpc.GetFullStateResponse0\x01\x12I\n\nSetControl\x12\x1c.hazel.rpc.SetControlRequest\x1a\x1d.hazel.rpc.SetControlResponse\x12@\n\x07SetQpos\x12\x19.hazel.rpc.SetQposRequest\x1a\x1a.hazel.rpc.SetQposResponse\x12[\n\x10GetActuatorGains\x12\".hazel.rpc.GetActuatorGainsRequest\x1a#.hazel.rpc.GetActuatorGainsResponse\x12I\n\nResetScene\x12\x1c.hazel.rpc.ResetSceneRequest\x1a\x1d.hazel.rpc.ResetSceneResponseB\x03\xf8\x01\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x12mujoco_scene.proto\x12\thazel.rpc\x1a\x0c\x63ommon.proto\"\xed\x01\n\x0fJointDescriptor\x12\r\n\x05index\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\x12$\n\x04type\x18\x03 \x01(\x0e\x32\x16.hazel.rpc.MjJointType\x12\x10\n\x08qpos_adr\x18\x04 \x01(\r\x12\x10\n\x08qvel_adr\x18\x05 \x01(\r\x12\x0f\n\x07limited\x18\x06 \x01(\x08\x12\x10\n\x08range_lo\x18\x07 \x01(\x02\x12\x10\n\x08range_hi\x18\x08 \x01(\x02\x12!\n\x19\x63laimed_by_policy_slot_id\x18\t \x01(\r\x12\x1b\n\x13\x63laimed_by_rl_agent\x18\n \x01(\x08\"\xd1\x01\n\x12\x41\x63tuatorDescriptor\x12\r\n\x05index\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x14\n\x0c\x63trl_limited\x18\x03 \x01(\x08\x12\x15\n\rctrl_range_lo\x18\x04 \x01(\x02\x12\x15\n\rctrl_range_hi\x18\x05 \x01(\x02\x12\x1a\n\x12target_joint_index\x18\x06 \x01(\x05\x12!\n\x19\x63laimed_by_policy_slot_id\x18\x07 \x01(\r\x12\x1b\n\x13\x63laimed_by_rl_agent\x18\x08 \x01(\x08\"\x15\n\x13GetModelInfoRequest\"\xc8\x01\n\x14GetModelInfoResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\n\n\x02nq\x18\x03 \x01(\r\x12\n\n\x02nv\x18\x04 \x01(\r\x12\n\n\x02nu\x18\x05 \x01(\r\x12\x0c\n\x04njnt\x18\x06 \x01(\r\x12*\n\x06joints\x18\x07 \x03(\x0b\x32\x1a.hazel.rpc.JointDescriptor\x12\x30\n\tactuators\x18\x08 \x03(\x0b\x32\x1d.hazel.rpc.ActuatorDescriptor\"\xf8\x01\n\tFullState\x12\x10\n\x04qpos\x18\x01 \x03(\x02\x42\x02\x10\x01\x12\x10\n\x04qvel\x18\x02 \x03(\x02\x42\x02\x10\x01\x12\x10\n\x04\x63trl\x18\x03 \x03(\x02\x42\x02\x10\x01\x12\x0c\n\x04time\x18\x04 \x01(\x01\x12\x14\n\x0c\x66rame_number\x18\x05 \x01(\x04\x12\x10\n\x08keyframe\x18\x06 \x01(\x08\x12)\n\nqpos_delta\x18\x07 \x01(\x0b\x32\x15.hazel.rpc.DeltaArray\x12)\n\nqvel_delta\x18\x08 \x01(\x0b\x32\x15.hazel.rpc.DeltaArray\x12)\n\nctrl_delta\x18\t \x01(\x0b\x32\x15.hazel.rpc.DeltaArray\"\x7f\n\x13GetFullStateRequest\x12\x14\n\x0cinclude_qpos\x18\x01 \x01(\x08\x12\x14\n\x0cinclude_qvel\x18\x02 \x01(\x08\x12\x14\n\x0cinclude_ctrl\x18\x03 \x01(\x08\x12&\n\x06\x66ilter\x18\x04 \x01(\x0b\x32\x16.hazel.rpc.StateFilter\"\xa0\x01\n\x14GetFullStateResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12#\n\x05state\x18\x03 \x01(\x0b\x32\x14.hazel.rpc.FullState\x12\x1e\n\x16included_joint_indices\x18\x04 \x03(\r\x12!\n\x19included_actuator_indices\x18\x05 \x03(\r\"\xc4\x01\n\x16StreamFullStateRequest\x12\x12\n\ntarget_fps\x18\x01 \x01(\r\x12\x14\n\x0cinclude_qpos\x18\x02 \x01(\x08\x12\x14\n\x0cinclude_qvel\x18\x03 \x01(\x08\x12\x14\n\x0cinclude_ctrl\x18\x04 \x01(\x08\x12&\n\x06\x66ilter\x18\x05 \x01(\x0b\x32\x16.hazel.rpc.StateFilter\x12,\n\x05\x64\x65lta\x18\x06 \x01(\x0b\x32\x1d.hazel.rpc.DeltaStreamOptions\"{\n\x0bStateFilter\x12*\n\"include_only_policy_claimed_joints\x18\x01 \x01(\x08\x12%\n\x1dinclude_only_unclaimed_joints\x18\x02 \x01(\x08\x12\x19\n\x11\x66ilter_by_slot_id\x18\x03 \x01(\r\"9\n\x11NamedControlEntry\x12\x15\n\ractuator_name\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x02\"<\n\x13IndexedControlEntry\x12\x16\n\x0e\x61\x63tuator_index\x18\x01 \x01(\r\x12\r\n\x05value\x18\x02 \x01(\x02\"\xb9\x01\n\x11SetControlRequest\x12\x10\n\x04\x62ulk\x18\x01 \x03(\x02\x42\x02\x10\x01\x12/\n\x07indexed\x18\x02 \x03(\x0b\x32\x1e.hazel.rpc.IndexedControlEntry\x12+\n\x05named\x18\x03 \x03(\x0b\x32\x1c.hazel.rpc.NamedControlEntry\x12\x1a\n\x12wait_for_next_step\x18\x04 \x01(\x08\x12\x18\n\x10skip_range_clamp\x18\x05 \x01(\x08\"m\n\x12SetControlResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x19\n\x11\x61\x63tuators_written\x18\x03 \x01(\r\x12\x1a\n\x12rejected_actuators\x18\x04 \x03(\t\"5\n\x10IndexedQposEntry\x12\x12\n\nqpos_index\x18\x01 \x01(\r\x12\r\n\x05value\x18\x02 \x01(\x02\"{\n\x0eSetQposRequest\x12\x10\n\x04\x62ulk\x18\x01 \x03(\x02\x42\x02\x10\x01\x12,\n\x07indexed\x18\x02 \x03(\x0b\x32\x1b.hazel.rpc.IndexedQposEntry\x12\r\n\x05\x66orce\x18\x03 \x01(\x08\x12\x1a\n\x12skip_policy_reseed\x18\x04 \x01(\x08\"K\n\x0fSetQposResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x16\n\x0evalues_written\x18\x03 \x01(\r\"~\n\x10\x41\x63tuatorGainInfo\x12\x16\n\x0e\x61\x63tuator_index\x18\x01 \x01(\r\x12\x15\n\ractuator_name\x18\x02 \x01(\t\x12\x12\n\ngain_prm_0\x18\x03 \x01(\x02\x12\x12\n\nbias_prm_0\x18\x04 \x01(\x02\x12\x13\n\x0bneutralized\x18\x05 \x01(\x08\"\x19\n\x17GetActuatorGainsRequest\"l\n\x18GetActuatorGainsResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12.\n\tactuators\x18\x03 \x03(\x0b\x32\x1b.hazel.rpc.ActuatorGainInfo\"*\n\x11ResetSceneRequest\x12\x15\n\rpreserve_time\x18\x01 \x01(\x08\"6\n\x12ResetSceneResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"X\n\x13SaveSnapshotRequest\x12\x0e\n\x06handle\x18\x01 \x01(\r\x12\x1c\n\x14\x65xclude_policy_state\x18\x02 \x01(\x08\x12\x13\n\x0b\x65xport_blob\x18\x03 \x01(\x08\"\xb8\x01\n\x14SaveSnapshotResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x0e\n\x06handle\x18\x03 \x01(\r\x12\x12\n\nsize_bytes\x18\x04 \x01(\x04\x12\x0c\n\x04time\x18\x05 \x01(\x01\x12\x14\n\x0c\x66rame_number\x18\x06 \x01(\x04\x12\x0c\n\x04\x62lob\x18\x07 \x01(\x0c\x12\x11\n\tpool_size\x18\x08 \x01(\r\x12\x15\n\rpool_capacity\x18\t \x01(\r\"D\n\x16RestoreSnapshotRequest\x12\x10\n\x06handle\x18\x01 \x01(\rH\x00\x12\x0e\n\x04\x62lob\x18\x02 \x01(\x0cH\x00\x42\x08\n\x06source\"_\n\x17RestoreSnapshotResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x0c\n\x04time\x18\x03 \x01(\x01\x12\x14\n\x0c\x66rame_number\x18\x04 \x01(\x04\";\n\x17ReleaseSnapshotsRequest\x12\x13\n\x07handles\x18\x01 \x03(\rB\x02\x10\x01\x12\x0b\n\x03\x61ll\x18\x02 \x01(\x08\"N\n\x18ReleaseSnapshotsResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x10\n\x08released\x18\x03 \x01(\r\"D\n\x10RolloutParameter\x12\x0f\n\x07\x65lement\x18\x01 \x01(\t\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x11\n\tattribute\x18\x03 \x01(\t\"\xe2\x01\n\x13\x42\x61tchRolloutRequest\x12\x0c\n\x04\x63trl\x18\x01 \x01(\x0c\x12\x11\n\tnum_steps\x18\x02 \x01(\r\x12\n\n\x02nu\x18\x03 \x01(\r\x12\x10\n\x08timestep\x18\x04 \x01(\x01\x12/\n\nparameters\x18\x05 \x03(\x0b\x32\x1b.hazel.rpc.RolloutParameter\x12\x12\n\ncandidates\x18\x06 \x01(\x0c\x12\x16\n\x0enum_candidates\x18\x07 \x01(\r\x12\x1a\n\x12\x66rom_current_state\x18\x08 \x01(\x08\x12\x13\n\x0bnum_threads\x18\t \x01(\r\"\xb1\x01\n\x14\x42\x61tchRolloutResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x16\n\x0enum_candidates\x18\x03 \x01(\r\x12\x11\n\tnum_steps\x18\x04 \x01(\r\x12\n\n\x02nq\x18\x05 \x01(\r\x12\n\n\x02nv\x18\x06 \x01(\r\x12\x0c\n\x04qpos\x18\x07 \x01(\x0c\x12\x0c\n\x04qvel\x18\x08 \x01(\x0c\x12\x18\n\x10wall_duration_us\x18\t \x01(\x04\"d\n\x1aPlayControlSequenceRequest\x12\x0c\n\x04\x63trl\x18\x01 \x01(\x0c\x12\x11\n\tnum_steps\x18\x02 \x01(\r\x12\n\n\x02nu\x18\x03 \x01(\r\x12\n\n\x02\x64t\x18\x04 \x01(\x01\x12\r\n\x05reset\x18\x05 \x01(\x08\"\x95\x01\n\x1bPlayControlSequenceResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x11\n\tnum_steps\x18\x03 \x01(\r\x12\n\n\x02nq\x18\x04 \x01(\r\x12\n\n\x02nv\x18\x05 \x01(\r\x12\r\n\x05times\x18\x06 \x01(\x0c\x12\x0c\n\x04qpos\x18\x07 \x01(\x0c\x12\x0c\n\x04qvel\x18\x08 \x01(\x0c\"\x89\x02\n\x0eRaycastRequest\x12\x0f\n\x07origins\x18\x01 \x01(\x0c\x12\x12\n\ndirections\x18\x02 \x01(\x0c\x12\x10\n\x08num_rays\x18\x03 \x01(\r\x12\x14\n\x0cmax_distance\x18\x04 \x01(\x02\x12\"\n\x05\x66rame\x18\x05 \x01(\x0e\x32\x13.hazel.rpc.RayFrame\x12\x12\n\nframe_body\x18\x06 \x01(\t\x12\x17\n\x0fgeom_group_mask\x18\x07 \x01(\r\x12\x16\n\x0e\x65xclude_static\x18\x08 \x01(\x08\x12\x14\n\x0c\x65xclude_body\x18\t \x01(\t\x12\x16\n\x0einclude_points\x18\n \x01(\x08\x12\x13\n\x0bnum_threads\x18\x0b \x01(\r\"\x94\x01\n\x0fRaycastResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x10\n\x08num_rays\x18\x03 \x01(\r\x12\x11\n\tdistances\x18\x04 \x01(\x0c\x12\x10\n\x08geom_ids\x18\x05 \x01(\x0c\x12\x0e\n\x06points\x18\x06 \x01(\x0c\x12\x18\n\x10wall_duration_us\x18\x07 \x01(\x04\"\xf5\x01\n\x11HeightScanRequest\x12\x0c\n\x04\x62ody\x18\x01 \x01(\t\x12\x0e\n\x06size_x\x18\x02 \x01(\x02\x12\x0e\n\x06size_y\x18\x03 \x01(\x02\x12\x12\n\nresolution\x18\x04 \x01(\x02\x12\x10\n\x08offset_x\x18\x05 \x01(\x02\x12\x10\n\x08offset_y\x18\x06 \x01(\x02\x12\x18\n\x10ray_start_height\x18\x07 \x01(\x02\x12\x14\n\x0cmax_distance\x18\x08 \x01(\x02\x12\x17\n\x0fgeom_group_mask\x18\t \x01(\r\x12\x1c\n\x14include_body_subtree\x18\n \x01(\x08\x12\x13\n\x0bnum_threads\x18\x0b \x01(\r\"\x94\x01\n\x12HeightScanResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x0c\n\x04rows\x18\x03 \x01(\r\x12\x0c\n\x04\x63ols\x18\x04 \x01(\r\x12\x0f\n\x07heights\x18\x05 \x01(\x0c\x12\x15\n\rbody_position\x18\x06 \x03(\x02\x12\x18\n\x10wall_duration_us\x18\x07 \x01(\x04\"\x85\x01\n\x12GetContactsRequest\x12\x0e\n\x06\x62odies\x18\x01 \x03(\t\x12\x17\n\x0finclude_subtree\x18\x02 \x01(\x08\x12\x16\n\x0einclude_forces\x18\x03 \x01(\x08\x12\x18\n\x10include_inactive\x18\x04 \x01(\x08\x12\x14\n\x0cmax_contacts\x18\x05 \x01(\r\"\xb8\x01\n\x13GetContactsResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x14\n\x0cnum_contacts\x18\x03 \x01(\r\x12\x10\n\x08geom_ids\x18\x04 \x01(\x0c\x12\x10\n\x08\x62ody_ids\x18\x05 \x01(\x0c\x12\x11\n\tpositions\x18\x06 \x01(\x0c\x12\x0f\n\x07normals\x18\x07 \x01(\x0c\x12\x11\n\tdistances\x18\x08 \x01(\x0c\x12\x0e\n\x06\x66orces\x18\t \x01(\x0c*g\n\x0bMjJointType\x12\x0f\n\x0bMJ_JNT_FREE\x10\x00\x12\x0f\n\x0bMJ_JNT_BALL\x10\x01\x12\x10\n\x0cMJ_JNT_SLIDE\x10\x02\x12\x10\n\x0cMJ_JNT_HINGE\x10\x03\x12\x12\n\x0eMJ_JNT_UNKNOWN\x10\x63*3\n\x08RayFrame\x12\x13\n\x0fRAY_FRAME_WORLD\x10\x00\x12\x12\n\x0eRAY_FRAME_BODY\x10\x01\x32\xde\t\n\x12MujocoSceneService\x12O\n\x0cGetModelInfo\x12\x1e.hazel.rpc.GetModelInfoRequest\x1a\x1f.hazel.rpc.GetModelInfoResponse\x12O\n\x0cGetFullState\x12\x1e.hazel.rpc.GetFullStateRequest\x1a\x1f.hazel.rpc.GetFullStateResponse\x12W\n\x0fStreamFullState\x12!.hazel.rpc.StreamFullStateRequest\x1a\x1f.hazel.rpc.GetFullStateResponse0\x01\x12I\n\nSetControl\x12\x1c.hazel.rpc.SetControlRequest\x1a\x1d.hazel.rpc.SetControlResponse\x12@\n\x07SetQpos\x12\x19.hazel.rpc.SetQposRequest\x1a\x1a.hazel.rpc.SetQposResponse\x12[\n\x10GetActuatorGains\x12\".hazel.rpc.GetActuatorGainsRequest\x1a#.hazel.rpc.GetActuatorGainsResponse\x12I\n\nResetScene\x12\x1c.hazel.rpc.ResetSceneRequest\x1a\x1d.hazel.rpc.ResetSceneResponse\x12O\n\x0cSaveSnapshot\x12\x1e.hazel.rpc.SaveSnapshotRequest\x1a\x1f.hazel.rpc.SaveSnapshotResponse\x12X\n\x0fRestoreSnapshot\x12!.hazel.rpc.RestoreSnapshotRequest\x1a\".hazel.rpc.RestoreSnapshotResponse\x12[\n\x10ReleaseSnapshots\x12\".hazel.rpc.ReleaseSnapshotsRequest\x1a#.hazel.rpc.ReleaseSnapshotsResponse\x12O\n\x0c\x42\x61tchRollout\x12\x1e.hazel.rpc.BatchRolloutRequest\x1a\x1f.hazel.rpc.BatchRolloutResponse\x12\x64\n\x13PlayControlSequence\x12%.hazel.rpc.PlayControlSequenceRequest\x1a&.hazel.rpc.PlayControlSequenceResponse\x12@\n\x07Raycast\x12\x19.hazel.rpc.RaycastRequest\x1a\x1a.hazel.rpc.RaycastResponse\x12I\n\nHeightScan\x12\x1c.hazel.rpc.HeightScanRequest\x1a\x1d.hazel.rpc.HeightScanResponse\x12L\n\x0bGetContacts\x12\x1d.hazel.rpc.GetContactsRequest\x1a\x1e.hazel.rpc.GetContactsResponseB\x03\xf8\x01\x01\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -42,50 +43,88 @@ if not _descriptor._USE_C_DESCRIPTORS:
   _globals['_SETCONTROLREQUEST'].fields_by_name['bulk']._serialized_options = b'\020\001'
   _globals['_SETQPOSREQUEST'].fields_by_name['bulk']._loaded_options = None
   _globals['_SETQPOSREQUEST'].fields_by_name['bulk']._serialized_options = b'\020\001'
-  _globals['_MJJOINTTYPE']._serialized_start=2426
-  _globals['_MJJOINTTYPE']._serialized_end=2529
-  _globals['_JOINTDESCRIPTOR']._serialized_start=34
-  _globals['_JOINTDESCRIPTOR']._serialized_end=271
-  _globals['_ACTUATORDESCRIPTOR']._serialized_start=274
-  _globals['_ACTUATORDESCRIPTOR']._serialized_end=483
-  _globals['_GETMODELINFOREQUEST']._serialized_start=485
-  _globals['_GETMODELINFOREQUEST']._serialized_end=506
-  _globals['_GETMODELINFORESPONSE']._serialized_start=509
-  _globals['_GETMODELINFORESPONSE']._serialized_end=709
-  _globals['_FULLSTATE']._serialized_start=711
-  _globals['_FULLSTATE']._serialized_end=812
-  _globals['_GETFULLSTATEREQUEST']._serialized_start=814
-  _globals['_GETFULLSTATEREQUEST']._serialized_end=941
-  _globals['_GETFULLSTATERESPONSE']._serialized_start=944
-  _globals['_GETFULLSTATERESPONSE']._serialized_end=1104
-  _globals['_STREAMFULLSTATEREQUEST']._serialized_start=1107
-  _globals['_STREAMFULLSTATEREQUEST']._serialized_end=1257
-  _globals['_STATEFILTER']._serialized_start=1259
-  _globals['_STATEFILTER']._serialized_end=1382
-  _globals['_NAMEDCONTROLENTRY']._serialized_start=1384
-  _globals['_NAMEDCONTROLENTRY']._serialized_end=1441
-  _globals['_INDEXEDCONTROLENTRY']._serialized_start=1443
-  _globals['_INDEXEDCONTROLENTRY']._serialized_end=1503
-  _globals['_SETCONTROLREQUEST']._serialized_start=1506
-  _globals['_SETCONTROLREQUEST']._serialized_end=1691
-  _globals['_SETCONTROLRESPONSE']._serialized_start=1693
-  _globals['_SETCONTROLRESPONSE']._serialized_end=1802
-  _globals['_INDEXEDQPOSENTRY']._serialized_start=1804
-  _globals['_INDEXEDQPOSENTRY']._serialized_end=1857
-  _globals['_SETQPOSREQUEST']._serialized_start=1859
-  _globals['_SETQPOSREQUEST']._serialized_end=1982
-  _globals['_SETQPOSRESPONSE']._serialized_start=1984
-  _globals['_SETQPOSRESPONSE']._serialized_end=2059
-  _globals['_ACTUATORGAININFO']._serialized_start=2061
-  _globals['_ACTUATORGAININFO']._serialized_end=2187
-  _globals['_GETACTUATORGAINSREQUEST']._serialized_start=2189
-  _globals['_GETACTUATORGAINSREQUEST']._serialized_end=2214
-  _globals['_GETACTUATORGAINSRESPONSE']._serialized_start=2216
-  _globals['_GETACTUATORGAINSRESPONSE']._serialized_end=2324
-  _globals['_RESETSCENEREQUEST']._serialized_start=2326
-  _globals['_RESETSCENEREQUEST']._serialized_end=2368
-  _globals['_RESETSCENERESPONSE']._serialized_start=2370
-  _globals['_RESETSCENERESPONSE']._serialized_end=2424
-  _globals['_MUJOCOSCENESERVICE']._serialized_start=2532
-  _globals['_MUJOCOSCENESERVICE']._serialized_end=3112
+  _globals['_RELEASESNAPSHOTSREQUEST'].fields_by_name['handles']._loaded_options = None
+  _globals['_RELEASESNAPSHOTSREQUEST'].fields_by_name['handles']._serialized_options = b'\020\001'
+  _globals['_MJJOINTTYPE']._serialized_start=5093
+  _globals['_MJJOINTTYPE']._serialized_end=5196
+  _globals['_RAYFRAME']._serialized_start=5198
+  _globals['_RAYFRAME']._serialized_end=5249
+  _globals['_JOINTDESCRIPTOR']._serialized_start=48
+  _globals['_JOINTDESCRIPTOR']._serialized_end=285
+  _globals['_ACTUATORDESCRIPTOR']._serialized_start=288
+  _globals['_ACTUATORDESCRIPTOR']._serialized_end=497
+  _globals['_GETMODELINFOREQUEST']._serialized_start=499
+  _globals['_GETMODELINFOREQUEST']._serialized_end=520
+  _globals['_GETMODELINFORESPONSE']._serialized_start=523
+  _globals['_GETMODELINFORESPONSE']._serialized_end=723
+  _globals['_FULLSTATE']._serialized_start=726
+  _globals['_FULLSTATE']._serialized_end=974
+  _globals['_GETFULLSTATEREQUEST']._serialized_start=976
+  _globals['_GETFULLSTATEREQUEST']._serialized_end=1103
+  _globals['_GETFULLSTATERESPONSE']._serialized_start=1106
+  _globals['_GETFULLSTATERESPONSE']._serialized_end=1266
+  _globals['_STREAMFULLSTATEREQUEST']._serialized_start=1269
+  _globals['_STREAMFULLSTATEREQUEST']._serialized_end=1465
+  _globals['_STATEFILTER']._serialized_start=1467
+  _globals['_STATEFILTER']._serialized_end=1590
+  _globals['_NAMEDCONTROLENTRY']._serialized_start=1592
+  _globals['_NAMEDCONTROLENTRY']._serialized_end=1649
+  _globals['_INDEXEDCONTROLENTRY']._serialized_start=1651
+  _globals['_INDEXEDCONTROLENTRY']._serialized_end=1711
+  _globals['_SETCONTROLREQUEST']._serialized_start=1714
+  _globals['_SETCONTROLREQUEST']._serialized_end=1899
+  _globals['_SETCONTROLRESPONSE']._serialized_start=1901
+  _globals['_SETCONTROLRESPONSE']._serialized_end=2010
+  _globals['_INDEXEDQPOSENTRY']._serialized_start=2012
+  _globals['_INDEXEDQPOSENTRY']._serialized_end=2065
+  _globals['_SETQPOSREQUEST']._serialized_start=2067
+  _globals['_SETQPOSREQUEST']._serialized_end=2190
+  _globals['_SETQPOSRESPONSE']._serialized_start=2192
+  _globals['_SETQPOSRESPONSE']._serialized_end=2267
+  _globals['_ACTUATORGAININFO']._serialized_start=2269
+  _globals['_ACTUATORGAININFO']._serialized_end=2395
+  _globals['_GETACTUATORGAINSREQUEST']._serialized_start=2397
+  _globals['_GETACTUATORGAINSREQUEST']._serialized_end=2422
+  _globals['_GETACTUATORGAINSRESPONSE']._serialized_start=2424
+  _globals['_GETACTUATORGAINSRESPONSE']._serialized_end=2532
+  _globals['_RESETSCENEREQUEST']._serialized_start=2534
+  _globals['_RESETSCENEREQUEST']._serialized_end=2576
+  _globals['_RESETSCENERESPONSE']._serialized_start=2578
+  _globals['_RESETSCENERESPONSE']._serialized_end=2632
+  _globals['_SAVESNAPSHOTREQUEST']._serialized_start=2634
+  _globals['_SAVESNAPSHOTREQUEST']._serialized_end=2722
+  _globals['_SAVESNAPSHOTRESPONSE']._serialized_start=2725
+  _globals['_SAVESNAPSHOTRESPONSE']._serialized_end=2909
+  _globals['_RESTORESNAPSHOTREQUEST']._serialized_start=2911
+  _globals['_RESTORESNAPSHOTREQUEST']._serialized_end=2979
+  _globals['_RESTORESNAPSHOTRESPONSE']._serialized_start=2981
+  _globals['_RESTORESNAPSHOTRESPONSE']._serialized_end=3076
+  _globals['_RELEASESNAPSHOTSREQUEST']._serialized_start=3078
+  _globals['_RELEASESNAPSHOTSREQUEST']._serialized_end=3137
+  _globals['_RELEASESNAPSHOTSRESPONSE']._serialized_start=3139
+  _globals['_RELEASESNAPSHOTSRESPONSE']._serialized_end=3217
+  _globals['_ROLLOUTPARAMETER']._serialized_start=3219
+  _globals['_ROLLOUTPARAMETER']._serialized_end=3287
+  _globals['_BATCHROLLOUTREQUEST']._serialized_start=3290
+  _globals['_BATCHROLLOUTREQUEST']._serialized_end=3516
+  _globals['_BATCHROLLOUTRESPONSE']._serialized_start=3519
+  _globals['_BATCHROLLOUTRESPONSE']._serialized_end=3696
+  _globals['_PLAYCONTROLSEQUENCEREQUEST']._serialized_start=3698
+  _globals['_PLAYCONTROLSEQUENCEREQUEST']._serialized_end=3798
+  _globals['_PLAYCONTROLSEQUENCERESPONSE']._serialized_start=3801
+  _globals['_PLAYCONTROLSEQUENCERESPONSE']._serialized_end=3950
+  _globals['_RAYCASTREQUEST']._serialized_start=3953
+  _globals['_RAYCASTREQUEST']._serialized_end=4218
+  _globals['_RAYCASTRESPONSE']._serialized_start=4221
+  _globals['_RAYCASTRESPONSE']._serialized_end=4369
+  _globals['_HEIGHTSCANREQUEST']._serialized_start=4372
+  _globals['_HEIGHTSCANREQUEST']._serialized_end=4617
+  _globals['_HEIGHTSCANRESPONSE']._serialized_start=4620
+  _globals['_HEIGHTSCANRESPONSE']._serialized_end=4768
+  _globals['_GETCONTACTSREQUEST']._serialized_start=4771
+  _globals['_GETCONTACTSREQUEST']._serialized_end=4904
+  _globals['_GETCONTACTSRESPONSE']._serialized_start=4907
+  _globals['_GETCONTACTSRESPONSE']._serialized_end=5091
+  _globals['_MUJOCOSCENESERVICE']._serialized_start=5252
+  _globals['_MUJOCOSCENESERVICE']._serialized_end=6498
 # @@protoc_insertion_point(module_scope)
@@ -73,6 +73,46 @@ class MujocoSceneServiceStub(object):
                 request_serializer=mujoco__scene__pb2.ResetSceneRequest.SerializeToString,
                 response_deserializer=mujoco__scene__pb2.ResetSceneResponse.FromString,
                 _registered_method=True)
+        self.SaveSnapshot = channel.unary_unary(
+                '/hazel.rpc.MujocoSceneService/SaveSnapshot',
+                request_serializer=mujoco__scene__pb2.SaveSnapshotRequest.SerializeToString,
+                response_deserializer=mujoco__scene__pb2.SaveSnapshotResponse.FromString,
+                _registered_method=True)
+        self.RestoreSnapshot = channel.unary_unary(
+                '/hazel.rpc.MujocoSceneService/RestoreSnapshot',
+                request_serializer=mujoco__scene__pb2.RestoreSnapshotRequest.SerializeToString,
+                response_deserializer=mujoco__scene__pb2.RestoreSnapshotResponse.FromString,
+                _registered_method=True)
+        self.ReleaseSnapshots = channel.unary_unary(
+                '/hazel.rpc.MujocoSceneService/ReleaseSnapshots',
+                request_serializer=mujoco__scene__pb2.ReleaseSnapshotsRequest.SerializeToString,
+                response_deserializer=mujoco__scene__pb2.ReleaseSnapshotsResponse.FromString,
+                _registered_method=True)
+        self.BatchRollout = channel.unary_unary(
+                '/hazel.rpc.MujocoSceneService/BatchRollout',
+                request_serializer=mujoco__scene__pb2.BatchRolloutRequest.SerializeToString,
+                response_deserializer=mujoco__scene__pb2.BatchRolloutResponse.FromString,
+                _registered_method=True)
+        self.PlayControlSequence = channel.unary_unary(
+                '/hazel.rpc.MujocoSceneService/PlayControlSequence',
+                request_serializer=mujoco__scene__pb2.PlayControlSequenceRequest.SerializeToString,
+                response_deserializer=mujoco__scene__pb2.PlayControlSequenceResponse.FromString,
+                _registered_method=True)
+        self.Raycast = channel.unary_unary(
+                '/hazel.rpc.MujocoSceneService/Raycast',
+                request_serializer=mujoco__scene__pb2.RaycastRequest.SerializeToString,
+                response_deserializer=mujoco__scene__pb2.RaycastResponse.FromString,
+                _registered_method=True)
+        self.HeightScan = channel.unary_unary(
+                '/hazel.rpc.MujocoSceneService/HeightScan',
+                request_serializer=mujoco__scene__pb2.HeightScanRequest.SerializeToString,
+                response_deserializer=mujoco__scene__pb2.HeightScanResponse.FromString,
+                _registered_method=True)
+        self.GetContacts = channel.unary_unary(
+                '/hazel.rpc.MujocoSceneService/GetContacts',
+                request_serializer=mujoco__scene__pb2.GetContactsRequest.SerializeToString,
+                response_deserializer=mujoco__scene__pb2.GetContactsResponse.FromString,
+                _registered_method=True)
 
 
 class MujocoSceneServiceServicer(object):
@@ -127,6 +167,60 @@ class MujocoSceneServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def SaveSnapshot(self, request, context):
+        """Full mjData + policy-state snapshots held in an engine-side pool.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def RestoreSnapshot(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def ReleaseSnapshots(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def BatchRollout(self, request, context):
+        """Parallel open-loop rollouts over candidate parameter sets (sysid).
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def PlayControlSequence(self, request, context):
+        """Open-loop playback + state recording on the live scene (sysid collection).
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def Raycast(self, request, context):
+        """Batched ray casts against the live mjData.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def HeightScan(self, request, context):
+        """Body-following downward ray grid (terrain heights).
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetContacts(self, request, context):
+        """Active contact list, optionally filtered by body and with forces.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
 
 def add_MujocoSceneServiceServicer_to_server(servicer, server):
     rpc_method_handlers = {
@@ -165,6 +259,46 @@ def add_MujocoSceneServiceServicer_to_server(servicer, server):
                     request_deserializer=mujoco__scene__pb2.ResetSceneRequest.FromString,
                     response_serializer=mujoco__scene__pb2.ResetSceneResponse.SerializeToString,
             ),
+            'SaveSnapshot': grpc.unary_unary_rpc_method_handler(
+                    servicer.SaveSnapshot,
+                    request_deserializer=mujoco__scene__pb2.SaveSnapshotRequest.FromString,
+                    response_serializer=mujoco__scene__pb2.SaveSnapshotResponse.SerializeToString,
+            ),
+            'RestoreSnapshot': grpc.unary_unary_rpc_method_handler(
+                    servicer.RestoreSnapshot,
+                    request_deserializer=mujoco__scene__pb2.RestoreSnapshotRequest.FromString,
+                    response_serializer=mujoco__scene__pb2.RestoreSnapshotResponse.SerializeToString,
+            ),
+            'ReleaseSnapshots': grpc.unary_unary_rpc_method_handler(
+                    servicer.ReleaseSnapshots,
+                    request_deserializer=mujoco__scene__pb2.ReleaseSnapshotsRequest.FromString,
+                    response_serializer=mujoco__scene__pb2.ReleaseSnapshotsResponse.SerializeToString,
+            ),
+            'BatchRollout': grpc.unary_unary_rpc_method_handler(
+                    servicer.BatchRollout,
+                    request_deserializer=mujoco__scene__pb2.BatchRolloutRequest.FromString,
+                    response_serializer=mujoco__scene__pb2.BatchRolloutResponse.SerializeToString,
+            ),
+            'PlayControlSequence': grpc.unary_unary_rpc_method_handler(
+                    servicer.PlayControlSequence,
+                    request_deserializer=mujoco__scene__pb2.PlayControlSequenceRequest.FromString,
+                    response_serializer=mujoco__scene__pb2.PlayControlSequenceResponse.SerializeToString,
+            ),
+            'Raycast': grpc.unary_unary_rpc_method_handler(
+                    servicer.Raycast,
+                    request_deserializer=mujoco__scene__pb2.RaycastRequest.FromString,
+                    response_serializer=mujoco__scene__pb2.RaycastResponse.SerializeToString,
+            ),
+            'HeightScan': grpc.unary_unary_rpc_method_handler(
+                    servicer.HeightScan,
+                    request_deserializer=mujoco__scene__pb2.HeightScanRequest.FromString,
+                    response_serializer=mujoco__scene__pb2.HeightScanResponse.SerializeToString,
+            ),
+            'GetContacts': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetContacts,
+                    request_deserializer=mujoco__scene__pb2.GetContactsRequest.FromString,
+                    response_serializer=mujoco__scene__pb2.GetContactsResponse.SerializeToString,
+            ),
     }
     generic_handler = grpc.method_handlers_generic_handler(
             'hazel.rpc.MujocoSceneService', rpc_method_handlers)
@@ -368,3 +502,219 @@ class MujocoSceneService(object):
             timeout,
             metadata,
             _registered_method=True)
+
+    @staticmethod
+    def SaveSnapshot(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.MujocoSceneService/SaveSnapshot',
+            mujoco__scene__pb2.SaveSnapshotRequest.SerializeToString,
+            mujoco__scene__pb2.SaveSnapshotResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def RestoreSnapshot(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.MujocoSceneService/RestoreSnapshot',
+            mujoco__scene__pb2.RestoreSnapshotRequest.SerializeToString,
+            mujoco__scene__pb2.RestoreSnapshotResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def ReleaseSnapshots(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.MujocoSceneService/ReleaseSnapshots',
+            mujoco__scene__pb2.ReleaseSnapshotsRequest.SerializeToString,
+            mujoco__scene__pb2.ReleaseSnapshotsResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def BatchRollout(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.MujocoSceneService/BatchRollout',
+            mujoco__scene__pb2.BatchRolloutRequest.SerializeToString,
+            mujoco__scene__pb2.BatchRolloutResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def PlayControlSequence(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.MujocoSceneService/PlayControlSequence',
+            mujoco__scene__pb2.PlayControlSequenceRequest.SerializeToString,
+            mujoco__scene__pb2.PlayControlSequenceResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def Raycast(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.MujocoSceneService/Raycast',
+            mujoco__scene__pb2.RaycastRequest.SerializeToString,
+            mujoco__scene__pb2.RaycastResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def HeightScan(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.MujocoSceneService/HeightScan',
+            mujoco__scene__pb2.HeightScanRequest.SerializeToString,
+            mujoco__scene__pb2.HeightScanResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetContacts(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.MujocoSceneService/GetContacts',
+            mujoco__scene__pb2.GetContactsRequest.SerializeToString,
+            mujoco__scene__pb2.GetContactsResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
@@ -0,0 +1,69 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# NO CHECKED-IN PROTOBUF GENCODE
+# source: recorder.proto
+# Protobuf Python Version: 6.31.1
+"""Generated protocol buffer code."""
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import runtime_version as _runtime_version
+from google.protobuf import symbol_database as _symbol_database
+from google.protobuf.internal import builder as _builder
+_runtime_version.ValidateProtobufRuntimeVersion(
+    _runtime_version.Domain.PUBLIC,
+    6,
+    31,
+    1,
+    '',
+    'recorder.proto'
+)
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0erecorder.proto\x12\thazel.rpc\"y\n\x0fRecordingCamera\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\r\n\x05\x63odec\x18\x04 \x01(\t\x12\x14\n\x0c\x65very_n_rows\x18\x05 \x01(\r\x12\x14\n\x0c\x62itrate_kbps\x18\x06 \x01(\r\"\xa1\x02\n\x15StartRecordingRequest\x12\x12\n\noutput_dir\x18\x01 \x01(\t\x12*\n\x06\x66ormat\x18\x02 \x01(\x0e\x32\x1a.hazel.rpc.RecordingFormat\x12\x0f\n\x07\x63olumns\x18\x03 \x03(\t\x12+\n\x07\x63\x61meras\x18\x04 \x03(\x0b\x32\x1a.hazel.rpc.RecordingCamera\x12\x15\n\revery_n_steps\x18\x05 \x01(\r\x12\x15\n\rrows_per_file\x18\x06 \x01(\r\x12\x18\n\x10max_buffer_bytes\x18\x07 \x01(\x04\x12\x34\n\x08overflow\x18\x08 \x01(\x0e\x32\".hazel.rpc.RecordingOverflowPolicy\x12\x0c\n\x04task\x18\t \x01(\t\"d\n\x16StartRecordingResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x14\n\x0crecording_id\x18\x03 \x01(\t\x12\x12\n\noutput_dir\x18\x04 \x01(\t\"\xa6\x02\n\x0fRecordingStatus\x12\x14\n\x0crecording_id\x18\x01 \x01(\t\x12\x0e\n\x06\x61\x63tive\x18\x02 \x01(\x08\x12\x12\n\noutput_dir\x18\x03 \x01(\t\x12\x15\n\rrows_recorded\x18\x04 \x01(\x04\x12\x14\n\x0crows_dropped\x18\x05 \x01(\x04\x12\x1c\n\x14video_frames_dropped\x18\x06 \x01(\x04\x12\x10\n\x08\x65pisodes\x18\x07 \x01(\r\x12\x15\n\rfiles_written\x18\x08 \x01(\r\x12\x15\n\rbytes_written\x18\t \x01(\x04\x12\x14\n\x0c\x62uffer_bytes\x18\n \x01(\x04\x12\x18\n\x10max_buffer_bytes\x18\x0b \x01(\x04\x12\x1e\n\x16physics_thread_time_us\x18\x0c \x01(\x04\"1\n\x19GetRecordingStatusRequest\x12\x14\n\x0crecording_id\x18\x01 \x01(\t\"j\n\x1aGetRecordingStatusResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12*\n\x06status\x18\x03 \x01(\x0b\x32\x1a.hazel.rpc.RecordingStatus\",\n\x14StopRecordingRequest\x12\x14\n\x0crecording_id\x18\x01 \x01(\t\"e\n\x15StopRecordingResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12*\n\x06status\x18\x03 \x01(\x0b\x32\x1a.hazel.rpc.RecordingStatus\"X\n\rReplayCommand\x12\x13\n\x0btimestamp_s\x18\x01 \x01(\x01\x12\x14\n\x0c\x66rame_number\x18\x02 \x01(\x03\x12\x0b\n\x03rpc\x18\x03 \x01(\t\x12\x0f\n\x07request\x18\x04 \x01(\x0c\"b\n\rReplayOptions\x12+\n\x08schedule\x18\x01 \x01(\x0e\x32\x19.hazel.rpc.ReplaySchedule\x12\r\n\x05speed\x18\x02 \x01(\x01\x12\x15\n\rstop_on_error\x18\x03 \x01(\x08\"k\n\x12ReplayCommandChunk\x12)\n\x07options\x18\x01 \x01(\x0b\x32\x18.hazel.rpc.ReplayOptions\x12*\n\x08\x63ommands\x18\x02 \x03(\x0b\x32\x18.hazel.rpc.ReplayCommand\":\n\x0bReplayError\x12\r\n\x05index\x18\x01 \x01(\x04\x12\x0b\n\x03rpc\x18\x02 \x01(\t\x12\x0f\n\x07message\x18\x03 \x01(\t\"\xe0\x01\n\x18ReplayCommandLogResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x18\n\x10\x63ommands_applied\x18\x03 \x01(\x04\x12\x18\n\x10\x63ommands_skipped\x18\x04 \x01(\x04\x12&\n\x06\x65rrors\x18\x05 \x03(\x0b\x32\x16.hazel.rpc.ReplayError\x12\x1a\n\x12\x66inal_frame_number\x18\x06 \x01(\x03\x12\x10\n\x08sim_time\x18\x07 \x01(\x01\x12\x18\n\x10wall_duration_us\x18\x08 \x01(\x04*Q\n\x0fRecordingFormat\x12\x1c\n\x18RECORDING_FORMAT_LEROBOT\x10\x00\x12 \n\x1cRECORDING_FORMAT_PARQUET_MP4\x10\x01*T\n\x17RecordingOverflowPolicy\x12\x1b\n\x17RECORDING_OVERFLOW_DROP\x10\x00\x12\x1c\n\x18RECORDING_OVERFLOW_BLOCK\x10\x01*E\n\x0eReplaySchedule\x12\x19\n\x15REPLAY_SCHEDULE_FRAME\x10\x00\x12\x18\n\x14REPLAY_SCHEDULE_TIME\x10\x01\x32\xf9\x02\n\x0fRecorderService\x12U\n\x0eStartRecording\x12 .hazel.rpc.StartRecordingRequest\x1a!.hazel.rpc.StartRecordingResponse\x12R\n\rStopRecording\x12\x1f.hazel.rpc.StopRecordingRequest\x1a .hazel.rpc.StopRecordingResponse\x12\x61\n\x12GetRecordingStatus\x12$.hazel.rpc.GetRecordingStatusRequest\x1a%.hazel.rpc.GetRecordingStatusResponse\x12X\n\x10ReplayCommandLog\x12\x1d.hazel.rpc.ReplayCommandChunk\x1a#.hazel.rpc.ReplayCommandLogResponse(\x01\x42\x03\xf8\x01\x01\x62\x06proto3')
+
+_globals = globals()
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'recorder_pb2', _globals)
+if not _descriptor._USE_C_DESCRIPTORS:
+  _globals['DESCRIPTOR']._loaded_options = None
+  _globals['DESCRIPTOR']._serialized_options = b'\370\001\001'
+  _globals['_RECORDINGFORMAT']._serialized_start=1737
+  _globals['_RECORDINGFORMAT']._serialized_end=1818
+  _globals['_RECORDINGOVERFLOWPOLICY']._serialized_start=1820
+  _globals['_RECORDINGOVERFLOWPOLICY']._serialized_end=1904
+  _globals['_REPLAYSCHEDULE']._serialized_start=1906
+  _globals['_REPLAYSCHEDULE']._serialized_end=1975
+  _globals['_RECORDINGCAMERA']._serialized_start=29
+  _globals['_RECORDINGCAMERA']._serialized_end=150
+  _globals['_STARTRECORDINGREQUEST']._serialized_start=153
+  _globals['_STARTRECORDINGREQUEST']._serialized_end=442
+  _globals['_STARTRECORDINGRESPONSE']._serialized_start=444
+  _globals['_STARTRECORDINGRESPONSE']._serialized_end=544
+  _globals['_RECORDINGSTATUS']._serialized_start=547
+  _globals['_RECORDINGSTATUS']._serialized_end=841
+  _globals['_GETRECORDINGSTATUSREQUEST']._serialized_start=843
+  _globals['_GETRECORDINGSTATUSREQUEST']._serialized_end=892
+  _globals['_GETRECORDINGSTATUSRESPONSE']._serialized_start=894
+  _globals['_GETRECORDINGSTATUSRESPONSE']._serialized_end=1000
+  _globals['_STOPRECORDINGREQUEST']._serialized_start=1002
+  _globals['_STOPRECORDINGREQUEST']._serialized_end=1046
+  _globals['_STOPRECORDINGRESPONSE']._serialized_start=1048
+  _globals['_STOPRECORDINGRESPONSE']._serialized_end=1149
+  _globals['_REPLAYCOMMAND']._serialized_start=1151
+  _globals['_REPLAYCOMMAND']._serialized_end=1239
+  _globals['_REPLAYOPTIONS']._serialized_start=1241
+  _globals['_REPLAYOPTIONS']._serialized_end=1339
+  _globals['_REPLAYCOMMANDCHUNK']._serialized_start=1341
+  _globals['_REPLAYCOMMANDCHUNK']._serialized_end=1448
+  _globals['_REPLAYERROR']._serialized_start=1450
+  _globals['_REPLAYERROR']._serialized_end=1508
+  _globals['_REPLAYCOMMANDLOGRESPONSE']._serialized_start=1511
+  _globals['_REPLAYCOMMANDLOGRESPONSE']._serialized_end=1735
+  _globals['_RECORDERSERVICE']._serialized_start=1978
+  _globals['_RECORDERSERVICE']._serialized_end=2355
+# @@protoc_insertion_point(module_scope)
@@ -0,0 +1,242 @@
+# Generated by the gRPC Python protocol compiler plugin. DO NOT EDIT!
+"""Client and server classes corresponding to protobuf-defined services."""
+import grpc
+import warnings
+
+from . import recorder_pb2 as recorder__pb2
+
+GRPC_GENERATED_VERSION = '1.80.0'
+GRPC_VERSION = grpc.__version__
+_version_not_supported = False
+
+try:
+    from grpc._utilities import first_version_is_lower
+    _version_not_supported = first_version_is_lower(GRPC_VERSION, GRPC_GENERATED_VERSION)
+except ImportError:
+    _version_not_supported = True
+
+if _version_not_supported:
+    raise RuntimeError(
+        f'The grpc package installed is at version {GRPC_VERSION},'
+        + ' but the generated code in recorder_pb2_grpc.py depends on'
+        + f' grpcio>={GRPC_GENERATED_VERSION}.'
+        + f' Please upgrade your grpc module to grpcio>={GRPC_GENERATED_VERSION}'
+        + f' or downgrade your generated code using grpcio-tools<={GRPC_VERSION}.'
+    )
+
+
+class RecorderServiceStub(object):
+    """=============================================================================
+    Service
+    =============================================================================
+
+    """
+
+    def __init__(self, channel):
+        """Constructor.
+
+        Args:
+            channel: A grpc.Channel.
+        """
+        self.StartRecording = channel.unary_unary(
+                '/hazel.rpc.RecorderService/StartRecording',
+                request_serializer=recorder__pb2.StartRecordingRequest.SerializeToString,
+                response_deserializer=recorder__pb2.StartRecordingResponse.FromString,
+                _registered_method=True)
+        self.StopRecording = channel.unary_unary(
+                '/hazel.rpc.RecorderService/StopRecording',
+                request_serializer=recorder__pb2.StopRecordingRequest.SerializeToString,
+                response_deserializer=recorder__pb2.StopRecordingResponse.FromString,
+                _registered_method=True)
+        self.GetRecordingStatus = channel.unary_unary(
+                '/hazel.rpc.RecorderService/GetRecordingStatus',
+                request_serializer=recorder__pb2.GetRecordingStatusRequest.SerializeToString,
+                response_deserializer=recorder__pb2.GetRecordingStatusResponse.FromString,
+                _registered_method=True)
+        self.ReplayCommandLog = channel.stream_unary(
+                '/hazel.rpc.RecorderService/ReplayCommandLog',
+                request_serializer=recorder__pb2.ReplayCommandChunk.SerializeToString,
+                response_deserializer=recorder__pb2.ReplayCommandLogResponse.FromString,
+                _registered_method=True)
+
+
+class RecorderServiceServicer(object):
+    """=============================================================================
+    Service
+    =============================================================================
+
+    """
+
+    def StartRecording(self, request, context):
+        """Begin recording. Fails if a recording is already active.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def StopRecording(self, request, context):
+        """Drain buffers, finalize files and metadata, and stop.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetRecordingStatus(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def ReplayCommandLog(self, request_iterator, context):
+        """Apply a whole recorded command log in one call, stepping physics
+        between commands instead of waiting out the recorded wall-clock gaps.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+
+def add_RecorderServiceServicer_to_server(servicer, server):
+    rpc_method_handlers = {
+            'StartRecording': grpc.unary_unary_rpc_method_handler(
+                    servicer.StartRecording,
+                    request_deserializer=recorder__pb2.StartRecordingRequest.FromString,
+                    response_serializer=recorder__pb2.StartRecordingResponse.SerializeToString,
+            ),
+            'StopRecording': grpc.unary_unary_rpc_method_handler(
+                    servicer.StopRecording,
+                    request_deserializer=recorder__pb2.StopRecordingRequest.FromString,
+                    response_serializer=recorder__pb2.StopRecordingResponse.SerializeToString,
+            ),
+            'GetRecordingStatus': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetRecordingStatus,
+                    request_deserializer=recorder__pb2.GetRecordingStatusRequest.FromString,
+                    response_serializer=recorder__pb2.GetRecordingStatusResponse.SerializeToString,
+            ),
+            'ReplayCommandLog': grpc.stream_unary_rpc_method_handler(
+                    servicer.ReplayCommandLog,
+                    request_deserializer=recorder__pb2.ReplayCommandChunk.FromString,
+                    response_serializer=recorder__pb2.ReplayCommandLogResponse.SerializeToString,
+            ),
+    }
+    generic_handler = grpc.method_handlers_generic_handler(
+            'hazel.rpc.RecorderService', rpc_method_handlers)
+    server.add_generic_rpc_handlers((generic_handler,))
+    server.add_registered_method_handlers('hazel.rpc.RecorderService', rpc_method_handlers)
+
+
+ # This class is part of an EXPERIMENTAL API.
+class RecorderService(object):
+    """=============================================================================
+    Service
+    =============================================================================
+
+    """
+
+    @staticmethod
+    def StartRecording(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.RecorderService/StartRecording',
+            recorder__pb2.StartRecordingRequest.SerializeToString,
+            recorder__pb2.StartRecordingResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def StopRecording(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.RecorderService/StopRecording',
+            recorder__pb2.StopRecordingRequest.SerializeToString,
+            recorder__pb2.StopRecordingResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetRecordingStatus(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.RecorderService/GetRecordingStatus',
+            recorder__pb2.GetRecordingStatusRequest.SerializeToString,
+            recorder__pb2.GetRecordingStatusResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def ReplayCommandLog(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_unary(
+            request_iterator,
+            target,
+            '/hazel.rpc.RecorderService/ReplayCommandLog',
+            recorder__pb2.ReplayCommandChunk.SerializeToString,
+            recorder__pb2.ReplayCommandLogResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
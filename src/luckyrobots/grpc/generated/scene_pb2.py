@@ -25,7 +25,7 @@ _sym_db = _symbol_database.Default()
 from . import common_pb2 as common__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0bscene.proto\x12\thazel.rpc\x1a\x0c\x63ommon.proto\"x\n\nEntityInfo\x12\x1f\n\x02id\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\'\n\ttransform\x18\x03 \x01(\x0b\x32\x14.hazel.rpc.Transform\x12\x12\n\ncomponents\x18\x04 \x03(\t\"\x15\n\x13GetSceneInfoRequest\"T\n\x14GetSceneInfoResponse\x12\x12\n\nscene_name\x18\x01 \x01(\t\x12\x12\n\nscene_path\x18\x02 \x01(\t\x12\x14\n\x0c\x65ntity_count\x18\x03 \x01(\r\"M\n\x13ListEntitiesRequest\x12\x1a\n\x12include_transforms\x18\x01 \x01(\x08\x12\x1a\n\x12include_components\x18\x02 \x01(\x08\"?\n\x14ListEntitiesResponse\x12\'\n\x08\x65ntities\x18\x01 \x03(\x0b\x32\x15.hazel.rpc.EntityInfo\"S\n\x10GetEntityRequest\x12!\n\x02id\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityIdH\x00\x12\x0e\n\x04name\x18\x02 \x01(\tH\x00\x42\x0c\n\nidentifier\"I\n\x11GetEntityResponse\x12\r\n\x05\x66ound\x18\x01 \x01(\x08\x12%\n\x06\x65ntity\x18\x02 \x01(\x0b\x32\x15.hazel.rpc.EntityInfo\"e\n\x19SetEntityTransformRequest\x12\x1f\n\x02id\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\'\n\ttransform\x18\x02 \x01(\x0b\x32\x14.hazel.rpc.Transform\">\n\x1aSetEntityTransformResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"C\n\x18SetSimulationModeRequest\x12\'\n\x04mode\x18\x01 \x01(\x0e\x32\x19.hazel.rpc.SimulationMode\"n\n\x19SetSimulationModeResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12/\n\x0c\x63urrent_mode\x18\x03 \x01(\x0e\x32\x19.hazel.rpc.SimulationMode\"\x1a\n\x18GetSimulationModeRequest\"D\n\x19GetSimulationModeResponse\x12\'\n\x04mode\x18\x01 \x01(\x0e\x32\x19.hazel.rpc.SimulationMode\"\x16\n\x14\x45nterPlayModeRequest\"9\n\x15\x45nterPlayModeResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"\x15\n\x13\x45xitPlayModeRequest\"8\n\x14\x45xitPlayModeResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t*k\n\x0eSimulationMode\x12\x1c\n\x18SIMULATION_MODE_REALTIME\x10\x00\x12!\n\x1dSIMULATION_MODE_DETERMINISTIC\x10\x01\x12\x18\n\x14SIMULATION_MODE_FAST\x10\x02\x32\xc0\x05\n\x0cSceneService\x12O\n\x0cGetSceneInfo\x12\x1e.hazel.rpc.GetSceneInfoRequest\x1a\x1f.hazel.rpc.GetSceneInfoResponse\x12O\n\x0cListEntities\x12\x1e.hazel.rpc.ListEntitiesRequest\x1a\x1f.hazel.rpc.ListEntitiesResponse\x12\x46\n\tGetEntity\x12\x1b.hazel.rpc.GetEntityRequest\x1a\x1c.hazel.rpc.GetEntityResponse\x12\x61\n\x12SetEntityTransform\x12$.hazel.rpc.SetEntityTransformRequest\x1a%.hazel.rpc.SetEntityTransformResponse\x12^\n\x11SetSimulationMode\x12#.hazel.rpc.SetSimulationModeRequest\x1a$.hazel.rpc.SetSimulationModeResponse\x12^\n\x11GetSimulationMode\x12#.hazel.rpc.GetSimulationModeRequest\x1a$.hazel.rpc.GetSimulationModeResponse\x12R\n\rEnterPlayMode\x12\x1f.hazel.rpc.EnterPlayModeRequest\x1a .hazel.rpc.EnterPlayModeResponse\x12O\n\x0c\x45xitPlayMode\x12\x1e.hazel.rpc.ExitPlayModeRequest\x1a\x1f.hazel.rpc.ExitPlayModeResponseB\x03\xf8\x01\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0bscene.proto\x12\thazel.rpc\x1a\x0c\x63ommon.proto\"x\n\nEntityInfo\x12\x1f\n\x02id\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\'\n\ttransform\x18\x03 \x01(\x0b\x32\x14.hazel.rpc.Transform\x12\x12\n\ncomponents\x18\x04 \x03(\t\"\x15\n\x13GetSceneInfoRequest\"\x9a\x02\n\x14GetSceneInfoResponse\x12\x12\n\nscene_name\x18\x01 \x01(\t\x12\x12\n\nscene_path\x18\x02 \x01(\t\x12\x14\n\x0c\x65ntity_count\x18\x03 \x01(\r\x12\x10\n\x08headless\x18\x04 \x01(\x08\x12\x19\n\x11rendering_enabled\x18\x05 \x01(\x08\x12\x1b\n\x13startup_duration_ms\x18\x06 \x01(\x04\x12\x1e\n\x16scene_load_duration_ms\x18\x07 \x01(\x04\x12\x17\n\x0fscene_cache_hit\x18\x08 \x01(\x08\x12\x1d\n\x15resident_memory_bytes\x18\t \x01(\x04\x12\"\n\x1apeak_resident_memory_bytes\x18\n \x01(\x04\"M\n\x13ListEntitiesRequest\x12\x1a\n\x12include_transforms\x18\x01 \x01(\x08\x12\x1a\n\x12include_components\x18\x02 \x01(\x08\"?\n\x14ListEntitiesResponse\x12\'\n\x08\x65ntities\x18\x01 \x03(\x0b\x32\x15.hazel.rpc.EntityInfo\"S\n\x10GetEntityRequest\x12!\n\x02id\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityIdH\x00\x12\x0e\n\x04name\x18\x02 \x01(\tH\x00\x42\x0c\n\nidentifier\"I\n\x11GetEntityResponse\x12\r\n\x05\x66ound\x18\x01 \x01(\x08\x12%\n\x06\x65ntity\x18\x02 \x01(\x0b\x32\x15.hazel.rpc.EntityInfo\"e\n\x19SetEntityTransformRequest\x12\x1f\n\x02id\x18\x01 \x01(\x0b\x32\x13.hazel.rpc.EntityId\x12\'\n\ttransform\x18\x02 \x01(\x0b\x32\x14.hazel.rpc.Transform\">\n\x1aSetEntityTransformResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"C\n\x18SetSimulationModeRequest\x12\'\n\x04mode\x18\x01 \x01(\x0e\x32\x19.hazel.rpc.SimulationMode\"n\n\x19SetSimulationModeResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12/\n\x0c\x63urrent_mode\x18\x03 \x01(\x0e\x32\x19.hazel.rpc.SimulationMode\"\x1a\n\x18GetSimulationModeRequest\"D\n\x19GetSimulationModeResponse\x12\'\n\x04mode\x18\x01 \x01(\x0e\x32\x19.hazel.rpc.SimulationMode\"c\n\x16PhysicsThreadingConfig\x12\x13\n\x0bnum_threads\x18\x01 \x01(\r\x12\x34\n\x0cpartitioning\x18\x02 \x01(\x0e\x32\x1e.hazel.rpc.PhysicsPartitioning\"O\n\x1aSetPhysicsThreadingRequest\x12\x31\n\x06\x63onfig\x18\x01 \x01(\x0b\x32!.hazel.rpc.PhysicsThreadingConfig\"\x1c\n\x1aGetPhysicsThreadingRequest\"\xa2\x01\n\x18PhysicsThreadingResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\x31\n\x06\x63onfig\x18\x03 \x01(\x0b\x32!.hazel.rpc.PhysicsThreadingConfig\x12\x18\n\x10hardware_threads\x18\x04 \x01(\r\x12\x17\n\x0fpartition_count\x18\x05 \x01(\r\"\xb2\x01\n\x0eRpcClassConfig\x12\x33\n\x0epriority_class\x18\x01 \x01(\x0e\x32\x1b.hazel.rpc.RpcPriorityClass\x12\x13\n\x0bnum_threads\x18\x02 \x01(\r\x12\x1c\n\x14max_bytes_per_second\x18\x03 \x01(\x04\x12\x1f\n\x17max_messages_per_second\x18\x04 \x01(\r\x12\x17\n\x0fmax_queue_depth\x18\x05 \x01(\r\"U\n\x0eRpcMethodClass\x12\x0e\n\x06method\x18\x01 \x01(\t\x12\x33\n\x0epriority_class\x18\x02 \x01(\x0e\x32\x1b.hazel.rpc.RpcPriorityClass\"m\n\x0cRpcQosConfig\x12*\n\x07\x63lasses\x18\x01 \x03(\x0b\x32\x19.hazel.rpc.RpcClassConfig\x12\x31\n\x0emethod_classes\x18\x02 \x03(\x0b\x32\x19.hazel.rpc.RpcMethodClass\";\n\x10SetRpcQosRequest\x12\'\n\x06\x63onfig\x18\x01 \x01(\x0b\x32\x17.hazel.rpc.RpcQosConfig\"\x12\n\x10GetRpcQosRequest\"[\n\x0eRpcQosResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\x12\'\n\x06\x63onfig\x18\x03 \x01(\x0b\x32\x17.hazel.rpc.RpcQosConfig\"(\n\x17GetRpcQosMetricsRequest\x12\r\n\x05reset\x18\x01 \x01(\x08\"\xff\x02\n\x0fRpcClassMetrics\x12\x33\n\x0epriority_class\x18\x01 \x01(\x0e\x32\x1b.hazel.rpc.RpcPriorityClass\x12\x13\n\x0bnum_threads\x18\x02 \x01(\r\x12\x13\n\x0bqueue_depth\x18\x03 \x01(\r\x12\x17\n\x0fmax_queue_depth\x18\x04 \x01(\r\x12\x14\n\x0c\x61\x63tive_calls\x18\x05 \x01(\r\x12\x17\n\x0f\x63ompleted_calls\x18\x06 \x01(\x04\x12\x15\n\rmessages_sent\x18\x07 \x01(\x04\x12\x12\n\nbytes_sent\x18\x08 \x01(\x04\x12\x1a\n\x12throttled_messages\x18\t \x01(\x04\x12\x18\n\x10\x64ropped_messages\x18\n \x01(\x04\x12\x19\n\x11queue_wait_p50_us\x18\x0b \x01(\r\x12\x19\n\x11queue_wait_p99_us\x18\x0c \x01(\r\x12\x16\n\x0elatency_p50_us\x18\r \x01(\r\x12\x16\n\x0elatency_p99_us\x18\x0e \x01(\r\"Y\n\x18GetRpcQosMetricsResponse\x12+\n\x07\x63lasses\x18\x01 \x03(\x0b\x32\x1a.hazel.rpc.RpcClassMetrics\x12\x10\n\x08window_s\x18\x02 \x01(\x01\"\x16\n\x14\x45nterPlayModeRequest\"9\n\x15\x45nterPlayModeResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"\x15\n\x13\x45xitPlayModeRequest\"8\n\x14\x45xitPlayModeResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t*k\n\x0eSimulationMode\x12\x1c\n\x18SIMULATION_MODE_REALTIME\x10\x00\x12!\n\x1dSIMULATION_MODE_DETERMINISTIC\x10\x01\x12\x18\n\x14SIMULATION_MODE_FAST\x10\x02*\x9c\x01\n\x13PhysicsPartitioning\x12\x1d\n\x19PHYSICS_PARTITIONING_AUTO\x10\x00\x12\x1d\n\x19PHYSICS_PARTITIONING_NONE\x10\x01\x12 \n\x1cPHYSICS_PARTITIONING_ISLANDS\x10\x02\x12%\n!PHYSICS_PARTITIONING_ENV_REPLICAS\x10\x03*\x93\x01\n\x10RpcPriorityClass\x12\"\n\x1eRPC_PRIORITY_CLASS_UNSPECIFIED\x10\x00\x12\x1e\n\x1aRPC_PRIORITY_CLASS_CONTROL\x10\x01\x12\x1e\n\x1aRPC_PRIORITY_CLASS_DEFAULT\x10\x02\x12\x1b\n\x17RPC_PRIORITY_CLASS_BULK\x10\x03\x32\xed\x08\n\x0cSceneService\x12O\n\x0cGetSceneInfo\x12\x1e.hazel.rpc.GetSceneInfoRequest\x1a\x1f.hazel.rpc.GetSceneInfoResponse\x12O\n\x0cListEntities\x12\x1e.hazel.rpc.ListEntitiesRequest\x1a\x1f.hazel.rpc.ListEntitiesResponse\x12\x46\n\tGetEntity\x12\x1b.hazel.rpc.GetEntityRequest\x1a\x1c.hazel.rpc.GetEntityResponse\x12\x61\n\x12SetEntityTransform\x12$.hazel.rpc.SetEntityTransformRequest\x1a%.hazel.rpc.SetEntityTransformResponse\x12^\n\x11SetSimulationMode\x12#.hazel.rpc.SetSimulationModeRequest\x1a$.hazel.rpc.SetSimulationModeResponse\x12^\n\x11GetSimulationMode\x12#.hazel.rpc.GetSimulationModeRequest\x1a$.hazel.rpc.GetSimulationModeResponse\x12\x61\n\x13SetPhysicsThreading\x12%.hazel.rpc.SetPhysicsThreadingRequest\x1a#.hazel.rpc.PhysicsThreadingResponse\x12\x61\n\x13GetPhysicsThreading\x12%.hazel.rpc.GetPhysicsThreadingRequest\x1a#.hazel.rpc.PhysicsThreadingResponse\x12\x43\n\tSetRpcQos\x12\x1b.hazel.rpc.SetRpcQosRequest\x1a\x19.hazel.rpc.RpcQosResponse\x12\x43\n\tGetRpcQos\x12\x1b.hazel.rpc.GetRpcQosRequest\x1a\x19.hazel.rpc.RpcQosResponse\x12[\n\x10GetRpcQosMetrics\x12\".hazel.rpc.GetRpcQosMetricsRequest\x1a#.hazel.rpc.GetRpcQosMetricsResponse\x12R\n\rEnterPlayMode\x12\x1f.hazel.rpc.EnterPlayModeRequest\x1a .hazel.rpc.EnterPlayModeResponse\x12O\n\x0c\x45xitPlayMode\x12\x1e.hazel.rpc.ExitPlayModeRequest\x1a\x1f.hazel.rpc.ExitPlayModeResponseB\x03\xf8\x01\x01\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -33,42 +33,72 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'scene_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   _globals['DESCRIPTOR']._loaded_options = None
   _globals['DESCRIPTOR']._serialized_options = b'\370\001\001'
-  _globals['_SIMULATIONMODE']._serialized_start=1185
-  _globals['_SIMULATIONMODE']._serialized_end=1292
+  _globals['_SIMULATIONMODE']._serialized_start=2833
+  _globals['_SIMULATIONMODE']._serialized_end=2940
+  _globals['_PHYSICSPARTITIONING']._serialized_start=2943
+  _globals['_PHYSICSPARTITIONING']._serialized_end=3099
+  _globals['_RPCPRIORITYCLASS']._serialized_start=3102
+  _globals['_RPCPRIORITYCLASS']._serialized_end=3249
   _globals['_ENTITYINFO']._serialized_start=40
   _globals['_ENTITYINFO']._serialized_end=160
   _globals['_GETSCENEINFOREQUEST']._serialized_start=162
   _globals['_GETSCENEINFOREQUEST']._serialized_end=183
-  _globals['_GETSCENEINFORESPONSE']._serialized_start=185
-  _globals['_GETSCENEINFORESPONSE']._serialized_end=269
-  _globals['_LISTENTITIESREQUEST']._serialized_start=271
-  _globals['_LISTENTITIESREQUEST']._serialized_end=348
-  _globals['_LISTENTITIESRESPONSE']._serialized_start=350
-  _globals['_LISTENTITIESRESPONSE']._serialized_end=413
-  _globals['_GETENTITYREQUEST']._serialized_start=415
-  _globals['_GETENTITYREQUEST']._serialized_end=498
-  _globals['_GETENTITYRESPONSE']._serialized_start=500
-  _globals['_GETENTITYRESPONSE']._serialized_end=573
-  _globals['_SETENTITYTRANSFORMREQUEST']._serialized_start=575
-  _globals['_SETENTITYTRANSFORMREQUEST']._serialized_end=676
-  _globals['_SETENTITYTRANSFORMRESPONSE']._serialized_start=678
-  _globals['_SETENTITYTRANSFORMRESPONSE']._serialized_end=740
-  _globals['_SETSIMULATIONMODEREQUEST']._serialized_start=742
-  _globals['_SETSIMULATIONMODEREQUEST']._serialized_end=809
-  _globals['_SETSIMULATIONMODERESPONSE']._serialized_start=811
-  _globals['_SETSIMULATIONMODERESPONSE']._serialized_end=921
-  _globals['_GETSIMULATIONMODEREQUEST']._serialized_start=923
-  _globals['_GETSIMULATIONMODEREQUEST']._serialized_end=949
-  _globals['_GETSIMULATIONMODERESPONSE']._serialized_start=951
-  _globals['_GETSIMULATIONMODERESPONSE']._serialized_end=1019
-  _globals['_ENTERPLAYMODEREQUEST']._serialized_start=1021
-  _globals['_ENTERPLAYMODEREQUEST']._serialized_end=1043
-  _globals['_ENTERPLAYMODERESPONSE']._serialized_start=1045
-  _globals['_ENTERPLAYMODERESPONSE']._serialized_end=1102
-  _globals['_EXITPLAYMODEREQUEST']._serialized_start=1104
-  _globals['_EXITPLAYMODEREQUEST']._serialized_end=1125
-  _globals['_EXITPLAYMODERESPONSE']._serialized_start=1127
-  _globals['_EXITPLAYMODERESPONSE']._serialized_end=1183
-  _globals['_SCENESERVICE']._serialized_start=1295
-  _globals['_SCENESERVICE']._serialized_end=1999
+  _globals['_GETSCENEINFORESPONSE']._serialized_start=186
+  _globals['_GETSCENEINFORESPONSE']._serialized_end=468
+  _globals['_LISTENTITIESREQUEST']._serialized_start=470
+  _globals['_LISTENTITIESREQUEST']._serialized_end=547
+  _globals['_LISTENTITIESRESPONSE']._serialized_start=549
+  _globals['_LISTENTITIESRESPONSE']._serialized_end=612
+  _globals['_GETENTITYREQUEST']._serialized_start=614
+  _globals['_GETENTITYREQUEST']._serialized_end=697
+  _globals['_GETENTITYRESPONSE']._serialized_start=699
+  _globals['_GETENTITYRESPONSE']._serialized_end=772
+  _globals['_SETENTITYTRANSFORMREQUEST']._serialized_start=774
+  _globals['_SETENTITYTRANSFORMREQUEST']._serialized_end=875
+  _globals['_SETENTITYTRANSFORMRESPONSE']._serialized_start=877
+  _globals['_SETENTITYTRANSFORMRESPONSE']._serialized_end=939
+  _globals['_SETSIMULATIONMODEREQUEST']._serialized_start=941
+  _globals['_SETSIMULATIONMODEREQUEST']._serialized_end=1008
+  _globals['_SETSIMULATIONMODERESPONSE']._serialized_start=1010
+  _globals['_SETSIMULATIONMODERESPONSE']._serialized_end=1120
+  _globals['_GETSIMULATIONMODEREQUEST']._serialized_start=1122
+  _globals['_GETSIMULATIONMODEREQUEST']._serialized_end=1148
+  _globals['_GETSIMULATIONMODERESPONSE']._serialized_start=1150
+  _globals['_GETSIMULATIONMODERESPONSE']._serialized_end=1218
+  _globals['_PHYSICSTHREADINGCONFIG']._serialized_start=1220
+  _globals['_PHYSICSTHREADINGCONFIG']._serialized_end=1319
+  _globals['_SETPHYSICSTHREADINGREQUEST']._serialized_start=1321
+  _globals['_SETPHYSICSTHREADINGREQUEST']._serialized_end=1400
+  _globals['_GETPHYSICSTHREADINGREQUEST']._serialized_start=1402
+  _globals['_GETPHYSICSTHREADINGREQUEST']._serialized_end=1430
+  _globals['_PHYSICSTHREADINGRESPONSE']._serialized_start=1433
+  _globals['_PHYSICSTHREADINGRESPONSE']._serialized_end=1595
+  _globals['_RPCCLASSCONFIG']._serialized_start=1598
+  _globals['_RPCCLASSCONFIG']._serialized_end=1776
+  _globals['_RPCMETHODCLASS']._serialized_start=1778
+  _globals['_RPCMETHODCLASS']._serialized_end=1863
+  _globals['_RPCQOSCONFIG']._serialized_start=1865
+  _globals['_RPCQOSCONFIG']._serialized_end=1974
+  _globals['_SETRPCQOSREQUEST']._serialized_start=1976
+  _globals['_SETRPCQOSREQUEST']._serialized_end=2035
+  _globals['_GETRPCQOSREQUEST']._serialized_start=2037
+  _globals['_GETRPCQOSREQUEST']._serialized_end=2055
+  _globals['_RPCQOSRESPONSE']._serialized_start=2057
+  _globals['_RPCQOSRESPONSE']._serialized_end=2148
+  _globals['_GETRPCQOSMETRICSREQUEST']._serialized_start=2150
+  _globals['_GETRPCQOSMETRICSREQUEST']._serialized_end=2190
+  _globals['_RPCCLASSMETRICS']._serialized_start=2193
+  _globals['_RPCCLASSMETRICS']._serialized_end=2576
+  _globals['_GETRPCQOSMETRICSRESPONSE']._serialized_start=2578
+  _globals['_GETRPCQOSMETRICSRESPONSE']._serialized_end=2667
+  _globals['_ENTERPLAYMODEREQUEST']._serialized_start=2669
+  _globals['_ENTERPLAYMODEREQUEST']._serialized_end=2691
+  _globals['_ENTERPLAYMODERESPONSE']._serialized_start=2693
+  _globals['_ENTERPLAYMODERESPONSE']._serialized_end=2750
+  _globals['_EXITPLAYMODEREQUEST']._serialized_start=2752
+  _globals['_EXITPLAYMODEREQUEST']._serialized_end=2773
+  _globals['_EXITPLAYMODERESPONSE']._serialized_start=2775
+  _globals['_EXITPLAYMODERESPONSE']._serialized_end=2831
+  _globals['_SCENESERVICE']._serialized_start=3252
+  _globals['_SCENESERVICE']._serialized_end=4385
 # @@protoc_insertion_point(module_scope)
@@ -65,6 +65,31 @@ class SceneServiceStub(object):
                 request_serializer=scene__pb2.GetSimulationModeRequest.SerializeToString,
                 response_deserializer=scene__pb2.GetSimulationModeResponse.FromString,
                 _registered_method=True)
+        self.SetPhysicsThreading = channel.unary_unary(
+                '/hazel.rpc.SceneService/SetPhysicsThreading',
+                request_serializer=scene__pb2.SetPhysicsThreadingRequest.SerializeToString,
+                response_deserializer=scene__pb2.PhysicsThreadingResponse.FromString,
+                _registered_method=True)
+        self.GetPhysicsThreading = channel.unary_unary(
+                '/hazel.rpc.SceneService/GetPhysicsThreading',
+                request_serializer=scene__pb2.GetPhysicsThreadingRequest.SerializeToString,
+                response_deserializer=scene__pb2.PhysicsThreadingResponse.FromString,
+                _registered_method=True)
+        self.SetRpcQos = channel.unary_unary(
+                '/hazel.rpc.SceneService/SetRpcQos',
+                request_serializer=scene__pb2.SetRpcQosRequest.SerializeToString,
+                response_deserializer=scene__pb2.RpcQosResponse.FromString,
+                _registered_method=True)
+        self.GetRpcQos = channel.unary_unary(
+                '/hazel.rpc.SceneService/GetRpcQos',
+                request_serializer=scene__pb2.GetRpcQosRequest.SerializeToString,
+                response_deserializer=scene__pb2.RpcQosResponse.FromString,
+                _registered_method=True)
+        self.GetRpcQosMetrics = channel.unary_unary(
+                '/hazel.rpc.SceneService/GetRpcQosMetrics',
+                request_serializer=scene__pb2.GetRpcQosMetricsRequest.SerializeToString,
+                response_deserializer=scene__pb2.GetRpcQosMetricsResponse.FromString,
+                _registered_method=True)
         self.EnterPlayMode = channel.unary_unary(
                 '/hazel.rpc.SceneService/EnterPlayMode',
                 request_serializer=scene__pb2.EnterPlayModeRequest.SerializeToString,
@@ -119,6 +144,40 @@ class SceneServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def SetPhysicsThreading(self, request, context):
+        """Configure / query multi-threaded physics stepping. Takes effect on the
+        next tick; per-thread timings come back in StepResponse.physics_threads.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetPhysicsThreading(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def SetRpcQos(self, request, context):
+        """Configure / query per-class RPC scheduling (thread pools, bulk-stream
+        budgets) and read per-class queue-depth and latency metrics.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetRpcQos(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetRpcQosMetrics(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def EnterPlayMode(self, request, context):
         """Editor scene lifecycle. Both RPCs return immediately after dispatching
         the request — the actual transition is async (entering Play triggers
@@ -181,6 +240,31 @@ def add_SceneServiceServicer_to_server(servicer, server):
                     request_deserializer=scene__pb2.GetSimulationModeRequest.FromString,
                     response_serializer=scene__pb2.GetSimulationModeResponse.SerializeToString,
             ),
+            'SetPhysicsThreading': grpc.unary_unary_rpc_method_handler(
+                    servicer.SetPhysicsThreading,
+                    request_deserializer=scene__pb2.SetPhysicsThreadingRequest.FromString,
+                    response_serializer=scene__pb2.PhysicsThreadingResponse.SerializeToString,
+            ),
+            'GetPhysicsThreading': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetPhysicsThreading,
+                    request_deserializer=scene__pb2.GetPhysicsThreadingRequest.FromString,
+                    response_serializer=scene__pb2.PhysicsThreadingResponse.SerializeToString,
+            ),
+            'SetRpcQos': grpc.unary_unary_rpc_method_handler(
+                    servicer.SetRpcQos,
+                    request_deserializer=scene__pb2.SetRpcQosRequest.FromString,
+                    response_serializer=scene__pb2.RpcQosResponse.SerializeToString,
+            ),
+            'GetRpcQos': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetRpcQos,
+                    request_deserializer=scene__pb2.GetRpcQosRequest.FromString,
+                    response_serializer=scene__pb2.RpcQosResponse.SerializeToString,
+            ),
+            'GetRpcQosMetrics': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetRpcQosMetrics,
+                    request_deserializer=scene__pb2.GetRpcQosMetricsRequest.FromString,
+                    response_serializer=scene__pb2.GetRpcQosMetricsResponse.SerializeToString,
+            ),
             'EnterPlayMode': grpc.unary_unary_rpc_method_handler(
                     servicer.EnterPlayMode,
                     request_deserializer=scene__pb2.EnterPlayModeRequest.FromString,
@@ -365,6 +449,141 @@ class SceneService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def SetPhysicsThreading(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.SceneService/SetPhysicsThreading',
+            scene__pb2.SetPhysicsThreadingRequest.SerializeToString,
+            scene__pb2.PhysicsThreadingResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetPhysicsThreading(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.SceneService/GetPhysicsThreading',
+            scene__pb2.GetPhysicsThreadingRequest.SerializeToString,
+            scene__pb2.PhysicsThreadingResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def SetRpcQos(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.SceneService/SetRpcQos',
+            scene__pb2.SetRpcQosRequest.SerializeToString,
+            scene__pb2.RpcQosResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetRpcQos(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.SceneService/GetRpcQos',
+            scene__pb2.GetRpcQosRequest.SerializeToString,
+            scene__pb2.RpcQosResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetRpcQosMetrics(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/hazel.rpc.SceneService/GetRpcQosMetrics',
+            scene__pb2.GetRpcQosMetricsRequest.SerializeToString,
+            scene__pb2.GetRpcQosMetricsResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def EnterPlayMode(request,
             target,
@@ -22,9 +22,10 @@ _runtime_version.ValidateProtobufRuntimeVersion(
 _sym_db = _symbol_database.Default()
 
 
+from . import common_pb2 as common__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0ftelemetry.proto\x12\thazel.rpc\"Z\n\x0fTelemetrySchema\x12\x19\n\x11observation_names\x18\x01 \x03(\t\x12\x14\n\x0c\x61\x63tion_names\x18\x02 \x03(\t\x12\n\n\x02nq\x18\x03 \x01(\r\x12\n\n\x02nu\x18\x04 \x01(\r\"\x1b\n\x19GetTelemetrySchemaRequest\"H\n\x1aGetTelemetrySchemaResponse\x12*\n\x06schema\x18\x01 \x01(\x0b\x32\x1a.hazel.rpc.TelemetrySchema\",\n\x16StreamTelemetryRequest\x12\x12\n\ntarget_fps\x18\x01 \x01(\r\"\x7f\n\x0eTelemetryFrame\x12\x14\n\x0ctimestamp_ms\x18\x01 \x01(\x04\x12\x14\n\x0c\x66rame_number\x18\x02 \x01(\r\x12\x12\n\ntask_index\x18\x03 \x01(\r\x12\x18\n\x10observation_qpos\x18\x04 \x03(\x02\x12\x13\n\x0b\x61\x63tion_ctrl\x18\x05 \x03(\x02\x32\xc8\x01\n\x10TelemetryService\x12\x61\n\x12GetTelemetrySchema\x12$.hazel.rpc.GetTelemetrySchemaRequest\x1a%.hazel.rpc.GetTelemetrySchemaResponse\x12Q\n\x0fStreamTelemetry\x12!.hazel.rpc.StreamTelemetryRequest\x1a\x19.hazel.rpc.TelemetryFrame0\x01\x42\x03\xf8\x01\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0ftelemetry.proto\x12\thazel.rpc\x1a\x0c\x63ommon.proto\"Z\n\x0fTelemetrySchema\x12\x19\n\x11observation_names\x18\x01 \x03(\t\x12\x14\n\x0c\x61\x63tion_names\x18\x02 \x03(\t\x12\n\n\x02nq\x18\x03 \x01(\r\x12\n\n\x02nu\x18\x04 \x01(\r\"\x1b\n\x19GetTelemetrySchemaRequest\"H\n\x1aGetTelemetrySchemaResponse\x12*\n\x06schema\x18\x01 \x01(\x0b\x32\x1a.hazel.rpc.TelemetrySchema\"Z\n\x16StreamTelemetryRequest\x12\x12\n\ntarget_fps\x18\x01 \x01(\r\x12,\n\x05\x64\x65lta\x18\x02 \x01(\x0b\x32\x1d.hazel.rpc.DeltaStreamOptions\"\xfa\x01\n\x0eTelemetryFrame\x12\x14\n\x0ctimestamp_ms\x18\x01 \x01(\x04\x12\x14\n\x0c\x66rame_number\x18\x02 \x01(\r\x12\x12\n\ntask_index\x18\x03 \x01(\r\x12\x18\n\x10observation_qpos\x18\x04 \x03(\x02\x12\x13\n\x0b\x61\x63tion_ctrl\x18\x05 \x03(\x02\x12\x10\n\x08keyframe\x18\x06 \x01(\x08\x12\x35\n\x16observation_qpos_delta\x18\x07 \x01(\x0b\x32\x15.hazel.rpc.DeltaArray\x12\x30\n\x11\x61\x63tion_ctrl_delta\x18\x08 \x01(\x0b\x32\x15.hazel.rpc.DeltaArray2\xc8\x01\n\x10TelemetryService\x12\x61\n\x12GetTelemetrySchema\x12$.hazel.rpc.GetTelemetrySchemaRequest\x1a%.hazel.rpc.GetTelemetrySchemaResponse\x12Q\n\x0fStreamTelemetry\x12!.hazel.rpc.StreamTelemetryRequest\x1a\x19.hazel.rpc.TelemetryFrame0\x01\x42\x03\xf8\x01\x01\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -32,16 +33,16 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'telemetry_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   _globals['DESCRIPTOR']._loaded_options = None
   _globals['DESCRIPTOR']._serialized_options = b'\370\001\001'
-  _globals['_TELEMETRYSCHEMA']._serialized_start=30
-  _globals['_TELEMETRYSCHEMA']._serialized_end=120
-  _globals['_GETTELEMETRYSCHEMAREQUEST']._serialized_start=122
-  _globals['_GETTELEMETRYSCHEMAREQUEST']._serialized_end=149
-  _globals['_GETTELEMETRYSCHEMARESPONSE']._serialized_start=151
-  _globals['_GETTELEMETRYSCHEMARESPONSE']._serialized_end=223
-  _globals['_STREAMTELEMETRYREQUEST']._serialized_start=225
-  _globals['_STREAMTELEMETRYREQUEST']._serialized_end=269
-  _globals['_TELEMETRYFRAME']._serialized_start=271
-  _globals['_TELEMETRYFRAME']._serialized_end=398
-  _globals['_TELEMETRYSERVICE']._serialized_start=401
-  _globals['_TELEMETRYSERVICE']._serialized_end=601
+  _globals['_TELEMETRYSCHEMA']._serialized_start=44
+  _globals['_TELEMETRYSCHEMA']._serialized_end=134
+  _globals['_GETTELEMETRYSCHEMAREQUEST']._serialized_start=136
+  _globals['_GETTELEMETRYSCHEMAREQUEST']._serialized_end=163
+  _globals['_GETTELEMETRYSCHEMARESPONSE']._serialized_start=165
+  _globals['_GETTELEMETRYSCHEMARESPONSE']._serialized_end=237
+  _globals['_STREAMTELEMETRYREQUEST']._serialized_start=239
+  _globals['_STREAMTELEMETRYREQUEST']._serialized_end=329
+  _globals['_TELEMETRYFRAME']._serialized_start=332
+  _globals['_TELEMETRYFRAME']._serialized_end=582
+  _globals['_TELEMETRYSERVICE']._serialized_start=585
+  _globals['_TELEMETRYSERVICE']._serialized_end=785
 # @@protoc_insertion_point(module_scope)
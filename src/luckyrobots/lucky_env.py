@@ -53,6 +53,71 @@ def _require_gymnasium():
         )
 
 
+def build_task_contract(
+    robot: str,
+    scene: str,
+    reward_terms: Optional[list[str]] = None,
+    termination_terms: Optional[list[str]] = None,
+    observation_terms: Optional[list[str]] = None,
+    max_episode_length_s: float = 20.0,
+    num_envs: int = 0,
+    step_encoding: str = "proto",
+    physics_backend: str = "cpu",
+) -> dict:
+    """Build the task contract dict accepted by LuckyEngineClient.negotiate_task."""
+    contract: dict[str, Any] = {
+        "task_id": f"{robot}_{scene}",
+        "robot": robot,
+        "scene": scene,
+    }
+
+    if reward_terms:
+        contract["rewards"] = {
+            "engine_terms": [{"name": t} for t in reward_terms],
+        }
+
+    if termination_terms:
+        contract["terminations"] = {
+            "terms": [
+                {
+                    "name": t,
+                    "is_timeout": t == "time_out",
+                    "params": (
+                        {"max_episode_length_s": str(max_episode_length_s)}
+                        if t == "time_out"
+                        else {}
+                    ),
+                }
+                for t in termination_terms
+            ],
+        }
+
+    if observation_terms:
+        contract["observations"] = {
+            "required": [{"name": t} for t in observation_terms],
+        }
+
+    if num_envs:
+        contract["num_envs"] = int(num_envs)
+
+    if step_encoding != "proto":
+        contract["step_encoding"] = step_encoding
+
+    if physics_backend != "cpu":
+        contract["physics_backend"] = physics_backend
+
+    return contract
+
+
+def log_contract_warnings(result: dict) -> None:
+    """Log the validation warnings returned by negotiate_task, if any."""
+    for w in result.get("warnings", []):
+        logger.warning(
+            "Contract warning [%s/%s]: %s — %s",
+            w["component"], w["term_name"], w["message"], w["suggestion"],
+        )
+
+
 class LuckyEnv:
     """Gymnasium-compatible environment wrapping LuckyEngine via gRPC.
 
@@ -85,6 +150,9 @@ class LuckyEnv:
         max_episode_length_s: float = 20.0,
         auto_start: bool = False,
         agent_name: str = "",
+        packed: bool = False,
+        decimation: int = 1,
+        substep_reduction: str = "sum",
     ):
         """Initialize LuckyEnv.
 
@@ -103,9 +171,14 @@ class LuckyEnv:
             max_episode_length_s: Maximum episode length in seconds.
             auto_start: If True, launch the engine process automatically.
             agent_name: Agent name (empty = default agent).
+            packed: Negotiate the packed Step encoding: observation, reward
+                signals and flags arrive as one little-endian buffer decoded
+                with np.frombuffer instead of per-field proto lists and maps.
+            decimation: Physics substeps per env step. The engine repeats each
+                action this many times in a single Step RPC.
+            substep_reduction: How reward signals combine across substeps
+                ("sum", "mean" or "last").
         """
-        from .client import LuckyEngineClient
-
         self._robot = robot
         self._scene = scene
         self._reward_fn = reward_fn or self._default_reward_fn
@@ -115,15 +188,31 @@ class LuckyEnv:
         self._randomization_cfg = randomization_cfg
         self._max_episode_length_s = max_episode_length_s
         self._agent_name = agent_name
+        self._packed = packed
+        if decimation < 1:
+            raise ValueError(f"decimation must be >= 1, got {decimation}")
+        self._decimation = int(decimation)
+        self._substep_reduction = substep_reduction
         self._step_count = 0
+        self._client = None
+        self._session_id = None
+        self._connect(host, port, timeout)
+
+    def _connect(self, host: str, port: int, timeout: float) -> None:
+        """Connect, size the spaces from the agent schema and negotiate the contract."""
+        from .client import LuckyEngineClient
 
-        # Connect to engine
         self._client = LuckyEngineClient(host=host, port=port, timeout=timeout)
         self._client.connect()
         self._client.wait_for_server(timeout=timeout)
 
-        # Fetch schema for observation/action dimensions
-        schema_resp = self._client.get_agent_schema(agent_name=agent_name)
+        self._init_spaces(self._client.get_agent_schema(agent_name=self._agent_name))
+        if self._needs_contract():
+            self._negotiate_contract()
+        self._log_initialized()
+
+    def _init_spaces(self, schema_resp) -> None:
+        """Size observation_space / action_space from a GetAgentSchemaResponse."""
         schema = getattr(schema_resp, "schema", None)
         self._obs_size = int(schema.observation_size) if schema else 0
         self._act_size = int(schema.action_size) if schema else 0
@@ -143,61 +232,39 @@ class LuckyEnv:
             low=-1.0, high=1.0, shape=(self._act_size,), dtype=np.float32
         ) if _HAS_GYMNASIUM else None
 
-        # Negotiate task contract if reward/termination terms provided
-        self._session_id = None
-        if self._reward_terms or self._termination_terms:
-            self._negotiate_contract()
+    def _needs_contract(self) -> bool:
+        """Negotiate only when reward/termination terms (or packed encoding) are requested."""
+        return bool(self._reward_terms or self._termination_terms or self._packed)
 
+    def _log_initialized(self) -> None:
         logger.info(
-            "LuckyEnv initialized: robot=%s, obs=%d, act=%d, rewards=%s, terms=%s",
-            robot, self._obs_size, self._act_size,
+            "%s initialized: robot=%s, obs=%d, act=%d, rewards=%s, terms=%s",
+            type(self).__name__, self._robot, self._obs_size, self._act_size,
             self._reward_terms, self._termination_terms,
         )
 
+    def _task_contract(self) -> dict:
+        return build_task_contract(
+            robot=self._robot,
+            scene=self._scene,
+            reward_terms=self._reward_terms,
+            termination_terms=self._termination_terms,
+            observation_terms=self._observation_terms,
+            max_episode_length_s=self._max_episode_length_s,
+            step_encoding="packed" if self._packed else "proto",
+        )
+
     def _negotiate_contract(self):
         """Send task contract to engine for validation and configuration."""
-        contract = {
-            "task_id": f"{self._robot}_{self._scene}",
-            "robot": self._robot,
-            "scene": self._scene,
-        }
+        self._adopt_contract(self._client.negotiate_task(self._task_contract()))
 
-        if self._reward_terms:
-            contract["rewards"] = {
-                "engine_terms": [{"name": t} for t in self._reward_terms],
-            }
-
-        if self._termination_terms:
-            contract["terminations"] = {
-                "terms": [
-                    {
-                        "name": t,
-                        "is_timeout": t == "time_out",
-                        "params": (
-                            {"max_episode_length_s": str(self._max_episode_length_s)}
-                            if t == "time_out"
-                            else {}
-                        ),
-                    }
-                    for t in self._termination_terms
-                ],
-            }
-
-        if self._observation_terms:
-            contract["observations"] = {
-                "required": [{"name": t} for t in self._observation_terms],
-            }
-
-        result = self._client.negotiate_task(contract)
+    def _adopt_contract(self, result: dict) -> None:
         self._session_id = result.get("session_id", "")
         logger.info("Task contract negotiated: session=%s", self._session_id)
+        log_contract_warnings(result)
 
-        if "warnings" in result:
-            for w in result["warnings"]:
-                logger.warning(
-                    "Contract warning [%s/%s]: %s — %s",
-                    w["component"], w["term_name"], w["message"], w["suggestion"],
-                )
+        if self._packed and result.get("step_encoding") != "packed":
+            logger.warning("Engine declined packed Step encoding; using per-field proto payloads")
 
     def reset(
         self,
@@ -227,11 +294,7 @@ class LuckyEnv:
             actions=zero_actions,
             agent_name=self._agent_name,
         )
-
-        obs = np.array(obs_response.observation, dtype=np.float32)
-        info = self._build_info(obs_response)
-
-        return obs, info
+        return self._reset_result(obs_response)
 
     def step(self, action: np.ndarray) -> tuple[np.ndarray, float, bool, bool, dict]:
         """Take a step in the environment.
@@ -244,13 +307,26 @@ class LuckyEnv:
         """
         self._step_count += 1
 
-        action_list = action.tolist() if hasattr(action, "tolist") else list(action)
         obs_response = self._client.step(
-            actions=action_list,
+            actions=self._action_list(action),
             agent_name=self._agent_name,
+            num_substeps=self._decimation,
+            substep_reduction=self._substep_reduction,
         )
+        return self._transition(obs_response)
+
+    @staticmethod
+    def _action_list(action) -> list[float]:
+        return action.tolist() if hasattr(action, "tolist") else list(action)
+
+    def _reset_result(self, obs_response) -> tuple[np.ndarray, dict]:
+        """``(obs, info)`` from the zero-action step that follows a reset."""
+        obs = np.array(obs_response.to_numpy(), dtype=np.float32)
+        return obs, self._build_info(obs_response)
 
-        obs = np.array(obs_response.observation, dtype=np.float32)
+    def _transition(self, obs_response) -> tuple[np.ndarray, float, bool, bool, dict]:
+        """``(obs, reward, terminated, truncated, info)`` from a Step response."""
+        obs = np.array(obs_response.to_numpy(), dtype=np.float32)
 
         # Compute reward from engine signals
         reward_signals = obs_response.reward_signals or {}
@@ -279,6 +355,7 @@ class LuckyEnv:
             info["termination_flags"] = obs_response.termination_flags
         info["frame_number"] = obs_response.frame_number
         info["step_count"] = self._step_count
+        info["substeps"] = obs_response.substeps_completed
         return info
 
     @staticmethod
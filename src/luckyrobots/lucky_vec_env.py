@@ -0,0 +1,320 @@
+"""Vectorized Gymnasium environment over LuckyEngine's BatchStep RPC.
+
+Sibling to LuckyEnv. Where LuckyEnv drives a single agent with one Step RPC
+per transition, LuckyVecEnv negotiates a TaskContract with ``num_envs``
+replicas and advances all of them with a single BatchStep round trip — the
+replicas live inside one engine process, so N envs cost one gRPC call
+instead of N engine processes.
+
+Usage:
+    import numpy as np
+    from luckyrobots import LuckyVecEnv
+
+    def my_reward(signals: dict[str, np.ndarray]) -> np.ndarray:
+        return (np.exp(-3 * signals["track_linear_velocity"])
+                - 0.05 * signals["joint_acc_penalty"])
+
+    envs = LuckyVecEnv(
+        num_envs=4096,
+        robot="unitreego2",
+        scene="velocity",
+        reward_fn=my_reward,
+        reward_terms=["track_linear_velocity", "joint_acc_penalty"],
+        termination_terms=["fell_over", "time_out"],
+    )
+
+    obs, info = envs.reset()             # obs: (4096, obs_dim)
+    for _ in range(1_000):
+        actions = policy(obs)            # (4096, action_dim)
+        obs, rewards, terminated, truncated, info = envs.step(actions)
+
+Autoreset follows Gymnasium's "next step" convention: a replica that ends
+its episode on step t is reset by the engine on step t+1, where its action is
+ignored and it reports the new episode's first observation with reward 0.
+"""
+
+from __future__ import annotations
+
+import logging
+from typing import Any, Callable, Optional
+
+import numpy as np
+
+from .lucky_env import build_task_contract, log_contract_warnings
+
+logger = logging.getLogger(__name__)
+
+try:
+    import gymnasium as gym
+    from gymnasium import spaces
+    from gymnasium.vector.utils import batch_space
+
+    _HAS_GYMNASIUM = True
+except ImportError:
+    _HAS_GYMNASIUM = False
+    gym = None  # type: ignore
+    spaces = None  # type: ignore
+
+try:
+    from gymnasium.vector import AutoresetMode
+
+    _AUTORESET_MODE: Any = AutoresetMode.NEXT_STEP
+except ImportError:
+    _AUTORESET_MODE = "next_step"
+
+
+def _require_gymnasium() -> None:
+    if not _HAS_GYMNASIUM:
+        raise ImportError(
+            "gymnasium is required for LuckyVecEnv. Install it with: pip install gymnasium"
+        )
+
+
+# Use a real VectorEnv base class only when gymnasium is importable; otherwise
+# fall back to ``object`` so importing this module never fails.
+_BASE = gym.vector.VectorEnv if _HAS_GYMNASIUM else object  # type: ignore[misc]
+
+
+class LuckyVecEnv(_BASE):  # type: ignore[misc,valid-type]
+    """Gymnasium VectorEnv stepping N env replicas through one BatchStep RPC.
+
+    The engine computes observations, reward signals, and termination flags
+    for every replica. The user provides a reward function that combines the
+    per-term signal columns into a per-env reward vector.
+
+    Attributes:
+        num_envs: Number of env replicas negotiated with the engine.
+        single_observation_space: Box space of one replica's observation.
+        single_action_space: Box space of one replica's action.
+        observation_space: Batched observation space, shape (num_envs, obs_dim).
+        action_space: Batched action space, shape (num_envs, action_dim).
+        physics_backend: Backend the engine granted ("cpu", "mjx", ...).
+    """
+
+    metadata = {"render_modes": [], "autoreset_mode": _AUTORESET_MODE}
+
+    def __init__(
+        self,
+        num_envs: int,
+        robot: str = "unitreego2",
+        scene: str = "velocity",
+        reward_fn: Optional[Callable[[dict[str, np.ndarray]], np.ndarray]] = None,
+        reward_terms: Optional[list[str]] = None,
+        termination_terms: Optional[list[str]] = None,
+        observation_terms: Optional[list[str]] = None,
+        host: str = "127.0.0.1",
+        port: int = 50051,
+        timeout: float = 30.0,
+        max_episode_length_s: float = 20.0,
+        agent_name: str = "",
+        decimation: int = 1,
+        substep_reduction: str = "sum",
+        physics_backend: str = "cpu",
+        model_randomization: Optional[dict] = None,
+    ):
+        """Initialize LuckyVecEnv.
+
+        Args:
+            num_envs: Number of env replicas to request in the TaskContract.
+            robot: Robot identifier (e.g., "unitreego2", "so100").
+            scene: Scene identifier (e.g., "velocity", "manipulation").
+            reward_fn: Function mapping ``{term_name: (num_envs,) array}`` to a
+                (num_envs,) reward array. If None, sums all reward signals.
+            reward_terms: Engine reward terms to request (e.g., ["track_linear_velocity"]).
+            termination_terms: Engine termination terms (e.g., ["fell_over", "time_out"]).
+            observation_terms: Observation terms to request. If None, uses agent defaults.
+            host: Engine gRPC host.
+            port: Engine gRPC port.
+            timeout: Connection timeout in seconds.
+            max_episode_length_s: Maximum episode length in seconds.
+            agent_name: Agent whose schema sizes each replica (empty = default agent).
+            decimation: Physics substeps per env step, run inside the BatchStep RPC.
+            substep_reduction: How reward signals combine across substeps
+                ("sum", "mean" or "last").
+            physics_backend: "cpu", or "gpu" / "mujoco_warp" / "mjx" to keep
+                every replica and its reward / termination terms on device.
+                See ``get_capability_manifest()["physics_backends"]``.
+            model_randomization: In-place mjModel randomization applied to
+                every replica on reset (see ``LuckyEngineClient.reset_agents``).
+                The written values are reported as ``info["applied_randomization"]``.
+        """
+        _require_gymnasium()
+        from .client import LuckyEngineClient
+
+        if num_envs < 1:
+            raise ValueError(f"num_envs must be >= 1, got {num_envs}")
+        if decimation < 1:
+            raise ValueError(f"decimation must be >= 1, got {decimation}")
+
+        self._robot = robot
+        self._scene = scene
+        self._reward_fn = reward_fn or self._default_reward_fn
+        self._reward_terms = reward_terms or []
+        self._termination_terms = termination_terms or []
+        self._observation_terms = observation_terms
+        self._max_episode_length_s = max_episode_length_s
+        self._decimation = int(decimation)
+        self._substep_reduction = substep_reduction
+
+        # Connect to engine
+        self._client = LuckyEngineClient(host=host, port=port, timeout=timeout)
+        self._client.connect()
+        self._client.wait_for_server(timeout=timeout)
+
+        # Every replica shares the agent's schema
+        schema_resp = self._client.get_agent_schema(agent_name=agent_name)
+        schema = getattr(schema_resp, "schema", None)
+        self._obs_size = int(schema.observation_size) if schema else 0
+        self._act_size = int(schema.action_size) if schema else 0
+
+        if self._obs_size == 0 or self._act_size == 0:
+            raise RuntimeError(
+                f"Agent schema returned obs_size={self._obs_size}, act_size={self._act_size}. "
+                "Is the scene loaded and an external agent configured?"
+            )
+
+        # BatchStep always needs a negotiated session: that is where the
+        # replicas are instantiated.
+        contract = build_task_contract(
+            robot=robot,
+            scene=scene,
+            reward_terms=self._reward_terms,
+            termination_terms=self._termination_terms,
+            observation_terms=self._observation_terms,
+            max_episode_length_s=max_episode_length_s,
+            num_envs=num_envs,
+            physics_backend=physics_backend,
+        )
+        if model_randomization is not None:
+            contract.setdefault("randomization", {})["model"] = model_randomization
+        result = self._client.negotiate_task(contract)
+        self._session_id = result.get("session_id", "")
+        log_contract_warnings(result)
+
+        self.num_envs = int(result.get("num_envs", num_envs))
+        if self.num_envs != num_envs:
+            logger.warning(
+                "Engine granted %d env replicas (requested %d)", self.num_envs, num_envs
+            )
+
+        # Build Gymnasium spaces
+        self.single_observation_space = spaces.Box(
+            low=-np.inf, high=np.inf, shape=(self._obs_size,), dtype=np.float32
+        )
+        self.single_action_space = spaces.Box(
+            low=-1.0, high=1.0, shape=(self._act_size,), dtype=np.float32
+        )
+        self.observation_space = batch_space(self.single_observation_space, self.num_envs)
+        self.action_space = batch_space(self.single_action_space, self.num_envs)
+
+        self._step_counts = np.zeros(self.num_envs, dtype=np.int64)
+        self._autoreset = np.zeros(self.num_envs, dtype=bool)
+        self.closed = False
+
+        self.physics_backend = result.get("physics_backend", "cpu")
+
+        logger.info(
+            "LuckyVecEnv initialized: robot=%s, num_envs=%d, obs=%d, act=%d, "
+            "backend=%s, session=%s",
+            robot, self.num_envs, self._obs_size, self._act_size,
+            self.physics_backend, self._session_id,
+        )
+
+    def reset(
+        self,
+        *,
+        seed: Optional[int] = None,
+        options: Optional[dict] = None,
+    ) -> tuple[np.ndarray, dict]:
+        """Reset every replica.
+
+        Args:
+            seed: Random seed (currently unused — engine handles seeding).
+            options: Additional reset options (currently unused).
+
+        Returns:
+            Tuple of (observations, info) with observations of shape (num_envs, obs_dim).
+        """
+        self._step_counts[:] = 0
+        self._autoreset[:] = False
+
+        batch = self._client.batch_step(
+            np.zeros((self.num_envs, self._act_size), dtype=np.float32),
+            session_id=self._session_id,
+            reset_env_ids=list(range(self.num_envs)),
+        )
+        return batch.observations, self._build_info(batch)
+
+    def step(
+        self, actions: np.ndarray
+    ) -> tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray, dict]:
+        """Step every replica with one BatchStep RPC.
+
+        Args:
+            actions: Action array of shape (num_envs, action_dim).
+
+        Returns:
+            Tuple of (observations, rewards, terminated, truncated, info), each
+            batched along the first axis.
+        """
+        reset_ids = np.flatnonzero(self._autoreset)
+
+        batch = self._client.batch_step(
+            actions,
+            session_id=self._session_id,
+            reset_env_ids=reset_ids.tolist(),
+            num_substeps=self._decimation,
+            substep_reduction=self._substep_reduction,
+        )
+
+        # Compute reward from engine signals; replicas that were just reset
+        # start a fresh episode and earn nothing this step.
+        rewards = np.asarray(self._reward_fn(batch.reward_dict()), dtype=np.float32)
+        rewards = np.broadcast_to(rewards, (self.num_envs,)).copy()
+        rewards[reset_ids] = 0.0
+
+        terminated = batch.terminated
+        truncated = batch.truncated
+
+        self._step_counts += 1
+        self._step_counts[reset_ids] = 0
+        self._autoreset = terminated | truncated
+
+        info = self._build_info(batch)
+        info["reward_signals"] = batch.reward_dict()
+
+        return batch.observations, rewards, terminated, truncated, info
+
+    def close(self, **kwargs: Any) -> None:
+        """Close the environment and disconnect from engine."""
+        if getattr(self, "_client", None) is not None:
+            self._client.close()
+            self._client = None
+        self.closed = True
+
+    def _build_info(self, batch) -> dict[str, Any]:
+        """Build info dict from a BatchObservation."""
+        info = {
+            "frame_number": batch.frame_number,
+            "step_count": self._step_counts.copy(),
+            "physics_step_duration_us": batch.physics_step_duration_us,
+            "physics_thread_utilization": batch.physics_thread_utilization,
+        }
+        if batch.applied_randomization is not None:
+            info["applied_randomization"] = batch.applied_randomization
+        return info
+
+    @staticmethod
+    def _default_reward_fn(signals: dict[str, np.ndarray]) -> np.ndarray:
+        """Default reward: sum of all signals per env."""
+        return sum(signals.values()) if signals else 0.0
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.close()
+        return False
+
+    def __del__(self):
+        self.close()
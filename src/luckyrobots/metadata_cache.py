@@ -0,0 +1,122 @@
+"""On-disk cache of engine metadata keyed by ``EngineFingerprint`` hashes.
+
+Connecting normally costs a metadata round trip per payload:
+``GetCapabilityManifest``, ``ValidateTaskContract``, the negotiated layouts,
+``GetModelInfo`` and a reflection walk of every service. Short-lived eval
+workers repeat that handshake against identical engines. With a
+:class:`MetadataCache` enabled (``client.enable_metadata_cache()`` or the
+``LUCKYROBOTS_METADATA_CACHE`` environment variable), the client makes one
+``GetEngineFingerprint`` call instead. It then loads each payload the
+engine's content hashes say is unchanged from disk.
+
+Entries are the response protos' wire bytes (or JSON for the reflection
+method sets), stored as ``<directory>/<kind>/<key>``. Writes go to a
+temporary file followed by ``os.replace``, so many workers can share one
+directory. Entries are never invalidated in place: a changed model or
+engine build has a different hash, so its entries get different keys.
+"""
+
+from __future__ import annotations
+
+import hashlib
+import json
+import logging
+import os
+import shutil
+import tempfile
+from pathlib import Path
+from typing import Any, Optional, Type, TypeVar, Union
+
+logger = logging.getLogger("luckyrobots.metadata_cache")
+
+ENV_VAR = "LUCKYROBOTS_METADATA_CACHE"
+DEFAULT_DIRECTORY = Path("~/.cache/luckyrobots/metadata")
+
+M = TypeVar("M")
+
+
+def cache_key(*parts: Any) -> str:
+    """Filename-safe key over ``parts`` (hashes, robot names, contract bytes)."""
+    h = hashlib.sha256()
+    for part in parts:
+        h.update(part if isinstance(part, bytes) else str(part).encode())
+        h.update(b"\0")
+    return h.hexdigest()[:32]
+
+
+class MetadataCache:
+    """Directory of cached metadata payloads. Safe to share between processes.
+
+    Args:
+        directory: Cache root (default ``$LUCKYROBOTS_METADATA_CACHE`` if set
+            to a path, else ``~/.cache/luckyrobots/metadata``).
+    """
+
+    def __init__(self, directory: Optional[Union[str, Path]] = None) -> None:
+        if directory is None:
+            env = os.environ.get(ENV_VAR, "")
+            directory = env if env not in ("", "1", "true") else DEFAULT_DIRECTORY
+        self.directory = Path(directory).expanduser()
+        self.hits = 0
+        self.misses = 0
+
+    def _path(self, kind: str, key: str) -> Path:
+        return self.directory / kind / key
+
+    def _read(self, kind: str, key: str) -> Optional[bytes]:
+        try:
+            data = self._path(kind, key).read_bytes()
+        except OSError:
+            self.misses += 1
+            return None
+        self.hits += 1
+        return data
+
+    def _write(self, kind: str, key: str, data: bytes) -> None:
+        path = self._path(kind, key)
+        try:
+            path.parent.mkdir(parents=True, exist_ok=True)
+            fd, tmp = tempfile.mkstemp(dir=path.parent, prefix=f".{key}.")
+            with os.fdopen(fd, "wb") as f:
+                f.write(data)
+            os.replace(tmp, path)
+        except OSError as e:
+            # A read-only or full cache must never break a connection.
+            logger.debug("Could not write metadata cache entry %s/%s: %s", kind, key, e)
+
+    def load(self, kind: str, key: str, message_cls: Type[M]) -> Optional[M]:
+        """Cached proto of ``message_cls``, or None on a miss (or a corrupt entry)."""
+        data = self._read(kind, key)
+        if data is None:
+            return None
+        try:
+            return message_cls.FromString(data)
+        except Exception as e:
+            logger.debug("Ignoring corrupt metadata cache entry %s/%s: %s", kind, key, e)
+            return None
+
+    def store(self, kind: str, key: str, message) -> None:
+        self._write(kind, key, message.SerializeToString(deterministic=True))
+
+    def load_json(self, kind: str, key: str) -> Optional[Any]:
+        data = self._read(kind, key)
+        if data is None:
+            return None
+        try:
+            return json.loads(data)
+        except ValueError:
+            return None
+
+    def store_json(self, kind: str, key: str, value: Any) -> None:
+        self._write(kind, key, json.dumps(value, sort_keys=True).encode())
+
+    def clear(self) -> None:
+        """Delete every cached entry."""
+        shutil.rmtree(self.directory, ignore_errors=True)
+
+
+def cache_from_env() -> Optional[MetadataCache]:
+    """The cache named by ``LUCKYROBOTS_METADATA_CACHE``, or None when it is unset."""
+    if os.environ.get(ENV_VAR, "").lower() in ("", "0", "false"):
+        return None
+    return MetadataCache()
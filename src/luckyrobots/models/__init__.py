@@ -2,5 +2,11 @@
 
 from luckyrobots.models.benchmark import BenchmarkResult as BenchmarkResult
 from luckyrobots.models.benchmark import FPS as FPS
+from luckyrobots.models.benchmark import StageHistogram as StageHistogram
+from luckyrobots.models.benchmark import StepProfile as StepProfile
+from luckyrobots.models.observation import BatchObservation as BatchObservation
 from luckyrobots.models.observation import CameraFrame as CameraFrame
 from luckyrobots.models.observation import ObservationResponse as ObservationResponse
+from luckyrobots.models.observation import PhysicsThreadTiming as PhysicsThreadTiming
+from luckyrobots.models.randomization import AppliedRandomization as AppliedRandomization
+from luckyrobots.models.randomization import RandomizationColumn as RandomizationColumn
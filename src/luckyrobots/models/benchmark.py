@@ -2,9 +2,130 @@
 
 from __future__ import annotations
 
+import json
+import math
 import time
 from collections import deque
-from dataclasses import dataclass
+from dataclasses import dataclass, field
+from typing import Dict, List, Optional
+
+# StepProfile stages in the order the engine runs them.
+STEP_STAGES = (
+    "queue_wait",
+    "apply_controls",
+    "physics",
+    "reward_terms",
+    "observation",
+    "camera_render",
+    "camera_readback",
+    "serialize",
+)
+
+# Histogram bucket upper edges in microseconds (last bucket is open-ended).
+HISTOGRAM_EDGES_US = (10, 25, 50, 100, 250, 500, 1_000, 2_500, 5_000, 10_000, 25_000, 100_000)
+
+
+@dataclass(frozen=True)
+class StepProfile:
+    """Per-stage engine timings of one Step, in microseconds (``StepRequest.profile``)."""
+
+    queue_wait_us: int = 0
+    apply_controls_us: int = 0
+    physics_us: int = 0
+    reward_terms_us: int = 0
+    observation_us: int = 0
+    camera_render_us: int = 0
+    camera_readback_us: int = 0
+    serialize_us: int = 0
+    total_us: int = 0
+    received_at_us: int = 0
+
+    @classmethod
+    def _from_pb(cls, pb) -> "StepProfile":
+        return cls(
+            queue_wait_us=int(pb.queue_wait_us),
+            apply_controls_us=int(pb.apply_controls_us),
+            physics_us=int(pb.physics_us),
+            reward_terms_us=int(pb.reward_terms_us),
+            observation_us=int(pb.observation_us),
+            camera_render_us=int(pb.camera_render_us),
+            camera_readback_us=int(pb.camera_readback_us),
+            serialize_us=int(pb.serialize_us),
+            total_us=int(pb.total_us),
+            received_at_us=int(pb.received_at_us),
+        )
+
+    def stages(self) -> Dict[str, int]:
+        """Stage name -> microseconds, in execution order."""
+        return {name: getattr(self, f"{name}_us") for name in STEP_STAGES}
+
+
+@dataclass(frozen=True)
+class StepSample:
+    """One benchmarked call: client wall-clock span plus the engine profile."""
+
+    start_us: float  # client perf_counter, microseconds
+    latency_us: float
+    profile: Optional[StepProfile] = None
+
+
+@dataclass(frozen=True)
+class StageHistogram:
+    """Distribution of one stage's duration over a benchmark run.
+
+    ``counts[i]`` is the number of samples at or below ``HISTOGRAM_EDGES_US[i]``
+    (and above the previous edge); the final entry counts the rest.
+    """
+
+    count: int
+    mean_us: float
+    p50_us: float
+    p99_us: float
+    max_us: float
+    counts: List[int]
+
+    @classmethod
+    def from_values(cls, values: List[float]) -> "StageHistogram":
+        if not values:
+            return cls(0, 0.0, 0.0, 0.0, 0.0, [0] * (len(HISTOGRAM_EDGES_US) + 1))
+        ordered = sorted(values)
+        n = len(ordered)
+        counts = [0] * (len(HISTOGRAM_EDGES_US) + 1)
+        bucket = 0
+        for v in ordered:
+            while bucket < len(HISTOGRAM_EDGES_US) and v > HISTOGRAM_EDGES_US[bucket]:
+                bucket += 1
+            counts[bucket] += 1
+        return cls(
+            count=n,
+            mean_us=sum(ordered) / n,
+            p50_us=ordered[int(math.floor(0.50 * (n - 1)))],
+            p99_us=ordered[int(math.floor(0.99 * (n - 1)))],
+            max_us=ordered[-1],
+            counts=counts,
+        )
+
+
+def stage_histograms(samples: List[StepSample]) -> Dict[str, StageHistogram]:
+    """Per-stage histograms over the profiled samples.
+
+    Besides the engine stages this includes ``engine_total`` and
+    ``network_and_client`` (client round trip minus engine total).
+    """
+    profiled = [s for s in samples if s.profile is not None]
+    if not profiled:
+        return {}
+    out = {
+        name: StageHistogram.from_values(
+            [float(getattr(s.profile, f"{name}_us")) for s in profiled]
+        )
+        for name in STEP_STAGES
+    }
+    out["engine_total"] = StageHistogram.from_values([float(s.profile.total_us) for s in profiled])
+    out["network_and_client"] = StageHistogram.from_values(
+        [max(0.0, s.latency_us - s.profile.total_us) for s in profiled]
+    )
+    return out
 
 
 @dataclass
@@ -22,6 +143,9 @@ class BenchmarkResult:
         std_latency_ms: Standard deviation of per-call latency.
         p50_latency_ms: 50th percentile (median) latency in milliseconds.
         p99_latency_ms: 99th percentile latency in milliseconds.
+        stages: Per-stage histograms (see :func:`stage_histograms`); empty
+            unless the run was profiled.
+        samples: Every call's timing, for :meth:`to_chrome_trace`.
     """
 
     method: str
@@ -34,6 +158,50 @@ class BenchmarkResult:
     std_latency_ms: float
     p50_latency_ms: float
     p99_latency_ms: float
+    stages: Dict[str, StageHistogram] = field(default_factory=dict)
+    samples: List[StepSample] = field(default_factory=list, repr=False)
+
+    def to_chrome_trace(self, path: Optional[str] = None) -> dict:
+        """Export the samples in Chrome trace event format (chrome://tracing, Perfetto).
+
+        Each call is a span on the "client" track; profiled calls get their
+        engine stages laid out back to back on the "engine" track. The two
+        clocks aren't synchronized, so engine spans are centred in the client
+        span (assumes symmetric network latency).
+
+        Args:
+            path: Also write the JSON to this file.
+
+        Returns:
+            The trace as a dict.
+        """
+        events: List[dict] = [
+            {"name": "process_name", "ph": "M", "pid": 1, "args": {"name": "luckyrobots"}},
+            {"name": "thread_name", "ph": "M", "pid": 1, "tid": 1, "args": {"name": "client"}},
+            {"name": "thread_name", "ph": "M", "pid": 1, "tid": 2, "args": {"name": "engine"}},
+        ]
+        t_origin = self.samples[0].start_us if self.samples else 0.0
+        for i, s in enumerate(self.samples):
+            ts = s.start_us - t_origin
+            events.append({
+                "name": self.method, "ph": "X", "pid": 1, "tid": 1,
+                "ts": ts, "dur": s.latency_us, "args": {"call": i},
+            })
+            if s.profile is None:
+                continue
+            t = ts + max(0.0, s.latency_us - s.profile.total_us) / 2.0
+            for name, dur in s.profile.stages().items():
+                if dur:
+                    events.append({
+                        "name": name, "ph": "X", "pid": 1, "tid": 2,
+                        "ts": t, "dur": dur, "args": {"call": i},
+                    })
+                t += dur
+        trace = {"traceEvents": events, "displayTimeUnit": "ms"}
+        if path is not None:
+            with open(path, "w", encoding="utf-8") as f:
+                json.dump(trace, f)
+        return trace
 
 
 class FPS:
@@ -1,19 +1,148 @@
 """RL observation models for LuckyRobots."""
 
-from dataclasses import dataclass
-from typing import Dict, List, Optional
+from dataclasses import dataclass, field
+from typing import Any, Dict, List, Optional, Union
+
+import numpy as np
 from pydantic import BaseModel, Field, ConfigDict
 
+from .benchmark import StepProfile
+from .randomization import AppliedRandomization
+
+
+# ImageFrame.pixel_format name (lowercased, "PIXEL_FORMAT_" dropped) ->
+# (element dtype, render-target kind). "" is the legacy uint8 layout.
+PIXEL_FORMATS: Dict[str, tuple] = {
+    "": (np.uint8, "color"),
+    "rgba8": (np.uint8, "color"),
+    "rgb8": (np.uint8, "color"),
+    "depth_f16": (np.dtype("<f2"), "depth"),
+    "depth_u16": (np.dtype("<u2"), "depth"),
+    "segmentation_u8": (np.uint8, "segmentation"),
+    "segmentation_u16": (np.dtype("<u2"), "segmentation"),
+}
+
 
 @dataclass(frozen=True)
 class CameraFrame:
-    """A single camera frame returned from the engine."""
+    """A single camera frame returned from the engine.
+
+    ``data`` is ``bytes`` for inline frames, or a read-only ``memoryview``
+    into the shared-memory ring when the client uses the shm transport.
+    Depth / segmentation targets rendered in the same pass hang off
+    ``render_targets``, keyed ``"depth"`` / ``"segmentation"``.
+    """
     name: str
-    data: bytes
+    data: Union[bytes, memoryview]
     width: int
     height: int
     channels: int
     frame_number: int
+    # Physics steps between the rendered state and the observation carrying it
+    # (1 when cameras are captured in pipelined mode).
+    latency_steps: int = 0
+    pixel_format: str = ""
+    depth_scale: float = 0.0
+    render_targets: Dict[str, "CameraFrame"] = field(default_factory=dict)
+
+    @property
+    def kind(self) -> str:
+        """Render-target kind: ``"color"``, ``"depth"`` or ``"segmentation"``."""
+        return PIXEL_FORMATS.get(self.pixel_format, (np.uint8, "color"))[1]
+
+    @property
+    def array(self) -> np.ndarray:
+        """Pixels as a (height, width, channels) array in the frame's dtype, without copying."""
+        dtype = PIXEL_FORMATS.get(self.pixel_format, (np.uint8, "color"))[0]
+        return np.frombuffer(self.data, dtype=dtype).reshape(
+            self.height, self.width, max(self.channels, 1)
+        )
+
+    @property
+    def depth(self) -> Optional["CameraFrame"]:
+        """The depth render target, if one was requested."""
+        return self.render_targets.get("depth")
+
+    @property
+    def segmentation(self) -> Optional["CameraFrame"]:
+        """The segmentation render target, if one was requested."""
+        return self.render_targets.get("segmentation")
+
+    def depth_m(self) -> np.ndarray:
+        """Depth in metres as a (height, width) float32 array.
+
+        On a color frame this reads its ``depth`` render target.
+
+        Raises:
+            ValueError: If neither this frame nor its targets hold depth.
+        """
+        if self.kind != "depth" and self.depth is not None:
+            return self.depth.depth_m()
+        if self.kind != "depth":
+            raise ValueError(f"Frame {self.name!r} is {self.pixel_format or 'color'}, not depth")
+        depth = self.array[..., 0].astype(np.float32)
+        if self.pixel_format == "depth_u16":
+            depth *= self.depth_scale
+        return depth
+
+
+@dataclass(frozen=True)
+class PhysicsThreadTiming:
+    """One physics pool thread's share of a multi-threaded step.
+
+    ``busy_us`` covers physics, RecalculateControls and policy-slot evaluation
+    for the ``partitions`` (kinematic islands or env replicas) it stepped.
+    """
+    thread_index: int
+    busy_us: int
+    partitions: int
+    stolen_partitions: int = 0
+
+
+def physics_thread_utilization(
+    step_duration_us: int, threads: List[PhysicsThreadTiming]
+) -> float:
+    """Mean busy fraction of the physics threads over a step, in [0, 1].
+
+    1.0 means perfect scaling; 1/len(threads) means one thread did all the
+    work. Returns 1.0 for single-threaded steps (no breakdown).
+    """
+    if not threads or step_duration_us <= 0:
+        return 1.0
+    busy = sum(t.busy_us for t in threads)
+    return min(1.0, busy / (len(threads) * step_duration_us))
+
+
+@dataclass(frozen=True)
+class BatchObservation:
+    """Result of a vectorized BatchStep across ``num_envs`` env replicas.
+
+    Returned by LuckyEngineClient.batch_step(). Arrays are row-per-env; the
+    columns of ``reward_signals`` follow ``reward_terms``.
+    """
+    observations: np.ndarray  # (num_envs, obs_dim) float32
+    reward_signals: np.ndarray  # (num_envs, len(reward_terms)) float32
+    terminated: np.ndarray  # (num_envs,) bool
+    truncated: np.ndarray  # (num_envs,) bool
+    reward_terms: List[str]
+    frame_number: int
+    physics_step_duration_us: int = 0
+    physics_threads: List[PhysicsThreadTiming] = field(default_factory=list)
+    # Model values written to the replicas reset by this call (reset_env_ids).
+    applied_randomization: Optional[AppliedRandomization] = None
+
+    @property
+    def num_envs(self) -> int:
+        return int(self.observations.shape[0])
+
+    @property
+    def physics_thread_utilization(self) -> float:
+        """See :func:`physics_thread_utilization`."""
+        return physics_thread_utilization(self.physics_step_duration_us, self.physics_threads)
+
+    def reward_dict(self) -> Dict[str, np.ndarray]:
+        """Per-term reward columns keyed by term name, each of shape (num_envs,)."""
+        return {name: self.reward_signals[:, i] for i, name in enumerate(self.reward_terms)}
 
 
 class ObservationResponse(BaseModel):
@@ -26,17 +155,26 @@ class ObservationResponse(BaseModel):
         obs = client.step(actions)
 
         # Flat vector for RL training
-        obs.observation  # [0.1, 0.2, 0.3, ...]
+        obs.to_numpy()  # array([0.1, 0.2, 0.3, ...], dtype=float32)
 
         # Named access (if schema was fetched)
         obs["proj_grav_x"]  # 0.1
         obs.to_dict()  # {"proj_grav_x": 0.1, "proj_grav_y": 0.2, ...}
+
+    With a packed or shared-memory session the values arrive as a float32
+    array in ``observation_array`` and ``observation`` is an empty list, so
+    read the vector through ``to_numpy()`` (or named access), which works in
+    every mode.
     """
 
-    model_config = ConfigDict(frozen=True)
+    # arbitrary_types_allowed: CameraFrame.data may be a memoryview (shm transport)
+    model_config = ConfigDict(frozen=True, arbitrary_types_allowed=True)
 
     observation: List[float] = Field(
-        description="Flat observation vector from the agent's observation spec"
+        description=(
+            "Flat observation vector from the agent's observation spec. Empty for "
+            "packed and shared-memory steps; use to_numpy()"
+        )
     )
     actions: List[float] = Field(description="Last applied actions")
     timestamp_ms: int = Field(description="Wall-clock timestamp in milliseconds")
@@ -79,6 +217,85 @@ class ObservationResponse(BaseModel):
         description="Per-condition termination flags",
     )
 
+    substeps_completed: int = Field(
+        default=1,
+        description="Physics substeps run for this step (see StepRequest.num_substeps)",
+    )
+    physics_step_duration_us: int = Field(
+        default=0,
+        description="Engine wall time for the physics step(s) in microseconds",
+    )
+    physics_threads: List[PhysicsThreadTiming] = Field(
+        default_factory=list,
+        description="Per-thread breakdown when physics ran on the thread pool",
+    )
+    step_profile: Optional[StepProfile] = Field(
+        default=None,
+        description="Per-stage engine timings, set when the step was sent with profile=True",
+    )
+    full_state: Optional[Any] = Field(
+        default=None,
+        exclude=True,
+        description=(
+            "Post-step mjData state (scene.FullStateSnapshot), set when the step "
+            "was sent with state=True or a StateFilter dict"
+        ),
+    )
+    raycasts: List[Any] = Field(
+        default_factory=list,
+        exclude=True,
+        description=(
+            "scene.RaycastResult per StepRequest.raycasts entry, in request order; "
+            "None where the query failed (see query_errors)"
+        ),
+    )
+    height_scans: List[Any] = Field(
+        default_factory=list,
+        exclude=True,
+        description=(
+            "scene.HeightScan per StepRequest.height_scans entry, in request order; "
+            "None where the query failed (see query_errors)"
+        ),
+    )
+    contacts: Optional[Any] = Field(
+        default=None,
+        exclude=True,
+        description="scene.ContactSet, set when the step was sent with contacts=...",
+    )
+    query_errors: Dict[str, str] = Field(
+        default_factory=dict,
+        exclude=True,
+        description=(
+            "Engine message per failed step query, keyed 'raycasts[i]', "
+            "'height_scans[i]' or 'contacts'"
+        ),
+    )
+
+    # Packed step encoding / shared-memory transport (see LuckyEngineClient.enable_shared_memory)
+    observation_array: Optional[Any] = Field(
+        default=None,
+        exclude=True,
+        description=(
+            "Zero-copy float32 view of the observation in the packed payload or the "
+            "shared-memory ring. When set, `observation` is left empty. A ring view "
+            "is valid until the slot is reused."
+        ),
+    )
+
+    def to_numpy(self) -> np.ndarray:
+        """Observation as a float32 array (the shm view itself when available)."""
+        if self.observation_array is not None:
+            return self.observation_array
+        return np.asarray(self.observation, dtype=np.float32)
+
+    @property
+    def physics_thread_utilization(self) -> float:
+        """See :func:`physics_thread_utilization`."""
+        return physics_thread_utilization(self.physics_step_duration_us, self.physics_threads)
+
+    def _values(self):
+        return self.observation_array if self.observation_array is not None else self.observation
+
     def __getitem__(self, key: str) -> float:
         """Access observation value by name.
 
@@ -98,7 +315,7 @@ class ObservationResponse(BaseModel):
             )
         try:
             idx = self.observation_names.index(key)
-            return self.observation[idx]
+            return float(self._values()[idx])
         except ValueError:
             raise KeyError(
                 f"Unknown observation name: '{key}'. "
@@ -127,9 +344,10 @@ class ObservationResponse(BaseModel):
             Dict mapping observation names to values. If names not available,
             uses "obs_0", "obs_1", etc.
         """
+        values = [float(v) for v in self._values()]
         if self.observation_names is not None:
-            return dict(zip(self.observation_names, self.observation))
-        return {f"obs_{i}": v for i, v in enumerate(self.observation)}
+            return dict(zip(self.observation_names, values))
+        return {f"obs_{i}": v for i, v in enumerate(values)}
 
     def actions_to_dict(self) -> Dict[str, float]:
         """Convert actions to a name->value dictionary.
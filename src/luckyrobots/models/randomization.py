@@ -0,0 +1,67 @@
+"""In-place model randomization results (``ResetAgentResponse.applied_randomization``)."""
+
+from dataclasses import dataclass
+from typing import Dict, List
+
+import numpy as np
+
+
+@dataclass(frozen=True)
+class RandomizationColumn:
+    """One mjModel element written by a randomized reset."""
+
+    field: str  # "geom_friction", "body_mass", ... (see MODEL_RANDOMIZATION_FIELDS)
+    element: str
+    element_index: int
+    default_value: float
+
+
+@dataclass(frozen=True)
+class AppliedRandomization:
+    """Model values written by one batched reset.
+
+    ``values[i, j]`` is the value of ``columns[j]`` in env ``env_ids[i]``;
+    ``sample_indices[i]`` is the row of that env's sample table it came from.
+    """
+
+    columns: List[RandomizationColumn]
+    env_ids: np.ndarray  # (n,) int64
+    sample_indices: np.ndarray  # (n,) int64
+    values: np.ndarray  # (n, len(columns)) float32
+    apply_duration_us: int = 0
+
+    @classmethod
+    def _from_pb(cls, pb, field_names: Dict[int, str]) -> "AppliedRandomization":
+        columns = [
+            RandomizationColumn(
+                field=field_names.get(c.field, str(c.field)),
+                element=c.element,
+                element_index=int(c.element_index),
+                default_value=float(c.default_value),
+            )
+            for c in pb.columns
+        ]
+        env_ids = np.asarray(pb.env_ids, dtype=np.int64)
+        values = np.asarray(pb.values, dtype=np.float32).reshape(len(env_ids), len(columns))
+        return cls(
+            columns=columns,
+            env_ids=env_ids,
+            sample_indices=np.asarray(pb.sample_indices, dtype=np.int64),
+            values=values,
+            apply_duration_us=int(pb.apply_duration_us),
+        )
+
+    def column(self, field: str, element: str) -> np.ndarray:
+        """Per-env values of one element, e.g. ``column("body_mass", "trunk")``."""
+        for j, c in enumerate(self.columns):
+            if c.field == field and c.element == element:
+                return self.values[:, j]
+        raise KeyError(f"No randomized column {field}[{element!r}]")
+
+    def env(self, env_id: int) -> Dict[str, float]:
+        """``{"<field>/<element>": value}`` for one env."""
+        rows = np.flatnonzero(self.env_ids == env_id)
+        if not rows.size:
+            raise KeyError(f"env {env_id} was not reset in this call")
+        row = self.values[rows[0]]
+        return {f"{c.field}/{c.element}": float(row[j]) for j, c in enumerate(self.columns)}
@@ -81,7 +81,7 @@ class PolicyMonitor:
 
     # Iterator API. Yields RobotControllerSummary protos until stopped.
     def __iter__(self) -> Iterator[agent_pb2.RobotControllerSummary]:
-        agent_stub = self._session.engine_client.agent
+        agent_stub = self._session.engine_client.bulk_stub("agent")
         request = agent_pb2.StreamRobotControllerRequest(
             entity=common_pb2.EntityId(id=self._entity_id),
             target_fps=self._target_fps,
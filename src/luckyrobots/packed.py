@@ -0,0 +1,103 @@
+"""Decoder for STEP_ENCODING_PACKED Step responses.
+
+When a task contract is negotiated with ``step_encoding="packed"`` the engine
+stops sending ``repeated float`` observations and name-keyed maps. Each
+StepResponse instead carries one little-endian buffer (``packed_step``) whose
+layout — observation, reward signals, info values and termination flags — is
+fixed at NegotiateTask time by ``NegotiatedTaskSession.packed_layout``. The
+names therefore travel once, and a step decodes with a few ``np.frombuffer``
+views over the same bytes.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass, field
+
+import numpy as np
+
+
+@dataclass(frozen=True)
+class PackedStepLayout:
+    """Byte layout of ``StepResponse.packed_step`` for one negotiated session."""
+
+    total_size: int
+    observation_offset: int
+    observation_count: int
+    reward_offset: int
+    reward_terms: list[str] = field(default_factory=list)
+    info_offset: int = 0
+    info_names: list[str] = field(default_factory=list)
+    termination_offset: int = 0
+    termination_terms: list[str] = field(default_factory=list)
+
+    @classmethod
+    def _from_pb(
+        cls, pb, reward_terms: list[str], termination_terms: list[str]
+    ) -> "PackedStepLayout":
+        return cls(
+            total_size=int(pb.total_size),
+            observation_offset=int(pb.observation_offset),
+            observation_count=int(pb.observation_count),
+            reward_offset=int(pb.reward_offset),
+            reward_terms=list(reward_terms),
+            info_offset=int(pb.info_offset),
+            info_names=list(pb.info_names),
+            termination_offset=int(pb.termination_offset),
+            termination_terms=list(termination_terms),
+        )
+
+    def to_dict(self) -> dict:
+        return {
+            "total_size": self.total_size,
+            "observation_offset": self.observation_offset,
+            "observation_count": self.observation_count,
+            "reward_offset": self.reward_offset,
+            "info_offset": self.info_offset,
+            "info_names": list(self.info_names),
+            "termination_offset": self.termination_offset,
+        }
+
+    def decode(self, buf: bytes) -> "PackedStep":
+        """Slice a packed_step buffer into zero-copy numpy views."""
+        if len(buf) < self.total_size:
+            raise ValueError(
+                f"packed_step is {len(buf)} bytes, negotiated layout needs {self.total_size}"
+            )
+        return PackedStep(
+            observation=np.frombuffer(
+                buf, dtype="<f4", count=self.observation_count, offset=self.observation_offset
+            ),
+            rewards=np.frombuffer(
+                buf, dtype="<f4", count=len(self.reward_terms), offset=self.reward_offset
+            ),
+            info=np.frombuffer(
+                buf, dtype="<f4", count=len(self.info_names), offset=self.info_offset
+            ),
+            # The engine writes each flag as a 0/1 byte, so reinterpreting the
+            # uint8 slice as bool keeps it a view.
+            termination_flags=np.frombuffer(
+                buf, dtype=np.uint8, count=len(self.termination_terms),
+                offset=self.termination_offset,
+            ).view(np.bool_),
+            layout=self,
+        )
+
+
+@dataclass(frozen=True)
+class PackedStep:
+    """One decoded packed step. Arrays are read-only views over the response bytes."""
+
+    observation: np.ndarray
+    rewards: np.ndarray
+    info: np.ndarray
+    termination_flags: np.ndarray
+    layout: PackedStepLayout
+
+    def reward_dict(self) -> dict[str, float]:
+        return dict(zip(self.layout.reward_terms, self.rewards.tolist()))
+
+    def info_dict(self) -> dict[str, float]:
+        return dict(zip(self.layout.info_names, self.info.tolist()))
+
+    def termination_dict(self) -> dict[str, bool]:
+        return dict(zip(self.layout.termination_terms, self.termination_flags.tolist()))
@@ -8,11 +8,15 @@ PolicyRuntime — e.g. a navigation policy emitting (vx, vy, yaw_rate)
 into a fixed Walker policy.
 
 Action layout: action[i] -> SetPolicyCommandFloat(slot, command_names[i],
-action[i]). One forward physics step per ``step()`` via AgentService.Step.
+action[i]). ``decimation`` physics substeps per ``step()``, run engine-side
+by a single AgentService.Step.
 
 Observation: by default, the policy's last raw inference output (from
 GetPolicyLastAction). Pass ``observation_mode="full_state_filtered"`` to
-instead use MujocoScene.state(filter=by_slot) for richer observation.
+instead use the slot-filtered ``[qpos | qvel]`` for richer observation. The
+Step request asks for that state inline (``StepRequest.state``), so each
+env step is one round trip; engines that don't attach it fall back to a
+MujocoScene.state call.
 
 Reward: caller-supplied callable receiving the StepResponse and returning
 a float. Termination: caller-supplied callable receiving the StepResponse
@@ -39,6 +43,11 @@ except ImportError:
     spaces = None  # type: ignore
 
 
+# Consecutive failed inline states (StepResponse.state.success == False)
+# before PolicyEnv stops asking for them and uses GetFullState only.
+_INLINE_STATE_MAX_FAILURES = 3
+
+
 def _require_gymnasium() -> None:
     if not _HAS_GYMNASIUM:
         raise ImportError(
@@ -82,6 +91,7 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
         observation_high: float = 10.0,
         max_steps: Optional[int] = None,
         timeout_s: float = 5.0,
+        decimation: int = 1,
     ) -> None:
         """Initialize PolicyEnv.
 
@@ -103,12 +113,11 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
             observation_low, observation_high: Bounds for the observation Box.
             max_steps: Optional truncation horizon; ``None`` disables it.
             timeout_s: Server-side physics-step timeout (``StepRequest.timeout_s``).
+            decimation: Physics substeps per env step (``StepRequest.num_substeps``).
+                The commands stay fixed across the substeps.
         """
         _require_gymnasium()
 
-        # Local imports so module-level import never depends on these.
-        from .robots.robot_controller import RobotController, list_robot_controllers
-
         if observation_mode not in ("last_action", "full_state_filtered"):
             raise ValueError(
                 f"observation_mode must be 'last_action' or 'full_state_filtered', "
@@ -116,6 +125,8 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
             )
         if not command_names:
             raise ValueError("command_names must be non-empty")
+        if decimation < 1:
+            raise ValueError(f"decimation must be >= 1, got {decimation}")
 
         self._session = session
         self._robot_entity_id = int(robot_entity_id)
@@ -124,11 +135,17 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
         self._termination_fn = termination_fn
         self._observation_mode = observation_mode
         self._timeout_s = float(timeout_s)
+        self._decimation = int(decimation)
         self._max_steps = max_steps
         self._step_count = 0
+        # Cleared on the first Step response without an inline state, so
+        # older engines go straight to the GetFullState fallback, or after
+        # _INLINE_STATE_MAX_FAILURES failed ones in a row.
+        self._inline_state = observation_mode == "full_state_filtered"
+        self._inline_state_failures = 0
 
         # ---- Locate the RobotController for our entity ----
-        controllers = list_robot_controllers(session)
+        controllers = self._list_controllers()
         match_state = next(
             (c for c in controllers if c.entity_id == self._robot_entity_id),
             None,
@@ -138,7 +155,7 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
                 f"No RobotControllerComponent on entity {self._robot_entity_id}. "
                 f"Found ids: {[c.entity_id for c in controllers]}"
             )
-        self._robot = RobotController.from_state(session, match_state)
+        self._robot = self._controller_from_state(match_state)
 
         # ---- Resolve slot to a uint id and cache the slot state ----
         slot_state = match_state.slot(slot)
@@ -209,6 +226,15 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
     # Internals
     # ------------------------------------------------------------------
 
+    def _list_controllers(self):
+        # Local import so module-level import never depends on the robots module.
+        from .robots.robot_controller import list_robot_controllers
+        return list_robot_controllers(self._session)
+
+    def _controller_from_state(self, state):
+        from .robots.robot_controller import RobotController
+        return RobotController.from_state(self._session, state)
+
     def _build_scene(self):
         """Lazily import MujocoScene; let ImportError propagate so it is
         raised at instantiation rather than module import time."""
@@ -229,38 +255,84 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
         return int(snap.qpos.shape[0]) + int(snap.qvel.shape[0])
 
     def _step_engine(self):
-        """Drive one physics step via AgentService.Step.
+        """Drive ``decimation`` physics substeps via one AgentService.Step.
 
-        ``actions`` is left empty: this env steers via SetPolicyCommandFloat
-        side-effects, not raw ctrl actions. Server-side ``timeout_s`` bounds
-        how long the engine waits for the physics tick.
+        ``actions`` is left empty: this env steers via the buffered command
+        writes, not raw ctrl actions. Server-side ``timeout_s`` bounds
+        how long the engine waits for each physics tick.
         """
         client = self._session.engine_client
         if client is None:
             raise RuntimeError(
                 "Session is not connected — call session.start()/connect() first."
             )
+        return client.agent.Step(self._step_request(), timeout=self._step_rpc_timeout())
+
+    def _step_rpc_timeout(self) -> float:
+        return self._timeout_s * self._decimation + 5.0
+
+    def _step_request(self):
+        """StepRequest for one env step: no actions, optional inline slot state."""
         from .grpc.generated import agent_pb2 as _agent_pb2
-        return client.agent.Step(
-            _agent_pb2.StepRequest(
-                agent_name="",
-                actions=[],
-                timeout_s=float(self._timeout_s),
-            ),
-            timeout=self._timeout_s + 5.0,
+        from .grpc.generated import mujoco_scene_pb2 as _ms_pb2
+
+        request = _agent_pb2.StepRequest(
+            agent_name="",
+            actions=[],
+            timeout_s=float(self._timeout_s),
+            num_substeps=self._decimation,
+        )
+        if self._inline_state:
+            request.state.CopyFrom(_ms_pb2.GetFullStateRequest(
+                include_qpos=True,
+                include_qvel=True,
+                filter=_ms_pb2.StateFilter(filter_by_slot_id=self._slot_id),
+            ))
+        return request
+
+    def _scene_state_obs(self) -> np.ndarray:
+        """``[qpos | qvel]`` via a separate GetFullState (slot filter, else full model)."""
+        assert self._scene is not None
+        try:
+            snap = self._scene.state(filter={"filter_by_slot_id": self._slot_id})
+        except Exception:
+            snap = self._scene.state()
+        return np.concatenate(
+            [snap.qpos.astype(np.float32), snap.qvel.astype(np.float32)]
         )
 
+    def _inline_state_obs(self, step_response) -> Optional[np.ndarray]:
+        """``[qpos | qvel]`` from ``StepResponse.state``, or None to fall back to GetFullState."""
+        if self._inline_state and step_response.HasField("state"):
+            state = step_response.state
+            if state.success:
+                self._inline_state_failures = 0
+                return np.concatenate([
+                    np.asarray(state.state.qpos, dtype=np.float32),
+                    np.asarray(state.state.qvel, dtype=np.float32),
+                ])
+            self._inline_state_failures += 1
+            logger.debug("PolicyEnv: inline step state failed: %s", state.message)
+            if self._inline_state_failures >= _INLINE_STATE_MAX_FAILURES:
+                logger.info(
+                    "PolicyEnv: inline step state failed %d times in a row (%s); "
+                    "using GetFullState per step",
+                    self._inline_state_failures, state.message,
+                )
+                self._inline_state = False
+        elif self._inline_state:
+            logger.info(
+                "PolicyEnv: engine does not attach StepResponse.state; "
+                "falling back to GetFullState per step"
+            )
+            self._inline_state = False
+        return None
+
     def _build_observation(self, step_response) -> np.ndarray:
         """Build the next observation per ``observation_mode``."""
         if self._observation_mode == "full_state_filtered":
-            assert self._scene is not None
-            try:
-                snap = self._scene.state(filter={"filter_by_slot_id": self._slot_id})
-            except Exception:
-                snap = self._scene.state()
-            return np.concatenate(
-                [snap.qpos.astype(np.float32), snap.qvel.astype(np.float32)]
-            )
+            obs = self._inline_state_obs(step_response)
+            return obs if obs is not None else self._scene_state_obs()
 
         # "last_action" mode — read the policy's most recent inference output.
         try:
@@ -322,14 +394,7 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
 
         # Build initial observation without driving an extra physics step.
         if self._observation_mode == "full_state_filtered":
-            assert self._scene is not None
-            try:
-                snap = self._scene.state(filter={"filter_by_slot_id": self._slot_id})
-            except Exception:
-                snap = self._scene.state()
-            obs = np.concatenate(
-                [snap.qpos.astype(np.float32), snap.qvel.astype(np.float32)]
-            )
+            obs = self._scene_state_obs()
         else:
             try:
                 action_values, _names = self._robot.get_last_action(self._slot_id)
@@ -354,8 +419,24 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
             ``"step_response"`` (the raw proto) for downstream debugging.
         """
         self._step_count += 1
+        action_list = self._action_values(action)
+
+        # 1) Push each scalar command into the slot's CommandStore — one
+        #    ApplyRobotCommands call, so every command lands on the same tick
+        #    (per-command SetPolicyCommandFloat on engines without it).
+        with self._robot.buffered():
+            for cmd_id, value in zip(self._command_ids, action_list):
+                self._robot.set_command_float(self._slot_id, cmd_id, float(value))
+
+        # 2) Advance physics. The command writes above steer the slot;
+        #    ``actions`` stays empty.
+        step_response = self._step_engine()
 
-        # Coerce to flat list for the per-command writes below.
+        # 3) Build observation per mode.
+        return self._transition(step_response, self._build_observation(step_response))
+
+    def _action_values(self, action) -> list:
+        """Coerce ``action`` to a flat list for the per-command writes."""
         action_list = (
             action.tolist()
             if hasattr(action, "tolist")
@@ -366,17 +447,12 @@ class PolicyEnv(_BASE):  # type: ignore[misc,valid-type]
                 f"action has length {len(action_list)}; expected "
                 f"{len(self._command_ids)} (one per command_name)"
             )
+        return action_list
 
-        # 1) Push each scalar command into the slot's CommandStore.
-        for cmd_id, value in zip(self._command_ids, action_list):
-            self._robot.set_command_float(self._slot_id, cmd_id, float(value))
-
-        # 2) Advance physics. We rely on the SetPolicyCommandFloat
-        #    side-effects above; ``actions`` stays empty.
-        step_response = self._step_engine()
-
-        # 3) Build observation per mode.
-        obs = self._build_observation(step_response)
+    def _transition(
+        self, step_response, obs: np.ndarray
+    ) -> tuple[np.ndarray, float, bool, bool, dict]:
+        """``(obs, reward, terminated, truncated, info)`` for one env step."""
         self._maybe_resize_obs_space(obs)
 
         # 4) Reward / termination / truncation.
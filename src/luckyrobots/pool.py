@@ -0,0 +1,435 @@
+"""EnginePool: one step call over N LuckyEngine workers.
+
+Each worker is a :class:`~luckyrobots.session.Session` bound to its own
+engine. The engine is either launched locally on its own gRPC port (one
+:class:`~luckyrobots.engine.manager.EngineProcess` with its own lock file)
+or attached at a remote ``host:port``. The pool health-checks every worker
+and negotiates the same task contract on each. It then steps them together.
+
+:meth:`EnginePool.step_async` sends every worker's Step RPC (``Step.future``)
+before waiting on any of them, so engine time overlaps across workers and
+throughput grows with the number of engines instead of paying one round
+trip per engine.
+
+When a worker's engine dies (local process exited, channel unavailable or
+``health_check`` failing), the pool restarts it, up to ``max_restarts``
+times. A local engine is relaunched and a remote one is reconnected; either
+way the worker is renegotiated and reset. That worker's entry in the step
+results is then the post-reset observation, with ``truncated=True`` and
+``info["worker_restarted"] = 1.0``. ``StepArrays`` (``return_numpy=True``)
+has no ``info``; there only ``truncated`` is set, and a bump in
+``EngineWorker.restarts`` tells a restart apart from a time-limit truncation.
+
+    from luckyrobots import EnginePool
+
+    with EnginePool.launch(4, scene="ArmLevel", robot="so100", task="pickandplace") as pool:
+        obs = pool.reset()
+        for _ in range(1000):
+            pending = pool.step_async([policy(o.to_numpy()) for o in obs])
+            ...                                  # overlap client work with the engines
+            obs = pending.result()
+"""
+
+from __future__ import annotations
+
+import logging
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass
+from typing import Any, Dict, List, Optional, Sequence, Tuple, Union
+
+import grpc
+
+from .client import GrpcConnectionError, LuckyEngineClient
+from .engine.manager import EngineProcess
+from .session import Session
+
+logger = logging.getLogger("luckyrobots.pool")
+
+Address = Union[str, Tuple[str, int]]
+
+
+def _parse_address(address: Address) -> Tuple[str, int]:
+    if isinstance(address, tuple):
+        return address[0], int(address[1])
+    host, sep, port = address.rpartition(":")
+    if not sep or not port.isdigit():
+        raise ValueError(f"Engine address must be 'host:port', got {address!r}")
+    return host, int(port)
+
+
+@dataclass
+class EngineWorker:
+    """One engine of an :class:`EnginePool`."""
+
+    index: int
+    session: Session
+    process: Optional[EngineProcess] = None  # None = attached (remote) engine
+    negotiated: Optional[Dict[str, Any]] = None
+    restarts: int = 0
+
+    @property
+    def address(self) -> str:
+        return f"{self.session.host}:{self.session.port}"
+
+    @property
+    def client(self) -> LuckyEngineClient:
+        return self.session._require_client()
+
+
+class PendingPoolStep:
+    """Step RPCs in flight on every worker of a pool."""
+
+    def __init__(self, pool: "EnginePool", calls: list, agent_name: str, return_numpy: bool):
+        self._pool = pool
+        self._calls = calls
+        self._agent_name = agent_name
+        self._return_numpy = return_numpy
+
+    def done(self) -> bool:
+        """True once every worker has answered."""
+        return all(future.done() for _, future in self._calls)
+
+    def result(self) -> list:
+        """Wait for every worker; one observation (or StepArrays) per worker."""
+        return [
+            self._pool._step_result(worker, future, self._agent_name, self._return_numpy)
+            for worker, future in self._calls
+        ]
+
+
+class EnginePool:
+    """N LuckyEngine workers driven as one batched environment.
+
+    Use :meth:`launch` for local engines on consecutive ports and
+    :meth:`attach` for engines that are already running. The constructor
+    accepts both (``local_ports`` and ``remote``) and :meth:`start` brings
+    them up.
+
+    Args:
+        robot: Robot name, as for :meth:`Session.start`.
+        local_ports: Launch one engine per port on this machine.
+        remote: ``"host:port"`` (or ``(host, port)``) engines to attach to.
+        scene: Scene to load in the local engines (required with ``local_ports``).
+        task: Task name passed to the local engines.
+        host: Address the local engines are reached at.
+        executable_path: LuckyEngine executable (auto-detected if None).
+        headless: Launch local engines render-free (default; pass False for
+            pixel observations).
+        sim_mode: Simulation time mode of the local engines.
+        scene_cache: Precooked scene directory shared by the local engines.
+        task_contract: Negotiated on every worker at start and after each
+            restart; each worker's result is in ``worker.negotiated``.
+        auto_restart: Restart dead workers inside ``step`` / ``reset``.
+        max_restarts: Restarts allowed per worker before ``RuntimeError``.
+        timeout_s: Connect / agents-ready timeout per worker.
+    """
+
+    def __init__(
+        self,
+        robot: str,
+        *,
+        local_ports: Sequence[int] = (),
+        remote: Sequence[Address] = (),
+        scene: str = "",
+        task: Optional[str] = None,
+        host: str = "127.0.0.1",
+        executable_path: Optional[str] = None,
+        headless: bool = True,
+        sim_mode: str = "fast",
+        scene_cache: Optional[str] = None,
+        task_contract: Optional[dict] = None,
+        auto_restart: bool = True,
+        max_restarts: int = 3,
+        timeout_s: float = 120.0,
+    ) -> None:
+        if not local_ports and not remote:
+            raise ValueError("EnginePool needs at least one local port or remote address")
+        if local_ports and not scene:
+            raise ValueError("scene is required to launch local engines")
+
+        self.robot = robot
+        self.scene = scene
+        self.task = task
+        self.executable_path = executable_path
+        self.headless = headless
+        self.sim_mode = sim_mode
+        self.scene_cache = scene_cache
+        self.task_contract = task_contract
+        self.auto_restart = auto_restart
+        self.max_restarts = max_restarts
+        self.timeout_s = timeout_s
+
+        self.workers: List[EngineWorker] = []
+        for port in local_ports:
+            self.workers.append(EngineWorker(
+                index=len(self.workers),
+                session=Session(host=host, port=int(port)),
+                process=EngineProcess(grpc_port=int(port)),
+            ))
+        for address in remote:
+            remote_host, remote_port = _parse_address(address)
+            self.workers.append(EngineWorker(
+                index=len(self.workers), session=Session(host=remote_host, port=remote_port)
+            ))
+        self._executor = ThreadPoolExecutor(len(self.workers), thread_name_prefix="engine-pool")
+
+    # ---- construction ----
+
+    @classmethod
+    def launch(
+        cls,
+        num_engines: int,
+        *,
+        scene: str,
+        robot: str,
+        task: Optional[str] = None,
+        base_port: int = 50051,
+        **options: Any,
+    ) -> "EnginePool":
+        """Launch ``num_engines`` local engines on ``base_port``, ``base_port + 1``, ..."""
+        if num_engines < 1:
+            raise ValueError(f"num_engines must be >= 1, got {num_engines}")
+        pool = cls(
+            robot,
+            local_ports=range(base_port, base_port + num_engines),
+            scene=scene,
+            task=task,
+            **options,
+        )
+        return pool._started()
+
+    @classmethod
+    def attach(cls, addresses: Sequence[Address], *, robot: str, **options: Any) -> "EnginePool":
+        """Connect to engines that are already running at ``addresses``."""
+        return cls(robot, remote=addresses, **options)._started()
+
+    def _started(self) -> "EnginePool":
+        try:
+            self.start()
+        except BaseException:
+            self.close()
+            raise
+        return self
+
+    # ---- lifecycle ----
+
+    def start(self) -> None:
+        """Launch the local engines, then connect, wait for and negotiate every worker.
+
+        All local engines are launched before any is waited on, so they boot
+        concurrently.
+        """
+        for worker in self.workers:
+            if worker.process is not None:
+                self._launch(worker)
+        list(self._executor.map(self._bring_up, self.workers))
+        logger.info("EnginePool ready: %d workers (%s)", len(self.workers),
+                    ", ".join(w.address for w in self.workers))
+
+    def _launch(self, worker: EngineWorker) -> None:
+        ok = worker.process.launch(
+            scene=self.scene,
+            robot=self.robot,
+            task=self.task,
+            executable_path=self.executable_path,
+            headless=self.headless,
+            auto_play=True,
+            grpc_port=worker.session.port,
+            sim_mode=self.sim_mode,
+            scene_cache=self.scene_cache,
+        )
+        if not ok:
+            raise RuntimeError(
+                f"Failed to launch LuckyEngine worker {worker.index} on port {worker.session.port}"
+            )
+
+    def _bring_up(self, worker: EngineWorker) -> None:
+        worker.session.connect(timeout_s=self.timeout_s, robot=self.robot)
+        worker.session._wait_for_agents_ready(timeout_s=self.timeout_s)
+        worker.negotiated = None
+        if self.task_contract is not None:
+            worker.negotiated = worker.client.negotiate_task(self.task_contract)
+            worker.session._negotiated_session = worker.negotiated
+        logger.info("Worker %d ready at %s", worker.index, worker.address)
+
+    def close(self) -> None:
+        """Close every channel and stop the engines this pool launched.
+
+        A worker that fails to close is logged and skipped, so the remaining
+        engines are still stopped.
+        """
+        for worker in self.workers:
+            try:
+                worker.session.close(stop_engine=False)
+            except Exception as e:
+                logger.warning("Closing worker %d (%s) failed: %s", worker.index, worker.address, e)
+            if worker.process is not None:
+                try:
+                    worker.process.stop()
+                except Exception as e:
+                    logger.warning("Stopping engine of worker %d failed: %s", worker.index, e)
+        self._executor.shutdown(wait=False)
+
+    def __enter__(self) -> "EnginePool":
+        return self
+
+    def __exit__(self, exc_type, exc, tb) -> None:
+        self.close()
+
+    def __len__(self) -> int:
+        return len(self.workers)
+
+    # ---- health ----
+
+    def _healthy(self, worker: EngineWorker, timeout: Optional[float] = None) -> bool:
+        if worker.process is not None and not worker.process.is_alive():
+            return False
+        client = worker.session.engine_client
+        return client is not None and client.health_check(timeout=timeout)
+
+    def _is_dead(self, worker: EngineWorker, error: Exception) -> bool:
+        if isinstance(error, grpc.RpcError) and error.code() == grpc.StatusCode.UNAVAILABLE:
+            return True
+        return not self._healthy(worker)
+
+    def health_check(self, timeout: Optional[float] = None) -> List[bool]:
+        """Per-worker liveness: local process running and ``health_check`` answered."""
+        return list(self._executor.map(lambda w: self._healthy(w, timeout), self.workers))
+
+    def restart_worker(self, index: int) -> EngineWorker:
+        """Relaunch (local) or reconnect (remote) one worker and renegotiate it.
+
+        Raises:
+            RuntimeError: The worker already used its ``max_restarts``.
+        """
+        worker = self.workers[index]
+        if worker.restarts >= self.max_restarts:
+            raise RuntimeError(
+                f"Engine worker {index} ({worker.address}) died again after "
+                f"{worker.restarts} restarts"
+            )
+        worker.restarts += 1
+        logger.warning("Restarting engine worker %d (%s), restart %d/%d",
+                       index, worker.address, worker.restarts, self.max_restarts)
+        worker.session.close(stop_engine=False)
+        if worker.process is not None:
+            worker.process.stop()
+            self._launch(worker)
+        self._bring_up(worker)
+        return worker
+
+    def restart_dead_workers(self) -> List[int]:
+        """Health-check every worker and restart the dead ones; returns their indices."""
+        dead = [i for i, ok in enumerate(self.health_check()) if not ok]
+        list(self._executor.map(self.restart_worker, dead))
+        return dead
+
+    # ---- stepping ----
+
+    def step_async(
+        self,
+        actions: Sequence[Sequence[float]],
+        agent_name: str = "",
+        return_numpy: bool = False,
+        timeout: Optional[float] = None,
+        **step_options: Any,
+    ) -> PendingPoolStep:
+        """Send one Step RPC to every worker without waiting for any.
+
+        Args:
+            actions: One action vector per worker (a list of lists or a
+                ``(num_workers, action_dim)`` array).
+            agent_name: Agent name (empty = default agent).
+            return_numpy: Decode into per-worker `StepArrays` buffers. A
+                restarted worker's entry then only carries ``truncated=True``;
+                compare ``EngineWorker.restarts`` to detect the restart.
+            timeout: RPC timeout in seconds (default: each client's timeout).
+            **step_options: ``num_substeps``, ``substep_reduction``,
+                ``profile`` or ``state``, as for :meth:`LuckyEngineClient.step`.
+
+        Returns:
+            A :class:`PendingPoolStep`; ``result()`` waits for all workers.
+        """
+        if len(actions) != len(self.workers):
+            raise ValueError(
+                f"Expected {len(self.workers)} action vectors (one per worker), "
+                f"got {len(actions)}"
+            )
+        calls = []
+        for worker, action in zip(self.workers, actions):
+            client = worker.client
+            request = client._build_step_request(
+                actions=action.tolist() if hasattr(action, "tolist") else list(action),
+                agent_name=agent_name,
+                **step_options,
+            )
+            calls.append((worker, client.agent.Step.future(request, timeout=timeout or client.timeout)))
+        return PendingPoolStep(self, calls, agent_name, return_numpy)
+
+    def step(
+        self,
+        actions: Sequence[Sequence[float]],
+        agent_name: str = "",
+        return_numpy: bool = False,
+        timeout: Optional[float] = None,
+        **step_options: Any,
+    ) -> list:
+        """Step every worker with overlapped RPCs; one observation per worker."""
+        return self.step_async(
+            actions, agent_name=agent_name, return_numpy=return_numpy, timeout=timeout,
+            **step_options,
+        ).result()
+
+    def _step_result(self, worker: EngineWorker, future, agent_name: str, return_numpy: bool):
+        try:
+            resp = future.result()
+        except grpc.RpcError as e:
+            if not self.auto_restart or not self._is_dead(worker, e):
+                raise
+            self.restart_worker(worker.index)
+            return _mark_restarted(
+                worker.session.reset(agent_name=agent_name, return_numpy=return_numpy)
+            )
+        client = worker.client
+        if return_numpy:
+            return client._arrays_from_step_response(resp, agent_name)
+        return client._observation_from_step_response(resp, agent_name)
+
+    def reset(
+        self,
+        agent_name: str = "",
+        randomization_cfg: Optional[Any] = None,
+        return_numpy: bool = False,
+    ) -> list:
+        """Reset every worker (concurrently); one observation per worker."""
+        return list(self._executor.map(
+            lambda w: self._reset_worker(w, agent_name, randomization_cfg, return_numpy),
+            self.workers,
+        ))
+
+    def _reset_worker(self, worker, agent_name, randomization_cfg, return_numpy):
+        try:
+            return worker.session.reset(
+                agent_name=agent_name, randomization_cfg=randomization_cfg,
+                return_numpy=return_numpy,
+            )
+        except (grpc.RpcError, GrpcConnectionError) as e:
+            if not self.auto_restart or not self._is_dead(worker, e):
+                raise
+            self.restart_worker(worker.index)
+            return _mark_restarted(worker.session.reset(
+                agent_name=agent_name, randomization_cfg=randomization_cfg,
+                return_numpy=return_numpy,
+            ))
+
+
+def _mark_restarted(obs):
+    """Flag a post-restart observation as an episode boundary.
+
+    ``StepArrays`` has no ``info`` field, so it only gets ``truncated=True``.
+    """
+    if hasattr(obs, "model_copy"):
+        return obs.model_copy(update={
+            "truncated": True, "info": {**(obs.info or {}), "worker_restarted": 1.0},
+        })
+    return obs._replace(truncated=True)
@@ -0,0 +1,338 @@
+"""Memory-mapped binary format for SessionRecording (``.lrrec``).
+
+Parquet / JSONL recordings are loaded into a list of events up front and
+carry requests as JSON. ``.lrrec`` files store each request as its
+serialized proto plus a fixed-width index (time, frame, RPC, offsets) at the
+end of the file. Opening one maps the file and reads only the header and
+the index, so an hour-long log opens in milliseconds, ``seek_time`` /
+``seek_frame`` are binary searches, and payloads are decoded only when an
+event is actually touched.
+
+Layout (little-endian)::
+
+    header   magic, version, started_at, event count, names / index offsets
+    payloads request proto bytes and response JSON, back to back
+    names    RPC name table (u32 count, then u16 length + UTF-8 per name)
+    index    INDEX_DTYPE rows, one per event, 8-byte aligned
+
+Usage:
+    rec.save("run.lrrec")
+
+    with RecordingLog.open("run.lrrec") as log:
+        i = log.seek_frame(120_000)
+        log.replay(sess, start=i, fast_forward=True)
+"""
+
+from __future__ import annotations
+
+import mmap
+import struct
+from typing import TYPE_CHECKING, BinaryIO, Dict, Iterator, List, Optional, Union
+
+import numpy as np
+
+from .recording import RecordedEvent, SessionRecording, _build_rpc_registry, _replay_events
+
+if TYPE_CHECKING:
+    from .session import Session
+
+MAGIC = b"LRREC\x00\x00\x00"
+VERSION = 1
+
+# magic, version, reserved, started_at, event_count, names_offset, index_offset
+_HEADER = struct.Struct("<8sIIdQQQ")
+
+INDEX_DTYPE = np.dtype([
+    ("timestamp_s", "<f8"),
+    ("frame_number", "<i8"),   # carried forward from the last event that had one
+    ("request_offset", "<u8"),
+    ("response_offset", "<u8"),
+    ("rpc_id", "<u4"),
+    ("request_len", "<u4"),
+    ("response_len", "<u4"),   # _NO_RESPONSE for setters
+    ("_pad", "<u4"),
+])
+
+_NO_RESPONSE = 0xFFFFFFFF
+
+
+def _encode_request(ev: RecordedEvent, registry: Dict[str, type]) -> bytes:
+    """Typed request payload: the captured bytes, else the JSON re-serialized."""
+    if ev.request_bytes is not None:
+        return bytes(ev.request_bytes)
+    request_cls = registry.get(ev.rpc)
+    if request_cls is None or not ev.request_json:
+        return b""
+    from google.protobuf import json_format  # type: ignore
+
+    return json_format.Parse(ev.request_json, request_cls()).SerializeToString()
+
+
+class RecordingLogWriter:
+    """Streams events into an ``.lrrec`` file.
+
+    Payloads go to disk as they are appended; only the index rows are held
+    in memory until :meth:`close` writes the name table and index.
+    """
+
+    def __init__(self, path: str, started_at: float = 0.0) -> None:
+        self._f: BinaryIO = open(path, "wb")
+        self._started_at = started_at
+        self._f.write(b"\0" * _HEADER.size)
+        self._offset = _HEADER.size
+        self._rows: List[tuple] = []
+        self._rpc_ids: Dict[str, int] = {}
+        self._last_frame = -1
+        self._registry = _build_rpc_registry()
+
+    def _write(self, data: bytes) -> int:
+        offset = self._offset
+        self._f.write(data)
+        self._offset += len(data)
+        return offset
+
+    def append(self, ev: RecordedEvent) -> None:
+        request = _encode_request(ev, self._registry)
+        request_offset = self._write(request)
+        if ev.response_json is None:
+            response_offset, response_len = self._offset, _NO_RESPONSE
+        else:
+            response = ev.response_json.encode("utf-8")
+            response_offset, response_len = self._write(response), len(response)
+        if ev.frame_number >= 0:
+            self._last_frame = ev.frame_number
+        rpc_id = self._rpc_ids.setdefault(ev.rpc, len(self._rpc_ids))
+        self._rows.append((
+            ev.timestamp_s, self._last_frame, request_offset, response_offset,
+            rpc_id, len(request), response_len, 0,
+        ))
+
+    def close(self) -> None:
+        if self._f.closed:
+            return
+        names_offset = self._offset
+        names = [struct.pack("<I", len(self._rpc_ids))]
+        for name in self._rpc_ids:  # insertion order == id order
+            raw = name.encode("utf-8")
+            names.append(struct.pack("<H", len(raw)) + raw)
+        self._write(b"".join(names))
+        self._write(b"\0" * (-self._offset % 8))
+        index_offset = self._offset
+        self._write(np.array(self._rows, dtype=INDEX_DTYPE).tobytes())
+        self._f.seek(0)
+        self._f.write(_HEADER.pack(
+            MAGIC, VERSION, 0, self._started_at, len(self._rows), names_offset, index_offset,
+        ))
+        self._f.close()
+
+    def __enter__(self) -> "RecordingLogWriter":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
+
+
+def write_recording(path: str, recording: SessionRecording) -> None:
+    """Write a whole SessionRecording as ``.lrrec``."""
+    with RecordingLogWriter(path, started_at=recording.started_at) as writer:
+        for ev in recording.events:
+            writer.append(ev)
+
+
+class RecordingLog:
+    """Read-only, memory-mapped view of an ``.lrrec`` recording.
+
+    Attributes:
+        started_at: Wall-clock start of the recording.
+        index: Structured ``INDEX_DTYPE`` array over the mapped file.
+        rpc_names: RPC name per ``rpc_id``.
+    """
+
+    def __init__(self, path: str) -> None:
+        self.path = path
+        self._file = open(path, "rb")
+        try:
+            self._mm = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+        except ValueError:  # empty file
+            self._file.close()
+            raise ValueError(f"{path!r} is not a .lrrec recording") from None
+        try:
+            self._load_header()
+        except Exception:
+            self.close()
+            raise
+
+    def _load_header(self) -> None:
+        if len(self._mm) < _HEADER.size:
+            raise ValueError(f"{self.path!r} is not a .lrrec recording")
+        magic, version, _, started_at, count, names_offset, index_offset = (
+            _HEADER.unpack_from(self._mm, 0)
+        )
+        if magic != MAGIC:
+            raise ValueError(f"{self.path!r} is not a .lrrec recording")
+        if version > VERSION:
+            raise ValueError(f"{self.path!r} is .lrrec version {version}; max supported {VERSION}")
+        self.started_at = started_at
+        (n_names,) = struct.unpack_from("<I", self._mm, names_offset)
+        pos = names_offset + 4
+        self.rpc_names: List[str] = []
+        for _ in range(n_names):
+            (n,) = struct.unpack_from("<H", self._mm, pos)
+            self.rpc_names.append(bytes(self._mm[pos + 2:pos + 2 + n]).decode("utf-8"))
+            pos += 2 + n
+        if count:
+            self.index = np.frombuffer(
+                self._mm, dtype=INDEX_DTYPE, count=count, offset=index_offset
+            )
+        else:
+            self.index = np.empty(0, dtype=INDEX_DTYPE)
+
+    @classmethod
+    def open(cls, path: str) -> "RecordingLog":
+        return cls(path)
+
+    def close(self) -> None:
+        """Unmap the file.
+
+        If index arrays handed out (``timestamps`` etc.) are still alive the
+        mapping stays open until they are garbage-collected.
+        """
+        self.index = np.empty(0, dtype=INDEX_DTYPE)
+        try:
+            self._mm.close()
+        except BufferError:
+            pass
+        self._file.close()
+
+    def __enter__(self) -> "RecordingLog":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
+
+    # ---- index ------------------------------------------------------------
+
+    def __len__(self) -> int:
+        return int(self.index.shape[0])
+
+    @property
+    def timestamps(self) -> np.ndarray:
+        """Per-event seconds since the recording started (a view, no copy)."""
+        return self.index["timestamp_s"]
+
+    @property
+    def frame_numbers(self) -> np.ndarray:
+        """Per-event engine frame number (-1 before the first known frame)."""
+        return self.index["frame_number"]
+
+    @property
+    def duration_s(self) -> float:
+        return float(self.timestamps[-1]) if len(self) else 0.0
+
+    def seek_time(self, t: float) -> int:
+        """Index of the first event at or after ``t`` seconds (``len`` if none)."""
+        return int(np.searchsorted(self.timestamps, t, side="left"))
+
+    def seek_frame(self, frame_number: int) -> int:
+        """Index of the first event at or after ``frame_number``.
+
+        Frame numbers are assumed non-decreasing over the log.
+        """
+        return int(np.searchsorted(self.frame_numbers, frame_number, side="left"))
+
+    # ---- payloads ---------------------------------------------------------
+
+    def rpc(self, i: int) -> str:
+        return self.rpc_names[int(self.index[i]["rpc_id"])]
+
+    def request_bytes(self, i: int) -> bytes:
+        """Serialized request proto of event ``i``."""
+        row = self.index[i]
+        start = int(row["request_offset"])
+        return self._mm[start:start + int(row["request_len"])]
+
+    def request(self, i: int):
+        """Event ``i``'s request parsed into its proto class."""
+        rpc = self.rpc(i)
+        request_cls = _build_rpc_registry().get(rpc)
+        if request_cls is None:
+            raise KeyError(f"No request type registered for {rpc}")
+        return request_cls.FromString(self.request_bytes(i))
+
+    def response_json(self, i: int) -> Optional[str]:
+        row = self.index[i]
+        n = int(row["response_len"])
+        if n == _NO_RESPONSE:
+            return None
+        start = int(row["response_offset"])
+        return bytes(self._mm[start:start + n]).decode("utf-8")
+
+    def __getitem__(self, i: Union[int, slice]) -> Union[RecordedEvent, List[RecordedEvent]]:
+        if isinstance(i, slice):
+            return [self[j] for j in range(*i.indices(len(self)))]
+        if i < 0:
+            i += len(self)
+        if not 0 <= i < len(self):
+            raise IndexError(i)
+        row = self.index[i]
+        rpc = self.rpc(i)
+        request = self.request_bytes(i)
+        request_json = ""
+        request_cls = _build_rpc_registry().get(rpc)
+        if request_cls is not None:
+            from google.protobuf import json_format  # type: ignore
+
+            request_json = json_format.MessageToJson(
+                request_cls.FromString(request), preserving_proto_field_name=True
+            )
+        return RecordedEvent(
+            timestamp_s=float(row["timestamp_s"]),
+            rpc=rpc,
+            request_json=request_json,
+            response_json=self.response_json(i),
+            frame_number=int(row["frame_number"]),
+            request_bytes=request,
+        )
+
+    def events(self, start: int = 0, stop: Optional[int] = None) -> Iterator[RecordedEvent]:
+        """Decode events ``[start, stop)`` lazily."""
+        stop = len(self) if stop is None else min(stop, len(self))
+        for i in range(start, stop):
+            yield self[i]
+
+    def to_recording(self) -> SessionRecording:
+        """Materialize the whole log as an in-memory SessionRecording."""
+        return SessionRecording(started_at=self.started_at, events=list(self.events()))
+
+    # ---- replay -----------------------------------------------------------
+
+    def replay(
+        self,
+        session: "Session",
+        *,
+        start: int = 0,
+        stop: Optional[int] = None,
+        speed: float = 1.0,
+        include: Optional[set] = None,
+        fast_forward: bool = False,
+        schedule: str = "frame",
+    ):
+        """Replay events ``[start, stop)``; see `SessionRecording.replay`.
+
+        The fast-forward path sends request bytes straight from the mapping
+        without decoding them.
+        """
+        client = getattr(session, "engine_client", None)
+        if client is None:
+            raise RuntimeError("Session has no engine_client; call start()/connect() first.")
+        stop = len(self) if stop is None else min(stop, len(self))
+        if not fast_forward:
+            _replay_events(client, self.events(start, stop), speed=speed, include=include)
+            return None
+        commands = (
+            (float(self.index[i]["timestamp_s"]), int(self.index[i]["frame_number"]),
+             self.rpc(i), self.request_bytes(i))
+            for i in range(start, stop)
+            if include is None or self.rpc(i) in include
+        )
+        return client.replay_command_log(commands, schedule=schedule)
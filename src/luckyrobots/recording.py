@@ -1,9 +1,11 @@
 """Record + replay sessions for offline RL / debugging.
 
 Captures every Set*/Get* call against a Session into a structured event log
-that can be saved as Parquet (preferred) or JSONL (fallback when pyarrow
-isn't installed). Replay re-issues the events in order at the original
-timestamps (or scaled by `speed`).
+that can be saved as a memory-mapped binary log (``.lrrec``, see
+`luckyrobots.reclog`), Parquet, or JSONL (fallback when pyarrow isn't
+installed). Replay re-issues the events in order at the original
+timestamps (or scaled by `speed`), or hands the whole log to the engine
+with ``fast_forward=True``.
 
 Usage:
     with session.record() as rec:
@@ -24,7 +26,9 @@ import logging
 import os
 import time
 from dataclasses import asdict, dataclass, field
-from typing import Any, Callable, ContextManager, Dict, Iterator, List, Optional, TYPE_CHECKING
+from typing import (
+    Any, Callable, ContextManager, Dict, Iterable, Iterator, List, Optional, TYPE_CHECKING,
+)
 
 if TYPE_CHECKING:
     from .session import Session
@@ -149,6 +153,39 @@ class RecordedEvent:
     rpc: str                 # e.g. "AgentService.SetPolicyCommandFloat"
     request_json: str        # canonical JSON of the request proto (MessageToJson)
     response_json: Optional[str] = None  # for getters; None for setters
+    frame_number: int = -1   # engine frame from the response, -1 if it had none
+    # Serialized request proto (not written to JSONL / Parquet).
+    request_bytes: Optional[bytes] = field(default=None, repr=False)
+
+
+# Where responses carry their engine frame: a top-level counter, or a nested
+# frame (StepResponse.observation, GetFullStateResponse.state, and
+# StepResponse.state -> GetFullStateResponse.state).
+_FRAME_FIELDS = ("frame_number", "apply_frame_number")
+_FRAME_MESSAGES = ("observation", "state")
+
+
+def _frame_number_of(response: Any) -> int:
+    descriptor = getattr(response, "DESCRIPTOR", None)
+    if descriptor is None:
+        return -1
+    fields = descriptor.fields_by_name
+    for name in _FRAME_FIELDS:
+        if name in fields:
+            return int(getattr(response, name))
+    for name in _FRAME_MESSAGES:
+        if name in fields and fields[name].message_type is not None \
+                and response.HasField(name):
+            frame = _frame_number_of(getattr(response, name))
+            if frame >= 0:
+                return frame
+    return -1
+
+
+def _request_of(ev: RecordedEvent, request_cls: type, json_format: Any) -> Any:
+    if ev.request_bytes is not None:
+        return request_cls.FromString(ev.request_bytes)
+    return json_format.Parse(ev.request_json, request_cls())
 
 
 @dataclass
@@ -159,15 +196,18 @@ class SessionRecording:
     # ---- persistence ------------------------------------------------------
 
     def save(self, path: str) -> None:
-        """Save as parquet (.parquet) or jsonl (.jsonl). Determined by extension."""
+        """Save as .lrrec, .parquet or .jsonl. Determined by extension."""
         ext = os.path.splitext(path)[1].lower()
-        if ext == ".parquet":
+        if ext == ".lrrec":
+            from .reclog import write_recording
+            write_recording(path, self)
+        elif ext == ".parquet":
             self._save_parquet(path)
         elif ext in (".jsonl", ".json"):
             self._save_jsonl(path)
         else:
             raise ValueError(
-                f"Unknown recording extension '{ext}'. Use .parquet or .jsonl."
+                f"Unknown recording extension '{ext}'. Use .lrrec, .parquet or .jsonl."
             )
 
     def _save_jsonl(self, path: str) -> None:
@@ -175,7 +215,9 @@ class SessionRecording:
             header = {"_header": True, "started_at": self.started_at}
             f.write(json.dumps(header) + "\n")
             for ev in self.events:
-                f.write(json.dumps(asdict(ev)) + "\n")
+                row = asdict(ev)
+                del row["request_bytes"]
+                f.write(json.dumps(row) + "\n")
 
     def _save_parquet(self, path: str) -> None:
         try:
@@ -192,19 +234,30 @@ class SessionRecording:
             "rpc": [ev.rpc for ev in self.events],
             "request_json": [ev.request_json for ev in self.events],
             "response_json": [ev.response_json for ev in self.events],
+            "frame_number": [ev.frame_number for ev in self.events],
         }
         table = pa.table(cols, metadata={b"started_at": str(self.started_at).encode()})
         pq.write_table(table, path)
 
     @classmethod
     def load(cls, path: str) -> "SessionRecording":
-        """Load from parquet or jsonl."""
+        """Load from .lrrec, parquet or jsonl.
+
+        This materializes every event; open long ``.lrrec`` logs with
+        `luckyrobots.reclog.RecordingLog` instead to seek and replay lazily.
+        """
         ext = os.path.splitext(path)[1].lower()
+        if ext == ".lrrec":
+            from .reclog import RecordingLog
+            with RecordingLog.open(path) as log:
+                return log.to_recording()
         if ext == ".parquet":
             return cls._load_parquet(path)
         if ext in (".jsonl", ".json"):
             return cls._load_jsonl(path)
-        raise ValueError(f"Unknown recording extension '{ext}'. Use .parquet or .jsonl.")
+        raise ValueError(
+            f"Unknown recording extension '{ext}'. Use .lrrec, .parquet or .jsonl."
+        )
 
     @classmethod
     def _load_jsonl(cls, path: str) -> "SessionRecording":
@@ -236,6 +289,8 @@ class SessionRecording:
         rec = cls(started_at=started_at, events=[])
         cols = table.to_pydict()
         n = len(cols.get("timestamp_s", []))
+        # Recordings saved before frame_number was captured lack the column.
+        frames = cols.get("frame_number") or [-1] * n
         for i in range(n):
             rec.events.append(
                 RecordedEvent(
@@ -243,6 +298,7 @@ class SessionRecording:
                     rpc=str(cols["rpc"][i]),
                     request_json=str(cols["request_json"][i]),
                     response_json=cols["response_json"][i] if cols["response_json"][i] is not None else None,
+                    frame_number=int(frames[i]),
                 )
             )
         return rec
@@ -255,67 +311,122 @@ class SessionRecording:
         *,
         speed: float = 1.0,
         include: Optional[set] = None,
-    ) -> None:
+        fast_forward: bool = False,
+        schedule: str = "frame",
+    ):
         """Re-issue events at original spacing (scaled by speed). `include`
-        filters by RPC name, e.g. {"AgentService.SetPolicyCommandFloat"}."""
-        if speed == 0:
-            raise ValueError("Replay speed=0 is not allowed (would be infinite speed).")
-        if speed < 0:
-            raise ValueError("Replay speed must be positive.")
-
-        try:
-            from google.protobuf import json_format  # type: ignore
-        except ImportError as e:  # pragma: no cover
-            raise ImportError(
-                "Replay requires google.protobuf (transitive dep of grpc)."
-            ) from e
-
-        registry = _build_rpc_registry()
+        filters by RPC name, e.g. {"AgentService.SetPolicyCommandFloat"}.
+
+        With ``fast_forward=True`` the whole log is sent to the engine in one
+        ``RecorderService.ReplayCommandLog`` call, which applies each command
+        at its recorded frame (``schedule="frame"``) or sim time
+        (``schedule="time"``) and steps physics as fast as it can in between;
+        ``speed`` is then ignored and the engine's replay summary is returned.
+        """
         client = getattr(session, "engine_client", None)
         if client is None:
             raise RuntimeError("Session has no engine_client; call start()/connect() first.")
+        if fast_forward:
+            return _replay_on_engine(client, self.events, include=include, schedule=schedule)
+        _replay_events(client, self.events, speed=speed, include=include)
+        return None
+
+
+def _replay_events(
+    client: Any,
+    events: Iterable[RecordedEvent],
+    *,
+    speed: float,
+    include: Optional[set],
+) -> None:
+    """Re-issue `events` through the client's stubs at their recorded spacing."""
+    if speed == 0:
+        raise ValueError("Replay speed=0 is not allowed (would be infinite speed).")
+    if speed < 0:
+        raise ValueError("Replay speed must be positive.")
 
-        prev_ts: Optional[float] = None
-        for ev in self.events:
-            if include is not None and ev.rpc not in include:
-                prev_ts = ev.timestamp_s
-                continue
+    try:
+        from google.protobuf import json_format  # type: ignore
+    except ImportError as e:  # pragma: no cover
+        raise ImportError(
+            "Replay requires google.protobuf (transitive dep of grpc)."
+        ) from e
 
-            if prev_ts is not None:
-                dt = ev.timestamp_s - prev_ts
-                if dt > 0:
-                    time.sleep(max(0.0, dt / speed))
+    registry = _build_rpc_registry()
+
+    prev_ts: Optional[float] = None
+    for ev in events:
+        if include is not None and ev.rpc not in include:
             prev_ts = ev.timestamp_s
+            continue
 
-            short, _, method = ev.rpc.partition(".")
-            if not method:
-                logger.warning("Skipping malformed RPC name in event: %r", ev.rpc)
-                continue
-            stub_attr = next(
-                (attr for name, attr in _STUB_BINDINGS if name == short),
-                None,
-            )
-            if stub_attr is None:
-                logger.warning("No stub binding for service %s; skipping", short)
-                continue
-            stub = getattr(client, stub_attr, None)
-            if stub is None:
-                logger.warning("Client has no `%s` stub; skipping %s", stub_attr, ev.rpc)
-                continue
-            handle = getattr(stub, method, None)
-            if handle is None:
-                logger.warning("Stub %s missing method %s; skipping", short, method)
-                continue
-            request_cls = registry.get(ev.rpc)
-            if request_cls is None:
-                logger.warning("No request type registered for %s; skipping", ev.rpc)
+        if prev_ts is not None:
+            dt = ev.timestamp_s - prev_ts
+            if dt > 0:
+                time.sleep(max(0.0, dt / speed))
+        prev_ts = ev.timestamp_s
+
+        short, _, method = ev.rpc.partition(".")
+        if not method:
+            logger.warning("Skipping malformed RPC name in event: %r", ev.rpc)
+            continue
+        stub_attr = next(
+            (attr for name, attr in _STUB_BINDINGS if name == short),
+            None,
+        )
+        if stub_attr is None:
+            logger.warning("No stub binding for service %s; skipping", short)
+            continue
+        stub = getattr(client, stub_attr, None)
+        if stub is None:
+            logger.warning("Client has no `%s` stub; skipping %s", stub_attr, ev.rpc)
+            continue
+        handle = getattr(stub, method, None)
+        if handle is None:
+            logger.warning("Stub %s missing method %s; skipping", short, method)
+            continue
+        request_cls = registry.get(ev.rpc)
+        if request_cls is None:
+            logger.warning("No request type registered for %s; skipping", ev.rpc)
+            continue
+
+        try:
+            handle(_request_of(ev, request_cls, json_format))
+        except Exception as e:
+            logger.warning("Replay of %s failed: %s", ev.rpc, e)
+
+
+def _replay_on_engine(
+    client: Any,
+    events: Iterable[RecordedEvent],
+    *,
+    include: Optional[set],
+    schedule: str,
+) -> dict:
+    """Send `events` to the engine's ReplayCommandLog as typed request bytes."""
+    from google.protobuf import json_format  # type: ignore
+
+    registry = _build_rpc_registry()
+
+    def commands():
+        # Setters carry no frame; reuse the last known one, as RecordingLogWriter does.
+        last_frame = -1
+        for ev in events:
+            if ev.frame_number >= 0:
+                last_frame = ev.frame_number
+            if include is not None and ev.rpc not in include:
                 continue
+            if ev.request_bytes is not None:
+                request = ev.request_bytes
+            else:
+                request_cls = registry.get(ev.rpc)
+                if request_cls is None:
+                    logger.warning("No request type registered for %s; skipping", ev.rpc)
+                    continue
+                request = _request_of(ev, request_cls, json_format).SerializeToString()
+            yield ev.timestamp_s, last_frame, ev.rpc, request
 
-            try:
-                req = json_format.Parse(ev.request_json, request_cls())
-                handle(req)
-            except Exception as e:
-                logger.warning("Replay of %s failed: %s", ev.rpc, e)
+    return client.replay_command_log(commands(), schedule=schedule)
 
 
 # ── Recording context ────────────────────────────────────────────────────
@@ -361,6 +472,10 @@ def _wrap_stub_callables(
                     )
                 except Exception:
                     req_json = ""
+                try:
+                    req_bytes: Optional[bytes] = request.SerializeToString()
+                except Exception:
+                    req_bytes = None
                 response = orig(request, *args, **kwargs)
                 resp_json: Optional[str] = None
                 # Only serialize unary responses; streams are not recorded here.
@@ -377,6 +492,8 @@ def _wrap_stub_callables(
                         rpc=name,
                         request_json=req_json,
                         response_json=resp_json,
+                        frame_number=_frame_number_of(response),
+                        request_bytes=req_bytes,
                     )
                 )
                 return response
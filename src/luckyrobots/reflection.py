@@ -51,6 +51,41 @@ def _channel_cache(channel: "grpc.Channel") -> dict:
         return {}
 
 
+def _persist(cache: dict) -> None:
+    """Write the channel's service / method sets to its attached MetadataCache."""
+    target = cache.get("persist")
+    if target is None:
+        return
+    metadata_cache, key = target
+    metadata_cache.store_json("reflection", key, {
+        "services": sorted(cache.get("services", ())),
+        "methods": {svc: sorted(m) for svc, m in cache.get("methods", {}).items()},
+    })
+
+
+def attach_metadata_cache(channel: "grpc.Channel", metadata_cache, api_hash: str) -> bool:
+    """Back ``channel``'s feature cache with an on-disk ``MetadataCache``.
+
+    Seeds the service / method sets from the entry stored under ``api_hash``
+    (``EngineFingerprint.api_hash``), and writes newly discovered ones back.
+    A later connection to an engine with the same API then answers
+    :func:`has_rpc` without any reflection round trip.
+
+    Returns:
+        True if a cached entry was found.
+    """
+    from .metadata_cache import cache_key
+
+    cache = _channel_cache(channel)
+    key = cache_key(api_hash)
+    entry = metadata_cache.load_json("reflection", key)
+    if entry:
+        cache["services"] = set(entry.get("services", ()))
+        cache["methods"] = {svc: set(m) for svc, m in entry.get("methods", {}).items()}
+    cache["persist"] = (metadata_cache, key)
+    return bool(entry)
+
+
 def _reflection_db(channel: "grpc.Channel"):
     """Lazy-import the reflection descriptor database.
 
@@ -149,6 +184,7 @@ def supported_services(channel: "grpc.Channel") -> set[str]:
         return cached
     services = set(list_services(channel))
     cache["services"] = services
+    _persist(cache)
     return services
 
 
@@ -176,6 +212,7 @@ def supported_methods(channel: "grpc.Channel", service: str) -> set[str]:
         else:
             result = {m.name for m in descriptor.methods}
     methods_by_service[service] = result
+    _persist(cache)
     return result
 
 
@@ -206,6 +243,7 @@ def has_rpc(channel: "grpc.Channel", qualified_method: str) -> bool:
 
 
 __all__ = [
+    "attach_metadata_cache",
     "list_services",
     "describe_service",
     "describe_all",
@@ -7,18 +7,34 @@ gating over the AgentService gRPC surface.
 
 from .robot_controller import (
     RobotController,
+    RobotCommandBatch,
+    RobotCommandResult,
     PolicySlotState,
     RobotControllerState,
     PolicyDescriptorInfo,
+    PolicyInferenceStats,
+    PolicyInferenceBatch,
+    PolicyInferenceConfig,
     list_robot_controllers,
     list_policy_descriptors,
+    list_policy_inference_batches,
+    get_policy_inference_config,
+    set_policy_inference_config,
 )
 
 __all__ = [
     "RobotController",
+    "RobotCommandBatch",
+    "RobotCommandResult",
     "PolicySlotState",
     "RobotControllerState",
     "PolicyDescriptorInfo",
+    "PolicyInferenceStats",
+    "PolicyInferenceBatch",
+    "PolicyInferenceConfig",
     "list_robot_controllers",
     "list_policy_descriptors",
+    "list_policy_inference_batches",
+    "get_policy_inference_config",
+    "set_policy_inference_config",
 ]
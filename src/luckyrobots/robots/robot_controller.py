@@ -23,19 +23,31 @@ Quick start:
         robot.set_command_float(slot_id=1, command_id=1, value=0.5)  # SetVx
         robot.set_driven_joints(slot_id=2, joints=["left_arm_*", "right_arm_*"])
         robot.set_motion_graph_active(False)
+
+        # Coalesce a teleop frame's writes into one ApplyRobotCommands call,
+        # applied together at the next physics tick.
+        with robot.buffered():
+            cmds = robot.commands("Walker")
+            cmds["vx"] = 0.5
+            cmds["run"] = True
+            robot.set_motion_graph_input(3, (0.0, 0.0, 1.0))
 """
 
 from __future__ import annotations
 
 import dataclasses
+import logging
 from contextlib import contextmanager
 from typing import Iterable, Iterator, List, Mapping, Optional, Sequence, Tuple, Union
 
+import grpc
 import numpy as np
 
 from ..grpc.generated import agent_pb2 as _agent_pb2
 from ..grpc.generated import common_pb2 as _common_pb2
 
+logger = logging.getLogger("luckyrobots.robots")
+
 
 # ---------------------------------------------------------------------------
 # Data classes mirroring the proto messages, but friendlier for Python callers.
@@ -55,6 +67,61 @@ class PolicyCommandIdEntry:
         return cls(id=pb.id, name=pb.name, type=_command_type_to_string(pb.type))
 
 
+@dataclasses.dataclass(frozen=True)
+class PolicyInferenceStats:
+    """Inference timing for one slot; ``last_latency_us`` is its whole batch's."""
+    last_latency_us: float
+    mean_latency_us: float
+    batch_size: int
+    execution_provider: str
+    inference_count: int
+
+    @classmethod
+    def _from_pb(cls, pb) -> "PolicyInferenceStats":
+        return cls(
+            last_latency_us=pb.last_latency_us,
+            mean_latency_us=pb.mean_latency_us,
+            batch_size=pb.batch_size,
+            execution_provider=pb.execution_provider,
+            inference_count=pb.inference_count,
+        )
+
+
+@dataclasses.dataclass(frozen=True)
+class PolicyInferenceBatch:
+    """One batched forward pass: every active slot sharing ``policy_id``."""
+    policy_id: str
+    batch_size: int
+    last_latency_us: float
+    execution_provider: str
+
+    @classmethod
+    def _from_pb(cls, pb) -> "PolicyInferenceBatch":
+        return cls(
+            policy_id=pb.policy_id,
+            batch_size=pb.batch_size,
+            last_latency_us=pb.last_latency_us,
+            execution_provider=pb.execution_provider,
+        )
+
+
+@dataclasses.dataclass(frozen=True)
+class PolicyInferenceConfig:
+    batch_across_slots: bool
+    execution_provider: str
+    max_batch_size: int
+    available_execution_providers: Sequence[str] = ()
+
+    @classmethod
+    def _from_pb(cls, resp) -> "PolicyInferenceConfig":
+        return cls(
+            batch_across_slots=resp.config.batch_across_slots,
+            execution_provider=resp.config.execution_provider,
+            max_batch_size=resp.config.max_batch_size,
+            available_execution_providers=tuple(resp.available_execution_providers),
+        )
+
+
 @dataclasses.dataclass(frozen=True)
 class PolicySlotState:
     slot_id: int
@@ -68,6 +135,7 @@ class PolicySlotState:
     active_policy_id: str
     command_id_map: Sequence[PolicyCommandIdEntry]
     policy_joint_names: Sequence[str]
+    inference: Optional[PolicyInferenceStats] = None
 
     @classmethod
     def _from_pb(cls, pb) -> "PolicySlotState":
@@ -83,6 +151,9 @@ class PolicySlotState:
             active_policy_id=pb.active_policy_id,
             command_id_map=tuple(PolicyCommandIdEntry._from_pb(c) for c in pb.command_id_map),
             policy_joint_names=tuple(pb.policy_joint_names),
+            inference=(
+                PolicyInferenceStats._from_pb(pb.inference) if pb.HasField("inference") else None
+            ),
         )
 
     def command_id(self, name: str) -> Optional[int]:
@@ -122,6 +193,26 @@ class RobotControllerState:
         return None
 
 
+@dataclasses.dataclass(frozen=True)
+class RobotCommandResult:
+    """Outcome of one ``ApplyRobotCommands`` flush.
+
+    ``errors`` lists ``(index, message)`` for writes the engine rejected;
+    it is only non-empty when the batch was sent with ``allow_partial``.
+    """
+    applied_count: int
+    frame_number: int
+    errors: Sequence[Tuple[int, str]] = ()
+
+    @classmethod
+    def _from_pb(cls, pb) -> "RobotCommandResult":
+        return cls(
+            applied_count=pb.applied_count,
+            frame_number=pb.apply_frame_number,
+            errors=tuple((e.index, e.message) for e in pb.errors),
+        )
+
+
 @dataclasses.dataclass(frozen=True)
 class PolicyDescriptorInfo:
     policy_id: str
@@ -149,6 +240,18 @@ class PolicyDescriptorInfo:
 
 SlotId = Union[int, str]
 
+# RobotCommand oneof field -> unary RPC used when no batch is active.
+_COMMAND_RPCS = {
+    "command_float": "SetPolicyCommandFloat",
+    "command_bool": "SetPolicyCommandBool",
+    "motion_graph_input": "SetMotionGraphInput",
+    "motion_graph_trigger": "FireMotionGraphTrigger",
+    "gains": "SetPolicyGains",
+    "clear_gains": "ClearPolicyGains",
+    "policy_active": "SetPolicyActive",
+    "motion_graph_active": "SetMotionGraphActive",
+}
+
 
 class RobotController:
     """
@@ -159,42 +262,54 @@ class RobotController:
     ``RobotController.from_state(session, state)``; slot ids may be passed
     as uint *or* as the slot's inspector name (resolved via GetRobotController
     on first use and then cached).
+
+    Command, gain, slot-activation and motion-graph writes made inside
+    :meth:`buffered` are queued and sent as one ``ApplyRobotCommands`` call.
     """
 
     def __init__(self, session, entity_id: int) -> None:
         self._session = session
         self._entity_id = int(entity_id)
         self._slot_name_cache: dict[str, int] = {}
+        self._command_map_cache: dict[int, Sequence[PolicyCommandIdEntry]] = {}
+        self._batch: Optional[RobotCommandBatch] = None
 
     # ---- construction helpers ----
 
     @classmethod
     def from_state(cls, session, state: RobotControllerState) -> "RobotController":
         rc = cls(session, state.entity_id)
-        for s in state.slots:
-            rc._slot_name_cache[s.name] = s.slot_id
+        rc._cache_state(state)
         return rc
 
     # ---- internals ----
 
-    def _stub(self):
+    def _stub(self, bulk: bool = False):
         client = self._session.engine_client
         if client is None:
             raise RuntimeError("Session is not connected — call session.start()/connect() first.")
-        return client.agent
+        return client.bulk_stub("agent") if bulk else client.agent
 
     def _entity(self) -> "_common_pb2.EntityId":
         return _common_pb2.EntityId(id=self._entity_id)
 
+    def _cache_state(self, state: RobotControllerState) -> None:
+        for s in state.slots:
+            self._slot_name_cache[s.name] = s.slot_id
+            self._command_map_cache[s.slot_id] = s.command_id_map
+
+    def _cached_command_map(self, slot: SlotId) -> Sequence[PolicyCommandIdEntry]:
+        """The slot's command_id_map from the last fetched state (no RPC)."""
+        slot_id = slot if isinstance(slot, int) else self._slot_name_cache.get(slot)
+        return self._command_map_cache.get(slot_id, ())
+
     def _resolve_slot(self, slot: SlotId) -> int:
         if isinstance(slot, int):
             return slot
         if slot in self._slot_name_cache:
             return self._slot_name_cache[slot]
         # Miss — fetch the full state and rebuild the cache.
-        state = self.get_state()
-        for s in state.slots:
-            self._slot_name_cache[s.name] = s.slot_id
+        self.get_state()
         if slot in self._slot_name_cache:
             return self._slot_name_cache[slot]
         raise KeyError(f"PolicySlot with name '{slot}' not found on entity {self._entity_id}")
@@ -204,6 +319,13 @@ class RobotController:
         if not ack.success:
             raise RuntimeError(f"Policy RPC failed: {ack.message}")
 
+    def _send(self, field: str, req) -> None:
+        """Queue ``req`` on the active batch, or send it via its unary RPC."""
+        if self._batch is not None:
+            self._batch._add(field, req)
+            return
+        self._check_ack(getattr(self._stub(), _COMMAND_RPCS[field])(req))
+
     # ---- introspection ----
 
     @property
@@ -217,13 +339,12 @@ class RobotController:
         if not resp.found:
             raise LookupError(f"No RobotControllerComponent on entity {self._entity_id}")
         state = RobotControllerState._from_pb(resp.controller)
-        for s in state.slots:
-            self._slot_name_cache[s.name] = s.slot_id
+        self._cache_state(state)
         return state
 
     def stream_state(self, target_fps: int = 30) -> Iterator[RobotControllerState]:
         req = _agent_pb2.StreamRobotControllerRequest(entity=self._entity(), target_fps=target_fps)
-        for frame in self._stub().StreamRobotController(req):
+        for frame in self._stub(bulk=True).StreamRobotController(req):
             yield RobotControllerState._from_pb(frame)
 
     def stream_slot_state(self, slot: SlotId, target_fps: int = 30) -> Iterator[PolicySlotState]:
@@ -232,7 +353,7 @@ class RobotController:
             slot_id=self._resolve_slot(slot),
             target_fps=target_fps,
         )
-        for frame in self._stub().StreamPolicySlotState(req):
+        for frame in self._stub(bulk=True).StreamPolicySlotState(req):
             yield PolicySlotState._from_pb(frame)
 
     # ---- slot control ----
@@ -241,7 +362,7 @@ class RobotController:
         req = _agent_pb2.SetPolicyActiveRequest(
             entity=self._entity(), slot_id=self._resolve_slot(slot), active=active
         )
-        self._check_ack(self._stub().SetPolicyActive(req))
+        self._send("policy_active", req)
 
     def set_policy_descriptor(self, slot: SlotId, descriptor_path: str) -> None:
         req = _agent_pb2.SetPolicyDescriptorRequest(
@@ -283,7 +404,7 @@ class RobotController:
             command_id=int(command_id),
             value=float(value),
         )
-        self._check_ack(self._stub().SetPolicyCommandFloat(req))
+        self._send("command_float", req)
 
     def set_command_bool(self, slot: SlotId, command_id: int, value: bool) -> None:
         req = _agent_pb2.SetPolicyCommandBoolRequest(
@@ -292,7 +413,7 @@ class RobotController:
             command_id=int(command_id),
             value=bool(value),
         )
-        self._check_ack(self._stub().SetPolicyCommandBool(req))
+        self._send("command_bool", req)
 
     def get_command_float(self, slot: SlotId, command_id: int) -> float:
         req = _agent_pb2.GetPolicyCommandFloatRequest(
@@ -337,14 +458,8 @@ class RobotController:
         req = _agent_pb2.SetPolicyGainsRequest(
             entity=self._entity(), slot_id=self._resolve_slot(slot)
         )
-        for joint_name, fields in overrides.items():
-            ov = req.overrides.add()
-            ov.joint_name = joint_name
-            for key in ("kp", "kd", "effort_limit", "action_scale", "default_pos"):
-                v = fields.get(key)
-                if v is not None:
-                    setattr(ov, key, float(v))
-        self._check_ack(self._stub().SetPolicyGains(req))
+        _add_gain_overrides(req, overrides)
+        self._send("gains", req)
 
     def clear_policy_gains(self, slot: SlotId) -> None:
         """Restore all gain/scale/default values for the slot's joints back
@@ -352,7 +467,7 @@ class RobotController:
         req = _agent_pb2.ClearPolicyGainsRequest(
             entity=self._entity(), slot_id=self._resolve_slot(slot)
         )
-        self._check_ack(self._stub().ClearPolicyGains(req))
+        self._send("clear_gains", req)
 
     # ---- motion graph ----
 
@@ -367,31 +482,16 @@ class RobotController:
 
     def set_motion_graph_active(self, active: bool) -> None:
         req = _agent_pb2.SetMotionGraphActiveRequest(entity=self._entity(), active=active)
-        self._check_ack(self._stub().SetMotionGraphActive(req))
+        self._send("motion_graph_active", req)
 
     def set_motion_graph_input(self, input_id: int, value) -> None:
         """Set a motion-graph input. `value` may be bool / int / float /
         3-tuple-or-list-of-floats. Use :meth:`fire_motion_graph_trigger` for
         pure trigger events."""
-        mg = _agent_pb2.MotionGraphInputValue()
-        if isinstance(value, bool):
-            mg.bool_val = value
-        elif isinstance(value, int):
-            mg.int_val = value
-        elif isinstance(value, float):
-            mg.float_val = value
-        elif isinstance(value, (tuple, list)) and len(value) == 3:
-            mg.vec3_val.x = float(value[0])
-            mg.vec3_val.y = float(value[1])
-            mg.vec3_val.z = float(value[2])
-        else:
-            raise TypeError(
-                f"Unsupported motion graph input value type: {type(value).__name__}"
-            )
         req = _agent_pb2.SetMotionGraphInputRequest(
-            entity=self._entity(), input_id=int(input_id), value=mg
+            entity=self._entity(), input_id=int(input_id), value=_motion_graph_value(value)
         )
-        self._check_ack(self._stub().SetMotionGraphInput(req))
+        self._send("motion_graph_input", req)
 
     def get_motion_graph_input(self, input_id: int, type_hint: str = "float"):
         type_enum = _string_to_command_type(type_hint)
@@ -414,7 +514,7 @@ class RobotController:
         req = _agent_pb2.FireMotionGraphTriggerRequest(
             entity=self._entity(), input_id=int(input_id)
         )
-        self._check_ack(self._stub().FireMotionGraphTrigger(req))
+        self._send("motion_graph_trigger", req)
 
     # ---- runtime diagnostics ----
 
@@ -455,12 +555,53 @@ class RobotController:
 
         Reads go through :meth:`get_command_float`; writes pick the right
         Float vs Bool RPC based on the Python type of the value. The
-        name->id resolution is cached on the view, so tight loops only
-        hit ``GetRobotController`` once."""
+        name->id map is seeded from the controller's cached state, so
+        creating a view per write doesn't add a ``GetRobotController``
+        round trip."""
         return CommandStoreView(self, slot)
 
     # ---- context managers ----
 
+    @contextmanager
+    def buffered(
+        self, batch: Optional["RobotCommandBatch"] = None, *, allow_partial: bool = False
+    ):
+        """Queue writes for the duration of a ``with`` block and send them
+        as one ``ApplyRobotCommands`` call on exit.
+
+        Usage::
+
+            with robot.buffered() as batch:
+                robot.commands('Walker')['vx'] = 0.5
+                robot.set_policy_gains('Walker', {'knee': {'kp': 40.0}})
+            batch.result.frame_number   # tick the writes landed on
+
+        The engine applies the whole batch at the start of the next tick.
+        An exception inside the block discards the queued writes. To
+        coalesce several controllers, pass one shared batch, which flushes
+        when its own ``with`` block exits::
+
+            with RobotCommandBatch(sess) as batch, a.buffered(batch), b.buffered(batch):
+                ...
+
+        Reads (``get_*``) are never buffered and see the pre-flush values.
+        Nesting without a ``batch`` reuses the enclosing one."""
+        if batch is None and self._batch is not None:
+            yield self._batch
+            return
+        own = batch is None
+        if own:
+            batch = RobotCommandBatch(self._session, allow_partial=allow_partial)
+        prior, self._batch = self._batch, batch
+        try:
+            if own:
+                with batch:
+                    yield batch
+            else:
+                yield batch
+        finally:
+            self._batch = prior
+
     @contextmanager
     def policy_slot(self, slot: SlotId, *, active: bool = True):
         """Activate a slot for the duration of a ``with`` block.
@@ -501,6 +642,123 @@ class RobotController:
             self.set_motion_graph_active(prior)
 
 
+# ---------------------------------------------------------------------------
+# Coalesced writes (ApplyRobotCommands).
+# ---------------------------------------------------------------------------
+
+class RobotCommandBatch:
+    """Controller writes queued for a single ``ApplyRobotCommands`` call.
+
+    Usually created by :meth:`RobotController.buffered`. Writes keep their
+    queue order, so the last write to a command wins. Used directly as a
+    context manager it flushes on a clean exit and discards on an exception.
+
+    With ``allow_partial=False`` (default) the engine rejects the whole
+    batch if any write is invalid and :meth:`flush` raises ``RuntimeError``.
+
+    Engines without ``ApplyRobotCommands`` answer UNIMPLEMENTED; the client
+    remembers that and from then on flushes by sending each write through
+    its own unary RPC, in queue order. Those writes may land on different
+    ticks, a failed write stops the flush after the earlier ones were
+    applied (or, with ``allow_partial``, is reported in ``result.errors``),
+    and ``result.frame_number`` is 0.
+    """
+
+    def __init__(self, session, *, allow_partial: bool = False) -> None:
+        self._session = session
+        self.allow_partial = allow_partial
+        self.result: Optional[RobotCommandResult] = None
+        self._commands: List = []
+
+    def __len__(self) -> int:
+        return len(self._commands)
+
+    def _add(self, field: str, req) -> None:
+        self._commands.append(_agent_pb2.RobotCommand(**{field: req}))
+
+    def _take_request(self) -> "_agent_pb2.ApplyRobotCommandsRequest":
+        req = _agent_pb2.ApplyRobotCommandsRequest(
+            commands=self._commands, allow_partial=self.allow_partial
+        )
+        self._commands = []
+        return req
+
+    def _finish(self, resp) -> RobotCommandResult:
+        if not resp.success:
+            raise RuntimeError(f"ApplyRobotCommands failed: {resp.message}")
+        self.result = RobotCommandResult._from_pb(resp)
+        return self.result
+
+    def _stub(self):
+        client = self._session.engine_client
+        if client is None:
+            raise RuntimeError("Session is not connected — call session.start()/connect() first.")
+        return client.agent
+
+    def _unsupported_rpcs(self) -> set:
+        """Per-connection set of AgentService RPCs the engine answered UNIMPLEMENTED."""
+        return self._session.engine_client._unsupported_rpcs
+
+    def _batch_unimplemented(self, error: grpc.RpcError) -> bool:
+        if error.code() != grpc.StatusCode.UNIMPLEMENTED:
+            return False
+        logger.info(
+            "Engine does not implement ApplyRobotCommands; "
+            "falling back to one unary RPC per buffered write"
+        )
+        self._unsupported_rpcs().add("ApplyRobotCommands")
+        return True
+
+    @staticmethod
+    def _unary_calls(req) -> Iterator[Tuple[str, object]]:
+        for cmd in req.commands:
+            field = cmd.WhichOneof("command")
+            yield _COMMAND_RPCS[field], getattr(cmd, field)
+
+    def _unary_ack(self, index: int, ack, errors: list) -> None:
+        if ack.success:
+            return
+        if not self.allow_partial:
+            raise RuntimeError(f"Policy RPC failed for buffered write {index}: {ack.message}")
+        errors.append((index, ack.message))
+
+    def _unary_result(self, count: int, errors: list) -> RobotCommandResult:
+        self.result = RobotCommandResult(
+            applied_count=count - len(errors), frame_number=0, errors=tuple(errors)
+        )
+        return self.result
+
+    def flush(self) -> RobotCommandResult:
+        """Send the queued writes. An empty batch sends nothing."""
+        if not self._commands:
+            return RobotCommandResult(applied_count=0, frame_number=0)
+        req = self._take_request()
+        stub = self._stub()
+        if "ApplyRobotCommands" not in self._unsupported_rpcs():
+            try:
+                return self._finish(stub.ApplyRobotCommands(req))
+            except grpc.RpcError as e:
+                if not self._batch_unimplemented(e):
+                    raise
+        errors: list = []
+        for index, (rpc, cmd_req) in enumerate(self._unary_calls(req)):
+            self._unary_ack(index, getattr(stub, rpc)(cmd_req), errors)
+        return self._unary_result(len(req.commands), errors)
+
+    def discard(self) -> None:
+        """Drop the queued writes without sending them."""
+        self._commands = []
+
+    def __enter__(self) -> "RobotCommandBatch":
+        return self
+
+    def __exit__(self, exc_type, exc, tb) -> None:
+        if exc_type is None:
+            self.flush()
+        else:
+            self.discard()
+
+
 # ---------------------------------------------------------------------------
 # Dict-like view of a slot's policy commands, keyed by name.
 # ---------------------------------------------------------------------------
@@ -519,17 +777,21 @@ class CommandStoreView:
         self._slot = slot
         self._name_to_id: dict[str, int] = {}
         self._name_to_type: dict[str, str] = {}
+        self._set_entries(robot._cached_command_map(slot))
 
     # ---- internals ----
 
+    def _set_entries(self, entries: Sequence[PolicyCommandIdEntry]) -> None:
+        self._name_to_id = {entry.name: entry.id for entry in entries}
+        self._name_to_type = {entry.name: entry.type for entry in entries}
+
     def _refresh(self) -> None:
         state = self._robot.get_state().slot(self._slot)
         if state is None:
             raise KeyError(
                 f"PolicySlot '{self._slot}' not found on entity {self._robot.entity_id}"
             )
-        self._name_to_id = {entry.name: entry.id for entry in state.command_id_map}
-        self._name_to_type = {entry.name: entry.type for entry in state.command_id_map}
+        self._set_entries(state.command_id_map)
 
     def _resolve(self, name: str) -> int:
         if name in self._name_to_id:
@@ -547,6 +809,8 @@ class CommandStoreView:
         return self._robot.get_command_float(self._slot, self._resolve(name))
 
     def __setitem__(self, name: str, value: Union[float, bool]) -> None:
+        # Resolves from the cached map; inside ``robot.buffered()`` the
+        # write itself is queued rather than sent.
         cmd_id = self._resolve(name)
         # ``bool`` is a subclass of ``int`` in Python, so check it first.
         if isinstance(value, bool):
@@ -603,6 +867,61 @@ def list_policy_descriptors(session) -> List[PolicyDescriptorInfo]:
     return [PolicyDescriptorInfo._from_pb(p) for p in resp.policies]
 
 
+def list_policy_inference_batches(session) -> List[PolicyInferenceBatch]:
+    """Batched inference groups of the current tick, across every controller."""
+    client = session.engine_client
+    if client is None:
+        raise RuntimeError("Session is not connected.")
+    resp = client.agent.ListRobotControllers(_agent_pb2.ListRobotControllersRequest())
+    return [PolicyInferenceBatch._from_pb(b) for b in resp.inference_batches]
+
+
+def get_policy_inference_config(session) -> PolicyInferenceConfig:
+    """Scene-wide PolicySlot inference batching / execution-provider settings."""
+    client = session.engine_client
+    if client is None:
+        raise RuntimeError("Session is not connected.")
+    resp = client.agent.GetPolicyInferenceConfig(_agent_pb2.GetPolicyInferenceConfigRequest())
+    if not resp.success:
+        raise RuntimeError(f"GetPolicyInferenceConfig failed: {resp.message}")
+    return PolicyInferenceConfig._from_pb(resp)
+
+
+def set_policy_inference_config(
+    session,
+    batch_across_slots: bool = True,
+    execution_provider: str = "",
+    max_batch_size: int = 0,
+) -> PolicyInferenceConfig:
+    """Configure how the engine schedules PolicySlot inference.
+
+    With ``batch_across_slots`` every active slot sharing a PolicyRegistryEntry
+    runs in one forward pass per tick. The returned config is what the engine
+    applied — ``execution_provider`` may fall back to ``"cpu"`` if the requested
+    one is unavailable.
+    """
+    client = session.engine_client
+    if client is None:
+        raise RuntimeError("Session is not connected.")
+    resp = client.agent.SetPolicyInferenceConfig(
+        _agent_pb2.PolicyInferenceConfig(
+            batch_across_slots=batch_across_slots,
+            execution_provider=execution_provider,
+            max_batch_size=max_batch_size,
+        )
+    )
+    if not resp.success:
+        raise RuntimeError(f"SetPolicyInferenceConfig failed: {resp.message}")
+    applied = PolicyInferenceConfig._from_pb(resp)
+    if execution_provider and applied.execution_provider != execution_provider:
+        logger.warning(
+            "Execution provider %r unavailable; engine is using %r (available: %s)",
+            execution_provider, applied.execution_provider,
+            list(applied.available_execution_providers),
+        )
+    return applied
+
+
 # ---------------------------------------------------------------------------
 # Internal helpers.
 # ---------------------------------------------------------------------------
@@ -620,6 +939,36 @@ _CMD_TYPE_NAMES = {
 _CMD_TYPE_FROM_NAME = {v: k for k, v in _CMD_TYPE_NAMES.items()}
 
 
+def _motion_graph_value(value) -> "_agent_pb2.MotionGraphInputValue":
+    mg = _agent_pb2.MotionGraphInputValue()
+    # ``bool`` is a subclass of ``int`` in Python, so check it first.
+    if isinstance(value, bool):
+        mg.bool_val = value
+    elif isinstance(value, int):
+        mg.int_val = value
+    elif isinstance(value, float):
+        mg.float_val = value
+    elif isinstance(value, (tuple, list)) and len(value) == 3:
+        mg.vec3_val.x = float(value[0])
+        mg.vec3_val.y = float(value[1])
+        mg.vec3_val.z = float(value[2])
+    else:
+        raise TypeError(
+            f"Unsupported motion graph input value type: {type(value).__name__}"
+        )
+    return mg
+
+
+def _add_gain_overrides(req, overrides: Mapping[str, Mapping[str, float]]) -> None:
+    for joint_name, fields in overrides.items():
+        ov = req.overrides.add()
+        ov.joint_name = joint_name
+        for key in ("kp", "kd", "effort_limit", "action_scale", "default_pos"):
+            v = fields.get(key)
+            if v is not None:
+                setattr(ov, key, float(v))
+
+
 def _command_type_to_string(enum_value) -> str:
     return _CMD_TYPE_NAMES.get(enum_value, "float")
 
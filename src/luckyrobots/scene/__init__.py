@@ -3,7 +3,8 @@
 The service exposes the *whole* loaded mjModel/mjData (not just per-agent
 joints/actuators) — model introspection, full ``qpos``/``qvel``/``ctrl``
 reads, ``ctrl`` writes by index/name, ``qpos`` teleports, and live actuator
-``gainprm``/``biasprm`` inspection.
+``gainprm``/``biasprm`` inspection, full-state snapshot/restore, and batched
+ray / height-scan / contact queries.
 """
 
 from .mujoco_scene import (
@@ -13,6 +14,10 @@ from .mujoco_scene import (
     ActuatorGainInfo,
     ModelInfo,
     FullStateSnapshot,
+    SceneSnapshot,
+    RaycastResult,
+    HeightScan,
+    ContactSet,
 )
 
 __all__ = [
@@ -22,4 +27,8 @@ __all__ = [
     "ActuatorGainInfo",
     "ModelInfo",
     "FullStateSnapshot",
+    "SceneSnapshot",
+    "RaycastResult",
+    "HeightScan",
+    "ContactSet",
 ]
@@ -23,6 +23,9 @@ Quick start::
 
         scene.set_control(named={"left_knee_actuator": 0.25})
         scene.set_qpos(indexed={model.joint("torso_z").qpos_adr: 1.05})
+
+        scan = scene.height_scan("pelvis", size=(1.6, 1.0), resolution=0.1)
+        feet = scene.contacts(bodies=["left_ankle_roll_link", "right_ankle_roll_link"])
 """
 
 from __future__ import annotations
@@ -34,6 +37,7 @@ import numpy as np
 
 from ..grpc.generated import common_pb2 as _common_pb2  # noqa: F401  (kept for parity with sibling wrappers)
 from ..grpc.generated import mujoco_scene_pb2 as _ms_pb2
+from ..delta import DeltaArrayDecoder, delta_stream_options
 
 
 # ---------------------------------------------------------------------------
@@ -180,6 +184,10 @@ class ModelInfo:
         raise KeyError(f"No actuator with name '{name_or_index}'")
 
 
+def _index_array(indices) -> Optional[np.ndarray]:
+    return np.array(indices, dtype=np.int64) if len(indices) > 0 else None
+
+
 @dataclasses.dataclass(frozen=True)
 class FullStateSnapshot:
     qpos: np.ndarray              # always float32, 1-D
@@ -196,16 +204,8 @@ class FullStateSnapshot:
         qpos = np.array(state.qpos, dtype=np.float32)
         qvel = np.array(state.qvel, dtype=np.float32)
         ctrl = np.array(state.ctrl, dtype=np.float32)
-        joint_idx = (
-            np.array(resp.included_joint_indices, dtype=np.int64)
-            if len(resp.included_joint_indices) > 0
-            else None
-        )
-        act_idx = (
-            np.array(resp.included_actuator_indices, dtype=np.int64)
-            if len(resp.included_actuator_indices) > 0
-            else None
-        )
+        joint_idx = _index_array(resp.included_joint_indices)
+        act_idx = _index_array(resp.included_actuator_indices)
         return cls(
             qpos=qpos,
             qvel=qvel,
@@ -217,6 +217,104 @@ class FullStateSnapshot:
         )
 
 
+@dataclasses.dataclass(frozen=True)
+class SceneSnapshot:
+    """Handle to a full-state snapshot held in the engine-side pool.
+
+    ``blob`` is the serialized snapshot when it was exported, else None.
+    """
+    handle: int
+    size_bytes: int
+    time: float
+    frame_number: int
+    blob: Optional[bytes] = None
+
+    @classmethod
+    def _from_pb(cls, resp) -> "SceneSnapshot":
+        return cls(
+            handle=int(resp.handle),
+            size_bytes=int(resp.size_bytes),
+            time=float(resp.time),
+            frame_number=int(resp.frame_number),
+            blob=bytes(resp.blob) if resp.blob else None,
+        )
+
+
+@dataclasses.dataclass(frozen=True)
+class RaycastResult:
+    """First hit of each ray in a batch. Arrays are read-only views over the response."""
+    distances: np.ndarray          # (num_rays,) float32, -1 on a miss
+    geom_ids: np.ndarray           # (num_rays,) int32, -1 on a miss
+    points: Optional[np.ndarray]   # (num_rays, 3) float32, NaN on a miss; None unless requested
+    wall_duration_us: int = 0
+
+    @property
+    def hit(self) -> np.ndarray:
+        """(num_rays,) bool mask of rays that hit something."""
+        return self.geom_ids >= 0
+
+    @classmethod
+    def _from_pb(cls, resp) -> "RaycastResult":
+        n = int(resp.num_rays)
+        return cls(
+            distances=np.frombuffer(resp.distances, dtype="<f4"),
+            geom_ids=np.frombuffer(resp.geom_ids, dtype="<i4"),
+            points=np.frombuffer(resp.points, dtype="<f4").reshape(n, 3) if resp.points else None,
+            wall_duration_us=int(resp.wall_duration_us),
+        )
+
+
+@dataclasses.dataclass(frozen=True)
+class HeightScan:
+    """Terrain heights under a body-following ray grid (rows along x, cols along y)."""
+    heights: np.ndarray            # (rows, cols) float32 world z, NaN on a miss
+    body_position: np.ndarray      # (3,) world position of the body when scanned
+    wall_duration_us: int = 0
+
+    @property
+    def relative_heights(self) -> np.ndarray:
+        """Body height above each grid point (the usual locomotion observation)."""
+        return self.body_position[2] - self.heights
+
+    @classmethod
+    def _from_pb(cls, resp) -> "HeightScan":
+        return cls(
+            heights=np.frombuffer(resp.heights, dtype="<f4").reshape(resp.rows, resp.cols),
+            body_position=np.array(resp.body_position, dtype=np.float32),
+            wall_duration_us=int(resp.wall_duration_us),
+        )
+
+
+@dataclasses.dataclass(frozen=True)
+class ContactSet:
+    """Contacts of one mjData, one row per contact."""
+    geom_ids: np.ndarray           # (n, 2) int32
+    body_ids: np.ndarray           # (n, 2) int32
+    positions: np.ndarray          # (n, 3) float32 world frame
+    normals: np.ndarray            # (n, 3) float32, geom 1 -> geom 2
+    distances: np.ndarray          # (n,) float32, negative = penetration
+    forces: Optional[np.ndarray]   # (n, 6) contact-frame force / torque; None unless requested
+
+    def __len__(self) -> int:
+        return int(self.distances.shape[0])
+
+    @classmethod
+    def _from_pb(cls, resp) -> "ContactSet":
+        n = int(resp.num_contacts)
+
+        def rows(data, width, dtype="<f4"):
+            return np.frombuffer(data, dtype=dtype).reshape(n, width)
+
+        return cls(
+            geom_ids=rows(resp.geom_ids, 2, "<i4"),
+            body_ids=rows(resp.body_ids, 2, "<i4"),
+            positions=rows(resp.positions, 3),
+            normals=rows(resp.normals, 3),
+            distances=np.frombuffer(resp.distances, dtype="<f4"),
+            forces=rows(resp.forces, 6) if resp.forces else None,
+        )
+
+
 # ---------------------------------------------------------------------------
 # StateFilter helpers
 # ---------------------------------------------------------------------------
@@ -254,6 +352,117 @@ def _build_state_filter(filter_dict: Optional[Mapping[str, object]]):
     return sf
 
 
+def _full_state_request(
+    filter: Optional[Mapping[str, object]],
+    include_qpos: bool,
+    include_qvel: bool,
+    include_ctrl: bool,
+):
+    """GetFullStateRequest shared by MujocoScene.state and AsyncMujocoScene.state."""
+    req = _ms_pb2.GetFullStateRequest(
+        include_qpos=bool(include_qpos),
+        include_qvel=bool(include_qvel),
+        include_ctrl=bool(include_ctrl),
+    )
+    sf = _build_state_filter(filter)
+    if sf is not None:
+        req.filter.CopyFrom(sf)
+    return req
+
+
+# ---------------------------------------------------------------------------
+# Spatial query requests (MujocoScene methods and StepRequest attachments)
+# ---------------------------------------------------------------------------
+
+def _packed_rows(values, width: int, name: str) -> np.ndarray:
+    arr = np.ascontiguousarray(values, dtype="<f4")
+    if arr.size == 0 or arr.size % width:
+        raise ValueError(f"{name} must have shape (n, {width}), got {np.shape(values)}")
+    return arr.reshape(-1, width)
+
+
+def _geom_group_mask(groups: Optional[Sequence[int]]) -> int:
+    return sum(1 << int(g) for g in groups or ())
+
+
+def _raycast_request(
+    origins,
+    directions,
+    max_distance: float = 0.0,
+    frame_body: Optional[str] = None,
+    geom_groups: Optional[Sequence[int]] = None,
+    exclude_static: bool = False,
+    exclude_body: Optional[str] = None,
+    include_points: bool = False,
+    num_threads: int = 0,
+):
+    """RaycastRequest from (n, 3) origins and (n, 3) or (1, 3) directions."""
+    origins_arr = _packed_rows(origins, 3, "origins")
+    directions_arr = _packed_rows(directions, 3, "directions")
+    if directions_arr.shape[0] not in (1, origins_arr.shape[0]):
+        raise ValueError(
+            f"directions must have 1 or {origins_arr.shape[0]} rows, "
+            f"got {directions_arr.shape[0]}"
+        )
+    return _ms_pb2.RaycastRequest(
+        origins=origins_arr.tobytes(),
+        directions=directions_arr.tobytes(),
+        num_rays=origins_arr.shape[0],
+        max_distance=float(max_distance),
+        frame=_ms_pb2.RAY_FRAME_BODY if frame_body else _ms_pb2.RAY_FRAME_WORLD,
+        frame_body=frame_body or "",
+        geom_group_mask=_geom_group_mask(geom_groups),
+        exclude_static=bool(exclude_static),
+        exclude_body=exclude_body or "",
+        include_points=bool(include_points),
+        num_threads=int(num_threads),
+    )
+
+
+def _height_scan_request(
+    body: str,
+    size: Sequence[float] = (1.6, 1.0),
+    resolution: float = 0.1,
+    offset: Sequence[float] = (0.0, 0.0),
+    ray_start_height: float = 0.0,
+    max_distance: float = 0.0,
+    geom_groups: Optional[Sequence[int]] = None,
+    include_body_subtree: bool = False,
+    num_threads: int = 0,
+):
+    if resolution <= 0:
+        raise ValueError(f"resolution must be > 0, got {resolution}")
+    return _ms_pb2.HeightScanRequest(
+        body=body,
+        size_x=float(size[0]),
+        size_y=float(size[1]),
+        resolution=float(resolution),
+        offset_x=float(offset[0]),
+        offset_y=float(offset[1]),
+        ray_start_height=float(ray_start_height),
+        max_distance=float(max_distance),
+        geom_group_mask=_geom_group_mask(geom_groups),
+        include_body_subtree=bool(include_body_subtree),
+        num_threads=int(num_threads),
+    )
+
+
+def _contacts_request(
+    bodies: Optional[Sequence[str]] = None,
+    include_subtree: bool = True,
+    include_forces: bool = False,
+    include_inactive: bool = False,
+    max_contacts: int = 0,
+):
+    return _ms_pb2.GetContactsRequest(
+        bodies=list(bodies or ()),
+        include_subtree=bool(include_subtree),
+        include_forces=bool(include_forces),
+        include_inactive=bool(include_inactive),
+        max_contacts=int(max_contacts),
+    )
+
+
 # ---------------------------------------------------------------------------
 # MujocoScene — main wrapper
 # ---------------------------------------------------------------------------
@@ -275,13 +484,17 @@ class MujocoScene:
 
     # ---- internals ----
 
-    def _stub(self):
+    def _client(self):
         client = self._session.engine_client
         if client is None:
             raise RuntimeError(
                 "Session is not connected — call session.start()/connect() first."
             )
-        return client.mujoco_scene
+        return client
+
+    def _stub(self, bulk: bool = False):
+        client = self._client()
+        return client.bulk_stub("mujoco_scene") if bulk else client.mujoco_scene
 
     @staticmethod
     def _check_ok(resp) -> None:
@@ -294,7 +507,7 @@ class MujocoScene:
 
     def _ensure_model(self) -> ModelInfo:
         if self._cached_model is None:
-            self.model_info(refresh=True)
+            self.model_info()
         return self._cached_model  # type: ignore[return-value]
 
     def _build_name_caches(self, model: ModelInfo) -> None:
@@ -307,10 +520,15 @@ class MujocoScene:
         """Fetch (and cache) the engine's mjModel summary.
 
         Pass ``refresh=True`` after a scene change to invalidate the cache.
+        With the client's metadata cache enabled, the summary is loaded from
+        disk when the engine's ``model_hash`` matches a stored one.
         """
         if self._cached_model is not None and not refresh:
             return self._cached_model
-        resp = self._stub().GetModelInfo(_ms_pb2.GetModelInfoRequest())
+        client = self._client()
+        if refresh and client.metadata_cache is not None:
+            client.get_engine_fingerprint(refresh=True)
+        resp = client.get_model_info()
         self._check_ok(resp)
         model = ModelInfo._from_pb(resp)
         self._cached_model = model
@@ -344,14 +562,7 @@ class MujocoScene:
         When ``filter`` is ``None`` or empty the request is sent without a
         filter and the response covers the entire model.
         """
-        req = _ms_pb2.GetFullStateRequest(
-            include_qpos=bool(include_qpos),
-            include_qvel=bool(include_qvel),
-            include_ctrl=bool(include_ctrl),
-        )
-        sf = _build_state_filter(filter)
-        if sf is not None:
-            req.filter.CopyFrom(sf)
+        req = _full_state_request(filter, include_qpos, include_qvel, include_ctrl)
         resp = self._stub().GetFullState(req)
         self._check_ok(resp)
         return FullStateSnapshot._from_pb(resp)
@@ -363,10 +574,21 @@ class MujocoScene:
         include_qpos: bool = True,
         include_qvel: bool = True,
         include_ctrl: bool = True,
+        delta: bool = False,
+        keyframe_interval: int = 0,
+        epsilon: float = 0.0,
+        quantization_step: float = 0.0,
     ) -> Iterator[FullStateSnapshot]:
         """Server-streaming variant of :meth:`state`.
 
         Yields :class:`FullStateSnapshot` instances at roughly ``target_fps``.
+
+        With ``delta=True`` the engine sends periodic keyframes and only the
+        entries that changed by more than ``epsilon`` in between (as float32
+        values, or multiples of ``quantization_step`` when it is > 0). Full
+        arrays are rebuilt client-side into buffers reused across frames, so
+        each snapshot's ``qpos`` / ``qvel`` / ``ctrl`` are overwritten by the
+        next one — copy them to keep them.
         """
         req = _ms_pb2.StreamFullStateRequest(
             target_fps=int(target_fps),
@@ -377,13 +599,118 @@ class MujocoScene:
         sf = _build_state_filter(filter)
         if sf is not None:
             req.filter.CopyFrom(sf)
-        for resp in self._stub().StreamFullState(req):
+        if delta:
+            req.delta.CopyFrom(delta_stream_options(keyframe_interval, epsilon, quantization_step))
+            yield from self._decode_delta_stream(self._stub(bulk=True).StreamFullState(req))
+            return
+        for resp in self._stub(bulk=True).StreamFullState(req):
             # Stream RPCs return GetFullStateResponse messages too — they may
             # carry success=False if the engine wants to signal an error mid-stream.
             if not resp.success:
                 raise RuntimeError(resp.message or "StreamFullState reported failure")
             yield FullStateSnapshot._from_pb(resp)
 
+    @staticmethod
+    def _decode_delta_stream(stream) -> Iterator[FullStateSnapshot]:
+        qpos, qvel, ctrl = DeltaArrayDecoder(), DeltaArrayDecoder(), DeltaArrayDecoder()
+        joint_idx = act_idx = None
+        for resp in stream:
+            if not resp.success:
+                raise RuntimeError(resp.message or "StreamFullState reported failure")
+            state = resp.state
+            key = state.keyframe
+            if key:
+                # Filter index maps only travel on keyframes in delta mode.
+                joint_idx = _index_array(resp.included_joint_indices)
+                act_idx = _index_array(resp.included_actuator_indices)
+            yield FullStateSnapshot(
+                qpos=qpos.update(key, state.qpos, state.qpos_delta),
+                qvel=qvel.update(key, state.qvel, state.qvel_delta),
+                ctrl=ctrl.update(key, state.ctrl, state.ctrl_delta),
+                time=float(state.time),
+                included_joint_indices=joint_idx,
+                included_actuator_indices=act_idx,
+                frame_number=int(state.frame_number),
+            )
+
+    # ---- spatial queries ----
+
+    def raycast(
+        self,
+        origins,
+        directions,
+        max_distance: float = 0.0,
+        frame_body: Optional[str] = None,
+        geom_groups: Optional[Sequence[int]] = None,
+        exclude_static: bool = False,
+        exclude_body: Optional[str] = None,
+        include_points: bool = False,
+        num_threads: int = 0,
+    ) -> RaycastResult:
+        """Cast a batch of rays against the live scene in one RPC.
+
+        ``origins`` is ``(n, 3)``; ``directions`` is ``(n, 3)`` or one
+        ``(3,)`` direction shared by every ray. With ``frame_body`` both are
+        relative to that body (e.g. a lidar mount). ``geom_groups`` limits
+        hits to those mjModel geom groups; ``exclude_body`` skips a body's
+        subtree (usually the robot itself). ``max_distance`` of 0 means
+        unlimited.
+        """
+        resp = self._stub().Raycast(_raycast_request(
+            origins, directions, max_distance=max_distance, frame_body=frame_body,
+            geom_groups=geom_groups, exclude_static=exclude_static,
+            exclude_body=exclude_body, include_points=include_points,
+            num_threads=num_threads,
+        ))
+        self._check_ok(resp)
+        return RaycastResult._from_pb(resp)
+
+    def height_scan(
+        self,
+        body: str,
+        size: Sequence[float] = (1.6, 1.0),
+        resolution: float = 0.1,
+        offset: Sequence[float] = (0.0, 0.0),
+        ray_start_height: float = 0.0,
+        max_distance: float = 0.0,
+        geom_groups: Optional[Sequence[int]] = None,
+        include_body_subtree: bool = False,
+        num_threads: int = 0,
+    ) -> HeightScan:
+        """Terrain heights on a ``size`` (x forward, y left) grid that follows ``body``.
+
+        The grid moves with the body's position and yaw; roll and pitch are
+        ignored. The body's own subtree is not hit unless
+        ``include_body_subtree``.
+        """
+        resp = self._stub().HeightScan(_height_scan_request(
+            body, size=size, resolution=resolution, offset=offset,
+            ray_start_height=ray_start_height, max_distance=max_distance,
+            geom_groups=geom_groups, include_body_subtree=include_body_subtree,
+            num_threads=num_threads,
+        ))
+        self._check_ok(resp)
+        return HeightScan._from_pb(resp)
+
+    def contacts(
+        self,
+        bodies: Optional[Sequence[str]] = None,
+        include_subtree: bool = True,
+        include_forces: bool = False,
+        include_inactive: bool = False,
+        max_contacts: int = 0,
+    ) -> ContactSet:
+        """Current contact list, optionally only contacts touching ``bodies``.
+
+        ``include_forces`` also runs ``mj_contactForce`` per contact.
+        """
+        resp = self._stub().GetContacts(_contacts_request(
+            bodies, include_subtree=include_subtree, include_forces=include_forces,
+            include_inactive=include_inactive, max_contacts=max_contacts,
+        ))
+        self._check_ok(resp)
+        return ContactSet._from_pb(resp)
+
     # ---- writes ----
 
     def set_qpos(
@@ -484,3 +811,72 @@ class MujocoScene:
         )
         self._check_ok(resp)
         return resp
+
+    # ---- snapshots ----
+
+    def save_snapshot(
+        self,
+        handle: Union[int, SceneSnapshot] = 0,
+        include_policy_state: bool = True,
+        export: bool = False,
+    ) -> SceneSnapshot:
+        """Capture the full simulation state into the engine-side pool.
+
+        Covers all of mjData (qpos, qvel, act, ctrl, warm-start, contacts,
+        PRNG state) plus PolicyRuntime and motion-graph state, so a later
+        :meth:`restore_snapshot` is a memcpy rather than a scene reload.
+
+        Args:
+            handle: Existing snapshot (or its handle) to overwrite in place.
+                0 allocates a new pool slot.
+            include_policy_state: Also capture PolicyRuntime / motion-graph
+                state. False captures mjData only.
+            export: Return the serialized snapshot in ``SceneSnapshot.blob``
+                for persisting or restoring on another engine.
+        """
+        if isinstance(handle, SceneSnapshot):
+            handle = handle.handle
+        resp = self._stub().SaveSnapshot(
+            _ms_pb2.SaveSnapshotRequest(
+                handle=int(handle),
+                exclude_policy_state=not include_policy_state,
+                export_blob=bool(export),
+            )
+        )
+        self._check_ok(resp)
+        return SceneSnapshot._from_pb(resp)
+
+    def restore_snapshot(self, snapshot: Union[SceneSnapshot, int, bytes]):
+        """Restore a snapshot from the pool (by handle) or from an exported blob.
+
+        As with :meth:`reset`, the first frame recorded afterwards carries the
+        ``post_reset`` flag.
+
+        Args:
+            snapshot: A :class:`SceneSnapshot`, a pool handle, or blob bytes.
+        """
+        if isinstance(snapshot, SceneSnapshot):
+            snapshot = snapshot.handle
+        if isinstance(snapshot, (bytes, bytearray, memoryview)):
+            req = _ms_pb2.RestoreSnapshotRequest(blob=bytes(snapshot))
+        else:
+            req = _ms_pb2.RestoreSnapshotRequest(handle=int(snapshot))
+        resp = self._stub().RestoreSnapshot(req)
+        self._check_ok(resp)
+        return resp
+
+    def release_snapshots(
+        self, *snapshots: Union[SceneSnapshot, int], all: bool = False
+    ) -> int:
+        """Free pool slots. Returns the number of snapshots released.
+
+        Args:
+            *snapshots: Snapshots or handles to release.
+            all: Release every snapshot in the pool.
+        """
+        handles = [s.handle if isinstance(s, SceneSnapshot) else int(s) for s in snapshots]
+        resp = self._stub().ReleaseSnapshots(
+            _ms_pb2.ReleaseSnapshotsRequest(handles=handles, all=bool(all))
+        )
+        self._check_ok(resp)
+        return int(resp.released)
@@ -1,5 +1,6 @@
+import contextlib
 import logging
-from collections.abc import Sequence
+from collections.abc import Mapping, Sequence
 from typing import Any, Optional
 
 from .engine import launch_luckyengine, stop_luckyengine
@@ -22,9 +23,13 @@ class Session:
         self,
         host: str = "127.0.0.1",
         port: int = 50051,
+        *,
+        bulk_connection: bool = False,
     ) -> None:
         self.host = host
         self.port = port
+        # Stream on a second connection (see LuckyEngineClient).
+        self._bulk_connection = bulk_connection
 
         self._engine_client: Optional[LuckyEngineClient] = None
         self._robot_name: Optional[str] = None
@@ -47,6 +52,7 @@ class Session:
         headless: bool = False,
         timeout_s: float = 120.0,
         task_contract: dict | None = None,
+        scene_cache: str | None = None,
     ) -> None:
         """
         Launch LuckyEngine (if needed) and connect to gRPC.
@@ -57,15 +63,20 @@ class Session:
             task: Task name (must exist in `robots.yaml`).
             executable_path: Path to LuckyEngine executable (optional; auto-detected).
             observation_type: Used for validation and optional camera processing.
-            headless: Launch without rendering.
+            headless: Launch as a render-free worker (no window, renderer or
+                editor UI). Only use with non-pixel observation types.
             timeout_s: How long to wait for gRPC server to come up.
             task_contract: Optional task contract dict for engine-side MDP computation.
                 When provided, the engine is configured to compute reward signals
                 and termination flags alongside observations. Pass a dict with
                 observations, rewards, terminations sections — see LuckyEnv or
                 luckylab.contracts.TaskContract.to_dict() for the expected format.
+            scene_cache: Directory of precooked binary scenes shared between
+                workers (see ``EngineProcess.launch``).
         """
+        import time
         self._robot_name = robot
+        launch_start = time.monotonic()
 
         success = launch_luckyengine(
             scene=scene,
@@ -75,6 +86,7 @@ class Session:
             headless=headless,
             auto_play=True,
             grpc_port=self.port,
+            scene_cache=scene_cache,
         )
         if not success:
             logger.error("Failed to launch LuckyEngine")
@@ -84,6 +96,7 @@ class Session:
 
         self.connect(timeout_s=timeout_s, robot=robot)
         self._wait_for_agents_ready(timeout_s=timeout_s)
+        self._log_startup(time.monotonic() - launch_start)
 
         # Negotiate task contract if provided (engine-side reward/termination computation).
         self._negotiated_session = None
@@ -110,12 +123,30 @@ class Session:
                     return
             except Exception:
                 pass
-            time.sleep(1.0)
+            time.sleep(0.1)
         raise RuntimeError(
             f"Agents not ready after {timeout_s}s. "
             "The scene may not have entered Play mode."
         )
 
+    def _log_startup(self, elapsed_s: float) -> None:
+        """Log client-observed and engine-reported startup cost."""
+        try:
+            info = self._engine_client.get_scene_info()
+        except Exception:
+            logger.info("Engine ready in %.2fs", elapsed_s)
+            return
+        logger.info(
+            "Engine ready in %.2fs (engine startup %dms, scene load %dms%s, "
+            "RSS %.0f MiB, %s)",
+            elapsed_s,
+            info["startup_duration_ms"],
+            info["scene_load_duration_ms"],
+            ", cached" if info["scene_cache_hit"] else "",
+            info["resident_memory_bytes"] / (1 << 20),
+            "headless" if info["headless"] else "rendering",
+        )
+
     def connect(self, timeout_s: float = 120.0, robot: Optional[str] = None) -> None:
         """Connect to LuckyEngine gRPC server and cache MuJoCo metadata."""
         if robot is not None:
@@ -127,11 +158,12 @@ class Session:
             host=self.host,
             port=self.port,
             robot_name=self._robot_name,
+            bulk_connection=self._bulk_connection,
         )
         logger.info(
             "Waiting for LuckyEngine gRPC server at %s:%s", self.host, self.port
         )
-        if not self._engine_client.wait_for_server(timeout=timeout_s):
+        if not self._engine_client.wait_for_server(timeout=timeout_s, poll_interval=0.1):
             raise GrpcConnectionError(
                 f"LuckyEngine gRPC server connection timeout after {timeout_s} seconds"
             )
@@ -164,7 +196,7 @@ class Session:
             raise ValueError("Robot name is not set.")
         return client.get_joint_state(robot_name=self._robot_name)
 
-    def configure_cameras(self, cameras: list[dict]) -> None:
+    def configure_cameras(self, cameras: list[dict], pipelined: bool = False) -> None:
         """Configure cameras to capture on every step.
 
         Once configured, every call to step() and reset() will include
@@ -175,9 +207,12 @@ class Session:
                 name: Camera entity name in the scene.
                 width: Desired image width (0 = native resolution).
                 height: Desired image height (0 = native resolution).
+            pipelined: Overlap camera readback with the next physics step;
+                frames then lag the observation by one step (see
+                ``CameraFrame.latency_steps``).
         """
         client = self._require_client()
-        client.configure_cameras(cameras)
+        client.configure_cameras(cameras, pipelined=pipelined)
 
     def list_cameras(self) -> list[dict]:
         """List available cameras in the scene.
@@ -222,6 +257,12 @@ class Session:
         actions: Sequence[float] | None = None,
         agent_name: str = "",
         action_groups: list[dict] | None = None,
+        return_numpy: bool = False,
+        profile: bool = False,
+        state: bool | Mapping[str, Any] | None = None,
+        raycasts: Sequence[Mapping[str, Any]] | None = None,
+        height_scans: Sequence[Mapping[str, Any]] | None = None,
+        contacts: bool | Mapping[str, Any] | None = None,
     ) -> ObservationResponse:
         """
         Synchronous RL step: apply action, wait for physics, return observation.
@@ -235,6 +276,14 @@ class Session:
             agent_name: Agent name (empty = default agent).
             action_groups: Optional list of action group dicts for multi-policy control.
                 Each dict has keys: group_name, actions, action_indices.
+            return_numpy: Return reused numpy buffers (`StepArrays`) instead
+                of an ObservationResponse; see `LuckyEngineClient.step`.
+            profile: Request per-stage engine timings (``obs.step_profile``).
+            state: Attach post-step mjData state (``obs.full_state``);
+                ``True`` or a StateFilter dict. See `LuckyEngineClient.step`.
+            raycasts, height_scans, contacts: Spatial queries answered in
+                the same response (``obs.raycasts`` / ``obs.height_scans`` /
+                ``obs.contacts``). See `LuckyEngineClient.step`.
 
         Returns:
             ObservationResponse with observation after physics step.
@@ -244,6 +293,12 @@ class Session:
             actions=list(actions) if actions is not None else None,
             agent_name=agent_name,
             action_groups=action_groups,
+            return_numpy=return_numpy,
+            profile=profile,
+            state=state,
+            raycasts=raycasts,
+            height_scans=height_scans,
+            contacts=contacts,
         )
 
     def set_simulation_mode(self, mode: str = "fast"):
@@ -263,6 +318,31 @@ class Session:
         """Query the engine's current simulation timing mode."""
         return self._require_client().get_simulation_mode()
 
+    def set_physics_threading(self, num_threads: int = 0, partitioning: str = "auto") -> dict:
+        """Spread physics ticks across a thread pool (see
+        `LuckyEngineClient.set_physics_threading`)."""
+        return self._require_client().set_physics_threading(
+            num_threads=num_threads, partitioning=partitioning
+        )
+
+    def get_physics_threading(self) -> dict:
+        """Query the physics thread pool config and partition count."""
+        return self._require_client().get_physics_threading()
+
+    def set_rpc_qos(self, classes=None, method_classes=None) -> dict:
+        """Configure per-class RPC scheduling (see `LuckyEngineClient.set_rpc_qos`)."""
+        return self._require_client().set_rpc_qos(
+            classes=classes, method_classes=method_classes
+        )
+
+    def get_rpc_qos(self) -> dict:
+        """Query the RPC scheduling config."""
+        return self._require_client().get_rpc_qos()
+
+    def get_rpc_qos_metrics(self, reset: bool = False) -> dict:
+        """Per-class RPC queue-depth and latency metrics."""
+        return self._require_client().get_rpc_qos_metrics(reset=reset)
+
     def enter_play_mode(self):
         """Trigger the editor Edit -> Play transition (no-op in dist builds).
 
@@ -317,29 +397,46 @@ class Session:
         """Return the telemetry vector schema (observation/action names + nq/nu)."""
         return self._require_client().get_telemetry_schema()
 
-    def stream_telemetry(self, target_fps: int = 30):
-        """Iterate over server-streamed TelemetryFrame protos."""
-        return self._require_client().stream_telemetry(target_fps=target_fps)
+    def stream_telemetry(self, target_fps: int = 30, delta: bool = False, **delta_options):
+        """Iterate over server-streamed TelemetryFrame protos (or reconstructed
+        TelemetrySamples with ``delta=True``; see `LuckyEngineClient.stream_telemetry`)."""
+        return self._require_client().stream_telemetry(
+            target_fps=target_fps, delta=delta, **delta_options
+        )
+
+    def stream_synchronized(self, sources, decimation: int = 1, max_in_flight: int = 1):
+        """Lock-step multi-source stream (see `LuckyEngineClient.stream_synchronized`)."""
+        return self._require_client().stream_synchronized(
+            sources, decimation=decimation, max_in_flight=max_in_flight
+        )
 
     def get_viewport_info(self) -> dict:
         """List available viewports plus the current stream config."""
         return self._require_client().get_viewport_info()
 
     def stream_viewport(self, viewport_name: str = "Main", target_fps: int = 30,
-                        width: int = 0, height: int = 0, format: str = "raw"):
+                        width: int = 0, height: int = 0, format: str = "raw",
+                        keyframe_interval: int = 0, bitrate_kbps: int = 0,
+                        require_hardware: bool = False, decode: bool = False):
         """Iterate over server-streamed ImageFrame protos for a viewport."""
         return self._require_client().stream_viewport(
             viewport_name=viewport_name, target_fps=target_fps,
             width=width, height=height, format=format,
+            keyframe_interval=keyframe_interval, bitrate_kbps=bitrate_kbps,
+            require_hardware=require_hardware, decode=decode,
         )
 
     def stream_camera(self, name: Optional[str] = None, entity_id: Optional[int] = None,
                       target_fps: int = 30, width: int = 0, height: int = 0,
-                      format: str = "raw"):
+                      format: str = "raw", keyframe_interval: int = 0,
+                      bitrate_kbps: int = 0, require_hardware: bool = False,
+                      decode: bool = False):
         """Iterate over server-streamed ImageFrame protos for a camera."""
         return self._require_client().stream_camera(
             name=name, entity_id=entity_id, target_fps=target_fps,
             width=width, height=height, format=format,
+            keyframe_interval=keyframe_interval, bitrate_kbps=bitrate_kbps,
+            require_hardware=require_hardware, decode=decode,
         )
 
     def stream_joint_state(self, robot_name: Optional[str] = None):
@@ -350,6 +447,7 @@ class Session:
         self,
         agent_name: str = "",
         randomization_cfg: Optional[Any] = None,
+        return_numpy: bool = False,
     ) -> ObservationResponse:
         """
         Reset the agent and return a fresh observation.
@@ -359,6 +457,8 @@ class Session:
             randomization_cfg: Optional domain randomization config for this reset.
                 Use this to randomize physics parameters (friction, mass, etc.)
                 at the start of each episode for sim-to-real transfer.
+            return_numpy: Return the post-reset observation as `StepArrays`
+                (see `LuckyEngineClient.step`).
 
         Returns:
             ObservationResponse after reset.
@@ -386,7 +486,9 @@ class Session:
         # Query the agent schema for the correct action size (cached after first call).
         schema = client.get_agent_schema(agent_name=agent_name)
         action_size = schema.schema.action_size if schema.schema else 12
-        return client.step(actions=[0.0] * action_size, agent_name=agent_name)
+        return client.step(
+            actions=[0.0] * action_size, agent_name=agent_name, return_numpy=return_numpy
+        )
 
     def report_progress(self, **kwargs) -> None:
         """Report evaluation/training progress to the engine for UI display.
@@ -442,6 +544,20 @@ class Session:
         from .robots.robot_controller import list_policy_descriptors
         return list_policy_descriptors(self)
 
+    def set_policy_inference_config(self, batch_across_slots: bool = True,
+                                    execution_provider: str = "", max_batch_size: int = 0):
+        """Configure batched PolicySlot inference (see robots.set_policy_inference_config)."""
+        from .robots.robot_controller import set_policy_inference_config
+        return set_policy_inference_config(
+            self, batch_across_slots=batch_across_slots,
+            execution_provider=execution_provider, max_batch_size=max_batch_size,
+        )
+
+    def list_policy_inference_batches(self):
+        """Batched inference groups of the current tick, with their latency."""
+        from .robots.robot_controller import list_policy_inference_batches
+        return list_policy_inference_batches(self)
+
     def get_robot_controller(self, entity_id: int):
         """Fetch a single robot controller's live state by entity id."""
         from .robots.robot_controller import RobotController
@@ -473,7 +589,9 @@ class Session:
         )
 
     def stream_full_state(self, filter=None, target_fps: int = 30, **include):
-        """Forward to `MujocoScene.stream_state(...)` (returns iterator)."""
+        """Forward to `MujocoScene.stream_state(...)` (returns iterator).
+
+        Keyword arguments (``include_*``, ``delta``, ``epsilon``, ...) pass through."""
         return self.scene.stream_state(filter=filter, target_fps=target_fps, **include)
 
     def set_qpos(self, bulk=None, indexed=None, *, force: bool = False,
@@ -497,6 +615,21 @@ class Session:
         """Forward to `MujocoScene.actuator_gains()`."""
         return self.scene.actuator_gains()
 
+    def save_snapshot(self, handle=0, *, include_policy_state: bool = True,
+                      export: bool = False):
+        """Forward to `MujocoScene.save_snapshot(...)`."""
+        return self.scene.save_snapshot(
+            handle, include_policy_state=include_policy_state, export=export,
+        )
+
+    def restore_snapshot(self, snapshot):
+        """Forward to `MujocoScene.restore_snapshot(snapshot)`."""
+        return self.scene.restore_snapshot(snapshot)
+
+    def release_snapshots(self, *snapshots, all: bool = False):
+        """Forward to `MujocoScene.release_snapshots(...)`."""
+        return self.scene.release_snapshots(*snapshots, all=all)
+
     # ── Validation + reflection forwards ────────────────────────────────────
     def validate(self):
         """Run startup validation; returns list of `ValidationWarning`."""
@@ -516,6 +649,32 @@ class Session:
         from .recording import record_session
         return record_session(self)
 
+    def start_recording(self, output_dir: str, **options) -> dict:
+        """Start the engine-side dataset recorder (see `LuckyEngineClient.start_recording`)."""
+        return self._require_client().start_recording(output_dir, **options)
+
+    def stop_recording(self, recording_id: str = "") -> dict:
+        """Flush and finalize an engine-side recording; returns its final status."""
+        return self._require_client().stop_recording(recording_id)
+
+    def get_recording_status(self, recording_id: str = "") -> dict:
+        """Progress / drop counters of an engine-side recording."""
+        return self._require_client().get_recording_status(recording_id)
+
+    @contextlib.contextmanager
+    def record_dataset(self, output_dir: str, **options):
+        """Engine-side recording for the duration of a ``with`` block.
+
+        Unlike `record`, which logs this client's RPCs, the engine writes the
+        dataset itself. The yielded dict holds ``recording_id`` / ``output_dir``
+        and is updated with the final status on exit.
+        """
+        rec = self.start_recording(output_dir, **options)
+        try:
+            yield rec
+        finally:
+            rec.update(self.stop_recording(rec["recording_id"]))
+
     def policy_monitor(self, entity_id: int, target_fps: int = 30):
         """Construct a `PolicyMonitor` for the given robot entity."""
         from .monitor import PolicyMonitor
@@ -0,0 +1,126 @@
+"""Client side of the shared-memory Step transport.
+
+On a same-host connection the engine can write each Step's observation vector
+and camera pixels into a ring of slots in an OS shared-memory region, sending
+only slot offsets and a sequence number over gRPC. ``SharedMemoryRing`` maps
+that region and hands out numpy / memoryview views over it — no copies.
+
+Views are only valid until the engine reuses the slot (``slot_count - 1``
+further steps). Copy anything that must outlive that window.
+
+Usage (via LuckyEngineClient, which owns the ring):
+    client.enable_shared_memory(slot_count=4)
+    obs = client.step(actions)
+    obs.observation_array        # np.float32 view into the ring
+    obs.camera_frames[0].array   # (H, W, C) uint8 view into the ring
+"""
+
+from __future__ import annotations
+
+import logging
+import struct
+from multiprocessing import shared_memory
+from typing import Optional
+
+import numpy as np
+
+logger = logging.getLogger("luckyrobots.shm")
+
+_LOCAL_HOSTS = {"127.0.0.1", "localhost", "::1"}
+
+
+def is_local_host(host: str) -> bool:
+    """True if ``host`` refers to this machine (loopback)."""
+    return host in _LOCAL_HOSTS or host.startswith("127.")
+
+
+def _attach(name: str) -> shared_memory.SharedMemory:
+    """Attach to an existing segment without taking ownership of it.
+
+    Before Python 3.13 the resource tracker registers attached segments too
+    and unlinks them at interpreter exit, which would tear the region out
+    from under the engine. Opt out of tracking where supported, otherwise
+    unregister by hand.
+    """
+    try:
+        return shared_memory.SharedMemory(name=name, create=False, track=False)
+    except TypeError:
+        shm = shared_memory.SharedMemory(name=name, create=False)
+        try:
+            from multiprocessing import resource_tracker
+
+            resource_tracker.unregister(shm._name, "shared_memory")  # type: ignore[attr-defined]
+        except Exception:  # pragma: no cover - platform without a tracker
+            pass
+        return shm
+
+
+class SharedMemoryRing:
+    """A mapped engine-owned shared-memory ring of Step payload slots."""
+
+    def __init__(
+        self,
+        transport_id: str,
+        region_name: str,
+        region_size: int,
+        slot_count: int,
+        slot_size: int,
+    ) -> None:
+        self.transport_id = transport_id
+        self.region_name = region_name
+        self.slot_count = int(slot_count)
+        self.slot_size = int(slot_size)
+
+        self._shm: Optional[shared_memory.SharedMemory] = _attach(region_name)
+        if self._shm.size < region_size:
+            size = self._shm.size
+            self.close()
+            raise RuntimeError(
+                f"Shared-memory region {region_name!r} is {size} bytes, "
+                f"engine advertised {region_size}"
+            )
+        self._buf = self._shm.buf
+
+    @classmethod
+    def _from_pb(cls, resp) -> "SharedMemoryRing":
+        return cls(
+            transport_id=resp.transport_id,
+            region_name=resp.region_name,
+            region_size=int(resp.region_size),
+            slot_count=int(resp.slot_count),
+            slot_size=int(resp.slot_size),
+        )
+
+    @property
+    def closed(self) -> bool:
+        return self._shm is None
+
+    def sequence_at(self, offset: int) -> int:
+        """Read the little-endian uint64 sequence stamp at ``offset``."""
+        return struct.unpack_from("<Q", self._buf, offset)[0]
+
+    def is_current(self, slot) -> bool:
+        """True if ``slot`` (a SharedMemorySlot) has not been overwritten yet."""
+        return self.sequence_at(int(slot.sequence_offset)) == int(slot.sequence)
+
+    def floats(self, offset: int, count: int) -> np.ndarray:
+        """Read-only float32 view of ``count`` elements at byte ``offset``."""
+        arr = np.frombuffer(self._buf, dtype="<f4", count=int(count), offset=int(offset))
+        arr.flags.writeable = False
+        return arr
+
+    def bytes_view(self, offset: int, size: int) -> memoryview:
+        """Read-only memoryview of ``size`` bytes at ``offset``."""
+        return self._buf[int(offset) : int(offset) + int(size)].toreadonly()
+
+    def close(self) -> None:
+        """Unmap the region. The engine owns (and unlinks) the segment."""
+        if self._shm is None:
+            return
+        self._buf = None
+        try:
+            self._shm.close()
+        except BufferError:
+            # Callers still hold views; the mapping is released when they go.
+            logger.debug("Shared-memory views still alive; deferring unmap of %s", self.region_name)
+        self._shm = None
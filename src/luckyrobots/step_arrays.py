@@ -0,0 +1,94 @@
+"""Numpy decode of Step responses (``step(return_numpy=True)``).
+
+The default step path builds a pydantic ObservationResponse per step: lists
+of floats, four dicts and CameraFrame dataclasses. For small models that
+Python work costs more than the physics step. ``StepArrayDecoder`` instead
+copies the response's repeated fields into numpy buffers that it reuses
+from step to step when shapes are stable (a length change re-allocates),
+and returns them in a ``StepArrays`` tuple. With a shared-memory session
+the observation is a view into the ring; with a packed session the
+observation and rewards are views into the payload. Each step still
+allocates the small ``StepArrays`` tuple itself.
+
+The arrays are the decoder's buffers: the next step overwrites them, so
+``.copy()`` anything that must outlive it.
+"""
+
+from __future__ import annotations
+
+from typing import List, NamedTuple, Optional, Sequence
+
+import numpy as np
+
+
+class StepArrays(NamedTuple):
+    """One decoded step. Arrays are reused buffers (see module docs)."""
+
+    observation: np.ndarray      # (obs_dim,) float32
+    actions: np.ndarray          # (action_dim,) float32
+    rewards: np.ndarray          # (len(reward_terms),) float32
+    terminated: bool
+    truncated: bool
+    frame_number: int
+    timestamp_ms: int
+    reward_terms: List[str]
+
+
+class StepArrayDecoder:
+    """Decodes StepResponses of one agent into preallocated numpy buffers.
+
+    Args:
+        reward_terms: Column order of ``rewards``. Empty = the sorted keys of
+            the first response's ``reward_signals`` map.
+    """
+
+    def __init__(self, reward_terms: Sequence[str] = ()) -> None:
+        self.reward_terms: List[str] = list(reward_terms)
+        self._observation = np.zeros(0, dtype=np.float32)
+        self._actions = np.zeros(0, dtype=np.float32)
+        self._rewards = np.zeros(len(self.reward_terms), dtype=np.float32)
+
+    @staticmethod
+    def _fill(buf: np.ndarray, values) -> np.ndarray:
+        n = len(values)
+        if buf.shape[0] != n:
+            buf = np.empty(n, dtype=np.float32)
+        if n:
+            buf[:] = values
+        return buf
+
+    def decode(
+        self,
+        resp,
+        observation: Optional[np.ndarray] = None,
+        rewards: Optional[np.ndarray] = None,
+    ) -> StepArrays:
+        """Decode ``resp``.
+
+        ``observation`` / ``rewards`` override the proto fields with arrays
+        already decoded from a shared-memory slot or packed buffer.
+        """
+        frame = resp.observation
+        if observation is None:
+            observation = self._observation = self._fill(self._observation, frame.observations)
+        self._actions = self._fill(self._actions, frame.actions)
+
+        if rewards is None:
+            signals = resp.reward_signals
+            if not self.reward_terms and signals:
+                self.reward_terms = sorted(signals)
+                self._rewards = np.zeros(len(self.reward_terms), dtype=np.float32)
+            rewards = self._rewards
+            for i, name in enumerate(self.reward_terms):
+                rewards[i] = signals.get(name, 0.0)
+
+        return StepArrays(
+            observation=observation,
+            actions=self._actions,
+            rewards=rewards,
+            terminated=resp.terminated,
+            truncated=resp.truncated,
+            frame_number=frame.frame_number,
+            timestamp_ms=frame.timestamp_ms,
+            reward_terms=self.reward_terms,
+        )
@@ -0,0 +1,289 @@
+"""Persistent bidirectional step channels over AgentService.StepStream.
+
+Unary ``Step`` pays HTTP/2 stream setup and a full request/response cycle per
+tick. A step stream keeps one long-lived stream per agent: each request yields
+exactly one response, in order, so a high-rate control loop is just
+``send`` / ``recv`` on an open call. ``max_in_flight > 1`` pipelines actions —
+the next action can be on the wire while the engine is still stepping the
+previous one.
+
+Usage (sync):
+    with client.step_stream(max_in_flight=2) as stream:
+        stream.send(action0)
+        for t in range(10_000):
+            stream.send(policy_guess(t))       # pipelined
+            obs = stream.recv()                # observation for the oldest send
+
+Usage (asyncio):
+    async with sess.step_stream() as stream:
+        obs = await stream.step(actions)
+
+Every response must echo the sequence number of the oldest unread request;
+``recv`` raises (and closes the stream) on a dropped or reordered response
+rather than pairing an observation with the wrong action.
+"""
+
+from __future__ import annotations
+
+import logging
+import queue
+from collections import deque
+from typing import TYPE_CHECKING, Any
+
+from .models import ObservationResponse
+
+if TYPE_CHECKING:  # pragma: no cover - typing only
+    from .async_session import AsyncSession
+    from .client import LuckyEngineClient
+
+logger = logging.getLogger("luckyrobots.step_stream")
+
+_CLOSE = object()
+
+
+def _check_sequence(sent: deque, resp, name: str) -> None:
+    expected = sent.popleft()
+    if resp.sequence != expected:
+        raise RuntimeError(
+            f"{name} response out of order: expected sequence {expected}, "
+            f"got {resp.sequence}"
+        )
+
+
+class StepStream:
+    """Synchronous step channel bound to a LuckyEngineClient.
+
+    Created via :meth:`LuckyEngineClient.step_stream`. Requests reuse the
+    client's camera configuration and shared-memory transport, and
+    responses decode to the same ObservationResponse as ``client.step()``.
+    """
+
+    def __init__(
+        self,
+        client: "LuckyEngineClient",
+        agent_name: str = "",
+        max_in_flight: int = 1,
+        step_timeout_s: float = 0.0,
+    ) -> None:
+        if max_in_flight < 1:
+            raise ValueError(f"max_in_flight must be >= 1, got {max_in_flight}")
+
+        self._client = client
+        self._agent_name = agent_name
+        self._max_in_flight = int(max_in_flight)
+        self._step_timeout_s = float(step_timeout_s)
+
+        self._requests: "queue.Queue[Any]" = queue.Queue()
+        self._next_sequence = 1
+        # Sequence numbers sent and not yet received, oldest first.
+        self._sent: deque[int] = deque()
+        self._closed = False
+        self._responses = client.agent.StepStream(self._request_iter())
+
+    def _request_iter(self):
+        while True:
+            req = self._requests.get()
+            if req is _CLOSE:
+                return
+            yield req
+
+    @property
+    def in_flight(self) -> int:
+        """Number of steps sent whose observations have not been read yet."""
+        return len(self._sent)
+
+    def send(
+        self,
+        actions: list[float] | None = None,
+        action_groups: list[dict] | None = None,
+    ) -> int:
+        """Queue one step. Returns the sequence number its response must echo.
+
+        Raises:
+            RuntimeError: If the stream is closed or ``max_in_flight`` unread
+                steps are already outstanding (call recv() first).
+        """
+        if self._closed:
+            raise RuntimeError("StepStream is closed")
+        if self.in_flight >= self._max_in_flight:
+            raise RuntimeError(
+                f"StepStream has {self.in_flight} unread steps (max_in_flight="
+                f"{self._max_in_flight}); call recv() before sending more"
+            )
+
+        if hasattr(actions, "tolist"):
+            actions = actions.tolist()
+        sequence = self._next_sequence
+        self._next_sequence += 1
+        self._requests.put(
+            self._client._build_step_request(
+                actions=actions,
+                agent_name=self._agent_name,
+                step_timeout_s=self._step_timeout_s,
+                action_groups=action_groups,
+                sequence=sequence,
+            )
+        )
+        self._sent.append(sequence)
+        return sequence
+
+    def recv(self) -> ObservationResponse:
+        """Block until the observation for the oldest outstanding step arrives.
+
+        Raises:
+            RuntimeError: If the server ended the stream, or the response does
+                not echo the oldest outstanding sequence number (the stream is
+                closed, since every later pairing would be wrong too).
+        """
+        if not self._sent:
+            raise RuntimeError("StepStream.recv() called with no step in flight")
+        try:
+            resp = next(self._responses)
+        except StopIteration:
+            self._closed = True
+            raise RuntimeError("StepStream ended by the server") from None
+        try:
+            _check_sequence(self._sent, resp, "StepStream")
+        except RuntimeError:
+            self.close()
+            raise
+        return self._client._observation_from_step_response(resp, self._agent_name)
+
+    def step(
+        self,
+        actions: list[float] | None = None,
+        action_groups: list[dict] | None = None,
+    ) -> ObservationResponse:
+        """Lock-step convenience: send one action and wait for its observation.
+
+        With steps already in flight this returns the *oldest* pending
+        observation, exactly like ``recv()``.
+        """
+        self.send(actions, action_groups=action_groups)
+        return self.recv()
+
+    def close(self) -> None:
+        """Half-close the request side and cancel the call."""
+        if self._closed:
+            return
+        self._closed = True
+        self._requests.put(_CLOSE)
+        try:
+            self._responses.cancel()
+        except Exception as e:
+            logger.debug("StepStream cancel failed: %s", e)
+
+    def __enter__(self) -> "StepStream":
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb) -> bool:
+        self.close()
+        return False
+
+
+class AsyncStepStream:
+    """Asyncio step channel bound to an AsyncSession.
+
+    Created via :meth:`AsyncSession.step_stream`. Uses the aio
+    stream-stream call's ``write`` / ``read`` directly, so no helper thread
+    is involved. Requests and responses go through the session's
+    ``LuckyEngineClient`` codec, so action groups, negotiated reward order
+    and packed layouts behave as in :class:`StepStream`.
+    """
+
+    def __init__(
+        self,
+        session: "AsyncSession",
+        agent_name: str = "",
+        max_in_flight: int = 1,
+        step_timeout_s: float = 0.0,
+    ) -> None:
+        if max_in_flight < 1:
+            raise ValueError(f"max_in_flight must be >= 1, got {max_in_flight}")
+
+        self._codec = session._codec
+        self._agent_name = agent_name
+        self._max_in_flight = int(max_in_flight)
+        self._step_timeout_s = float(step_timeout_s)
+        self._next_sequence = 1
+        self._sent: deque[int] = deque()
+        self._closed = False
+        self._call = session.agent.StepStream()
+
+    @property
+    def in_flight(self) -> int:
+        """Number of steps sent whose observations have not been read yet."""
+        return len(self._sent)
+
+    async def send(
+        self,
+        actions: list[float] | None = None,
+        action_groups: list[dict] | None = None,
+    ) -> int:
+        """Write one step. Returns the sequence number its response must echo."""
+        if self._closed:
+            raise RuntimeError("AsyncStepStream is closed")
+        if self.in_flight >= self._max_in_flight:
+            raise RuntimeError(
+                f"AsyncStepStream has {self.in_flight} unread steps (max_in_flight="
+                f"{self._max_in_flight}); await recv() before sending more"
+            )
+
+        if hasattr(actions, "tolist"):
+            actions = actions.tolist()
+        sequence = self._next_sequence
+        self._next_sequence += 1
+        await self._call.write(
+            self._codec._build_step_request(
+                actions=actions,
+                agent_name=self._agent_name,
+                step_timeout_s=self._step_timeout_s,
+                action_groups=action_groups,
+                sequence=sequence,
+            )
+        )
+        self._sent.append(sequence)
+        return sequence
+
+    async def recv(self) -> ObservationResponse:
+        """Await the observation for the oldest outstanding step (see :meth:`StepStream.recv`)."""
+        import grpc.aio as grpc_aio
+
+        if not self._sent:
+            raise RuntimeError("AsyncStepStream.recv() called with no step in flight")
+        resp = await self._call.read()
+        if resp is grpc_aio.EOF:
+            self._closed = True
+            raise RuntimeError("AsyncStepStream ended by the server")
+        try:
+            _check_sequence(self._sent, resp, "AsyncStepStream")
+        except RuntimeError:
+            await self.close()
+            raise
+        return self._codec._observation_from_step_response(resp, self._agent_name)
+
+    async def step(
+        self,
+        actions: list[float] | None = None,
+        action_groups: list[dict] | None = None,
+    ) -> ObservationResponse:
+        """Lock-step convenience: send one action and await its observation."""
+        await self.send(actions, action_groups=action_groups)
+        return await self.recv()
+
+    async def close(self) -> None:
+        """Half-close the request side and cancel the call."""
+        if self._closed:
+            return
+        self._closed = True
+        try:
+            await self._call.done_writing()
+        except Exception as e:
+            logger.debug("AsyncStepStream done_writing failed: %s", e)
+        self._call.cancel()
+
+    async def __aenter__(self) -> "AsyncStepStream":
+        return self
+
+    async def __aexit__(self, *exc_info) -> None:
+        await self.close()
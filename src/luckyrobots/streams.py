@@ -5,6 +5,13 @@ Combines N concurrent streams (e.g. StreamRobotController + StreamFullState
 dataset collection where you want each yielded item to contain the latest
 update from each source as of a common timestamp.
 
+``StreamMultiplexer`` merges client-side on a wall-clock cadence, so its
+sources are only approximately aligned. When every item must come from the
+same physics tick, use :class:`SynchronizedStream` (``StreamSynchronized``
+RPC, via ``LuckyEngineClient.stream_synchronized``) instead: the engine
+captures all sources at one frame_number every N ticks and skips frames the
+client can't read rather than sending them to be dropped.
+
 Usage:
     from luckyrobots.streams import StreamMultiplexer
     mux = StreamMultiplexer()
@@ -20,7 +27,13 @@ import logging
 import queue
 import threading
 import time
-from typing import Any, Dict, Iterable, Iterator, List, Optional
+from dataclasses import dataclass, field
+from typing import Any, Dict, Iterable, Iterator, List, Mapping, Optional
+
+from .client import _camera_frame_from_pb
+from .grpc.generated import agent_pb2, camera_pb2, common_pb2, mujoco_scene_pb2
+from .robots.robot_controller import RobotControllerState
+from .scene.mujoco_scene import FullStateSnapshot, _build_state_filter
 
 logger = logging.getLogger("luckyrobots.streams")
 
@@ -133,3 +146,149 @@ class StreamMultiplexer:
                 t.join(timeout=2.0)
             except Exception:
                 pass
+
+
+# ---------------------------------------------------------------------------
+# Server-side lock-step streams (StreamSynchronized)
+# ---------------------------------------------------------------------------
+
+
+def camera_source(
+    name: Optional[str] = None,
+    entity_id: Optional[int] = None,
+    width: int = 0,
+    height: int = 0,
+    format: str = "raw",
+) -> camera_pb2.StreamCameraRequest:
+    """StreamSynchronized camera source, by camera name or entity id."""
+    if (name is None) == (entity_id is None):
+        raise ValueError("Pass exactly one of `name` or `entity_id`.")
+    if format.lower() not in ("raw", "jpeg"):
+        raise ValueError(f"Synchronized camera sources support raw/jpeg, got {format!r}")
+    req = camera_pb2.StreamCameraRequest(width=width, height=height, format=format)
+    if entity_id is not None:
+        req.id.CopyFrom(common_pb2.EntityId(id=entity_id))
+    else:
+        req.name = name
+    return req
+
+
+def full_state_source(
+    filter: Optional[Mapping[str, object]] = None,
+    include_qpos: bool = True,
+    include_qvel: bool = True,
+    include_ctrl: bool = True,
+) -> mujoco_scene_pb2.StreamFullStateRequest:
+    """StreamSynchronized full-state source (same filter dict as ``MujocoScene.state``)."""
+    req = mujoco_scene_pb2.StreamFullStateRequest(
+        include_qpos=include_qpos, include_qvel=include_qvel, include_ctrl=include_ctrl
+    )
+    sf = _build_state_filter(filter)
+    if sf is not None:
+        req.filter.CopyFrom(sf)
+    return req
+
+
+def robot_controller_source(entity_id: int) -> agent_pb2.StreamRobotControllerRequest:
+    """StreamSynchronized RobotController summary source."""
+    return agent_pb2.StreamRobotControllerRequest(entity=common_pb2.EntityId(id=entity_id))
+
+
+_SYNC_SOURCE_FIELDS = {
+    camera_pb2.StreamCameraRequest: "camera",
+    mujoco_scene_pb2.StreamFullStateRequest: "full_state",
+    agent_pb2.StreamRobotControllerRequest: "robot_controller",
+}
+
+
+def build_synchronized_request(
+    sources: Mapping[str, Any], decimation: int = 1, max_in_flight: int = 1
+) -> agent_pb2.StreamSynchronizedRequest:
+    """Build a StreamSynchronizedRequest from ``{name: source request}``."""
+    if not sources:
+        raise ValueError("StreamSynchronized needs at least one source")
+    if decimation < 1 or max_in_flight < 1:
+        raise ValueError("decimation and max_in_flight must be >= 1")
+    req = agent_pb2.StreamSynchronizedRequest(decimation=decimation, max_in_flight=max_in_flight)
+    for name, source in sources.items():
+        field_name = _SYNC_SOURCE_FIELDS.get(type(source))
+        if field_name is None:
+            raise TypeError(
+                f"Source {name!r} must be a StreamCameraRequest, StreamFullStateRequest or "
+                f"StreamRobotControllerRequest (see camera_source() etc.), got {type(source).__name__}"
+            )
+        sub = req.streams.add(name=name)
+        getattr(sub, field_name).CopyFrom(source)
+    return req
+
+
+@dataclass(frozen=True)
+class SyncFrame:
+    """Every requested source captured at one physics ``frame_number``.
+
+    ``payloads`` maps source name to a :class:`CameraFrame`,
+    :class:`FullStateSnapshot` or :class:`RobotControllerState`; sources that
+    failed this tick are absent from ``payloads`` and listed in ``errors``.
+    """
+    frame_number: int
+    sim_time: float
+    timestamp_ms: int
+    payloads: Dict[str, Any]
+    skipped_since_last: int = 0
+    errors: Dict[str, str] = field(default_factory=dict)
+
+    def __getitem__(self, name: str) -> Any:
+        return self.payloads[name]
+
+
+class SynchronizedStream:
+    """Iterator over a StreamSynchronized call, decoding each payload.
+
+    Attributes:
+        frames_sent, frames_skipped, frames_dropped: Engine-side counters
+            from the latest frame (see ``SyncStreamStats``).
+    """
+
+    def __init__(self, frames: Iterable[Any]) -> None:
+        self._frames = frames
+        self.frames_sent = 0
+        self.frames_skipped = 0
+        self.frames_dropped = 0
+
+    def __iter__(self) -> Iterator[SyncFrame]:
+        for frame in self._frames:
+            yield self.decode(frame)
+
+    def decode(self, frame) -> SyncFrame:
+        """Decode one ``SynchronizedFrame`` proto."""
+        payloads: Dict[str, Any] = {}
+        errors: Dict[str, str] = {}
+        for p in frame.payloads:
+            kind = p.WhichOneof("payload")
+            if p.error or kind is None:
+                errors[p.name] = p.error or "no payload"
+            elif kind == "camera":
+                payloads[p.name] = _camera_frame_from_pb(p.name, p.camera, 0, ())
+            elif kind == "full_state":
+                payloads[p.name] = FullStateSnapshot._from_pb(p.full_state)
+            else:
+                payloads[p.name] = RobotControllerState._from_pb(p.robot_controller)
+
+        stats = frame.stats
+        self.frames_sent = int(stats.frames_sent)
+        self.frames_skipped = int(stats.frames_skipped)
+        self.frames_dropped = int(stats.frames_dropped)
+        return SyncFrame(
+            frame_number=int(frame.frame_number),
+            sim_time=float(frame.sim_time),
+            timestamp_ms=int(frame.timestamp_ms),
+            payloads=payloads,
+            skipped_since_last=int(frame.skipped_since_last),
+            errors=errors,
+        )
+
+    def cancel(self) -> None:
+        """Cancel the underlying stream call, if it supports cancellation."""
+        cancel = getattr(self._frames, "cancel", None)
+        if cancel is not None:
+            cancel()
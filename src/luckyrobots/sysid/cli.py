@@ -67,7 +67,17 @@ def collect(host, port, robot, signal, duration, dt, amplitude, num_joints, outp
 @click.option("--max-iter", default=100, type=int, help="Max optimization iterations.")
 @click.option("--report-dir", default=None, help="Directory for identification report.")
 @click.option("-o", "--output", default="sysid_result.json", help="Output result file.")
-def identify(data_path, model, preset, max_iter, report_dir, output):
+@click.option(
+    "--engine",
+    default=None,
+    metavar="HOST:PORT",
+    help="Run rollouts in parallel in LuckyEngine (BatchRollout) instead of local MuJoCo.",
+)
+@click.option(
+    "--workers", default=None, type=int,
+    help="Local rollout threads (default: CPU count, capped at #params + 1).",
+)
+def identify(data_path, model, preset, max_iter, report_dir, output, engine, workers):
     """Identify model parameters from trajectory data."""
     from .trajectory import TrajectoryData
     from .sysid import identify as run_identify
@@ -83,13 +93,29 @@ def identify(data_path, model, preset, max_iter, report_dir, output):
     specs = load_preset(robot, group)
     click.echo(f"Identifying {len(specs)} parameters ({robot}:{group})")
 
-    result = run_identify(
-        model_xml=model,
-        trajectories=traj,
-        param_specs=specs,
-        report_dir=report_dir,
-        max_iterations=max_iter,
-    )
+    client = None
+    if engine is not None:
+        from luckyrobots import LuckyEngineClient
+
+        host, _, port = engine.rpartition(":")
+        client = LuckyEngineClient(host=host or "127.0.0.1", port=int(port))
+        client.connect()
+        client.wait_for_server(timeout=30.0)
+        click.echo(f"Rolling out in LuckyEngine at {engine}")
+
+    try:
+        result = run_identify(
+            model_xml=model,
+            trajectories=traj,
+            param_specs=specs,
+            report_dir=report_dir,
+            max_iterations=max_iter,
+            engine=client,
+            workers=workers,
+        )
+    finally:
+        if client is not None:
+            client.close()
 
     result.save(output)
     click.echo(f"\nResidual: {result.residual_before:.4f} -> {result.residual_after:.4f}")
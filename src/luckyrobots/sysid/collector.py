@@ -59,33 +59,21 @@ class EngineCollector(Collector):
         self._client.wait_for_server(timeout=30.0)
 
     def collect(self, ctrl_sequence: np.ndarray, dt: float) -> TrajectoryData:
+        """Play ``ctrl_sequence`` open-loop in one PlayControlSequence call.
+
+        The scene is reset first; qpos / qvel are the full mjData state after
+        each row, matching what :func:`luckyrobots.sysid.identify` simulates.
+        """
         if self._client is None:
             raise RuntimeError("Not connected. Call connect() first.")
 
-        T, nu = ctrl_sequence.shape
-        times = np.zeros(T)
-        qpos_list = []
-        qvel_list = []
-        ctrl_list = []
-
-        self._client.reset_agent()
-
-        for t in range(T):
-            ctrl = ctrl_sequence[t].tolist()
-
-            state = self._client.get_joint_state(self.robot_name)
-            qpos_list.append(np.array(state.state.positions))
-            qvel_list.append(np.array(state.state.velocities))
-
-            self._client.step(actions=ctrl)
-            ctrl_list.append(ctrl_sequence[t])
-            times[t] = t * dt
+        played = self._client.play_control_sequence(ctrl_sequence, dt=dt, reset=True)
 
         return TrajectoryData(
-            times=times,
-            qpos=np.array(qpos_list),
-            qvel=np.array(qvel_list),
-            ctrl=np.array(ctrl_list),
+            times=played["times"],
+            qpos=played["qpos"],
+            qvel=played["qvel"],
+            ctrl=np.asarray(ctrl_sequence, dtype=np.float64),
             metadata={
                 "source": "luckyengine",
                 "host": self.host,
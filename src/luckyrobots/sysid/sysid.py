@@ -3,13 +3,24 @@
 Replays recorded controls in simulation, adjusts model parameters to minimize
 the difference between simulated and recorded joint positions/velocities.
 Uses scipy.optimize.least_squares (Levenberg-Marquardt / Trust Region Reflective).
+
+Finite-difference Jacobians evaluate all parameter perturbations as one batch:
+on a pool of model/data copies across worker threads (mj_step releases the
+GIL), or engine-side through BatchRollout. Residuals are cached per parameter
+vector, so the point scipy already evaluated is not rolled out again.
 """
 
 from __future__ import annotations
 
+import copy
 import json
 import logging
+import os
+import queue
+from collections import OrderedDict
+from concurrent.futures import ThreadPoolExecutor
 from dataclasses import dataclass
+from typing import Callable
 from pathlib import Path
 
 import numpy as np
@@ -79,6 +90,140 @@ def _rollout(model, data, ctrl_sequence: np.ndarray, dt: float) -> tuple[np.ndar
     return qpos_traj, qvel_traj
 
 
+def _trajectory_residual(
+    sim_qpos: np.ndarray,
+    sim_qvel: np.ndarray,
+    traj: TrajectoryData,
+    qpos_weight: float,
+    qvel_weight: float,
+) -> np.ndarray:
+    """Weighted (sim - recorded) qpos/qvel error of one rollout, flattened."""
+    nq_compare = min(sim_qpos.shape[1], traj.qpos.shape[1])
+    nv_compare = min(sim_qvel.shape[1], traj.qvel.shape[1])
+
+    qpos_err = (sim_qpos[:, :nq_compare] - traj.qpos[:, :nq_compare]) * qpos_weight
+    qvel_err = (sim_qvel[:, :nv_compare] - traj.qvel[:, :nv_compare]) * qvel_weight
+
+    return np.concatenate([qpos_err.ravel(), qvel_err.ravel()])
+
+
+def _fd_steps(x: np.ndarray, lo: np.ndarray, hi: np.ndarray) -> np.ndarray:
+    """Forward-difference steps as scipy's '2-point' picks them.
+
+    The step follows the sign of ``x`` (positive at zero) and is flipped when
+    it would leave ``[lo, hi]``; where neither direction fits, it spans the
+    wider side instead. Steps are rounded to the exactly representable
+    ``(x + h) - x``.
+    """
+    sign = np.where(x >= 0, 1.0, -1.0)
+    h = np.sqrt(np.finfo(float).eps) * sign * np.maximum(1.0, np.abs(x))
+    lo_dist, hi_dist = x - lo, hi - x
+    violated = (x + h < lo) | (x + h > hi)
+    fitting = np.abs(h) <= np.maximum(lo_dist, hi_dist)
+    h[violated & fitting] *= -1.0
+    forward = ~fitting & (hi_dist >= lo_dist)
+    h[forward] = hi_dist[forward]
+    backward = ~fitting & (hi_dist < lo_dist)
+    h[backward] = -lo_dist[backward]
+    return (x + h) - x
+
+
+def _fd_jacobian(
+    batch_fn: Callable[[np.ndarray], np.ndarray],
+    x: np.ndarray,
+    lo: np.ndarray,
+    hi: np.ndarray,
+) -> np.ndarray:
+    """(n_residuals, P) forward-difference Jacobian from one batch of P + 1 rollouts."""
+    h = _fd_steps(x, lo, hi)
+    R = batch_fn(np.vstack([x, x + np.diag(h)]))
+    return ((R[1:] - R[0]) / h[:, None]).T
+
+
+class _RolloutPool:
+    """Model/data copies for evaluating candidate parameter vectors in parallel.
+
+    Each worker checks a copy out, writes the candidate parameters into it
+    and rolls out every trajectory. The caller's model is never mutated.
+    """
+
+    def __init__(
+        self,
+        model,
+        trajectories: list[TrajectoryData],
+        param_specs: list[ParamSpec],
+        qpos_weight: float,
+        qvel_weight: float,
+        workers: int,
+    ):
+        import mujoco
+
+        self._trajectories = trajectories
+        self._param_specs = param_specs
+        self._qpos_weight = qpos_weight
+        self._qvel_weight = qvel_weight
+        self._copies: queue.SimpleQueue = queue.SimpleQueue()
+        for _ in range(workers):
+            m = copy.deepcopy(model)
+            self._copies.put((m, mujoco.MjData(m)))
+        self._executor = ThreadPoolExecutor(workers) if workers > 1 else None
+
+    def _evaluate(self, x: np.ndarray) -> np.ndarray:
+        model, data = self._copies.get()
+        try:
+            for i, spec in enumerate(self._param_specs):
+                set_param(model, spec, x[i])
+            return np.concatenate([
+                _trajectory_residual(
+                    *_rollout(model, data, traj.ctrl, traj.dt),
+                    traj, self._qpos_weight, self._qvel_weight,
+                )
+                for traj in self._trajectories
+            ])
+        finally:
+            self._copies.put((model, data))
+
+    def __call__(self, X: np.ndarray) -> np.ndarray:
+        """(K, P) candidates -> (K, n_residuals)."""
+        if self._executor is None:
+            return np.stack([self._evaluate(x) for x in X])
+        return np.stack(list(self._executor.map(self._evaluate, X)))
+
+    def close(self) -> None:
+        if self._executor is not None:
+            self._executor.shutdown()
+
+
+class _ResidualCache:
+    """LRU cache of residual vectors keyed by the exact parameter vector."""
+
+    def __init__(self, batch_fn: Callable[[np.ndarray], np.ndarray], maxsize: int):
+        self._batch_fn = batch_fn
+        self._maxsize = maxsize
+        self._entries: OrderedDict[bytes, np.ndarray] = OrderedDict()
+        self.hits = 0
+        self.misses = 0
+
+    def __call__(self, X: np.ndarray) -> np.ndarray:
+        """(K, P) candidates -> (K, n_residuals), rolling out only uncached rows."""
+        keys = [np.ascontiguousarray(x, dtype=np.float64).tobytes() for x in X]
+        missing = [k for k, key in enumerate(keys) if key not in self._entries]
+        # Duplicate rows within one batch are rolled out once.
+        todo = list({keys[k]: k for k in missing}.values())
+        self.hits += len(keys) - len(todo)
+        self.misses += len(todo)
+        if todo:
+            for k, r in zip(todo, self._batch_fn(X[todo])):
+                self._entries[keys[k]] = r
+        rows = []
+        for key in keys:
+            self._entries.move_to_end(key)
+            rows.append(self._entries[key])
+        while len(self._entries) > self._maxsize:
+            self._entries.popitem(last=False)
+        return np.stack(rows)
+
+
 def identify(
     model_xml: str | Path,
     trajectories: list[TrajectoryData] | TrajectoryData,
@@ -88,6 +233,10 @@ def identify(
     max_iterations: int = 100,
     qpos_weight: float = 1.0,
     qvel_weight: float = 0.1,
+    engine=None,
+    engine_threads: int = 0,
+    workers: int | None = None,
+    cache_size: int = 256,
 ) -> SysIdResult:
     """Run system identification.
 
@@ -103,6 +252,17 @@ def identify(
         max_iterations: Maximum optimization iterations.
         qpos_weight: Weight for position error in residual.
         qvel_weight: Weight for velocity error in residual.
+        engine: Optional connected ``LuckyEngineClient``. Rollouts then run
+            engine-side through ``BatchRollout``: each residual is one batch
+            per trajectory, and each Jacobian sends the current point plus
+            every forward-difference perturbation as candidates of a single
+            parallel batch. The engine's loaded model must match
+            ``model_xml``, which is still used for initial values.
+        engine_threads: Engine worker threads per batch (0 = physics pool size).
+        workers: Local rollout threads, each with its own model/data copy
+            (default: CPU count, capped at len(param_specs) + 1). Ignored
+            with ``engine``.
+        cache_size: Residual vectors kept in the per-parameter-vector cache.
 
     Returns:
         SysIdResult with identified parameters and diagnostics.
@@ -115,7 +275,6 @@ def identify(
 
     model_xml = Path(model_xml)
     model = mujoco.MjModel.from_xml_path(str(model_xml))
-    data = mujoco.MjData(model)
 
     # Read initial parameter values
     initial_params = {}
@@ -131,37 +290,59 @@ def identify(
 
     x0 = np.array(x0)
 
-    def residual_fn(x: np.ndarray) -> np.ndarray:
-        for i, spec in enumerate(param_specs):
-            set_param(model, spec, x[i])
-
-        all_residuals = []
-        for traj in trajectories:
-            dt = traj.dt
-            sim_qpos, sim_qvel = _rollout(model, data, traj.ctrl, dt)
-
-            nq_compare = min(sim_qpos.shape[1], traj.qpos.shape[1])
-            nv_compare = min(sim_qvel.shape[1], traj.qvel.shape[1])
+    lo = np.asarray(bounds_lo, dtype=float)
+    hi = np.asarray(bounds_hi, dtype=float)
 
-            qpos_err = (sim_qpos[:, :nq_compare] - traj.qpos[:, :nq_compare]) * qpos_weight
-            qvel_err = (sim_qvel[:, :nv_compare] - traj.qvel[:, :nv_compare]) * qvel_weight
+    pool = None
+    if engine is None:
+        n_workers = workers or min(os.cpu_count() or 1, len(param_specs) + 1)
+        pool = _RolloutPool(
+            model, trajectories, param_specs, qpos_weight, qvel_weight, max(1, n_workers),
+        )
+        batch_fn = pool
+    else:
+        def batch_fn(X: np.ndarray) -> np.ndarray:
+            """(K, P) candidates -> (K, n_residuals), one BatchRollout per trajectory."""
+            per_traj = []
+            for traj in trajectories:
+                sim_qpos, sim_qvel = engine.batch_rollout(
+                    traj.ctrl, param_specs, X,
+                    timestep=traj.dt, num_threads=engine_threads,
+                )
+                per_traj.append(np.stack([
+                    _trajectory_residual(sim_qpos[k], sim_qvel[k], traj, qpos_weight, qvel_weight)
+                    for k in range(X.shape[0])
+                ]))
+            return np.concatenate(per_traj, axis=1)
 
-            all_residuals.append(qpos_err.ravel())
-            all_residuals.append(qvel_err.ravel())
+    batch_residuals = _ResidualCache(batch_fn, cache_size)
 
-        return np.concatenate(all_residuals)
+    def residual_fn(x: np.ndarray) -> np.ndarray:
+        return batch_residuals(x[None, :])[0]
 
-    # Compute initial residual
-    residual_before = float(np.sum(residual_fn(x0) ** 2))
+    def jac(x: np.ndarray) -> np.ndarray:
+        return _fd_jacobian(batch_residuals, x, lo, hi)
 
-    # Run optimization
-    result = scipy_lsq(
-        residual_fn,
-        x0,
-        bounds=(bounds_lo, bounds_hi),
-        max_nfev=max_iterations,
-        method="trf",
-        verbose=1,
+    try:
+        # Compute initial residual
+        residual_before = float(np.sum(residual_fn(x0) ** 2))
+
+        # Run optimization
+        result = scipy_lsq(
+            residual_fn,
+            x0,
+            jac=jac,
+            bounds=(bounds_lo, bounds_hi),
+            max_nfev=max_iterations,
+            method="trf",
+            verbose=1,
+        )
+    finally:
+        if pool is not None:
+            pool.close()
+    logger.info(
+        "Rollouts: %d evaluated, %d served from cache",
+        batch_residuals.misses, batch_residuals.hits,
     )
 
     residual_after = float(np.sum(result.fun ** 2))
@@ -112,6 +112,15 @@ def fake_session(fake_agent_stub):
     # Mimic the MujocoScene stub surface as well so the same fixture works
     # for both controller and scene unit tests.
     session.engine_client.mujoco_scene = MagicMock(name="FakeMujocoSceneStub")
+    # Uncached LuckyEngineClient.get_model_info(): straight to the stub.
+    session.engine_client.metadata_cache = None
+    session.engine_client.get_model_info.side_effect = (
+        lambda timeout=None: session.engine_client.mujoco_scene.GetModelInfo(None)
+    )
+    session.engine_client._unsupported_rpcs = set()
+    session.engine_client.bulk_stub.side_effect = lambda name: getattr(
+        session.engine_client, name
+    )
     return session
 
 
@@ -5,6 +5,7 @@ Note: Tests marked with @pytest.mark.integration require a running LuckyEngine s
 Run with: pytest -m integration
 """
 
+import numpy as np
 import pytest
 from unittest.mock import MagicMock, patch
 
@@ -55,6 +56,2103 @@ class TestLuckyEngineClientUnit:
             client.benchmark(method="invalid_method")
 
 
+class TestBatchStep:
+    """Unit tests for the vectorized BatchStep path (no server needed)."""
+
+    def _client(self, fake_agent_stub):
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        return client
+
+    def test_batch_step_reshapes_packed_tensors(self, fake_agent_stub):
+        """Packed response arrays come back as (num_envs, ...) numpy arrays."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = self._client(fake_agent_stub)
+        client._session_reward_terms[""] = ["alive", "vel"]
+        fake_agent_stub.BatchStep.return_value = agent_pb2.BatchStepResponse(
+            success=True,
+            num_envs=2,
+            observation_dim=3,
+            observations=[0.0, 1.0, 2.0, 3.0, 4.0, 5.0],
+            reward_signals=[1.0, 0.5, 1.0, 0.25],
+            terminated=[False, True],
+            truncated=[False, False],
+            frame_number=7,
+        )
+
+        batch = client.batch_step(np.zeros((2, 4), dtype=np.float32))
+
+        assert batch.observations.shape == (2, 3)
+        assert batch.observations[1].tolist() == [3.0, 4.0, 5.0]
+        assert batch.reward_dict()["vel"].tolist() == [0.5, 0.25]
+        assert batch.terminated.tolist() == [False, True]
+        assert batch.frame_number == 7
+
+        req = fake_agent_stub.BatchStep.call_args.args[0]
+        assert req.num_envs == 2
+        assert req.action_dim == 4
+        assert len(req.actions) == 8
+
+    def test_batch_step_rejects_flat_actions(self, fake_agent_stub):
+        """A 1-D action vector is a caller error, not a silent single env."""
+        client = self._client(fake_agent_stub)
+
+        with pytest.raises(ValueError, match="num_envs, action_dim"):
+            client.batch_step([0.0, 0.0, 0.0])
+
+    def test_batch_step_failure_raises(self, fake_agent_stub):
+        """success=False surfaces as RuntimeError with the server message."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = self._client(fake_agent_stub)
+        fake_agent_stub.BatchStep.return_value = agent_pb2.BatchStepResponse(
+            success=False, message="no session"
+        )
+
+        with pytest.raises(RuntimeError, match="no session"):
+            client.batch_step(np.zeros((1, 2)))
+
+    def test_batch_step_deadline_uses_shared_error(self, fake_agent_stub):
+        """DEADLINE_EXCEEDED raises the same client-side timeout error as Step."""
+        import grpc
+
+        class _Deadline(grpc.RpcError):
+            def code(self):
+                return grpc.StatusCode.DEADLINE_EXCEEDED
+
+        client = self._client(fake_agent_stub)
+        fake_agent_stub.BatchStep.side_effect = _Deadline()
+
+        with pytest.raises(RuntimeError, match=r"Client-side gRPC timeout \(2.5s\)"):
+            client.batch_step(np.zeros((1, 2)), timeout=2.5)
+
+
+class TestPhysicsBackend:
+    """Unit tests for GPU physics backend discovery and negotiation."""
+
+    def test_manifest_lists_backends_and_gpu_kernels(self, fake_agent_stub):
+        """physics_backends and per-term gpu_kernel flags are decoded."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        manifest = agent_pb2.EngineCapabilityManifest(engine_version="1.0")
+        manifest.rewards.add(name="alive", gpu_kernel=True)
+        manifest.rewards.add(name="contact_forces")
+        manifest.physics_backends.add(backend=agent_pb2.PHYSICS_BACKEND_CPU, name="mujoco")
+        manifest.physics_backends.add(
+            backend=agent_pb2.PHYSICS_BACKEND_MUJOCO_WARP,
+            name="mujoco_warp",
+            device="cuda:0",
+            max_num_envs=65536,
+        )
+        fake_agent_stub.GetCapabilityManifest.return_value = (
+            agent_pb2.GetCapabilityManifestResponse(manifest=manifest)
+        )
+
+        result = client.get_capability_manifest()
+
+        assert [r["gpu_kernel"] for r in result["rewards"]] == [True, False]
+        backends = result["physics_backends"]
+        assert [b["backend"] for b in backends] == ["cpu", "mujoco_warp"]
+        assert backends[1]["max_num_envs"] == 65536
+
+    def test_negotiate_gpu_backend(self, fake_agent_stub):
+        """physics_backend reaches the TaskContract and the granted one is returned."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.NegotiateTask.return_value = agent_pb2.NegotiateTaskResponse(
+            success=True,
+            session=agent_pb2.NegotiatedTaskSession(
+                session_id="s1",
+                num_envs=8192,
+                physics_backend=agent_pb2.PHYSICS_BACKEND_MUJOCO_WARP,
+            ),
+        )
+
+        result = client.negotiate_task({"robot": "go2", "num_envs": 8192, "physics_backend": "gpu"})
+
+        contract = fake_agent_stub.NegotiateTask.call_args.args[0].contract
+        assert contract.physics_backend == agent_pb2.PHYSICS_BACKEND_GPU
+        assert result["physics_backend"] == "mujoco_warp"
+        with pytest.raises(ValueError, match="physics_backend"):
+            client.negotiate_task({"robot": "go2", "physics_backend": "tpu"})
+
+
+class TestCompiledObservationTerms:
+    """Unit tests for observation term post-processing and inline Step state."""
+
+    def test_contract_carries_noise_clip_scale(self):
+        """Observation term noise / clip / scale reach the TaskContract."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        contract = client._build_task_contract({"observations": {"required": [
+            {"name": "joint_vel", "scale": 0.05, "clip": 5.0,
+             "noise": {"type": "uniform", "low": -0.1, "high": 0.1}},
+            {"name": "base_ang_vel"},
+        ]}})
+
+        term, plain = contract.observations.required
+        assert term.clip == 5.0 and term.scale == pytest.approx(0.05)
+        assert term.noise.type == agent_pb2.OBSERVATION_NOISE_UNIFORM
+        assert term.noise.high == pytest.approx(0.1)
+        assert not plain.HasField("noise") and plain.group == "policy"
+        with pytest.raises(ValueError, match="observation noise type"):
+            client._build_task_contract(
+                {"observations": {"required": [{"name": "x", "noise": {"type": "pink"}}]}}
+            )
+
+    def test_negotiate_reports_observation_program(self, fake_agent_stub):
+        """The compiled kernel list is returned from negotiate_task."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        session = agent_pb2.NegotiatedTaskSession(session_id="s1")
+        session.observation_program.observation_size = 24
+        session.observation_program.fused_kernels = 1
+        session.observation_program.kernels.add(
+            kernel="gather_qpos", terms=["joint_pos", "joint_pos_rel"], offset=0, size=24,
+            noise=True,
+        )
+        fake_agent_stub.NegotiateTask.return_value = agent_pb2.NegotiateTaskResponse(
+            success=True, session=session
+        )
+
+        program = client.negotiate_task({"robot": "go2"})["observation_program"]
+
+        assert program["observation_size"] == 24
+        assert program["kernels"][0]["terms"] == ["joint_pos", "joint_pos_rel"]
+        assert program["kernels"][0]["noise"] and not program["kernels"][0]["clip"]
+
+    def test_step_attaches_filtered_state(self, fake_agent_stub):
+        """step(state=filter) requests state inline and decodes full_state."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        resp = agent_pb2.StepResponse(success=True)
+        resp.state.success = True
+        resp.state.state.qpos.extend([0.1, 0.2])
+        resp.state.state.qvel.extend([0.3])
+        resp.state.included_joint_indices.extend([4])
+        fake_agent_stub.Step.return_value = resp
+
+        obs = client.step(actions=[0.0], state={"filter_by_slot_id": 2})
+
+        sent = fake_agent_stub.Step.call_args[0][0]
+        assert sent.state.filter.filter_by_slot_id == 2
+        assert obs.full_state.qpos.tolist() == pytest.approx([0.1, 0.2])
+        assert obs.full_state.included_joint_indices.tolist() == [4]
+
+    def test_step_without_state(self, fake_agent_stub):
+        """By default no state is requested and full_state is None."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(success=True)
+
+        obs = client.step(actions=[0.0])
+
+        assert not fake_agent_stub.Step.call_args[0][0].HasField("state")
+        assert obs.full_state is None
+
+    def test_step_state_failure_raises(self, fake_agent_stub):
+        """A failed state attachment raises like a failed GetFullState."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        resp = agent_pb2.StepResponse(success=True)
+        resp.state.message = "unknown slot"
+        fake_agent_stub.Step.return_value = resp
+
+        with pytest.raises(RuntimeError, match="unknown slot"):
+            client.step(actions=[0.0], state=True)
+
+
+class TestModelRandomization:
+    """Unit tests for in-place, batched model randomization at reset."""
+
+    TERMS = {
+        "seed": 7,
+        "table_size": 1024,
+        "terms": [
+            {"field": "geom_friction", "targets": ["floor"], "range": [0.5, 1.25]},
+            {"field": "body_mass", "targets": ["trunk"], "range": [-1.0, 1.0],
+             "operation": "add"},
+            {"field": "actuator_gain", "range": [0.8, 1.2], "distribution": "log_uniform",
+             "shared": True},
+        ],
+    }
+
+    def _applied_response(self):
+        from luckyrobots.grpc.generated import agent_pb2
+
+        resp = agent_pb2.ResetAgentResponse(success=True)
+        applied = resp.applied_randomization
+        applied.columns.add(field=agent_pb2.MODEL_RANDOMIZATION_FIELD_GEOM_FRICTION,
+                            element="floor", element_index=0, default_value=1.0)
+        applied.columns.add(field=agent_pb2.MODEL_RANDOMIZATION_FIELD_BODY_MASS,
+                            element="trunk", element_index=1, default_value=6.9)
+        applied.env_ids.extend([3, 5])
+        applied.sample_indices.extend([10, 11])
+        applied.values.extend([0.7, 7.2, 1.1, 6.5])
+        applied.apply_duration_us = 42
+        return resp
+
+    def test_contract_carries_model_randomization(self):
+        """randomization.model becomes RandomizationContract.model."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        contract = client._build_task_contract({"randomization": {"model": self.TERMS}})
+
+        model = contract.randomization.model
+        assert model.seed == 7 and model.table_size == 1024
+        friction, mass, gain = model.terms
+        assert friction.field == agent_pb2.MODEL_RANDOMIZATION_FIELD_GEOM_FRICTION
+        assert list(friction.targets) == ["floor"]
+        assert mass.operation == agent_pb2.RANDOMIZATION_OPERATION_ADD
+        assert gain.distribution == agent_pb2.RANDOMIZATION_DISTRIBUTION_LOG_UNIFORM
+        assert gain.shared
+
+    def test_unknown_field_rejected(self):
+        """Unknown field names raise before any RPC."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        with pytest.raises(ValueError, match="randomization field"):
+            client._build_task_contract(
+                {"randomization": {"model": {"terms": [{"field": "geom_color"}]}}}
+            )
+
+    def test_reset_agents_batches_envs_and_decodes_values(self, fake_agent_stub):
+        """One ResetAgent carries every env id; values come back as a table."""
+        from luckyrobots import AppliedRandomization
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.ResetAgent.return_value = self._applied_response()
+
+        applied = client.reset_agents(env_ids=[3, 5], model_randomization=self.TERMS)
+
+        req = fake_agent_stub.ResetAgent.call_args[0][0]
+        assert list(req.env_ids) == [3, 5]
+        assert req.model_randomization.seed == 7
+        assert isinstance(applied, AppliedRandomization)
+        assert applied.values.shape == (2, 2)
+        assert applied.column("body_mass", "trunk").tolist() == pytest.approx([7.2, 6.5])
+        assert applied.env(5)["geom_friction/floor"] == pytest.approx(1.1)
+        assert applied.sample_indices.tolist() == [10, 11]
+        assert applied.columns[1].default_value == pytest.approx(6.9)
+
+    def test_reset_agents_failure(self, fake_agent_stub):
+        """A failed reset raises RuntimeError."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.ResetAgent.return_value = agent_pb2.ResetAgentResponse(
+            success=False, message="no session"
+        )
+
+        with pytest.raises(RuntimeError, match="no session"):
+            client.reset_agents(env_ids=[0])
+
+    def test_batch_step_reports_applied_randomization(self, fake_agent_stub):
+        """BatchStep resets surface the applied values on BatchObservation."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        resp = agent_pb2.BatchStepResponse(
+            success=True, num_envs=1, observation_dim=1, observations=[0.0],
+            terminated=[False], truncated=[False],
+        )
+        resp.applied_randomization.CopyFrom(self._applied_response().applied_randomization)
+        fake_agent_stub.BatchStep.return_value = resp
+
+        batch = client.batch_step(np.zeros((1, 2), dtype=np.float32), reset_env_ids=[0])
+
+        assert batch.applied_randomization.env_ids.tolist() == [3, 5]
+        fake_agent_stub.BatchStep.return_value = agent_pb2.BatchStepResponse(
+            success=True, num_envs=1, observation_dim=1, observations=[0.0],
+            terminated=[False], truncated=[False],
+        )
+        assert client.batch_step(np.zeros((1, 2))).applied_randomization is None
+
+
+class TestSharedMemoryTransport:
+    """Unit tests for the shm Step transport against a locally created segment."""
+
+    def test_step_returns_views_into_ring(self, fake_agent_stub):
+        """Observation and pixels are read from the ring, not the proto payload."""
+        import struct
+        from multiprocessing import shared_memory
+
+        from luckyrobots.grpc.generated import agent_pb2
+
+        seg = shared_memory.SharedMemory(create=True, size=256)
+        try:
+            struct.pack_into("<Q", seg.buf, 0, 5)
+            struct.pack_into("<3f", seg.buf, 8, 1.0, 2.0, 3.0)
+            seg.buf[32:44] = bytes(range(12))
+
+            client = LuckyEngineClient(robot_name="test_robot")
+            client._agent = fake_agent_stub
+            fake_agent_stub.OpenSharedMemoryTransport.return_value = (
+                agent_pb2.OpenSharedMemoryTransportResponse(
+                    success=True,
+                    transport_id="t0",
+                    region_name=seg.name,
+                    region_size=256,
+                    slot_count=1,
+                    slot_size=256,
+                )
+            )
+            client.enable_shared_memory()
+
+            slot = agent_pb2.SharedMemorySlot(
+                slot_index=0,
+                sequence=5,
+                sequence_offset=0,
+                observation_offset=8,
+                observation_count=3,
+                camera_frames=[
+                    agent_pb2.SharedMemoryImage(
+                        name="wrist", offset=32, size=12, width=2, height=2, channels=3
+                    )
+                ],
+            )
+            fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+                success=True, shm_slot=slot
+            )
+
+            obs = client.step(actions=[0.0])
+
+            assert fake_agent_stub.Step.call_args.args[0].shm_transport_id == "t0"
+            assert obs.to_numpy().tolist() == [1.0, 2.0, 3.0]
+            assert obs.observation == []
+            assert obs.camera_frames[0].array.shape == (2, 2, 3)
+            assert obs.camera_frames[0].array[1, 1, 2] == 11
+
+            # Engine reuses the slot -> stale read is refused.
+            struct.pack_into("<Q", seg.buf, 0, 6)
+            with pytest.raises(RuntimeError, match="overwritten"):
+                client.step(actions=[0.0])
+
+            del obs
+            client.disable_shared_memory()
+            fake_agent_stub.CloseSharedMemoryTransport.assert_called_once()
+        finally:
+            seg.close()
+            seg.unlink()
+
+    def test_remote_host_rejected(self):
+        """The transport is refused for non-loopback hosts."""
+        client = LuckyEngineClient(host="10.0.0.5")
+
+        with pytest.raises(ValueError, match="same-host"):
+            client.enable_shared_memory()
+
+
+class _EchoStepCall:
+    """Fake stream-stream call: one StepResponse per request, echoing actions."""
+
+    def __init__(self, request_iterator):
+        self._requests = request_iterator
+        self.cancelled = False
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        from luckyrobots.grpc.generated import agent_pb2
+
+        req = next(self._requests)
+        return agent_pb2.StepResponse(
+            success=True,
+            sequence=req.sequence,
+            observation=agent_pb2.AgentFrame(observations=list(req.actions)),
+        )
+
+    def cancel(self):
+        self.cancelled = True
+
+
+class TestStepStream:
+    """Unit tests for the persistent StepStream channel."""
+
+    def test_pipelined_steps_return_in_order(self, fake_agent_stub):
+        """Responses come back in request order with max_in_flight > 1."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        calls = []
+
+        def _open(request_iterator):
+            calls.append(_EchoStepCall(request_iterator))
+            return calls[-1]
+
+        fake_agent_stub.StepStream.side_effect = _open
+
+        with client.step_stream(max_in_flight=2) as stream:
+            assert stream.send([1.0]) == 1
+            assert stream.send([2.0]) == 2
+            with pytest.raises(RuntimeError, match="max_in_flight"):
+                stream.send([3.0])
+
+            assert stream.recv().observation == [1.0]
+            assert stream.step([3.0]).observation == [2.0]
+            assert stream.recv().observation == [3.0]
+            assert stream.in_flight == 0
+
+        assert calls[0].cancelled
+
+    def test_recv_without_send_raises(self, fake_agent_stub):
+        """recv() with nothing in flight is a usage error, not a hang."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.StepStream.side_effect = _EchoStepCall
+
+        stream = client.step_stream()
+        with pytest.raises(RuntimeError, match="no step in flight"):
+            stream.recv()
+        stream.close()
+
+    def test_out_of_order_response_raises_and_closes(self, fake_agent_stub):
+        """A response that does not echo the oldest sequence is rejected."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        call = MagicMock()
+        call.__next__.return_value = agent_pb2.StepResponse(success=True, sequence=2)
+        fake_agent_stub.StepStream.return_value = call
+
+        stream = client.step_stream(max_in_flight=2)
+        stream.send([1.0])
+        stream.send([2.0])
+        with pytest.raises(RuntimeError, match="expected sequence 1, got 2"):
+            stream.recv()
+        call.cancel.assert_called_once()
+        with pytest.raises(RuntimeError, match="closed"):
+            stream.send([3.0])
+
+    def test_async_stream_uses_client_codec(self):
+        """AsyncStepStream takes dict action groups and decodes with the cached schema."""
+        import asyncio
+        from unittest.mock import AsyncMock
+
+        from luckyrobots import AsyncSession
+        from luckyrobots.grpc.generated import agent_pb2
+
+        sess = AsyncSession()
+        sess._channel = MagicMock()
+        sess._agent = MagicMock()
+        call = MagicMock()
+        call.write = AsyncMock()
+        call.done_writing = AsyncMock()
+        call.read = AsyncMock(side_effect=[
+            agent_pb2.StepResponse(
+                success=True,
+                sequence=1,
+                observation=agent_pb2.AgentFrame(observations=[0.25]),
+            ),
+            agent_pb2.StepResponse(success=True, sequence=7),
+        ])
+        sess._agent.StepStream.return_value = call
+        sess._codec._schema_cache["agent_0"] = (["base_height"], ["arm"])
+
+        async def run():
+            stream = sess.step_stream(max_in_flight=2)
+            obs = await stream.step(
+                [0.0],
+                action_groups=[{"group_name": "arm", "actions": [0.5], "action_indices": [3]}],
+            )
+            await stream.send([0.0])
+            with pytest.raises(RuntimeError, match="out of order"):
+                await stream.recv()
+            return obs
+
+        obs = asyncio.run(run())
+
+        req = call.write.call_args_list[0].args[0]
+        assert req.sequence == 1
+        assert req.action_groups[0].group_name == "arm"
+        assert list(req.action_groups[0].action_indices) == [3]
+        assert obs.observation_names == ["base_height"]
+        call.cancel.assert_called_once()
+
+
+class TestPackedStepEncoding:
+    """Unit tests for STEP_ENCODING_PACKED negotiation + decode."""
+
+    def test_packed_step_decodes_from_negotiated_layout(self, fake_agent_stub):
+        """One packed buffer yields obs, named rewards, info and termination flags."""
+        import struct
+
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.NegotiateTask.return_value = agent_pb2.NegotiateTaskResponse(
+            success=True,
+            session=agent_pb2.NegotiatedTaskSession(
+                session_id="s1",
+                reward_terms=["alive", "vel"],
+                termination_terms=["fell_over"],
+                step_encoding=agent_pb2.STEP_ENCODING_PACKED,
+                packed_layout=agent_pb2.PackedStepLayout(
+                    total_size=25,
+                    observation_offset=0,
+                    observation_count=3,
+                    reward_offset=12,
+                    info_offset=20,
+                    info_names=[],
+                    termination_offset=20,
+                ),
+            ),
+        )
+
+        result = client.negotiate_task({"robot": "go2", "step_encoding": "packed"})
+        assert result["step_encoding"] == "packed"
+        contract = fake_agent_stub.NegotiateTask.call_args.args[0].contract
+        assert contract.step_encoding == agent_pb2.STEP_ENCODING_PACKED
+
+        buf = struct.pack("<3f2fB", 0.5, 1.5, 2.5, 1.0, 0.25, 1) + bytes(4)
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+            success=True, packed_step=buf, terminated=True
+        )
+
+        obs = client.step(actions=[0.0])
+
+        assert obs.to_numpy().tolist() == [0.5, 1.5, 2.5]
+        assert obs.reward_signals == {"alive": 1.0, "vel": 0.25}
+        assert obs.termination_flags == {"fell_over": True}
+        assert obs.terminated
+
+    def test_packed_decode_returns_views(self):
+        """Every PackedStep array, termination flags included, aliases the buffer."""
+        import struct
+
+        from luckyrobots.packed import PackedStepLayout
+
+        layout = PackedStepLayout(
+            total_size=14, observation_offset=0, observation_count=2, reward_offset=8,
+            reward_terms=["alive"], info_offset=12, termination_offset=12,
+            termination_terms=["fell_over", "timeout"],
+        )
+        buf = struct.pack("<2ff2B", 0.5, 1.5, 1.0, 1, 0)
+
+        step = layout.decode(buf)
+
+        source = np.frombuffer(buf, dtype=np.uint8)
+        assert step.termination_flags.dtype == np.bool_
+        assert step.termination_flags.tolist() == [True, False]
+        assert step.termination_dict() == {"fell_over": True, "timeout": False}
+        for arr in (step.observation, step.rewards, step.termination_flags):
+            assert np.shares_memory(arr, source)
+
+    def test_unknown_step_encoding_rejected(self):
+        """A typo in step_encoding fails before any RPC."""
+        client = LuckyEngineClient(robot_name="test_robot")
+
+        with pytest.raises(ValueError, match="step_encoding"):
+            client._build_task_contract({"step_encoding": "msgpack"})
+
+
+class TestStepReturnNumpy:
+    """Unit tests for the step(return_numpy=True) fast path."""
+
+    def test_decodes_into_reused_buffers(self, fake_agent_stub):
+        """Repeated fields land in per-agent float32 buffers reused across steps."""
+        from luckyrobots import StepArrays
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        resp = agent_pb2.StepResponse(success=True, terminated=True)
+        resp.observation.observations.extend([0.1, 0.2, 0.3])
+        resp.observation.actions.extend([1.0, -1.0])
+        resp.observation.frame_number = 7
+        resp.reward_signals["upright"] = 0.5
+        resp.reward_signals["alive"] = 1.0
+        fake_agent_stub.Step.return_value = resp
+
+        first = client.step(actions=[1.0, -1.0], return_numpy=True)
+        second = client.step(actions=[1.0, -1.0], return_numpy=True)
+
+        assert isinstance(first, StepArrays)
+        assert first.observation.dtype == np.float32
+        assert first.observation.tolist() == pytest.approx([0.1, 0.2, 0.3])
+        assert first.reward_terms == ["alive", "upright"]
+        assert first.rewards.tolist() == [1.0, 0.5]
+        assert first.terminated and first.frame_number == 7
+        assert second.observation is first.observation
+
+    def test_uses_negotiated_reward_order(self, fake_agent_stub):
+        """Reward columns follow the negotiated term order when one exists."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        client._session_reward_terms[""] = ["upright", "alive"]
+        resp = agent_pb2.StepResponse(success=True)
+        resp.reward_signals["upright"] = 0.5
+        fake_agent_stub.Step.return_value = resp
+
+        out = client.step(actions=[0.0], return_numpy=True)
+
+        assert out.reward_terms == ["upright", "alive"]
+        assert out.rewards.tolist() == [0.5, 0.0]
+
+    def test_failure_raises(self, fake_agent_stub):
+        """success=False raises like the default path."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(success=False, message="t/o")
+
+        with pytest.raises(RuntimeError, match="t/o"):
+            client.step(actions=[0.0], return_numpy=True)
+
+
+class TestStepProfile:
+    """Unit tests for per-stage step profiling and benchmark traces."""
+
+    def _profiled_response(self, physics_us=400, total_us=1000):
+        from luckyrobots.grpc.generated import agent_pb2
+
+        resp = agent_pb2.StepResponse(success=True)
+        resp.observation.observations.extend([0.0])
+        resp.profile.queue_wait_us = 100
+        resp.profile.physics_us = physics_us
+        resp.profile.serialize_us = 50
+        resp.profile.total_us = total_us
+        return resp
+
+    def test_step_requests_and_parses_profile(self, fake_agent_stub):
+        """profile=True sets StepRequest.profile and fills step_profile."""
+        from luckyrobots import StepProfile
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = self._profiled_response()
+
+        obs = client.step(actions=[0.0], profile=True)
+
+        assert fake_agent_stub.Step.call_args[0][0].profile is True
+        assert isinstance(obs.step_profile, StepProfile)
+        assert obs.step_profile.physics_us == 400
+        assert obs.step_profile.stages()["queue_wait"] == 100
+
+    def test_step_profile_absent_by_default(self, fake_agent_stub):
+        """Without profiling the request flag is off and step_profile is None."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(success=True)
+
+        obs = client.step(actions=[0.0])
+
+        assert fake_agent_stub.Step.call_args[0][0].profile is False
+        assert obs.step_profile is None
+
+    def test_stage_histograms(self):
+        """Histograms cover each stage plus engine total and network/client time."""
+        from luckyrobots.models.benchmark import StepProfile, StepSample, stage_histograms
+
+        samples = [
+            StepSample(start_us=i * 2000.0, latency_us=1500.0,
+                       profile=StepProfile(physics_us=100 * (i + 1), total_us=1000))
+            for i in range(10)
+        ]
+        stages = stage_histograms(samples)
+
+        assert stages["physics"].count == 10
+        assert stages["physics"].p50_us == 500
+        assert stages["physics"].max_us == 1000
+        assert sum(stages["physics"].counts) == 10
+        assert stages["network_and_client"].mean_us == 500
+        assert stage_histograms([StepSample(0.0, 1.0)]) == {}
+
+    def test_benchmark_sizes_actions_from_schema(self, fake_agent_stub):
+        """Default benchmark actions match the schema's action size."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        schema_resp = agent_pb2.GetAgentSchemaResponse()
+        schema_resp.schema.action_size = 3
+        fake_agent_stub.GetAgentSchema.return_value = schema_resp
+        fake_agent_stub.Step.return_value = self._profiled_response()
+
+        result = client.benchmark(duration_seconds=0.05, profile=True)
+
+        assert list(fake_agent_stub.Step.call_args[0][0].actions) == [0.0, 0.0, 0.0]
+        assert result.frame_count > 0
+        assert result.stages["physics"].p50_us == 400
+
+    def test_chrome_trace(self, fake_agent_stub, tmp_path):
+        """to_chrome_trace emits one client span per call and engine stage spans."""
+        import json
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = self._profiled_response()
+        path = tmp_path / "trace.json"
+
+        result = client.benchmark(
+            duration_seconds=0.05, actions=[0.0], profile=True, trace_path=str(path)
+        )
+
+        events = json.loads(path.read_text())["traceEvents"]
+        client_spans = [e for e in events if e.get("ph") == "X" and e["tid"] == 1]
+        engine_spans = [e for e in events if e.get("ph") == "X" and e["tid"] == 2]
+        assert len(client_spans) == result.frame_count
+        assert {e["name"] for e in engine_spans} == {"queue_wait", "physics", "serialize"}
+
+
+class TestBenchSuite:
+    """Unit tests for the ``luckyrobots bench`` helpers."""
+
+    def test_latency_summary(self):
+        """Percentiles use the same floor indexing as benchmark()."""
+        from luckyrobots.cli.bench import latency_summary
+
+        out = latency_summary([float(i) for i in range(1, 101)])
+
+        assert out["min"] == 1.0 and out["max"] == 100.0
+        assert out["p50"] == 50.0
+        assert out["p99"] == 99.0
+        assert latency_summary([]) == {}
+
+    def test_measure_stream_counts_bytes_and_cancels(self):
+        """Streams report per-message bytes and are cancelled when done."""
+        from luckyrobots.cli.bench import BenchCaseResult, measure_stream
+
+        class Stream:
+            cancelled = False
+
+            def __iter__(self):
+                for _ in range(50):
+                    yield b"x" * 10
+
+            def cancel(self):
+                self.cancelled = True
+
+        stream = Stream()
+        result = measure_stream(BenchCaseResult("s", "camera"), stream, len, duration_s=10.0)
+
+        assert result.calls == 48  # 2 warmup messages, then one gap per message
+        assert result.response_bytes == 10.0
+        assert stream.cancelled
+
+    def test_failing_case_records_error(self):
+        """A case that raises is reported with its error instead of aborting."""
+        from luckyrobots.cli.bench import BenchCaseResult, _run_case
+
+        def body(r):
+            raise RuntimeError("no camera")
+
+        results = []
+        _run_case(results, BenchCaseResult("c", "camera"), body, log=lambda _: None)
+
+        assert results[0].error == "RuntimeError: no camera"
+
+    def test_state_group_runs_each_filter(self):
+        """The state group issues GetFullState once per StateFilter mode."""
+        from luckyrobots.cli.bench import STATE_FILTERS, run_suite
+        from luckyrobots.grpc.generated import mujoco_scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._mujoco_scene = MagicMock()
+        client._mujoco_scene.GetFullState.return_value = mujoco_scene_pb2.GetFullStateResponse(
+            success=True
+        )
+        sess = MagicMock(engine_client=client)
+
+        results = run_suite(sess, groups=["state"], duration_s=0.01, log=lambda _: None)
+
+        assert [r.name for r in results] == [f"get_full_state_{n}" for n, _ in STATE_FILTERS]
+        assert all(r.error is None and r.calls > 0 for r in results)
+        sent = client._mujoco_scene.GetFullState.call_args_list[-1][0][0]
+        assert sent.filter.filter_by_slot_id == 1
+
+    def test_bench_main_connects_without_robot_and_keeps_engine(self, tmp_path, capsys):
+        """bench_main uses a bare client, writes the report and only closes the channel."""
+        import json
+
+        from luckyrobots.cli.bench import bench_main
+        from luckyrobots.grpc.generated import mujoco_scene_pb2
+
+        client = LuckyEngineClient()
+        client._mujoco_scene = MagicMock()
+        client._mujoco_scene.GetFullState.return_value = mujoco_scene_pb2.GetFullStateResponse(
+            success=True
+        )
+        path = tmp_path / "bench.json"
+
+        with patch("luckyrobots.LuckyEngineClient", return_value=client) as make_client, \
+                patch.object(client, "wait_for_server", return_value=True), \
+                patch.object(client, "close") as close, \
+                patch("luckyrobots.session.stop_luckyengine") as stop_engine:
+            code = bench_main("10.0.0.5", 50051, groups=["state"], duration_s=0.01,
+                              json_path=str(path))
+
+        assert code == 0
+        make_client.assert_called_once_with(host="10.0.0.5", port=50051)
+        close.assert_called_once_with()
+        stop_engine.assert_not_called()
+        report = json.loads(path.read_text())
+        assert report["engine"] == "10.0.0.5:50051"
+        assert all(r["error"] is None for r in report["results"])
+
+    def test_bench_main_unreachable_engine_exits_2(self, capsys):
+        """No server within the connect timeout is exit code 2."""
+        from luckyrobots.cli.bench import bench_main
+
+        client = MagicMock()
+        client.wait_for_server.return_value = False
+        with patch("luckyrobots.LuckyEngineClient", return_value=client):
+            assert bench_main("10.0.0.5", 50051, groups=["state"]) == 2
+        client.close.assert_called_once_with()
+        assert "FAILED" in capsys.readouterr().err
+
+    def test_unknown_group(self):
+        """Unknown group names are rejected."""
+        from luckyrobots.cli.bench import run_suite
+
+        with pytest.raises(ValueError, match="Unknown bench group"):
+            run_suite(MagicMock(), groups=["nope"])
+
+    def test_compare_reports(self):
+        """Throughput and p50 changes are relative to the baseline."""
+        from luckyrobots.cli.bench import compare_reports
+
+        baseline = {"results": [
+            {"name": "step", "throughput_hz": 1000.0, "latency_ms": {"p50": 1.0}},
+            {"name": "gone", "throughput_hz": 10.0, "latency_ms": {"p50": 1.0}},
+        ]}
+        current = {"results": [
+            {"name": "step", "throughput_hz": 800.0, "latency_ms": {"p50": 1.25}},
+            {"name": "new", "throughput_hz": 10.0, "latency_ms": {"p50": 1.0}},
+        ]}
+
+        rows = compare_reports(current, baseline)
+
+        assert [r["name"] for r in rows] == ["step"]
+        assert rows[0]["throughput_change"] == pytest.approx(-0.2)
+        assert rows[0]["p50_change"] == pytest.approx(0.25)
+
+
+class TestEnginePool:
+    """Unit tests for EnginePool fan-out and dead-worker restart (no server needed)."""
+
+    @staticmethod
+    def _pool(fake_agent_stub, n=2, **options):
+        from luckyrobots import EnginePool
+
+        pool = EnginePool("test_robot", remote=[f"10.0.0.{i}:50051" for i in range(n)], **options)
+        for worker in pool.workers:
+            client = LuckyEngineClient(robot_name="test_robot")
+            client._channel = MagicMock()
+            client._agent = fake_agent_stub
+            worker.session._engine_client = client
+        return pool
+
+    @staticmethod
+    def _future(resp=None, error=None):
+        future = MagicMock()
+        future.done.return_value = True
+        if error is not None:
+            future.result.side_effect = error
+        else:
+            future.result.return_value = resp
+        return future
+
+    def test_parses_addresses_and_per_port_lock_files(self):
+        """Remote addresses split into host/port; local workers get their own lock file."""
+        from luckyrobots import EnginePool
+
+        pool = EnginePool("r", local_ports=[50060, 50061], remote=[("gpu-1", 50051)], scene="s")
+
+        assert [w.address for w in pool.workers] == [
+            "127.0.0.1:50060", "127.0.0.1:50061", "gpu-1:50051",
+        ]
+        locks = {w.process.lock_file for w in pool.workers[:2]}
+        assert len(locks) == 2 and all(lock.endswith(("_50060", "_50061")) for lock in locks)
+        assert pool.workers[2].process is None
+        with pytest.raises(ValueError, match="host:port"):
+            EnginePool("r", remote=["nohost"])
+        with pytest.raises(ValueError, match="scene"):
+            EnginePool("r", local_ports=[50060])
+
+    def test_step_sends_every_rpc_before_waiting(self, fake_agent_stub):
+        """All Step futures are issued before the first result() is read."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        pool = self._pool(fake_agent_stub, n=3)
+        events = []
+
+        def _issue(request, timeout=None):
+            events.append(("send", list(request.actions)))
+            resp = agent_pb2.StepResponse(success=True)
+            resp.observation.observations.append(request.actions[0])
+            future = self._future(resp)
+            future.result.side_effect = lambda: events.append(("wait",)) or resp
+            return future
+
+        fake_agent_stub.Step.future.side_effect = _issue
+
+        obs = pool.step(np.array([[0.0], [1.0], [2.0]]))
+
+        assert [e[0] for e in events] == ["send"] * 3 + ["wait"] * 3
+        assert [o.observation[0] for o in obs] == [0.0, 1.0, 2.0]
+        with pytest.raises(ValueError, match="one per worker"):
+            pool.step([[0.0]])
+
+    def test_dead_worker_is_restarted_and_reset(self, fake_agent_stub):
+        """UNAVAILABLE restarts the worker and returns a truncated post-reset observation."""
+        import grpc
+        from luckyrobots.grpc.generated import agent_pb2
+
+        class _Unavailable(grpc.RpcError):
+            def code(self):
+                return grpc.StatusCode.UNAVAILABLE
+
+        pool = self._pool(fake_agent_stub, n=2, max_restarts=1)
+        ok = agent_pb2.StepResponse(success=True)
+        fake_agent_stub.Step.future.side_effect = [
+            self._future(ok), self._future(error=_Unavailable()),
+        ]
+        reset_obs = ObservationResponse(
+            observation=[0.5], actions=[], timestamp_ms=0, frame_number=0, agent_name="agent_0",
+        )
+        dead = pool.workers[1]
+        with patch.object(pool, "_bring_up") as bring_up, \
+                patch.object(dead.session, "reset", return_value=reset_obs):
+            obs = pool.step([[0.0], [0.0]])
+
+        bring_up.assert_called_once_with(dead)
+        assert dead.restarts == 1
+        assert not obs[0].truncated
+        assert obs[1].truncated and obs[1].info["worker_restarted"] == 1.0
+
+        with pytest.raises(RuntimeError, match="after 1 restarts"):
+            pool.restart_worker(1)
+
+    def test_other_rpc_errors_propagate(self, fake_agent_stub):
+        """Errors from a healthy worker are raised, not treated as a crash."""
+        import grpc
+
+        class _Invalid(grpc.RpcError):
+            def code(self):
+                return grpc.StatusCode.INVALID_ARGUMENT
+
+        pool = self._pool(fake_agent_stub, n=1)
+        fake_agent_stub.Step.future.return_value = self._future(error=_Invalid())
+        with patch.object(pool, "_healthy", return_value=True), \
+                patch.object(pool, "restart_worker") as restart:
+            with pytest.raises(grpc.RpcError):
+                pool.step([[0.0]])
+        restart.assert_not_called()
+
+    def test_close_continues_past_failing_worker(self, fake_agent_stub):
+        """One worker failing to close still closes the rest and stops the executor."""
+        pool = self._pool(fake_agent_stub, n=3)
+        processes = [MagicMock(name=f"process_{i}") for i in range(3)]
+        for worker, process in zip(pool.workers, processes):
+            worker.process = process
+        processes[1].stop.side_effect = OSError("already gone")
+
+        with patch.object(pool.workers[0].session, "close", side_effect=RuntimeError("boom")), \
+                patch.object(pool._executor, "shutdown") as shutdown:
+            pool.close()
+
+        assert all(p.stop.call_count == 1 for p in processes)
+        assert pool.workers[2].session.engine_client is None
+        shutdown.assert_called_once_with(wait=False)
+
+
+class TestMetadataCache:
+    """Unit tests for fingerprint-keyed metadata caching (no server needed)."""
+
+    @staticmethod
+    def _client(fake_agent_stub, directory, fingerprint="fp-1"):
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        client.enable_metadata_cache(directory)
+        fake_agent_stub.GetEngineFingerprint.return_value = agent_pb2.GetEngineFingerprintResponse(
+            fingerprint=agent_pb2.EngineFingerprint(
+                engine_version="1.0",
+                model_hash="model-1",
+                manifest_hash="manifest-1",
+                api_hash="api-1",
+                fingerprint=fingerprint,
+            )
+        )
+        return client
+
+    def test_manifest_fetched_once_across_clients(self, fake_agent_stub, tmp_path):
+        """A second client against the same engine loads the manifest from disk."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        manifest = agent_pb2.EngineCapabilityManifest(engine_version="1.0", manifest_version=3)
+        fake_agent_stub.GetCapabilityManifest.return_value = (
+            agent_pb2.GetCapabilityManifestResponse(manifest=manifest)
+        )
+
+        first = self._client(fake_agent_stub, tmp_path).get_capability_manifest("test_robot")
+        second_client = self._client(fake_agent_stub, tmp_path)
+        second = second_client.get_capability_manifest("test_robot")
+
+        assert first == second and second["manifest_version"] == 3
+        assert fake_agent_stub.GetCapabilityManifest.call_count == 1
+        assert second_client.metadata_cache.hits == 1
+
+    def test_layout_omitted_session_is_restored_from_cache(self, fake_agent_stub, tmp_path):
+        """The cached session hash is offered and omitted layouts are filled back in."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        contract = {"robot": "test_robot"}
+        fake_agent_stub.NegotiateTask.return_value = agent_pb2.NegotiateTaskResponse(
+            success=True,
+            session=agent_pb2.NegotiatedTaskSession(
+                session_id="s-1",
+                session_hash="h-1",
+                reward_terms=["alive"],
+                observation_layout=[agent_pb2.ObservationSlot(name="q", size=12)],
+            ),
+        )
+        self._client(fake_agent_stub, tmp_path).negotiate_task(contract)
+
+        fake_agent_stub.NegotiateTask.return_value = agent_pb2.NegotiateTaskResponse(
+            success=True,
+            session=agent_pb2.NegotiatedTaskSession(
+                session_id="s-2", session_hash="h-1", layout_omitted=True
+            ),
+        )
+        result = self._client(fake_agent_stub, tmp_path).negotiate_task(contract)
+
+        request = fake_agent_stub.NegotiateTask.call_args[0][0]
+        assert request.cached_session_hash == "h-1"
+        assert result["session_id"] == "s-2"
+        assert result["reward_terms"] == ["alive"]
+        assert result["observation_layout"][0]["size"] == 12
+
+    def test_bypassed_when_engine_has_no_fingerprint(self, fake_agent_stub, tmp_path):
+        """Older engines (UNIMPLEMENTED) are served uncached, asked only once."""
+        import grpc
+        from luckyrobots.grpc.generated import agent_pb2
+
+        class _Unimplemented(grpc.RpcError):
+            def code(self):
+                return grpc.StatusCode.UNIMPLEMENTED
+
+        client = self._client(fake_agent_stub, tmp_path)
+        fake_agent_stub.GetEngineFingerprint.side_effect = _Unimplemented()
+        fake_agent_stub.GetCapabilityManifest.return_value = (
+            agent_pb2.GetCapabilityManifestResponse()
+        )
+
+        client.get_capability_manifest()
+        client.get_capability_manifest()
+
+        assert client.get_engine_fingerprint() is None
+        assert fake_agent_stub.GetCapabilityManifest.call_count == 2
+        assert fake_agent_stub.GetEngineFingerprint.call_count == 1
+        assert not any(tmp_path.iterdir())
+
+
+class TestAsyncRLSurface:
+    """Unit tests for AsyncSession stepping and AsyncLuckyEnv pipelining (no server needed)."""
+
+    @staticmethod
+    def _session(steps):
+        from unittest.mock import AsyncMock
+
+        from luckyrobots import AsyncSession
+
+        sess = AsyncSession()
+        sess._channel = MagicMock()
+        sess._agent = MagicMock()
+        sess._agent.Step = AsyncMock(side_effect=steps)
+        return sess
+
+    def test_session_step_uses_negotiated_layout(self):
+        """Async negotiate_task + step decode exactly like the sync client."""
+        import asyncio
+        from unittest.mock import AsyncMock
+
+        from luckyrobots.grpc.generated import agent_pb2
+
+        sess = self._session([
+            agent_pb2.StepResponse(
+                success=True,
+                observation=agent_pb2.AgentFrame(observations=[0.5, 1.5]),
+                reward_signals={"alive": 1.0},
+            )
+        ])
+        sess._agent.NegotiateTask = AsyncMock(
+            return_value=agent_pb2.NegotiateTaskResponse(
+                success=True,
+                session=agent_pb2.NegotiatedTaskSession(session_id="s-1", reward_terms=["alive"]),
+            )
+        )
+
+        async def run():
+            result = await sess.negotiate_task({"robot": "test_robot"})
+            obs = await sess.step(actions=np.array([0.1, 0.2]), num_substeps=2)
+            return result, obs
+
+        result, obs = asyncio.run(run())
+
+        req = sess._agent.Step.call_args.args[0]
+        assert result["reward_terms"] == ["alive"]
+        assert req.num_substeps == 2 and list(req.actions) == pytest.approx([0.1, 0.2])
+        assert obs.observation == pytest.approx([0.5, 1.5])
+        assert obs.reward_signals == {"alive": 1.0}
+
+    def test_step_async_keeps_one_step_in_flight(self):
+        """step_async returns before the response; a second send must await the first."""
+        import asyncio
+
+        from luckyrobots import AsyncLuckyEnv
+        from luckyrobots.grpc.generated import agent_pb2
+
+        env = AsyncLuckyEnv(reward_terms=["alive"], reward_fn=lambda s: 2 * s["alive"])
+        env._session = self._session([
+            agent_pb2.StepResponse(
+                success=True,
+                observation=agent_pb2.AgentFrame(observations=[float(i)]),
+                reward_signals={"alive": 1.0},
+            )
+            for i in range(2)
+        ])
+
+        async def run():
+            pending = await env.step_async(np.zeros(1))
+            with pytest.raises(RuntimeError, match="in flight"):
+                await env.step_async(np.zeros(1))
+            first = await pending
+            second = await env.step(np.ones(1))
+            return first, second
+
+        first, second = asyncio.run(run())
+
+        assert first[0].tolist() == [0.0] and first[1] == 2.0
+        assert second[0].tolist() == [1.0] and second[4]["step_count"] == 2
+        assert env._session._agent.Step.call_count == 2
+
+    def test_step_async_applies_env_timeout(self):
+        """The env's timeout becomes the Step deadline and its error message."""
+        import asyncio
+
+        import grpc
+
+        from luckyrobots import AsyncLuckyEnv
+
+        class _Deadline(grpc.RpcError):
+            def code(self):
+                return grpc.StatusCode.DEADLINE_EXCEEDED
+
+        env = AsyncLuckyEnv(reward_terms=["alive"], reward_fn=lambda s: 0.0, timeout=7.0)
+        env._session = self._session(_Deadline())
+
+        with pytest.raises(RuntimeError, match=r"timeout \(7.0s\)"):
+            asyncio.run(env.step(np.zeros(1)))
+        assert env._session._agent.Step.call_args.kwargs["timeout"] == 7.0
+
+    def test_reset_raises_when_reset_agent_fails(self):
+        """A failed ResetAgentResponse raises instead of stepping a stale episode."""
+        import asyncio
+        from unittest.mock import AsyncMock
+
+        from luckyrobots import AsyncLuckyEnv
+        from luckyrobots.grpc.generated import agent_pb2
+
+        env = AsyncLuckyEnv(reward_terms=["alive"], reward_fn=lambda s: 0.0)
+        env._session = self._session([])
+        env._session._agent.ResetAgent = AsyncMock(
+            return_value=agent_pb2.ResetAgentResponse(success=False, message="no agent")
+        )
+
+        with pytest.raises(RuntimeError, match="ResetAgent failed: no agent"):
+            asyncio.run(env.reset())
+        env._session._agent.Step.assert_not_called()
+
+
+class TestRpcQos:
+    """Unit tests for RPC scheduling classes and the bulk-stream connection."""
+
+    def test_set_rpc_qos_and_metrics(self):
+        """Class names map to RpcPriorityClass; metrics come back keyed by class."""
+        from luckyrobots.grpc.generated import scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._scene = MagicMock()
+        client._scene.SetRpcQos.return_value = scene_pb2.RpcQosResponse(
+            success=True,
+            config=scene_pb2.RpcQosConfig(
+                classes=[scene_pb2.RpcClassConfig(
+                    priority_class=scene_pb2.RPC_PRIORITY_CLASS_BULK,
+                    num_threads=1,
+                    max_bytes_per_second=40_000_000,
+                )],
+            ),
+        )
+        client._scene.GetRpcQosMetrics.return_value = scene_pb2.GetRpcQosMetricsResponse(
+            window_s=2.0,
+            classes=[scene_pb2.RpcClassMetrics(
+                priority_class=scene_pb2.RPC_PRIORITY_CLASS_CONTROL,
+                queue_depth=0,
+                max_queue_depth=3,
+                latency_p99_us=900,
+            )],
+        )
+
+        cfg = client.set_rpc_qos(
+            classes={"bulk": {"num_threads": 1, "max_bytes_per_second": 40e6}},
+            method_classes={"hazel.rpc.AgentService/StreamSynchronized": "control"},
+        )
+        metrics = client.get_rpc_qos_metrics(reset=True)
+
+        req = client._scene.SetRpcQos.call_args.args[0]
+        assert req.config.classes[0].priority_class == scene_pb2.RPC_PRIORITY_CLASS_BULK
+        assert req.config.classes[0].max_bytes_per_second == 40_000_000
+        assert req.config.method_classes[0].priority_class == scene_pb2.RPC_PRIORITY_CLASS_CONTROL
+        assert cfg["classes"]["bulk"]["num_threads"] == 1
+        assert client._scene.GetRpcQosMetrics.call_args.args[0].reset
+        assert metrics["window_s"] == 2.0
+        assert metrics["classes"]["control"]["max_queue_depth"] == 3
+        assert metrics["classes"]["control"]["latency_p99_us"] == 900
+
+        with pytest.raises(ValueError, match="RPC priority class"):
+            client.set_rpc_qos(classes={"realtime": {}})
+        with pytest.raises(ValueError, match="max_fps"):
+            client.set_rpc_qos(classes={"bulk": {"max_fps": 30}})
+
+    def test_get_rpc_qos_failure_raises(self):
+        """GetRpcQos with success=False raises instead of returning an empty config."""
+        from luckyrobots.grpc.generated import scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._scene = MagicMock()
+        client._scene.GetRpcQos.return_value = scene_pb2.RpcQosResponse(
+            success=False, message="qos disabled"
+        )
+
+        with pytest.raises(RuntimeError, match="GetRpcQos failed: qos disabled"):
+            client.get_rpc_qos()
+
+    def test_bulk_stub_uses_second_connection(self):
+        """Streams open on their own channel only when bulk_connection=True."""
+        shared = LuckyEngineClient(robot_name="test_robot")
+        shared.connect()
+        assert shared.bulk_stub("camera") is shared.camera
+        shared.close()
+
+        client = LuckyEngineClient(robot_name="test_robot", bulk_connection=True)
+        client.connect()
+        assert client._bulk_channel is not client.channel
+        assert client.bulk_stub("camera") is not client.camera
+        assert client.bulk_stub("camera") is client.bulk_stub("camera")
+        client.close()
+        assert client._bulk_channel is None
+
+
+class TestSubsteps:
+    """Unit tests for engine-side action repeat (StepRequest.num_substeps)."""
+
+    def test_num_substeps_forwarded(self, fake_agent_stub):
+        """num_substeps / substep_reduction reach the StepRequest in one RPC."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+            success=True, substeps_completed=3, reward_signals={"alive": 3.0}
+        )
+
+        obs = client.step(actions=[0.0], num_substeps=4, substep_reduction="mean")
+
+        req = fake_agent_stub.Step.call_args.args[0]
+        assert fake_agent_stub.Step.call_count == 1
+        assert req.num_substeps == 4
+        assert req.substep_reduction == agent_pb2.SUBSTEP_REDUCTION_MEAN
+        assert obs.substeps_completed == 3
+
+    def test_invalid_substep_args_rejected(self, fake_agent_stub):
+        """Zero substeps or an unknown reduction fails before any RPC."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+
+        with pytest.raises(ValueError, match="num_substeps"):
+            client.step(actions=[0.0], num_substeps=0)
+        with pytest.raises(ValueError, match="substep_reduction"):
+            client.step(actions=[0.0], num_substeps=2, substep_reduction="max")
+        fake_agent_stub.Step.assert_not_called()
+
+
+class TestStepSpatialQueries:
+    """Unit tests for raycasts / height scans / contacts attached to a Step."""
+
+    def test_spatial_queries_attach_to_step(self, fake_agent_stub):
+        """Raycasts / height scans / contacts ride on the Step RPC and decode from it."""
+        from luckyrobots.grpc.generated import agent_pb2, mujoco_scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+            success=True,
+            raycasts=[mujoco_scene_pb2.RaycastResponse(
+                success=True,
+                num_rays=1,
+                distances=np.array([0.25], dtype="<f4").tobytes(),
+                geom_ids=np.array([7], dtype="<i4").tobytes(),
+            )],
+            contacts=mujoco_scene_pb2.GetContactsResponse(success=True),
+        )
+
+        obs = client.step(
+            actions=[0.0],
+            raycasts=[{"origins": [[0, 0, 1]], "directions": [0, 0, -1]}],
+            height_scans=[{"body": "base", "resolution": 0.05}],
+            contacts={"bodies": ["foot"], "include_forces": True},
+        )
+
+        req = fake_agent_stub.Step.call_args.args[0]
+        assert len(req.raycasts) == 1 and req.raycasts[0].num_rays == 1
+        assert req.height_scans[0].body == "base"
+        assert req.contacts.include_forces and list(req.contacts.bodies) == ["foot"]
+        assert obs.raycasts[0].distances.tolist() == [0.25]
+        assert obs.height_scans == [] and len(obs.contacts) == 0
+        assert obs.query_errors == {}
+
+    def test_failed_query_is_reported_per_entry(self, fake_agent_stub):
+        """A failed query decodes to None with its message; the others still decode."""
+        from luckyrobots.grpc.generated import agent_pb2, mujoco_scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+            success=True,
+            raycasts=[
+                mujoco_scene_pb2.RaycastResponse(success=False, message="no body"),
+                mujoco_scene_pb2.RaycastResponse(
+                    success=True,
+                    num_rays=1,
+                    distances=np.array([1.5], dtype="<f4").tobytes(),
+                    geom_ids=np.array([3], dtype="<i4").tobytes(),
+                ),
+            ],
+            contacts=mujoco_scene_pb2.GetContactsResponse(success=False, message="bad body"),
+        )
+
+        obs = client.step(
+            actions=[0.0],
+            raycasts=[
+                {"origins": [0, 0, 1], "directions": [0, 0, 1]},
+                {"origins": [0, 0, 1], "directions": [0, 0, -1]},
+            ],
+            contacts={"bodies": ["nope"]},
+        )
+
+        assert obs.raycasts[0] is None
+        assert obs.raycasts[1].distances.tolist() == [1.5]
+        assert obs.contacts is None
+        assert obs.query_errors == {"raycasts[0]": "no body", "contacts": "bad body"}
+
+
+class TestPhysicsThreading:
+    """Unit tests for multi-threaded physics config and per-thread timings."""
+
+    def test_step_decodes_per_thread_breakdown(self, fake_agent_stub):
+        """StepResponse.physics_threads becomes PhysicsThreadTiming entries."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        resp = agent_pb2.StepResponse(success=True, physics_step_duration_us=1000)
+        resp.physics_threads.add(thread_index=0, busy_us=900, partitions=3)
+        resp.physics_threads.add(thread_index=1, busy_us=700, partitions=2, stolen_partitions=1)
+        fake_agent_stub.Step.return_value = resp
+
+        obs = client.step(actions=[0.0])
+
+        assert obs.physics_step_duration_us == 1000
+        assert [t.partitions for t in obs.physics_threads] == [3, 2]
+        assert obs.physics_threads[1].stolen_partitions == 1
+        assert obs.physics_thread_utilization == pytest.approx(0.8)
+
+    def test_single_threaded_step_has_no_breakdown(self, fake_agent_stub):
+        """No physics_threads means utilization reads as 1.0."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+            success=True, physics_step_duration_us=500
+        )
+
+        obs = client.step(actions=[0.0])
+
+        assert obs.physics_threads == []
+        assert obs.physics_thread_utilization == 1.0
+
+    def test_set_physics_threading(self):
+        """Partitioning names map to the enum; the effective config comes back."""
+        from luckyrobots.grpc.generated import scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._scene = MagicMock()
+        client._scene.SetPhysicsThreading.return_value = scene_pb2.PhysicsThreadingResponse(
+            success=True,
+            config=scene_pb2.PhysicsThreadingConfig(
+                num_threads=8, partitioning=scene_pb2.PHYSICS_PARTITIONING_ISLANDS
+            ),
+            hardware_threads=16,
+            partition_count=20,
+        )
+
+        cfg = client.set_physics_threading(num_threads=0, partitioning="islands")
+
+        req = client._scene.SetPhysicsThreading.call_args.args[0]
+        assert req.config.partitioning == scene_pb2.PHYSICS_PARTITIONING_ISLANDS
+        assert cfg == {
+            "num_threads": 8,
+            "partitioning": "islands",
+            "hardware_threads": 16,
+            "partition_count": 20,
+        }
+        with pytest.raises(ValueError, match="partitioning"):
+            client.set_physics_threading(partitioning="bodies")
+
+    def test_get_physics_threading_failure_raises(self):
+        """A failed query raises instead of returning a config of zeros."""
+        from luckyrobots.grpc.generated import scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._scene = MagicMock()
+        client._scene.GetPhysicsThreading.return_value = scene_pb2.PhysicsThreadingResponse(
+            success=False, message="no scene loaded"
+        )
+
+        with pytest.raises(RuntimeError, match="no scene loaded"):
+            client.get_physics_threading()
+
+
+class TestCameraCapture:
+    """Unit tests for batched / pipelined Step camera capture."""
+
+    def test_pipelined_mode_sent_and_latency_tagged(self, fake_agent_stub):
+        """pipelined=True selects CAMERA_CAPTURE_PIPELINED and frames keep their latency tag."""
+        from luckyrobots.grpc.generated import agent_pb2, media_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        client.configure_cameras(
+            [{"name": "wrist", "width": 64, "height": 48}, {"name": "head"}], pipelined=True
+        )
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+            success=True,
+            camera_frames=[
+                media_pb2.NamedImageFrame(
+                    name="wrist",
+                    frame=media_pb2.ImageFrame(data=bytes(4), width=1, height=1, channels=4),
+                    latency_steps=1,
+                )
+            ],
+        )
+
+        obs = client.step(actions=[0.0])
+
+        req = fake_agent_stub.Step.call_args.args[0]
+        assert req.camera_capture_mode == agent_pb2.CAMERA_CAPTURE_PIPELINED
+        assert [c.name for c in req.camera_requests] == ["wrist", "head"]
+        assert obs.camera_frames[0].latency_steps == 1
+
+    def test_default_mode_is_sync(self, fake_agent_stub):
+        """Without pipelined=True frames are read back within the step."""
+        from luckyrobots.grpc.generated import agent_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        client.configure_cameras([{"name": "wrist"}])
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(success=True)
+
+        client.step(actions=[0.0])
+
+        req = fake_agent_stub.Step.call_args.args[0]
+        assert req.camera_capture_mode == agent_pb2.CAMERA_CAPTURE_SYNC
+
+
+class TestCameraRenderTargets:
+    """Unit tests for depth / segmentation / RGB8 camera render targets."""
+
+    def test_render_targets_requested_and_decoded(self, fake_agent_stub):
+        """Depth and segmentation ride in the same NamedImageFrame as the color image."""
+        import struct
+
+        from luckyrobots.grpc.generated import agent_pb2, media_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        client.configure_cameras(
+            [{"name": "wrist", "color": "rgb8", "depth": "u16", "segmentation": True}]
+        )
+        fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+            success=True,
+            camera_frames=[
+                media_pb2.NamedImageFrame(
+                    name="wrist",
+                    frame=media_pb2.ImageFrame(
+                        data=bytes(6), width=2, height=1, channels=3,
+                        pixel_format=media_pb2.PIXEL_FORMAT_RGB8,
+                    ),
+                    render_targets=[
+                        media_pb2.ImageFrame(
+                            data=struct.pack("<2H", 1000, 2500), width=2, height=1,
+                            channels=1, pixel_format=media_pb2.PIXEL_FORMAT_DEPTH_U16,
+                            depth_scale=0.001,
+                        ),
+                        media_pb2.ImageFrame(
+                            data=struct.pack("<2H", 0, 7), width=2, height=1, channels=1,
+                            pixel_format=media_pb2.PIXEL_FORMAT_SEGMENTATION_U16,
+                        ),
+                    ],
+                )
+            ],
+        )
+
+        obs = client.step(actions=[0.0])
+
+        req = fake_agent_stub.Step.call_args.args[0].camera_requests[0]
+        assert req.color_format == media_pb2.PIXEL_FORMAT_RGB8
+        assert list(req.render_targets) == [
+            media_pb2.PIXEL_FORMAT_DEPTH_U16,
+            media_pb2.PIXEL_FORMAT_SEGMENTATION_U16,
+        ]
+        frame = obs.camera_frames[0]
+        assert frame.array.shape == (1, 2, 3)
+        assert frame.depth_m().tolist() == pytest.approx([[1.0, 2.5]])
+        assert frame.segmentation.array[..., 0].tolist() == [[0, 7]]
+
+    def test_unknown_render_target_rejected(self):
+        """A typo in a format key fails at configure time."""
+        client = LuckyEngineClient(robot_name="test_robot")
+
+        with pytest.raises(ValueError, match="depth"):
+            client.configure_cameras([{"name": "wrist", "depth": "f32"}])
+
+
+class _FakeVideoFrame:
+    def __init__(self, width, height):
+        self.width = width
+        self.height = height
+
+    def to_ndarray(self, format="rgb24"):
+        return np.zeros((self.height, self.width, 3 if format == "rgb24" else 4), np.uint8)
+
+
+class _FakeAv:
+    """Stand-in for PyAV that records the bytes handed to the decoder."""
+
+    class error:
+        FFmpegError = RuntimeError
+
+    class Packet:
+        def __init__(self, data):
+            self.data = data
+
+    def __init__(self):
+        self.fed = []
+        fed = self.fed
+
+        class _Ctx:
+            def decode(self, packet):
+                fed.append(packet.data)
+                return [_FakeVideoFrame(4, 2)]
+
+        self.CodecContext = MagicMock()
+        self.CodecContext.create.return_value = _Ctx()
+
+
+class TestVideoStreams:
+    """Unit tests for h264/hevc/av1 camera and viewport streams."""
+
+    def test_encoder_settings_forwarded(self):
+        """keyframe_interval / bitrate land in the StreamCameraRequest."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._camera = MagicMock()
+
+        client.stream_camera(name="front", format="h264", keyframe_interval=30, bitrate_kbps=4000)
+
+        req = client._camera.StreamCamera.call_args.args[0]
+        assert req.format == "h264"
+        assert req.video.keyframe_interval == 30
+        assert req.video.bitrate_kbps == 4000
+
+    def test_decode_requires_video_format(self):
+        """decode=True on a still-image format is a caller error."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._viewport = MagicMock()
+
+        with pytest.raises(ValueError, match="video format"):
+            client.stream_viewport(format="jpeg", decode=True)
+
+    def test_decoder_waits_for_keyframe_and_prepends_config(self):
+        """Deltas before the first keyframe are dropped; config rides in-band."""
+        from luckyrobots.grpc.generated import media_pb2
+        from luckyrobots.video import VideoStreamDecoder
+
+        fake_av = _FakeAv()
+        packets = [
+            media_pb2.ImageFrame(data=b"D0", packet_type=media_pb2.IMAGE_PACKET_DELTA),
+            media_pb2.ImageFrame(data=b"CFG", packet_type=media_pb2.IMAGE_PACKET_CODEC_CONFIG),
+            media_pb2.ImageFrame(
+                data=b"K1", packet_type=media_pb2.IMAGE_PACKET_KEYFRAME, frame_number=1
+            ),
+            media_pb2.ImageFrame(
+                data=b"D2", packet_type=media_pb2.IMAGE_PACKET_DELTA, frame_number=2
+            ),
+        ]
+
+        with patch("luckyrobots.video._require_av", return_value=fake_av):
+            decoder = VideoStreamDecoder(packets, codec="h264", name="front")
+            frames = list(decoder)
+
+        assert fake_av.fed == [b"CFGK1", b"D2"]
+        assert decoder.dropped_packets == 1
+        assert [f.frame_number for f in frames] == [1, 2]
+        assert frames[0].array.shape == (2, 4, 3)
+
+
+class TestHeadlessMode:
+    """Unit tests for headless launch flags and GetSceneInfo startup stats."""
+
+    def test_headless_launch_disables_rendering(self, tmp_path):
+        """headless=True passes the render-free flags and the scene cache dir."""
+        from luckyrobots.engine.manager import EngineProcess
+
+        exe = tmp_path / "LuckyEngine"
+        exe.write_text("")
+        proc = EngineProcess()
+        with patch("luckyrobots.engine.manager.subprocess.Popen") as popen, \
+                patch("luckyrobots.engine.manager._create_lock_file"), \
+                patch.object(proc, "is_running", return_value=False), \
+                patch.object(proc, "_monitor_process"):
+            popen.return_value.pid = 1234
+            assert proc.launch(
+                executable_path=str(exe), headless=True, scene_cache=str(tmp_path)
+            )
+
+        command = popen.call_args.args[0]
+        assert "-Headless" in command
+        assert "--no-render=1" in command
+        assert "--no-editor-ui=1" in command
+        assert f"--scene-cache={tmp_path}" in command
+
+    def test_scene_info_reports_startup_and_memory(self):
+        """get_scene_info() surfaces run mode, startup time and RSS."""
+        from luckyrobots.grpc.generated import scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._scene = MagicMock()
+        client._scene.GetSceneInfo.return_value = scene_pb2.GetSceneInfoResponse(
+            scene_name="ArmLevel",
+            headless=True,
+            startup_duration_ms=640,
+            scene_cache_hit=True,
+            resident_memory_bytes=512 << 20,
+        )
+
+        info = client.get_scene_info()
+
+        assert info["headless"] is True
+        assert info["rendering_enabled"] is False
+        assert info["startup_duration_ms"] == 640
+        assert info["scene_cache_hit"] is True
+        assert info["resident_memory_bytes"] == 512 << 20
+
+
+class TestDeltaTelemetry:
+    """Unit tests for delta-encoded StreamTelemetry reconstruction."""
+
+    def test_delta_telemetry_rebuilds_arrays(self):
+        """Keyframe + changed-index frames come back as full qpos/ctrl arrays."""
+        from luckyrobots.grpc.generated import telemetry_pb2
+
+        key = telemetry_pb2.TelemetryFrame(
+            keyframe=True, observation_qpos=[0.0, 0.0], action_ctrl=[1.0], frame_number=1
+        )
+        delta = telemetry_pb2.TelemetryFrame(frame_number=2)
+        delta.observation_qpos_delta.indices.append(1)
+        delta.observation_qpos_delta.values.append(0.5)
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._telemetry = MagicMock()
+        client._telemetry.StreamTelemetry.return_value = iter([key, delta])
+
+        stream = client.stream_telemetry(target_fps=60, delta=True, keyframe_interval=30)
+        samples = [(s.frame_number, s.qpos.tolist(), s.ctrl.tolist()) for s in stream]
+
+        req = client._telemetry.StreamTelemetry.call_args.args[0]
+        assert req.delta.enabled and req.delta.keyframe_interval == 30
+        assert samples == [(1, [0.0, 0.0], [1.0]), (2, [0.0, 0.5], [1.0])]
+        assert (stream.keyframes, stream.delta_frames) == (1, 1)
+
+    def test_plain_telemetry_returns_raw_stream(self):
+        """Without delta=True the raw TelemetryFrame stream is returned untouched."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._telemetry = MagicMock()
+        call = client._telemetry.StreamTelemetry.return_value
+
+        assert client.stream_telemetry() is call
+        assert not client._telemetry.StreamTelemetry.call_args.args[0].HasField("delta")
+
+
+class TestSynchronizedStream:
+    """Unit tests for the lock-step StreamSynchronized wrapper."""
+
+    def test_request_and_payload_decoding(self, fake_agent_stub):
+        """Sources map onto SyncSubStreams; payloads decode to wrapper types."""
+        from luckyrobots.grpc.generated import agent_pb2
+        from luckyrobots.streams import camera_source, full_state_source, robot_controller_source
+
+        frame = agent_pb2.SynchronizedFrame(frame_number=120, sim_time=2.4, skipped_since_last=3)
+        cam = frame.payloads.add(name="front")
+        cam.camera.width, cam.camera.height, cam.camera.channels = 1, 1, 3
+        cam.camera.data = b"\x01\x02\x03"
+        state = frame.payloads.add(name="state")
+        state.full_state.success = True
+        state.full_state.state.qpos.extend([0.5])
+        frame.payloads.add(name="robot", error="entity 42 destroyed")
+        frame.stats.frames_sent = 10
+        frame.stats.frames_skipped = 5
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = fake_agent_stub
+        fake_agent_stub.StreamSynchronized.return_value = iter([frame])
+
+        stream = client.stream_synchronized(
+            {
+                "front": camera_source("front", width=64, height=48),
+                "state": full_state_source(),
+                "robot": robot_controller_source(42),
+            },
+            decimation=4,
+        )
+        (out,) = list(stream)
+
+        req = fake_agent_stub.StreamSynchronized.call_args.args[0]
+        assert req.decimation == 4
+        assert [s.WhichOneof("source") for s in req.streams] == [
+            "camera", "full_state", "robot_controller"
+        ]
+        assert req.streams[0].camera.width == 64
+        assert out.frame_number == 120
+        assert out["front"].array.shape == (1, 1, 3)
+        assert out["state"].qpos.tolist() == [0.5]
+        assert out.errors == {"robot": "entity 42 destroyed"}
+        assert out.skipped_since_last == 3
+        assert (stream.frames_sent, stream.frames_skipped) == (10, 5)
+
+    def test_invalid_sources_rejected(self):
+        """Unknown source types and video formats fail before the RPC."""
+        from luckyrobots.streams import camera_source
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._agent = MagicMock()
+
+        with pytest.raises(TypeError, match="StreamCameraRequest"):
+            client.stream_synchronized({"bad": {"camera": "front"}})
+        with pytest.raises(ValueError, match="raw/jpeg"):
+            camera_source("front", format="h264")
+        with pytest.raises(ValueError, match="decimation"):
+            client.stream_synchronized({"front": camera_source("front")}, decimation=0)
+        client._agent.StreamSynchronized.assert_not_called()
+
+
+class TestEngineRecorder:
+    """Unit tests for the engine-side dataset recorder RPCs."""
+
+    def test_start_recording_builds_request(self):
+        """Format, overflow and camera dicts map onto StartRecordingRequest."""
+        from luckyrobots.grpc.generated import recorder_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._recorder = MagicMock()
+        client._recorder.StartRecording.return_value = recorder_pb2.StartRecordingResponse(
+            success=True, recording_id="rec-1", output_dir="/data/run"
+        )
+
+        info = client.start_recording(
+            "run",
+            format="parquet_mp4",
+            columns=["qpos", "ctrl"],
+            cameras=[{"name": "Head", "codec": "hevc", "every_n_rows": 10}],
+            overflow="block",
+        )
+
+        req = client._recorder.StartRecording.call_args[0][0]
+        assert req.format == recorder_pb2.RECORDING_FORMAT_PARQUET_MP4
+        assert req.overflow == recorder_pb2.RECORDING_OVERFLOW_BLOCK
+        assert list(req.columns) == ["qpos", "ctrl"]
+        assert req.cameras[0].codec == "hevc"
+        assert req.cameras[0].every_n_rows == 10
+        assert info == {"recording_id": "rec-1", "output_dir": "/data/run"}
+
+    def test_start_recording_rejects_unknown_format(self):
+        """Unknown format names fail before any RPC is sent."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._recorder = MagicMock()
+
+        with pytest.raises(ValueError, match="recording format"):
+            client.start_recording("run", format="hdf5")
+        client._recorder.StartRecording.assert_not_called()
+
+    def test_stop_recording_returns_final_status(self):
+        """StopRecording's status (including drop counters) becomes a dict."""
+        from luckyrobots.grpc.generated import recorder_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._recorder = MagicMock()
+        client._recorder.StopRecording.return_value = recorder_pb2.StopRecordingResponse(
+            success=True,
+            status=recorder_pb2.RecordingStatus(
+                recording_id="rec-1", rows_recorded=1000, rows_dropped=3, episodes=2
+            ),
+        )
+
+        status = client.stop_recording("rec-1")
+
+        assert status["rows_recorded"] == 1000
+        assert status["rows_dropped"] == 3
+        assert status["episodes"] == 2
+        assert status["active"] is False
+
+    def test_stop_recording_failure_raises(self):
+        """success=False surfaces as RuntimeError."""
+        from luckyrobots.grpc.generated import recorder_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._recorder = MagicMock()
+        client._recorder.StopRecording.return_value = recorder_pb2.StopRecordingResponse(
+            success=False, message="no active recording"
+        )
+
+        with pytest.raises(RuntimeError, match="no active recording"):
+            client.stop_recording()
+
+
+class TestCommandLogReplay:
+    """Unit tests for the .lrrec recording format and engine-side replay."""
+
+    @staticmethod
+    def _recording():
+        from luckyrobots import RecordedEvent, SessionRecording
+        from luckyrobots.grpc.generated import agent_pb2
+
+        events = []
+        for i in range(5):
+            req = agent_pb2.SetPolicyCommandFloatRequest(slot_id=0, command_id=1, value=0.1 * i)
+            events.append(
+                RecordedEvent(
+                    timestamp_s=0.5 * i,
+                    rpc="AgentService.SetPolicyCommandFloat",
+                    request_json="",
+                    frame_number=100 * i if i != 2 else -1,
+                    request_bytes=req.SerializeToString(),
+                )
+            )
+        return SessionRecording(started_at=123.0, events=events)
+
+    def test_recorded_responses_keep_nested_frame_numbers(self, tmp_path):
+        """record_session reads the frame from nested observation / state messages."""
+        from types import SimpleNamespace
+
+        from luckyrobots import RecordingLog, record_session
+        from luckyrobots.grpc.generated import agent_pb2
+        from luckyrobots.grpc.generated import mujoco_scene_pb2 as ms_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._channel = MagicMock()
+        step = agent_pb2.StepResponse(
+            success=True, observation=agent_pb2.AgentFrame(frame_number=120)
+        )
+        state = ms_pb2.GetFullStateResponse(success=True, state=ms_pb2.FullState(frame_number=121))
+        applied = agent_pb2.ApplyRobotCommandsResponse(success=True, apply_frame_number=122)
+        client._agent = SimpleNamespace(
+            Step=lambda req, timeout=None: step,
+            ApplyRobotCommands=lambda req, timeout=None: applied,
+            SetPolicyCommandFloat=lambda req, timeout=None: agent_pb2.PolicyOperationAck(),
+        )
+        client._mujoco_scene = SimpleNamespace(GetFullState=lambda req, timeout=None: state)
+        session = SimpleNamespace(engine_client=client)
+
+        with record_session(session) as rec:
+            client.agent.Step(agent_pb2.StepRequest())
+            client.mujoco_scene.GetFullState(ms_pb2.GetFullStateRequest())
+            client.agent.ApplyRobotCommands(agent_pb2.ApplyRobotCommandsRequest())
+            client.agent.SetPolicyCommandFloat(agent_pb2.SetPolicyCommandFloatRequest())
+
+        assert [ev.frame_number for ev in rec.events] == [120, 121, 122, -1]
+        path = str(tmp_path / "live.lrrec")
+        rec.save(path)
+        with RecordingLog.open(path) as log:
+            assert list(log.frame_numbers) == [120, 121, 122, 122]
+            assert log.seek_frame(121) == 1
+
+    def test_lrrec_round_trip_and_seek(self, tmp_path):
+        """Typed payloads survive a save/open; seeks binary-search the index."""
+        from luckyrobots import RecordingLog
+
+        path = str(tmp_path / "run.lrrec")
+        self._recording().save(path)
+
+        with RecordingLog.open(path) as log:
+            assert len(log) == 5
+            assert log.started_at == 123.0
+            # Frame numbers are carried forward over events without one.
+            assert list(log.frame_numbers) == [0, 100, 100, 300, 400]
+            assert log.seek_time(1.2) == 3
+            assert log.seek_frame(300) == 3
+            assert log.request(4).value == pytest.approx(0.4)
+            assert log[4].rpc == "AgentService.SetPolicyCommandFloat"
+            assert log[4].response_json is None
+
+    def test_fast_forward_replay_streams_command_log(self):
+        """fast_forward sends the whole log via ReplayCommandLog in chunks."""
+        from luckyrobots.grpc.generated import recorder_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._recorder = MagicMock()
+        sent = []
+
+        def fake_replay(chunks, timeout=None):
+            sent.extend(chunks)
+            return recorder_pb2.ReplayCommandLogResponse(success=True, commands_applied=5)
+
+        client._recorder.ReplayCommandLog.side_effect = fake_replay
+        rec = self._recording()
+        commands = [
+            (ev.timestamp_s, ev.frame_number, ev.rpc, ev.request_bytes) for ev in rec.events
+        ]
+
+        result = client.replay_command_log(commands, schedule="time", chunk_size=2)
+
+        assert [len(c.commands) for c in sent] == [2, 2, 1]
+        assert sent[0].options.schedule == recorder_pb2.REPLAY_SCHEDULE_TIME
+        assert not sent[1].HasField("options")
+        assert sent[2].commands[0].request == rec.events[4].request_bytes
+        assert result["commands_applied"] == 5
+
+    def test_fast_forward_replay_matches_between_memory_and_file(self, tmp_path):
+        """In-memory and .lrrec fast-forward replays send identical commands."""
+        from luckyrobots import RecordingLog
+
+        def replayed(source):
+            session = MagicMock()
+            source.replay(session, fast_forward=True)
+            (commands,), kwargs = session.engine_client.replay_command_log.call_args
+            assert kwargs["schedule"] == "frame"
+            return list(commands)
+
+        rec = self._recording()
+        path = str(tmp_path / "run.lrrec")
+        rec.save(path)
+
+        from_memory = replayed(rec)
+        with RecordingLog.open(path) as log:
+            from_file = replayed(log)
+
+        assert [frame for _, frame, _, _ in from_memory] == [0, 100, 100, 300, 400]
+        assert from_memory == from_file
+
+    def test_replay_command_log_rejects_unknown_schedule(self):
+        """Unknown schedule names fail before the stream is opened."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._recorder = MagicMock()
+
+        with pytest.raises(ValueError, match="replay schedule"):
+            client.replay_command_log([], schedule="wallclock")
+        client._recorder.ReplayCommandLog.assert_not_called()
+
+
+class TestBatchRollout:
+    """Unit tests for the sysid batch rollout / open-loop playback RPCs."""
+
+    def test_batch_rollout_packs_candidates_and_unpacks_tensors(self):
+        """Candidates go out as packed float64; qpos/qvel come back (K, T, n)."""
+        from luckyrobots.grpc.generated import mujoco_scene_pb2
+        from luckyrobots.sysid import ParamSpec
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._mujoco_scene = MagicMock()
+        K, T, nq, nv = 3, 4, 2, 2
+        qpos = np.arange(K * T * nq, dtype="<f8")
+        client._mujoco_scene.BatchRollout.return_value = mujoco_scene_pb2.BatchRolloutResponse(
+            success=True, num_candidates=K, num_steps=T, nq=nq, nv=nv,
+            qpos=qpos.tobytes(), qvel=np.zeros(K * T * nv).tobytes(),
+        )
+        specs = [
+            ParamSpec("a", "joint", "hip", "damping", 0.1, 0.0, 1.0),
+            ParamSpec("b", "body", "base", "mass", 1.0, 0.1, 10.0),
+        ]
+        candidates = np.array([[0.1, 1.0], [0.2, 1.5], [0.3, 2.0]])
+
+        out_qpos, out_qvel = client.batch_rollout(np.zeros((T, 1)), specs, candidates)
+
+        req = client._mujoco_scene.BatchRollout.call_args[0][0]
+        assert req.num_candidates == 3
+        assert [p.name for p in req.parameters] == ["hip", "base"]
+        assert np.frombuffer(req.candidates, dtype="<f8").tolist() == candidates.ravel().tolist()
+        assert out_qpos.shape == (K, T, nq)
+        assert out_qpos[1, 0, 0] == T * nq
+        assert out_qvel.shape == (K, T, nv)
+
+    def test_batch_rollout_rejects_mismatched_candidates(self):
+        """Candidate columns must match the parameter list."""
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._mujoco_scene = MagicMock()
+
+        with pytest.raises(ValueError, match="columns"):
+            client.batch_rollout(np.zeros((4, 1)), [], np.zeros((2, 3)))
+        client._mujoco_scene.BatchRollout.assert_not_called()
+
+    def test_play_control_sequence(self):
+        """Open-loop playback returns times / qpos / qvel in one call."""
+        from luckyrobots.grpc.generated import mujoco_scene_pb2
+
+        client = LuckyEngineClient(robot_name="test_robot")
+        client._mujoco_scene = MagicMock()
+        client._mujoco_scene.PlayControlSequence.return_value = (
+            mujoco_scene_pb2.PlayControlSequenceResponse(
+                success=True, num_steps=2, nq=3, nv=2,
+                times=np.array([0.02, 0.04]).tobytes(),
+                qpos=np.zeros(6).tobytes(), qvel=np.zeros(4).tobytes(),
+            )
+        )
+
+        out = client.play_control_sequence(np.zeros((2, 12)), dt=0.02)
+
+        req = client._mujoco_scene.PlayControlSequence.call_args[0][0]
+        assert (req.num_steps, req.nu, req.reset) == (2, 12, True)
+        assert out["times"].tolist() == [0.02, 0.04]
+        assert out["qpos"].shape == (2, 3)
+        assert out["qvel"].shape == (2, 2)
+
+
 class TestObservationResponse:
     """Tests for ObservationResponse model."""
 
@@ -0,0 +1,101 @@
+"""
+Unit tests for :class:`luckyrobots.LuckyVecEnv`.
+
+No live engine — ``LuckyEngineClient`` is replaced by a MagicMock whose
+``batch_step`` returns canned :class:`BatchObservation` rows.
+"""
+
+from __future__ import annotations
+
+from unittest.mock import MagicMock, patch
+
+import numpy as np
+import pytest
+
+pytest.importorskip("gymnasium")
+
+from luckyrobots import BatchObservation, LuckyVecEnv  # noqa: E402
+
+NUM_ENVS = 3
+
+
+def _batch(alive, terminated=(False,) * NUM_ENVS, truncated=(False,) * NUM_ENVS):
+    """BatchObservation with one ``alive`` reward column and obs = env index."""
+    return BatchObservation(
+        observations=np.arange(NUM_ENVS * 2, dtype=np.float32).reshape(NUM_ENVS, 2),
+        reward_signals=np.asarray(alive, dtype=np.float32).reshape(NUM_ENVS, 1),
+        terminated=np.asarray(terminated, dtype=bool),
+        truncated=np.asarray(truncated, dtype=bool),
+        reward_terms=["alive"],
+        frame_number=0,
+    )
+
+
+def _make_env(batches):
+    client = MagicMock(name="LuckyEngineClient")
+    client.get_agent_schema.return_value.schema.observation_size = 2
+    client.get_agent_schema.return_value.schema.action_size = 1
+    client.negotiate_task.return_value = {"session_id": "s-1", "num_envs": NUM_ENVS}
+    client.batch_step.side_effect = batches
+    with patch("luckyrobots.client.LuckyEngineClient", return_value=client):
+        env = LuckyVecEnv(num_envs=NUM_ENVS, reward_terms=["alive"])
+    return env, client
+
+
+def _reset_ids(client, call):
+    return client.batch_step.call_args_list[call].kwargs["reset_env_ids"]
+
+
+def test_finished_rows_reset_on_next_step():
+    """Rows that end at step t are sent as reset_env_ids on step t+1 only."""
+    env, client = _make_env([
+        _batch([0.0] * NUM_ENVS),
+        _batch([1.0] * NUM_ENVS, terminated=(False, True, False)),
+        _batch([1.0] * NUM_ENVS, truncated=(False, False, True)),
+        _batch([1.0] * NUM_ENVS),
+    ])
+    actions = np.zeros((NUM_ENVS, 1), dtype=np.float32)
+
+    env.reset()
+    env.step(actions)
+    env.step(actions)
+    env.step(actions)
+
+    assert _reset_ids(client, 0) == [0, 1, 2]
+    assert _reset_ids(client, 1) == []
+    assert _reset_ids(client, 2) == [1]
+    assert _reset_ids(client, 3) == [2]
+
+
+def test_reset_rows_get_zero_reward():
+    """The autoreset step's reward is zeroed; other rows keep theirs."""
+    env, _ = _make_env([
+        _batch([0.0] * NUM_ENVS),
+        _batch([1.0, 2.0, 3.0], terminated=(True, False, False)),
+        _batch([4.0, 5.0, 6.0]),
+    ])
+    actions = np.zeros((NUM_ENVS, 1), dtype=np.float32)
+
+    env.reset()
+    _, first, terminated, _, _ = env.step(actions)
+    _, second, _, _, _ = env.step(actions)
+
+    assert first.tolist() == [1.0, 2.0, 3.0] and terminated.tolist() == [True, False, False]
+    assert second.tolist() == [0.0, 5.0, 6.0]
+
+
+def test_reset_rows_restart_step_count():
+    """info["step_count"] restarts at 0 for autoreset rows and keeps counting elsewhere."""
+    env, _ = _make_env([
+        _batch([0.0] * NUM_ENVS),
+        _batch([1.0] * NUM_ENVS),
+        _batch([1.0] * NUM_ENVS, truncated=(False, True, False)),
+        _batch([1.0] * NUM_ENVS),
+    ])
+    actions = np.zeros((NUM_ENVS, 1), dtype=np.float32)
+
+    _, info = env.reset()
+    assert info["step_count"].tolist() == [0, 0, 0]
+    counts = [env.step(actions)[4]["step_count"].tolist() for _ in range(3)]
+
+    assert counts == [[1, 1, 1], [2, 2, 2], [3, 0, 3]]
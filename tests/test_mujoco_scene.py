@@ -114,6 +114,33 @@ def test_model_info_refresh_re_fetches(fake_session):
     assert stub.GetModelInfo.call_count == 2
 
 
+def test_model_info_served_from_client_metadata_cache(tmp_path):
+    """With a metadata cache, a second scene loads the model from disk."""
+    from unittest.mock import MagicMock
+
+    from luckyrobots import LuckyEngineClient
+    from luckyrobots.grpc.generated import agent_pb2
+
+    client = LuckyEngineClient(robot_name="test_robot")
+    client._agent = MagicMock()
+    client._agent.GetEngineFingerprint.return_value = agent_pb2.GetEngineFingerprintResponse(
+        fingerprint=agent_pb2.EngineFingerprint(model_hash="model-1", fingerprint="fp-1")
+    )
+    client._mujoco_scene = MagicMock()
+    client._mujoco_scene.GetModelInfo.return_value = _make_model_info_response()
+    client.enable_metadata_cache(tmp_path)
+    session = MagicMock(engine_client=client)
+
+    MujocoScene(session).model_info()
+    model = MujocoScene(session).model_info()
+    MujocoScene(session).model_info(refresh=True)
+
+    assert model.nq == 8
+    assert client._mujoco_scene.GetModelInfo.call_count == 1
+    assert client.metadata_cache.hits == 2
+    assert client._agent.GetEngineFingerprint.call_count == 2
+
+
 # ---------------------------------------------------------------------------
 # state() filter wiring
 # ---------------------------------------------------------------------------
@@ -155,6 +182,90 @@ def test_state_with_filter_emits_index_arrays(fake_session):
     assert req.filter.include_only_policy_claimed_joints is True
 
 
+def test_async_scene_state_sends_same_request():
+    """AsyncMujocoScene.state builds the sync request and awaits the aio stub."""
+    import asyncio
+    from unittest.mock import AsyncMock, MagicMock
+
+    from luckyrobots.async_scene import AsyncMujocoScene
+
+    session = MagicMock()
+    session.mujoco_scene.GetFullState = AsyncMock(
+        return_value=_make_full_state_response(included_joints=[1])
+    )
+
+    snap = asyncio.run(AsyncMujocoScene(session).state(filter={"filter_by_slot_id": 3}))
+
+    req = session.mujoco_scene.GetFullState.call_args.args[0]
+    assert req.filter.filter_by_slot_id == 3
+    assert snap.included_joint_indices.tolist() == [1]
+
+
+# ---------------------------------------------------------------------------
+# spatial queries
+# ---------------------------------------------------------------------------
+
+
+def test_raycast_packs_rays_and_decodes_hits(fake_session):
+    """Origins / a shared direction go out as float32 rows; hits come back as arrays."""
+    stub = fake_session.engine_client.mujoco_scene
+    stub.Raycast.return_value = ms_pb2.RaycastResponse(
+        success=True,
+        num_rays=2,
+        distances=np.array([1.5, -1.0], dtype="<f4").tobytes(),
+        geom_ids=np.array([4, -1], dtype="<i4").tobytes(),
+    )
+
+    scene = MujocoScene(fake_session)
+    hits = scene.raycast(
+        [[0, 0, 1], [1, 0, 1]], (0, 0, -1), frame_body="lidar", geom_groups=[0, 2]
+    )
+
+    req = stub.Raycast.call_args.args[0]
+    assert req.num_rays == 2
+    assert np.frombuffer(req.origins, dtype="<f4").reshape(2, 3)[1].tolist() == [1, 0, 1]
+    assert np.frombuffer(req.directions, dtype="<f4").tolist() == [0, 0, -1]
+    assert req.frame == ms_pb2.RAY_FRAME_BODY and req.geom_group_mask == 0b101
+    assert hits.distances.tolist() == [1.5, -1.0]
+    assert hits.hit.tolist() == [True, False]
+    assert hits.points is None
+
+    with pytest.raises(ValueError, match="directions"):
+        scene.raycast(np.zeros((3, 3)), np.zeros((2, 3)))
+
+
+def test_height_scan_and_contacts_decode(fake_session):
+    """Height grids reshape to (rows, cols); contact rows keep their pairing."""
+    stub = fake_session.engine_client.mujoco_scene
+    stub.HeightScan.return_value = ms_pb2.HeightScanResponse(
+        success=True,
+        rows=2,
+        cols=3,
+        heights=np.arange(6, dtype="<f4").tobytes(),
+        body_position=[0.0, 0.0, 10.0],
+    )
+    stub.GetContacts.return_value = ms_pb2.GetContactsResponse(
+        success=True,
+        num_contacts=1,
+        geom_ids=np.array([3, 9], dtype="<i4").tobytes(),
+        body_ids=np.array([0, 5], dtype="<i4").tobytes(),
+        positions=np.zeros(3, dtype="<f4").tobytes(),
+        normals=np.array([0, 0, 1], dtype="<f4").tobytes(),
+        distances=np.array([-0.002], dtype="<f4").tobytes(),
+    )
+
+    scene = MujocoScene(fake_session)
+    scan = scene.height_scan("pelvis", size=(0.2, 0.3), resolution=0.1)
+    contacts = scene.contacts(bodies=["left_foot"])
+
+    assert scan.heights.shape == (2, 3)
+    assert scan.relative_heights[1, 2] == pytest.approx(5.0)
+    assert stub.HeightScan.call_args.args[0].body == "pelvis"
+    assert len(contacts) == 1 and contacts.body_ids.tolist() == [[0, 5]]
+    assert contacts.forces is None
+    assert list(stub.GetContacts.call_args.args[0].bodies) == ["left_foot"]
+
+
 # ---------------------------------------------------------------------------
 # set_qpos
 # ---------------------------------------------------------------------------
@@ -236,3 +347,174 @@ def test_joint_lookup_by_name_and_index(fake_session):
     assert by_index == by_name
     assert by_name.name == "left_hip"
     assert by_name.qpos_adr == 7
+
+
+# ---------------------------------------------------------------------------
+# Snapshots
+# ---------------------------------------------------------------------------
+
+
+def test_save_snapshot_decodes_handle_and_blob(fake_session):
+    stub = fake_session.engine_client.mujoco_scene
+    stub.SaveSnapshot.return_value = ms_pb2.SaveSnapshotResponse(
+        success=True, handle=7, size_bytes=4096, time=1.5, frame_number=42,
+        blob=b"\x01\x02",
+    )
+
+    scene = MujocoScene(fake_session)
+    snap = scene.save_snapshot(include_policy_state=False, export=True)
+
+    req = stub.SaveSnapshot.call_args.args[0]
+    assert req.handle == 0
+    assert req.exclude_policy_state is True
+    assert req.export_blob is True
+    assert snap.handle == 7
+    assert snap.size_bytes == 4096
+    assert snap.frame_number == 42
+    assert snap.blob == b"\x01\x02"
+
+
+def test_save_snapshot_overwrites_existing_handle(fake_session):
+    """Passing a SceneSnapshot reuses its pool slot; no blob unless exported."""
+    stub = fake_session.engine_client.mujoco_scene
+    stub.SaveSnapshot.return_value = ms_pb2.SaveSnapshotResponse(success=True, handle=3)
+
+    scene = MujocoScene(fake_session)
+    first = scene.save_snapshot()
+    scene.save_snapshot(first)
+
+    req = stub.SaveSnapshot.call_args.args[0]
+    assert req.handle == 3
+    assert req.exclude_policy_state is False
+    assert first.blob is None
+
+
+def test_restore_snapshot_by_handle_or_blob(fake_session):
+    stub = fake_session.engine_client.mujoco_scene
+    stub.RestoreSnapshot.return_value = ms_pb2.RestoreSnapshotResponse(success=True)
+
+    scene = MujocoScene(fake_session)
+    scene.restore_snapshot(5)
+    assert stub.RestoreSnapshot.call_args.args[0].WhichOneof("source") == "handle"
+    assert stub.RestoreSnapshot.call_args.args[0].handle == 5
+
+    scene.restore_snapshot(b"blob")
+    req = stub.RestoreSnapshot.call_args.args[0]
+    assert req.WhichOneof("source") == "blob"
+    assert req.blob == b"blob"
+
+
+def test_restore_snapshot_failure_raises(fake_session):
+    stub = fake_session.engine_client.mujoco_scene
+    stub.RestoreSnapshot.return_value = ms_pb2.RestoreSnapshotResponse(
+        success=False, message="unknown snapshot handle 9"
+    )
+
+    scene = MujocoScene(fake_session)
+    with pytest.raises(RuntimeError, match="unknown snapshot handle"):
+        scene.restore_snapshot(9)
+
+
+def test_async_session_snapshots_mirror_sync_scene():
+    """AsyncSession.save_snapshot returns a SceneSnapshot; refusals raise."""
+    import asyncio
+    from unittest.mock import AsyncMock, MagicMock
+
+    from luckyrobots import AsyncSession
+
+    sess = AsyncSession()
+    sess._channel = MagicMock()
+    sess._mujoco_scene = MagicMock()
+    sess._mujoco_scene.SaveSnapshot = AsyncMock(
+        return_value=ms_pb2.SaveSnapshotResponse(success=True, handle=7, frame_number=3)
+    )
+    sess._mujoco_scene.RestoreSnapshot = AsyncMock(
+        return_value=ms_pb2.RestoreSnapshotResponse(
+            success=False, message="unknown snapshot handle 7"
+        )
+    )
+
+    snap = asyncio.run(sess.save_snapshot(export=True))
+    assert isinstance(snap, mujoco_scene.SceneSnapshot)
+    assert (snap.handle, snap.frame_number, snap.blob) == (7, 3, None)
+    assert sess._mujoco_scene.SaveSnapshot.call_args.args[0].export_blob is True
+
+    with pytest.raises(RuntimeError, match="unknown snapshot handle"):
+        asyncio.run(sess.restore_snapshot(snap))
+    assert sess._mujoco_scene.RestoreSnapshot.call_args.args[0].handle == 7
+
+    sess._mujoco_scene.SaveSnapshot.return_value = ms_pb2.SaveSnapshotResponse(
+        success=False, message="snapshot pool full"
+    )
+    with pytest.raises(RuntimeError, match="pool full"):
+        asyncio.run(sess.save_snapshot())
+
+
+def test_release_snapshots(fake_session):
+    stub = fake_session.engine_client.mujoco_scene
+    stub.ReleaseSnapshots.return_value = ms_pb2.ReleaseSnapshotsResponse(
+        success=True, released=2
+    )
+
+    scene = MujocoScene(fake_session)
+    snap = mujoco_scene.SceneSnapshot(handle=4, size_bytes=0, time=0.0, frame_number=0)
+    assert scene.release_snapshots(snap, 6) == 2
+
+    req = stub.ReleaseSnapshots.call_args.args[0]
+    assert list(req.handles) == [4, 6]
+    assert req.all is False
+
+
+# ---------------------------------------------------------------------------
+# Delta-encoded streaming
+# ---------------------------------------------------------------------------
+
+
+def _delta_stream():
+    key = ms_pb2.GetFullStateResponse(success=True)
+    key.state.keyframe = True
+    key.state.qpos.extend([0.0, 1.0, 2.0])
+    key.state.ctrl.extend([0.5])
+    key.included_joint_indices.extend([3, 4, 5])
+
+    floats = ms_pb2.GetFullStateResponse(success=True)
+    floats.state.frame_number = 1
+    floats.state.qpos_delta.indices.extend([1])
+    floats.state.qpos_delta.values.extend([1.5])
+
+    quantized = ms_pb2.GetFullStateResponse(success=True)
+    quantized.state.frame_number = 2
+    quantized.state.qpos_delta.indices.extend([0, 2])
+    quantized.state.qpos_delta.quantized.extend([4, -2])
+    quantized.state.qpos_delta.quantization_step = 0.25
+    return [key, floats, quantized]
+
+
+def test_stream_state_delta_reconstructs_into_reused_buffers(fake_session):
+    stub = fake_session.engine_client.mujoco_scene
+    stub.StreamFullState.return_value = iter(_delta_stream())
+
+    scene = MujocoScene(fake_session)
+    seen = [
+        (snap.qpos.copy(), snap.qpos, snap.included_joint_indices)
+        for snap in scene.stream_state(delta=True, epsilon=1e-3, quantization_step=0.25)
+    ]
+
+    req = stub.StreamFullState.call_args.args[0]
+    assert req.delta.enabled is True
+    assert req.delta.epsilon == pytest.approx(1e-3)
+    np.testing.assert_allclose(seen[0][0], [0.0, 1.0, 2.0])
+    np.testing.assert_allclose(seen[1][0], [0.0, 1.5, 2.0])
+    np.testing.assert_allclose(seen[2][0], [1.0, 1.5, 1.5])
+    # Same preallocated buffer every frame; index map carried from the keyframe.
+    assert seen[0][1] is seen[2][1]
+    assert seen[2][2].tolist() == [3, 4, 5]
+
+
+def test_stream_state_delta_before_keyframe_raises(fake_session):
+    stub = fake_session.engine_client.mujoco_scene
+    stub.StreamFullState.return_value = iter(_delta_stream()[1:])
+
+    scene = MujocoScene(fake_session)
+    with pytest.raises(RuntimeError, match="keyframe"):
+        next(scene.stream_state(delta=True))
@@ -0,0 +1,213 @@
+"""
+Unit tests for :class:`luckyrobots.PolicyEnv` and :class:`luckyrobots.AsyncPolicyEnv`.
+
+No live engine — controller, scene and Step RPCs go through the Mock-based
+fake stubs on ``session.engine_client`` (see ``conftest.fake_session``), or
+``AsyncMock`` stubs on an unconnected ``AsyncSession``.
+"""
+
+from __future__ import annotations
+
+import asyncio
+from unittest.mock import AsyncMock, MagicMock
+
+import numpy as np
+import pytest
+
+pytest.importorskip("gymnasium")
+
+from luckyrobots.grpc.generated import agent_pb2, common_pb2  # noqa: E402
+from luckyrobots.grpc.generated import mujoco_scene_pb2 as ms_pb2  # noqa: E402
+from luckyrobots.policy_env import _INLINE_STATE_MAX_FAILURES, PolicyEnv  # noqa: E402
+
+
+# ---------------------------------------------------------------------------
+# Helpers — canned protobuf responses
+# ---------------------------------------------------------------------------
+
+
+def _controllers_response():
+    """One controller on entity 42 with a Walker slot declaring ``vx``."""
+    pb = agent_pb2.RobotControllerSummary(entity=common_pb2.EntityId(id=42))
+    slot = pb.slots.add(slot_id=1, name="Walker", active=True, ready=True)
+    slot.command_id_map.add(id=1, name="vx", type=agent_pb2.POLICY_CMD_FLOAT)
+    return agent_pb2.ListRobotControllersResponse(controllers=[pb])
+
+
+def _state_response(qpos, qvel, success=True):
+    resp = ms_pb2.GetFullStateResponse(success=success, message="" if success else "bad slot")
+    resp.state.qpos.extend(qpos)
+    resp.state.qvel.extend(qvel)
+    return resp
+
+
+def _make_env(fake_session, fake_agent_stub, **kwargs):
+    fake_agent_stub.ListRobotControllers.return_value = _controllers_response()
+    fake_agent_stub.ApplyRobotCommands.return_value = agent_pb2.ApplyRobotCommandsResponse(
+        success=True, applied_count=1
+    )
+    scene = fake_session.engine_client.mujoco_scene
+    scene.GetFullState.return_value = _state_response([0.0, 0.0], [0.0])
+    return PolicyEnv(
+        fake_session,
+        robot_entity_id=42,
+        slot="Walker",
+        command_names=["vx"],
+        reward_fn=lambda resp: 1.0,
+        **kwargs,
+    )
+
+
+# ---------------------------------------------------------------------------
+# full_state_filtered: inline StepResponse.state
+# ---------------------------------------------------------------------------
+
+
+def test_full_state_filtered_reads_inline_step_state(fake_session, fake_agent_stub):
+    """Each step asks for the slot state inline and skips GetFullState."""
+    env = _make_env(fake_session, fake_agent_stub, observation_mode="full_state_filtered")
+    scene = fake_session.engine_client.mujoco_scene
+    sizing_calls = scene.GetFullState.call_count
+    fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+        success=True, state=_state_response([0.1, 0.2], [0.3])
+    )
+
+    obs, reward, terminated, truncated, info = env.step(np.array([0.5]))
+
+    req = fake_agent_stub.Step.call_args.args[0]
+    assert req.HasField("state") and req.state.filter.filter_by_slot_id == 1
+    assert obs.tolist() == pytest.approx([0.1, 0.2, 0.3])
+    assert env.observation_space.shape == (3,)
+    assert scene.GetFullState.call_count == sizing_calls
+    assert reward == 1.0 and not terminated and not truncated
+    assert info["slot_name"] == "Walker"
+
+
+def test_inline_state_switches_off_on_older_engines(fake_session, fake_agent_stub):
+    """A Step response without ``state`` falls back to GetFullState for good."""
+    env = _make_env(fake_session, fake_agent_stub, observation_mode="full_state_filtered")
+    scene = fake_session.engine_client.mujoco_scene
+    scene.GetFullState.return_value = _state_response([0.4, 0.5], [0.6])
+    fake_agent_stub.Step.return_value = agent_pb2.StepResponse(success=True)
+
+    obs, *_ = env.step(np.array([0.5]))
+    env.step(np.array([0.5]))
+
+    assert obs.tolist() == pytest.approx([0.4, 0.5, 0.6])
+    assert not fake_agent_stub.Step.call_args.args[0].HasField("state")
+
+
+def test_failed_inline_state_gives_up_after_repeats(fake_session, fake_agent_stub):
+    """Repeated ``state.success=False`` stops asking for inline state."""
+    env = _make_env(fake_session, fake_agent_stub, observation_mode="full_state_filtered")
+    scene = fake_session.engine_client.mujoco_scene
+    fake_agent_stub.Step.return_value = agent_pb2.StepResponse(
+        success=True, state=_state_response([], [], success=False)
+    )
+
+    requests = []
+    for _ in range(_INLINE_STATE_MAX_FAILURES + 1):
+        calls = scene.GetFullState.call_count
+        env.step(np.array([0.5]))
+        requests.append(fake_agent_stub.Step.call_args.args[0])
+        assert scene.GetFullState.call_count == calls + 1
+
+    assert all(r.HasField("state") for r in requests[:-1])
+    assert not requests[-1].HasField("state")
+
+
+# ---------------------------------------------------------------------------
+# AsyncPolicyEnv
+# ---------------------------------------------------------------------------
+
+
+def _async_session():
+    """AsyncSession whose agent / mujoco_scene stubs are AsyncMocks."""
+    from luckyrobots import AsyncSession
+
+    sess = AsyncSession()
+    sess._channel = MagicMock()
+    sess._agent = MagicMock()
+    sess._mujoco_scene = MagicMock()
+    sess._agent.ListRobotControllers = AsyncMock(return_value=_controllers_response())
+    sess._agent.ApplyRobotCommands = AsyncMock(
+        return_value=agent_pb2.ApplyRobotCommandsResponse(success=True, applied_count=1)
+    )
+    sess._agent.Step = AsyncMock()
+    sess._agent.GetPolicyLastAction = AsyncMock()
+    sess._mujoco_scene.GetFullState = AsyncMock(
+        return_value=_state_response([0.1, 0.2], [0.3])
+    )
+    sess.reset = AsyncMock(name="reset")
+    return sess
+
+
+def _make_async_env(sess, **kwargs):
+    from luckyrobots import AsyncPolicyEnv
+
+    return asyncio.run(AsyncPolicyEnv.create(
+        sess,
+        robot_entity_id=42,
+        slot="Walker",
+        command_names=["vx"],
+        reward_fn=lambda resp: 1.0,
+        **kwargs,
+    ))
+
+
+def test_async_reset_sizes_space_from_scene_state():
+    """full_state_filtered reset resets the agent and reads the slot state."""
+    sess = _async_session()
+    env = _make_async_env(sess, observation_mode="full_state_filtered")
+
+    obs, info = asyncio.run(env.reset())
+
+    sess.reset.assert_awaited_once()
+    req = sess._mujoco_scene.GetFullState.call_args.args[0]
+    assert req.filter.filter_by_slot_id == 1
+    assert obs.tolist() == pytest.approx([0.1, 0.2, 0.3])
+    assert env.observation_space.shape == (3,)
+    assert info == {"step_count": 0}
+
+
+def test_async_step_full_state_filtered_reads_inline_state():
+    """One ApplyRobotCommands plus one Step carrying the slot state inline."""
+    sess = _async_session()
+    env = _make_async_env(sess, observation_mode="full_state_filtered", decimation=2)
+    sess._agent.Step.return_value = agent_pb2.StepResponse(
+        success=True, state=_state_response([0.4, 0.5], [0.6])
+    )
+
+    obs, reward, terminated, truncated, info = asyncio.run(env.step(np.array([0.5])))
+
+    batch = sess._agent.ApplyRobotCommands.call_args.args[0]
+    assert [c.command_float.value for c in batch.commands] == pytest.approx([0.5])
+    req = sess._agent.Step.call_args.args[0]
+    assert req.num_substeps == 2 and req.state.filter.filter_by_slot_id == 1
+    assert sess._agent.Step.call_args.kwargs["timeout"] == pytest.approx(15.0)
+    assert obs.tolist() == pytest.approx([0.4, 0.5, 0.6])
+    sess._mujoco_scene.GetFullState.assert_not_called()
+    assert reward == 1.0 and not terminated and not truncated
+    assert info["step_count"] == 1
+
+
+def test_async_last_action_mode_reads_policy_output():
+    """last_action observations come from GetPolicyLastAction, zeros until it succeeds."""
+    sess = _async_session()
+    env = _make_async_env(sess)
+    sess._agent.GetPolicyLastAction.return_value = agent_pb2.PolicyLastAction(
+        success=False, message="not inferred yet"
+    )
+
+    obs, _ = asyncio.run(env.reset())
+    assert obs.tolist() == [0.0]
+
+    sess._agent.Step.return_value = agent_pb2.StepResponse(success=True)
+    sess._agent.GetPolicyLastAction.return_value = agent_pb2.PolicyLastAction(
+        success=True, action=[0.25, -0.5], joint_names=["a", "b"]
+    )
+    obs, *_ = asyncio.run(env.step(np.array([0.5])))
+
+    assert obs.tolist() == pytest.approx([0.25, -0.5])
+    assert not sess._agent.Step.call_args.args[0].HasField("state")
+    sess._mujoco_scene.GetFullState.assert_not_called()
@@ -9,6 +9,7 @@ and oneof selection.
 
 from __future__ import annotations
 
+import grpc
 import pytest
 
 from luckyrobots.robots import (
@@ -249,3 +250,308 @@ def test_command_storeview_get_calls_float_rpc(
 
     assert val == pytest.approx(1.25)
     assert fake_agent_stub.GetPolicyCommandFloat.call_count == 1
+
+
+def test_command_storeview_reuses_cached_command_map(fake_session, fake_agent_stub):
+    """A fresh view per write resolves names from the controller's cached state."""
+    fake_agent_stub.GetRobotController.return_value = _walker_state_response()
+
+    rc = RobotController(fake_session, entity_id=42)
+    for v in (0.1, 0.2, 0.3):
+        rc.commands("Walker")["vx"] = v
+
+    assert fake_agent_stub.GetRobotController.call_count == 1
+    assert fake_agent_stub.SetPolicyCommandFloat.call_count == 3
+
+
+# ---------------------------------------------------------------------------
+# Buffered writes (ApplyRobotCommands)
+# ---------------------------------------------------------------------------
+
+
+def _apply_ack(applied: int, frame: int = 100):
+    return agent_pb2.ApplyRobotCommandsResponse(
+        success=True, applied_count=applied, apply_frame_number=frame
+    )
+
+
+def test_buffered_coalesces_writes_into_one_rpc(fake_session, fake_agent_stub):
+    """Writes inside ``buffered()`` go out as one ApplyRobotCommands, in order."""
+    fake_agent_stub.GetRobotController.return_value = _walker_state_response()
+    fake_agent_stub.ApplyRobotCommands.return_value = _apply_ack(4, frame=321)
+
+    rc = RobotController(fake_session, entity_id=42)
+    with rc.buffered() as batch:
+        cmds = rc.commands("Walker")
+        cmds["vx"] = 0.5
+        cmds["run"] = True
+        rc.set_motion_graph_input(7, (0.0, 0.0, 1.0))
+        rc.set_policy_gains("Walker", {"knee": {"kp": 40.0}})
+        assert len(batch) == 4
+        assert not fake_agent_stub.ApplyRobotCommands.called
+
+    for unary in ("SetPolicyCommandFloat", "SetPolicyCommandBool",
+                  "SetMotionGraphInput", "SetPolicyGains"):
+        assert not getattr(fake_agent_stub, unary).called, unary
+    assert fake_agent_stub.ApplyRobotCommands.call_count == 1
+    req = fake_agent_stub.ApplyRobotCommands.call_args.args[0]
+    assert [c.WhichOneof("command") for c in req.commands] == [
+        "command_float", "command_bool", "motion_graph_input", "gains",
+    ]
+    assert req.commands[0].command_float.command_id == 1
+    assert req.commands[0].command_float.slot_id == 1
+    assert req.commands[2].motion_graph_input.value.WhichOneof("value") == "vec3_val"
+    assert req.commands[3].gains.overrides[0].kp == pytest.approx(40.0)
+    assert not req.allow_partial
+    assert batch.result.frame_number == 321
+    assert len(batch) == 0
+
+
+def test_buffered_shared_batch_spans_entities(fake_session, fake_agent_stub):
+    """One shared batch coalesces several controllers and flushes once."""
+    from luckyrobots.robots import RobotCommandBatch
+
+    fake_agent_stub.ApplyRobotCommands.return_value = _apply_ack(2)
+
+    a = RobotController(fake_session, entity_id=1)
+    b = RobotController(fake_session, entity_id=2)
+    with RobotCommandBatch(fake_session) as batch, a.buffered(batch), b.buffered(batch):
+        a.set_command_float(1, 1, 0.5)
+        b.set_policy_active(3, True)
+        assert not fake_agent_stub.ApplyRobotCommands.called
+
+    req = fake_agent_stub.ApplyRobotCommands.call_args.args[0]
+    assert fake_agent_stub.ApplyRobotCommands.call_count == 1
+    assert [c.command_float.entity.id or c.policy_active.entity.id
+            for c in req.commands] == [1, 2]
+    # Controllers are back to unary sends after the block.
+    a.set_command_float(1, 1, 0.25)
+    assert fake_agent_stub.SetPolicyCommandFloat.call_count == 1
+
+
+def test_buffered_discards_on_exception(fake_session, fake_agent_stub):
+    """An exception inside the block sends nothing."""
+    rc = RobotController(fake_session, entity_id=42)
+    with pytest.raises(ValueError):
+        with rc.buffered():
+            rc.set_command_float(1, 1, 0.5)
+            raise ValueError("abort frame")
+
+    assert not fake_agent_stub.ApplyRobotCommands.called
+    assert not fake_agent_stub.SetPolicyCommandFloat.called
+
+
+def test_buffered_rejected_batch_raises(fake_session, fake_agent_stub):
+    """success=False from the engine surfaces as RuntimeError."""
+    fake_agent_stub.ApplyRobotCommands.return_value = agent_pb2.ApplyRobotCommandsResponse(
+        success=False, message="command 9 not declared on slot 1"
+    )
+    rc = RobotController(fake_session, entity_id=42)
+    with pytest.raises(RuntimeError, match="not declared"):
+        with rc.buffered():
+            rc.set_command_float(1, 9, 0.5)
+
+
+def test_buffered_empty_block_sends_nothing(fake_session, fake_agent_stub):
+    """Nothing queued -> no RPC; nested blocks reuse the outer batch."""
+    rc = RobotController(fake_session, entity_id=42)
+    with rc.buffered() as outer:
+        with rc.buffered() as inner:
+            assert inner is outer
+
+    assert not fake_agent_stub.ApplyRobotCommands.called
+
+
+class _Unimplemented(grpc.RpcError):
+    def code(self):
+        return grpc.StatusCode.UNIMPLEMENTED
+
+
+def test_buffered_falls_back_to_unary_writes(fake_session, fake_agent_stub):
+    """UNIMPLEMENTED ApplyRobotCommands is remembered; writes go out one by one."""
+    fake_agent_stub.ApplyRobotCommands.side_effect = _Unimplemented()
+    rc = RobotController(fake_session, entity_id=42)
+
+    for value in (0.5, 0.75):
+        with rc.buffered() as batch:
+            rc.set_command_float(1, 1, value)
+            rc.set_policy_active(1, True)
+
+    assert fake_agent_stub.ApplyRobotCommands.call_count == 1
+    assert fake_agent_stub.SetPolicyCommandFloat.call_count == 2
+    assert fake_agent_stub.SetPolicyActive.call_count == 2
+    last = fake_agent_stub.SetPolicyCommandFloat.call_args.args[0]
+    assert last.value == pytest.approx(0.75)
+    assert batch.result.applied_count == 2 and batch.result.frame_number == 0
+
+
+def test_buffered_fallback_reports_partial_errors(fake_session, fake_agent_stub):
+    """Without the batch RPC, allow_partial collects failed writes by index."""
+    fake_session.engine_client._unsupported_rpcs.add("ApplyRobotCommands")
+    fake_agent_stub.SetPolicyCommandFloat.side_effect = [
+        agent_pb2.PolicyOperationAck(success=False, message="command 9 not declared"),
+        agent_pb2.PolicyOperationAck(success=True),
+    ]
+    rc = RobotController(fake_session, entity_id=42)
+
+    with rc.buffered(allow_partial=True) as batch:
+        rc.set_command_float(1, 9, 0.5)
+        rc.set_command_float(1, 1, 0.5)
+
+    assert not fake_agent_stub.ApplyRobotCommands.called
+    assert batch.result.applied_count == 1
+    assert batch.result.errors == ((0, "command 9 not declared"),)
+
+    fake_agent_stub.SetPolicyCommandFloat.side_effect = None
+    fake_agent_stub.SetPolicyCommandFloat.return_value = agent_pb2.PolicyOperationAck(
+        success=False, message="slot inactive"
+    )
+    with pytest.raises(RuntimeError, match="slot inactive"):
+        with rc.buffered():
+            rc.set_command_float(1, 1, 0.5)
+
+
+def _async_session():
+    from unittest.mock import AsyncMock, MagicMock
+
+    session = MagicMock(name="FakeAsyncSession")
+    session._codec._unsupported_rpcs = set()
+    for rpc in ("ApplyRobotCommands", "SetPolicyCommandFloat", "SetPolicyActive"):
+        setattr(session.agent, rpc, AsyncMock(name=rpc))
+    session.agent.SetPolicyCommandFloat.return_value = agent_pb2.PolicyOperationAck(success=True)
+    session.agent.SetPolicyActive.return_value = agent_pb2.PolicyOperationAck(success=True)
+    return session
+
+
+def test_async_buffered_coalesces_writes():
+    """AsyncRobotController.buffered sends one ApplyRobotCommands on exit."""
+    import asyncio
+
+    from luckyrobots.async_robots import AsyncRobotCommandBatch, AsyncRobotController
+
+    session = _async_session()
+    session.agent.ApplyRobotCommands.return_value = _apply_ack(2, frame=77)
+    a = AsyncRobotController(session, entity_id=1)
+    b = AsyncRobotController(session, entity_id=2)
+
+    async def run():
+        async with a.buffered() as batch:
+            await a.set_command_float(1, 1, 0.5)
+            await a.set_policy_active(1, True)
+            assert not session.agent.ApplyRobotCommands.called
+        async with AsyncRobotCommandBatch(session) as shared, a.buffered(shared), \
+                b.buffered(shared):
+            await a.set_command_float(1, 1, 0.25)
+            await b.set_command_float(1, 1, 0.25)
+        return batch
+
+    batch = asyncio.run(run())
+
+    assert session.agent.ApplyRobotCommands.await_count == 2
+    assert not session.agent.SetPolicyCommandFloat.called
+    req = session.agent.ApplyRobotCommands.call_args.args[0]
+    assert [c.command_float.entity.id for c in req.commands] == [1, 2]
+    assert batch.result.frame_number == 77
+
+
+def test_async_buffered_falls_back_to_unary_writes():
+    """The async batch shares the UNIMPLEMENTED fallback of the sync one."""
+    import asyncio
+
+    from luckyrobots.async_robots import AsyncRobotController
+
+    session = _async_session()
+    session.agent.ApplyRobotCommands.side_effect = _Unimplemented()
+    rc = AsyncRobotController(session, entity_id=42)
+
+    async def run():
+        for _ in range(2):
+            async with rc.buffered() as batch:
+                await rc.set_command_float(1, 1, 0.5)
+        return batch
+
+    batch = asyncio.run(run())
+
+    assert session.agent.ApplyRobotCommands.await_count == 1
+    assert session.agent.SetPolicyCommandFloat.await_count == 2
+    assert batch.result.applied_count == 1
+    assert "ApplyRobotCommands" in session._codec._unsupported_rpcs
+
+
+def test_slot_inference_stats_parsed(fake_session, fake_agent_stub):
+    """Per-slot inference latency and batch groups surface from ListRobotControllers."""
+    from luckyrobots.robots import list_policy_inference_batches, list_robot_controllers
+
+    pb = _make_controller_pb(slot_specs=[{"slot_id": 1, "name": "Walker", "active": True}])
+    pb.slots[0].inference.CopyFrom(
+        agent_pb2.PolicyInferenceStats(
+            last_latency_us=420.0, batch_size=64, execution_provider="cuda", inference_count=10
+        )
+    )
+    fake_agent_stub.ListRobotControllers.return_value = agent_pb2.ListRobotControllersResponse(
+        controllers=[pb],
+        inference_batches=[
+            agent_pb2.PolicyInferenceBatch(
+                policy_id="g1_walk", batch_size=64, last_latency_us=420.0,
+                execution_provider="cuda",
+            )
+        ],
+    )
+
+    slot = list_robot_controllers(fake_session)[0].slot("Walker")
+    batches = list_policy_inference_batches(fake_session)
+
+    assert slot.inference.batch_size == 64
+    assert slot.inference.last_latency_us == pytest.approx(420.0)
+    assert [(b.policy_id, b.batch_size) for b in batches] == [("g1_walk", 64)]
+
+
+def test_set_policy_inference_config_reports_fallback(fake_session, fake_agent_stub):
+    """The applied config is returned even when the engine falls back to CPU."""
+    from luckyrobots.robots import set_policy_inference_config
+
+    fake_agent_stub.SetPolicyInferenceConfig.return_value = (
+        agent_pb2.PolicyInferenceConfigResponse(
+            success=True,
+            config=agent_pb2.PolicyInferenceConfig(
+                batch_across_slots=True, execution_provider="cpu"
+            ),
+            available_execution_providers=["cpu"],
+        )
+    )
+
+    applied = set_policy_inference_config(fake_session, execution_provider="tensorrt")
+
+    req = fake_agent_stub.SetPolicyInferenceConfig.call_args.args[0]
+    assert req.batch_across_slots is True
+    assert req.execution_provider == "tensorrt"
+    assert applied.execution_provider == "cpu"
+    assert applied.available_execution_providers == ("cpu",)
+
+
+# ---------------------------------------------------------------------------
+# State streams
+# ---------------------------------------------------------------------------
+
+
+def test_state_streams_use_bulk_stub(fake_session, fake_agent_stub):
+    """stream_state / stream_slot_state open on the bulk connection's agent stub."""
+    from unittest.mock import MagicMock
+
+    bulk = MagicMock(name="BulkAgentStub")
+    fake_session.engine_client.bulk_stub.side_effect = None
+    fake_session.engine_client.bulk_stub.return_value = bulk
+    pb = _make_controller_pb(slot_specs=[{"slot_id": 1, "name": "Walker"}])
+    bulk.StreamRobotController.return_value = iter([pb])
+    bulk.StreamPolicySlotState.return_value = iter([pb.slots[0]])
+    rc = RobotController(fake_session, entity_id=42)
+
+    states = list(rc.stream_state(target_fps=60))
+    slots = list(rc.stream_slot_state(1))
+
+    fake_session.engine_client.bulk_stub.assert_called_with("agent")
+    assert bulk.StreamRobotController.call_args.args[0].target_fps == 60
+    assert isinstance(states[0], RobotControllerState) and states[0].entity_id == 42
+    assert isinstance(slots[0], PolicySlotState) and slots[0].name == "Walker"
+    fake_agent_stub.StreamRobotController.assert_not_called()
+    fake_agent_stub.StreamPolicySlotState.assert_not_called()
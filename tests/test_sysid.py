@@ -0,0 +1,198 @@
+"""
+Unit tests for the batched rollout machinery in :mod:`luckyrobots.sysid.sysid`.
+
+The cache and step-size tests need only numpy; the rollout-pool and Jacobian
+tests build a one-joint MuJoCo model and compare against scipy.
+"""
+
+from __future__ import annotations
+
+import numpy as np
+import pytest
+
+from luckyrobots.sysid.sysid import _fd_jacobian, _fd_steps, _ResidualCache
+
+
+_SLIDER_XML = """
+<mujoco>
+  <option timestep="0.01"/>
+  <worldbody>
+    <body name="cart">
+      <joint name="slide" type="slide" axis="1 0 0" damping="0.5" armature="0.1"/>
+      <geom type="box" size="0.1 0.1 0.1" mass="1.0"/>
+    </body>
+  </worldbody>
+  <actuator>
+    <motor name="push" joint="slide"/>
+  </actuator>
+</mujoco>
+"""
+
+
+def _slider():
+    """(model, trajectory, param_specs) for a damped cart pushed by a sine."""
+    mujoco = pytest.importorskip("mujoco")
+    from luckyrobots.sysid import ParamSpec, TrajectoryData
+    from luckyrobots.sysid.sysid import _rollout
+
+    model = mujoco.MjModel.from_xml_string(_SLIDER_XML)
+    T = 50
+    ctrl = np.sin(np.linspace(0.0, 2 * np.pi, T))[:, None]
+    qpos, qvel = _rollout(model, mujoco.MjData(model), ctrl, 0.01)
+    traj = TrajectoryData(
+        times=np.arange(T) * 0.01, qpos=qpos + 0.01, qvel=qvel, ctrl=ctrl,
+    )
+    specs = [
+        ParamSpec("damping", "joint", "slide", "damping", 0.5, 0.0, 2.0),
+        ParamSpec("armature", "joint", "slide", "armature", 0.1, 0.0, 1.0),
+    ]
+    return model, traj, specs
+
+
+# ---------------------------------------------------------------------------
+# _ResidualCache
+# ---------------------------------------------------------------------------
+
+
+class _CountingBatch:
+    """Batch function returning ``[sum(x), k]`` and recording every call."""
+
+    def __init__(self):
+        self.calls: list[np.ndarray] = []
+
+    def __call__(self, X):
+        self.calls.append(np.array(X))
+        return np.stack([[x.sum(), len(self.calls)] for x in X])
+
+
+def test_residual_cache_serves_base_point_from_cache():
+    """The Jacobian batch reuses f(x) from the preceding residual call."""
+    batch = _CountingBatch()
+    cache = _ResidualCache(batch, maxsize=8)
+    x = np.array([1.0, 2.0])
+
+    base = cache(x[None, :])[0]
+    R = cache(np.vstack([x, x + np.diag([0.1, 0.1])]))
+
+    assert R[0].tolist() == base.tolist()
+    assert len(batch.calls) == 2 and len(batch.calls[1]) == 2
+    assert (cache.hits, cache.misses) == (1, 3)
+
+
+def test_residual_cache_rolls_out_duplicate_rows_once():
+    """Identical rows in one batch share a single rollout."""
+    batch = _CountingBatch()
+    cache = _ResidualCache(batch, maxsize=8)
+
+    R = cache(np.array([[1.0], [1.0], [2.0]]))
+
+    assert len(batch.calls[0]) == 2
+    assert R[0].tolist() == R[1].tolist()
+    assert (cache.hits, cache.misses) == (1, 2)
+
+
+def test_residual_cache_evicts_least_recently_used():
+    """Past ``maxsize`` the oldest untouched vector is rolled out again."""
+    batch = _CountingBatch()
+    cache = _ResidualCache(batch, maxsize=2)
+    a, b, c = np.array([[1.0]]), np.array([[2.0]]), np.array([[3.0]])
+
+    cache(a)
+    cache(b)
+    cache(a)  # refresh a; b is now the oldest
+    cache(c)  # evicts b
+    cache(a)
+    assert len(batch.calls) == 3
+
+    cache(b)
+    assert len(batch.calls) == 4
+    assert (cache.hits, cache.misses) == (2, 4)
+
+
+# ---------------------------------------------------------------------------
+# _fd_steps / _fd_jacobian
+# ---------------------------------------------------------------------------
+
+
+def test_fd_steps_follow_sign_and_bounds():
+    """Steps take the sign of x and flip where they would leave the bounds."""
+    eps = np.sqrt(np.finfo(float).eps)
+    x = np.array([0.0, -3.0, 1.0, -1.0])
+    lo = np.array([-1.0, -5.0, 0.0, -1.0])
+    hi = np.array([1.0, 0.0, 1.0, 1.0])
+
+    h = _fd_steps(x, lo, hi)
+
+    assert np.sign(h).tolist() == [1.0, -1.0, -1.0, 1.0]
+    assert np.abs(h) == pytest.approx(eps * np.maximum(1.0, np.abs(x)))
+    assert np.all((x + h >= lo) & (x + h <= hi))
+
+
+def test_fd_jacobian_matches_scipy_on_quadratic():
+    """Steps and differences match scipy's '2-point' scheme, bounds included."""
+    pytest.importorskip("scipy")
+    from scipy.optimize._numdiff import approx_derivative
+
+    def f(x):
+        return np.array([x[0] ** 2 + x[1], np.sin(x[0]) * x[1] ** 3, -x[1] ** 2])
+
+    x = np.array([-2.0, 0.999999999])
+    lo, hi = np.array([-3.0, 0.0]), np.array([3.0, 1.0])
+
+    J = _fd_jacobian(lambda X: np.stack([f(x) for x in X]), x, lo, hi)
+
+    expected = approx_derivative(f, x, method="2-point", bounds=(lo, hi))
+    np.testing.assert_allclose(J, expected, rtol=0, atol=1e-12)
+
+
+# ---------------------------------------------------------------------------
+# _RolloutPool
+# ---------------------------------------------------------------------------
+
+
+@pytest.mark.parametrize("workers", [1, 3])
+def test_rollout_pool_matches_serial_rollouts(workers):
+    """Pool rows equal single-copy rollouts and the caller's model is untouched."""
+    model, traj, specs = _slider()
+    import mujoco
+    from luckyrobots.sysid import set_param
+    from luckyrobots.sysid.sysid import _RolloutPool, _rollout, _trajectory_residual
+
+    X = np.array([[0.5, 0.1], [1.0, 0.2], [1.5, 0.3]])
+    pool = _RolloutPool(model, [traj], specs, 1.0, 0.1, workers)
+    try:
+        R = pool(X)
+    finally:
+        pool.close()
+
+    assert model.dof_damping[0] == 0.5 and model.dof_armature[0] == pytest.approx(0.1)
+    for x, row in zip(X, R):
+        m = mujoco.MjModel.from_xml_string(_SLIDER_XML)
+        for spec, value in zip(specs, x):
+            set_param(m, spec, value)
+        expected = _trajectory_residual(
+            *_rollout(m, mujoco.MjData(m), traj.ctrl, traj.dt), traj, 1.0, 0.1
+        )
+        np.testing.assert_array_equal(row, expected)
+
+
+def test_pool_jacobian_matches_scipy_2_point():
+    """The batched Jacobian equals scipy's '2-point' estimate on a real model."""
+    pytest.importorskip("scipy")
+    from scipy.optimize._numdiff import approx_derivative
+    from luckyrobots.sysid.sysid import _RolloutPool
+
+    model, traj, specs = _slider()
+    lo = np.array([s.min_value for s in specs])
+    hi = np.array([s.max_value for s in specs])
+    x = np.array([0.8, 1.0])  # armature at its upper bound: step flips
+    pool = _RolloutPool(model, [traj], specs, 1.0, 0.1, 2)
+    try:
+        J = _fd_jacobian(_ResidualCache(pool, 16), x, lo, hi)
+        expected = approx_derivative(
+            lambda p: pool(p[None, :])[0], x, method="2-point", bounds=(lo, hi)
+        )
+    finally:
+        pool.close()
+
+    np.testing.assert_allclose(J, expected, rtol=1e-9, atol=1e-12)